@@ -51,17 +51,17 @@ OBJECTDIR=build/${CND_CONF}/${IMAGE_TYPE}
 DISTDIR=dist/${CND_CONF}/${IMAGE_TYPE}
 
 # Source Files Quoted if spaced
-SOURCEFILES_QUOTED_IF_SPACED=../src/config/default/bsp/bsp.c ../src/config/default/crypto/src/crypto.c ../src/config/default/driver/ethmac/src/dynamic/drv_eth_pic32_lib.c ../src/config/default/driver/ethmac/src/dynamic/drv_ethmac_lib.c ../src/config/default/driver/ethmac/src/dynamic/drv_ethmac.c ../src/config/default/driver/ethphy/src/dynamic/drv_ethphy.c ../src/config/default/driver/ethphy/src/dynamic/drv_extphy_dp83848.c ../src/config/default/driver/memory/src/drv_memory.c ../src/config/default/driver/miim/src/dynamic/drv_miim_pic32m.c ../src/config/default/driver/miim/src/dynamic/drv_miim.c ../src/config/default/driver/usb/usbfs/src/drv_usbfs.c ../src/config/default/library/cryptoauthlib/app/pkcs11/trust_pkcs11_config.c ../src/config/default/library/cryptoauthlib/atcacert/atcacert_pem.c ../src/config/default/library/cryptoauthlib/atcacert/atcacert_der.c ../src/config/default/library/cryptoauthlib/atcacert/atcacert_date.c ../src/config/default/library/cryptoauthlib/atcacert/atcacert_def.c ../src/config/default/library/cryptoauthlib/atcacert/atcacert_host_sw.c ../src/config/default/library/cryptoauthlib/atcacert/atcacert_host_hw.c ../src/config/default/library/cryptoauthlib/atcacert/atcacert_client.c ../src/config/default/library/cryptoauthlib/crypto/hashes/sha2_routines.c ../src/config/default/library/cryptoauthlib/crypto/hashes/sha1_routines.c ../src/config/default/library/cryptoauthlib/crypto/atca_crypto_hw_aes_ccm.c ../src/config/default/library/cryptoauthlib/crypto/atca_crypto_hw_aes_cbcmac.c ../src/config/default/library/cryptoauthlib/crypto/atca_crypto_sw_sha2.c ../src/config/default/library/cryptoauthlib/crypto/atca_crypto_pad.c ../src/config/default/library/cryptoauthlib/crypto/atca_crypto_sw_aes_cmac.c ../src/config/default/library/cryptoauthlib/crypto/atca_crypto_hw_aes_cmac.c ../src/config/default/library/cryptoauthlib/crypto/atca_crypto_pbkdf2.c ../src/config/default/library/cryptoauthlib/crypto/atca_crypto_sw_aes_gcm.c ../src/config/default/library/cryptoauthlib/crypto/atca_crypto_hw_aes_ctr.c ../src/config/default/library/cryptoauthlib/crypto/atca_crypto_sw_sha1.c ../src/config/default/library/cryptoauthlib/crypto/atca_crypto_hw_aes_cbc.c ../src/config/default/library/cryptoauthlib/hal/hal_gpio_harmony.c ../src/config/default/library/cryptoauthlib/hal/hal_pic32_delay.c ../src/config/default/library/cryptoauthlib/hal/kit_protocol.c ../src/config/default/library/cryptoauthlib/hal/atca_hal.c ../src/config/default/library/cryptoauthlib/hal/hal_freertos.c ../src/config/default/library/cryptoauthlib/jwt/atca_jwt.c ../src/config/default/library/cryptoauthlib/kit_host/ascii_kit_host.c ../src/config/default/library/cryptoauthlib/pkcs11/pkcs11_signature.c ../src/config/default/library/cryptoauthlib/pkcs11/pkcs11_attrib.c ../src/config/default/library/cryptoauthlib/pkcs11/pkcs11_key.c ../src/config/default/library/cryptoauthlib/pkcs11/pkcs11_debug.c ../src/config/default/library/cryptoauthlib/pkcs11/pkcs11_info.c ../src/config/default/library/cryptoauthlib/pkcs11/pkcs11_init.c ../src/config/default/library/cryptoauthlib/pkcs11/pkcs11_token.c ../src/config/default/library/cryptoauthlib/pkcs11/pkcs11_slot.c ../src/config/default/library/cryptoauthlib/pkcs11/pkcs11_main.c ../src/config/default/library/cryptoauthlib/pkcs11/pkcs11_encrypt.c ../src/config/default/library/cryptoauthlib/pkcs11/pkcs11_object.c ../src/config/default/library/cryptoauthlib/pkcs11/pkcs11_cert.c ../src/config/default/library/cryptoauthlib/pkcs11/pkcs11_util.c ../src/config/default/library/cryptoauthlib/pkcs11/pkcs11_os.c ../src/config/default/library/cryptoauthlib/pkcs11/pkcs11_config.c ../src/config/default/library/cryptoauthlib/pkcs11/pkcs11_session.c ../src/config/default/library/cryptoauthlib/pkcs11/pkcs11_find.c ../src/config/default/library/cryptoauthlib/pkcs11/pkcs11_mech.c ../src/config/default/library/cryptoauthlib/pkcs11/pkcs11_digest.c ../src/config/default/library/cryptoauthlib/test/api_atcab/atca_tests_updateextra.c ../src/config/default/library/cryptoauthlib/test/api_atcab/atca_tests_secureboot.c ../src/config/default/library/cryptoauthlib/test/api_atcab/atca_tests_hmac.c ../src/config/default/library/cryptoauthlib/test/api_atcab/test_atcab.c ../src/config/default/library/cryptoauthlib/test/api_atcab/atca_tests_ecdh.c ../src/config/default/library/cryptoauthlib/test/api_atcab/atca_tests_aes_cbcmac.c ../src/config/default/library/cryptoauthlib/test/api_atcab/atca_tests_info.c ../src/config/default/library/cryptoauthlib/test/api_atcab/atca_tests_sha.c ../src/config/default/library/cryptoauthlib/test/api_atcab/atca_tests_sign.c ../src/config/default/library/cryptoauthlib/test/api_atcab/atca_tests_privwrite.c ../src/config/default/library/cryptoauthlib/test/api_atcab/atca_tests_aes_ccm.c ../src/config/default/library/cryptoauthlib/test/api_atcab/atca_tests_read.c ../src/config/default/library/cryptoauthlib/test/api_atcab/atca_tests_aes_cmac.c ../src/config/default/library/cryptoauthlib/test/api_atcab/atca_tests_aes.c ../src/config/default/library/cryptoauthlib/test/api_atcab/atca_tests_write.c ../src/config/default/library/cryptoauthlib/test/api_atcab/atca_tests_random.c ../src/config/default/library/cryptoauthlib/test/api_atcab/atca_tests_lock.c ../src/config/default/library/cryptoauthlib/test/api_atcab/atca_tests_aes_cbc.c ../src/config/default/library/cryptoauthlib/test/api_atcab/atca_tests_aes_gcm.c ../src/config/default/library/cryptoauthlib/test/api_atcab/atca_tests_helper.c ../src/config/default/library/cryptoauthlib/test/api_atcab/atca_tests_kdf.c ../src/config/default/library/cryptoauthlib/test/api_atcab/atca_tests_mac.c ../src/config/default/library/cryptoauthlib/test/api_atcab/atca_tests_verify.c ../src/config/default/library/cryptoauthlib/test/api_atcab/atca_tests_aes_ctr.c ../src/config/default/library/cryptoauthlib/test/api_atcab/atca_tests_startup.c ../src/config/default/library/cryptoauthlib/test/api_atcab/atca_tests_derivekey.c ../src/config/default/library/cryptoauthlib/test/api_atcab/atca_tests_counter.c ../src/config/default/library/cryptoauthlib/test/api_atcab/atca_tests_nonce.c ../src/config/default/library/cryptoauthlib/test/api_atcab/atca_tests_genkey.c ../src/config/default/library/cryptoauthlib/test/api_atcab/atca_tests_buffer.c ../src/config/default/library/cryptoauthlib/test/api_atcab/atca_tests_gendig.c ../src/config/default/library/cryptoauthlib/test/api_atcab/atca_tests_otpzero.c ../src/config/default/library/cryptoauthlib/test/api_atcab/atca_tests_selftest.c ../src/config/default/library/cryptoauthlib/test/api_calib/test_calib.c ../src/config/default/library/cryptoauthlib/test/api_calib/test_calib_config.c ../src/config/default/library/cryptoauthlib/test/api_calib/test_calib_info.c ../src/config/default/library/cryptoauthlib/test/api_calib/test_calib_delete.c ../src/config/default/library/cryptoauthlib/test/api_crypto/test_crypto.c ../src/config/default/library/cryptoauthlib/test/api_crypto/test_crypto_pk.c ../src/config/default/library/cryptoauthlib/test/api_crypto/test_crypto_sha.c ../src/config/default/library/cryptoauthlib/test/api_crypto/test_crypto_aes.c ../src/config/default/library/cryptoauthlib/test/api_crypto/test_crypto_pbkdf2.c ../src/config/default/library/cryptoauthlib/test/api_crypto/test_crypto_pad.c ../src/config/default/library/cryptoauthlib/test/atcacert/test_cert_def_5_device.c ../src/config/default/library/cryptoauthlib/test/atcacert/test_cert_def_16_signer.c ../src/config/default/library/cryptoauthlib/test/atcacert/test_cert_def_12_device.c ../src/config/default/library/cryptoauthlib/test/atcacert/test_atcacert_client.c ../src/config/default/library/cryptoauthlib/test/atcacert/test_atcacert_date.c ../src/config/default/library/cryptoauthlib/test/atcacert/test_atcacert_der_integer.c ../src/config/default/library/cryptoauthlib/test/atcacert/test_cert_def_10_device.c ../src/config/default/library/cryptoauthlib/test/atcacert/test_cert_def_13_signer.c ../src/config/default/library/cryptoauthlib/test/atcacert/test_cert_def_1_signer.c ../src/config/default/library/cryptoauthlib/test/atcacert/test_cert_def_15_device_csr.c ../src/config/default/library/cryptoauthlib/test/atcacert/test_cert_def_11_signer.c ../src/config/default/library/cryptoauthlib/test/atcacert/test_cert_def_9_device.c ../src/config/default/library/cryptoauthlib/test/atcacert/test_cert_def_2_device_csr.c ../src/config/default/library/cryptoauthlib/test/atcacert/test_atcacert_der_ecdsa_sig_value.c ../src/config/default/library/cryptoauthlib/test/atcacert/test_atcacert_host_sw.c ../src/config/default/library/cryptoauthlib/test/atcacert/test_cert_def_7_signer.c ../src/config/default/library/cryptoauthlib/test/atcacert/test_atcacert_host_hw.c ../src/config/default/library/cryptoauthlib/test/atcacert/test_cert_def_4_device.c ../src/config/default/library/cryptoauthlib/test/atcacert/test_cert_def_14_device.c ../src/config/default/library/cryptoauthlib/test/atcacert/test_atcacert_def.c ../src/config/default/library/cryptoauthlib/test/atcacert/test_cert_def_6_device.c ../src/config/default/library/cryptoauthlib/test/atcacert/test_cert_def_3_device.c ../src/config/default/library/cryptoauthlib/test/atcacert/test_atcacert.c ../src/config/default/library/cryptoauthlib/test/atcacert/test_cert_def_0_device.c ../src/config/default/library/cryptoauthlib/test/atcacert/test_cert_def_8_signer.c ../src/config/default/library/cryptoauthlib/test/atcacert/test_atcacert_der_length.c ../src/config/default/library/cryptoauthlib/test/hal/test_hal_basic.c ../src/config/default/library/cryptoauthlib/test/hal/test_hal.c ../src/config/default/library/cryptoauthlib/test/integration/test_integration.c ../src/config/default/library/cryptoauthlib/test/integration/test_mbedtls.c ../src/config/default/library/cryptoauthlib/test/jwt/atca_jwt_test.c ../src/config/default/library/cryptoauthlib/test/vectors/aes_cmac_nist_vectors.c ../src/config/default/library/cryptoauthlib/test/vectors/pkcs7_pad_vectors.c ../src/config/default/library/cryptoauthlib/test/vectors/vector_utils.c ../src/config/default/library/cryptoauthlib/test/vectors/ecdsa_nist_vectors.c ../src/config/default/library/cryptoauthlib/test/vectors/aes_gcm_nist_vectors.c ../src/config/default/library/cryptoauthlib/test/vectors/pbkdf2_sha256_vectors.c ../src/config/default/library/cryptoauthlib/test/vectors/ecdh_nist_vectors.c ../src/config/default/library/cryptoauthlib/test/atca_test_console.c ../src/config/default/library/cryptoauthlib/test/cmd-processor.c ../src/config/default/library/cryptoauthlib/test/atca_test.c ../src/config/default/library/cryptoauthlib/test/atca_test_config.c ../src/config/default/library/cryptoauthlib/test/atca_utils_atecc608.c ../src/config/default/library/cryptoauthlib/third_party/unity/unity.c ../src/config/default/library/cryptoauthlib/third_party/unity/unity_memory.c ../src/config/default/library/cryptoauthlib/third_party/unity/unity_fixture.c ../src/config/default/library/cryptoauthlib/atca_cfgs.c ../src/config/default/library/cryptoauthlib/atca_helpers.c ../src/config/default/library/cryptoauthlib/atca_iface.c ../src/config/default/library/cryptoauthlib/atca_basic.c ../src/config/default/library/cryptoauthlib/atca_device.c ../src/config/default/library/cryptoauthlib/cal_buffer.c ../src/config/default/library/cryptoauthlib/atca_debug.c ../src/config/default/library/tcpip/src/helpers.c ../src/config/default/library/tcpip/src/common/sys_fs_shell.c ../src/config/default/library/tcpip/src/tcpip_heap_internal.c ../src/config/default/library/tcpip/src/tcpip_notify.c ../src/config/default/library/tcpip/src/tcpip_manager.c ../src/config/default/library/tcpip/src/oahash.c ../src/config/default/library/tcpip/src/tcpip_packet.c ../src/config/default/library/tcpip/src/tcpip_helpers.c ../src/config/default/library/tcpip/src/tcpip_helper_c32.S ../src/config/default/library/tcpip/src/tcpip_heap_alloc.c ../src/config/default/library/tcpip/src/hash_fnv.c ../src/config/default/library/tcpip/src/dhcp.c ../src/config/default/library/tcpip/src/dns.c ../src/config/default/library/tcpip/src/tcpip_commands.c ../src/config/default/library/tcpip/src/telnet.c ../src/config/default/library/tcpip/src/tcpip_announce.c ../src/config/default/library/tcpip/src/ipv4.c ../src/config/default/library/tcpip/src/udp.c ../src/config/default/library/tcpip/src/icmp.c ../src/config/default/library/tcpip/src/tcp.c ../src/config/default/library/tcpip/src/arp.c ../src/config/default/library/tcpip/src/http_server.c ../src/config/default/library/tcpip/src/berkeley_api.c ../src/config/default/library/tcpip/src/icmpv6.c ../src/config/default/library/tcpip/src/http.c ../src/config/default/library/tcpip/src/sntp.c ../src/config/default/library/tcpip/src/zero_conf_helper.c ../src/config/default/library/tcpip/src/ipv6.c ../src/config/default/library/tcpip/src/smtpc.c ../src/config/default/library/tcpip/src/dnss.c ../src/config/default/library/tcpip/src/dhcpv6.c ../src/config/default/library/tcpip/src/igmp.c ../src/config/default/library/tcpip/src/ftpc.c ../src/config/default/library/tcpip/src/zero_conf_multicast_dns.c ../src/config/default/library/tcpip/src/zero_conf_link_local.c ../src/config/default/library/tcpip/src/ndp.c ../src/config/default/library/tcpip/src/iperf.c ../src/config/default/library/tcpip/src/nbns.c ../src/config/default/library/tcpip/src/snmpv3.c ../src/config/default/library/tcpip/src/ftp.c ../src/config/default/library/tcpip/src/snmpv3_usm.c ../src/config/default/library/tcpip/src/ddns.c ../src/config/default/library/tcpip/src/snmp.c ../src/config/default/net_pres/pres/src/net_pres.c ../src/config/default/net_pres/pres/net_pres_enc_glue.c ../src/config/default/net_pres/pres/net_pres_cert_store.c ../src/config/default/ota_service/ota_service.c ../src/config/default/ota_service/ota_service_file_handler.c ../src/config/default/ota_service/ota_service_transport_ble.c ../src/config/default/peripheral/adc/plib_adc.c ../src/config/default/peripheral/clk/plib_clk.c ../src/config/default/peripheral/coretimer/plib_coretimer.c ../src/config/default/peripheral/evic/plib_evic.c ../src/config/default/peripheral/gpio/plib_gpio.c ../src/config/default/peripheral/nvm/plib_nvm.c ../src/config/default/peripheral/ram/plib_ram.c ../src/config/default/peripheral/uart/plib_uart1.c ../src/config/default/peripheral/uart/plib_uart2.c ../src/config/default/peripheral/uart/plib_uart3.c ../src/config/default/peripheral/uart/plib_uart4.c ../src/config/default/rnbd/rnbd_interface.c ../src/config/default/stdio/xc32_monitor.c ../src/config/default/system/command/src/sys_command.c ../src/config/default/system/console/src/sys_console_usb_cdc.c ../src/config/default/system/console/src/sys_console.c ../src/config/default/system/fs/fat_fs/file_system/ff.c ../src/config/default/system/fs/fat_fs/file_system/ffunicode.c ../src/config/default/system/fs/fat_fs/hardware_access/diskio.c ../src/config/default/system/fs/src/sys_fs_media_manager.c ../src/config/default/system/fs/src/sys_fs_fat_interface.c ../src/config/default/system/fs/src/sys_fs.c ../src/config/default/system/reset/sys_reset.c ../src/config/default/system/time/src/sys_time.c ../src/config/default/system/sys_time_h2_adapter.c ../src/config/default/third_party_adapter/wolfMQTT/src/mqtt_net_glue.c ../src/config/default/usb/src/usb_device_cdc.c ../src/config/default/usb/src/usb_device_cdc_acm.c ../src/config/default/usb/src/usb_device.c ../src/config/default/usb/src/usb_host_generic.c ../src/config/default/usb/src/usb_host_cdc.c ../src/config/default/usb/src/usb_host_cdc_acm.c ../src/config/default/usb/src/usb_host.c ../src/config/default/usb/src/usb_host_hid.c ../src/config/default/exceptions.c ../src/config/default/interrupts.c ../src/config/default/initialization.c ../src/config/default/interrupts_a.S ../src/config/default/freertos_hooks.c ../src/config/default/usb_device_init_data.c ../src/third_party/rtos/FreeRTOS/Source/portable/MemMang/heap_1.c ../src/third_party/rtos/FreeRTOS/Source/portable/MPLAB/PIC32MX/port.c ../src/third_party/rtos/FreeRTOS/Source/portable/MPLAB/PIC32MX/port_asm.S ../src/third_party/rtos/FreeRTOS/Source/list.c ../src/third_party/rtos/FreeRTOS/Source/timers.c ../src/third_party/rtos/FreeRTOS/Source/queue.c ../src/third_party/rtos/FreeRTOS/Source/event_groups.c ../src/third_party/rtos/FreeRTOS/Source/croutine.c ../src/third_party/rtos/FreeRTOS/Source/stream_buffer.c ../src/third_party/rtos/FreeRTOS/Source/FreeRTOS_tasks.c ../src/third_party/paho.mqtt.embedded-c/MQTTClient-C/Platforms/MCHP_pic32mzw1.c ../src/third_party/paho.mqtt.embedded-c/MQTTClient-C/src/MQTTClient.c ../src/third_party/paho.mqtt.embedded-c/MQTTPacket/src/MQTTConnectServer.c ../src/third_party/paho.mqtt.embedded-c/MQTTPacket/src/MQTTUnsubscribeServer.c ../src/third_party/paho.mqtt.embedded-c/MQTTPacket/src/MQTTUnsubscribeClient.c ../src/third_party/paho.mqtt.embedded-c/MQTTPacket/src/MQTTConnectClient.c ../src/third_party/paho.mqtt.embedded-c/MQTTPacket/src/MQTTPacket.c ../src/third_party/paho.mqtt.embedded-c/MQTTPacket/src/MQTTSubscribeServer.c ../src/third_party/paho.mqtt.embedded-c/MQTTPacket/src/MQTTDeserializePublish.c ../src/third_party/paho.mqtt.embedded-c/MQTTPacket/src/MQTTSubscribeClient.c ../src/third_party/paho.mqtt.embedded-c/MQTTPacket/src/MQTTFormat.c ../src/third_party/paho.mqtt.embedded-c/MQTTPacket/src/MQTTSerializePublish.c ../src/rnbd/rnbd.c ../src/third_party/wolfMQTT/src/mqtt_packet.c ../src/third_party/wolfMQTT/src/mqtt_socket.c ../src/third_party/wolfMQTT/src/mqtt_client.c ../src/third_party/wolfssl/wolfssl/wolfcrypt/src/port/pic32/crypt_sha1_sam11105.c ../src/third_party/wolfssl/wolfssl/wolfcrypt/src/port/pic32/crypt_sha512_sam6156.c ../src/third_party/wolfssl/wolfssl/wolfcrypt/src/port/pic32/crypt_rsa_pukcl.c ../src/third_party/wolfssl/wolfssl/wolfcrypt/src/port/pic32/crypt_sha384_sam6156.c ../src/third_party/wolfssl/wolfssl/wolfcrypt/src/port/pic32/crypt_ecc_ba414e.c ../src/third_party/wolfssl/wolfssl/wolfcrypt/src/port/pic32/crypt_pukcl_functions.c ../src/third_party/wolfssl/wolfssl/wolfcrypt/src/port/pic32/crypt_sha1_sam6156.c ../src/third_party/wolfssl/wolfssl/wolfcrypt/src/port/pic32/crypt_sam_u2803.c ../src/third_party/wolfssl/wolfssl/wolfcrypt/src/port/pic32/crypt_rng_u2242.c ../src/third_party/wolfssl/wolfssl/wolfcrypt/src/port/pic32/crypt_rng_sam6334.c ../src/third_party/wolfssl/wolfssl/wolfcrypt/src/port/pic32/pic32mz-crypt.c ../src/third_party/wolfssl/wolfssl/wolfcrypt/src/port/pic32/crypt_sha224_sam11105.c ../src/third_party/wolfssl/wolfssl/wolfcrypt/src/port/pic32/crypt_sha256_sam6156.c ../src/third_party/wolfssl/wolfssl/wolfcrypt/src/port/pic32/crypt_tdes_sam6150.c ../src/third_party/wolfssl/wolfssl/wolfcrypt/src/port/pic32/crypt_aes_sam6149.c ../src/third_party/wolfssl/wolfssl/wolfcrypt/src/port/pic32/crypt_aes_u2238.c ../src/third_party/wolfssl/wolfssl/wolfcrypt/src/port/pic32/crypt_ecc_pukcl.c ../src/third_party/wolfssl/wolfssl/wolfcrypt/src/port/pic32/crypt_wolfcryptcb.c ../src/third_party/wolfssl/wolfssl/wolfcrypt/src/port/pic32/crypt_sha256_sam11105.c ../src/third_party/wolfssl/wolfssl/wolfcrypt/src/port/pic32/crypt_sha224_sam6156.c ../src/third_party/wolfssl/wolfssl/wolfcrypt/src/siphash.c ../src/third_party/wolfssl/wolfssl/wolfcrypt/src/srp.c ../src/third_party/wolfssl/wolfssl/wolfcrypt/src/ext_kyber.c ../src/third_party/wolfssl/wolfssl/wolfcrypt/src/eccsi.c ../src/third_party/wolfssl/wolfssl/wolfcrypt/src/sha.c ../src/third_party/wolfssl/wolfssl/wolfcrypt/src/dsa.c ../src/third_party/wolfssl/wolfssl/wolfcrypt/src/falcon.c ../src/third_party/wolfssl/wolfssl/wolfcrypt/src/arc4.c ../src/third_party/wolfssl/wolfssl/wolfcrypt/src/sha256.c ../src/third_party/wolfssl/wolfssl/wolfcrypt/src/wc_lms.c ../src/third_party/wolfssl/wolfssl/wolfcrypt/src/rsa.c ../src/third_party/wolfssl/wolfssl/wolfcrypt/src/sakke.c ../src/third_party/wolfssl/wolfssl/wolfcrypt/src/error.c ../src/third_party/wolfssl/wolfssl/wolfcrypt/src/md5.c ../src/third_party/wolfssl/wolfssl/wolfcrypt/src/tfm.c ../src/third_party/wolfssl/wolfssl/wolfcrypt/src/aes.c ../src/third_party/wolfssl/wolfssl/wolfcrypt/src/sp_sm2_arm64.c ../src/third_party/wolfssl/wolfssl/wolfcrypt/src/logging.c ../src/third_party/wolfssl/wolfssl/wolfcrypt/src/dh.c ../src/third_party/wolfssl/wolfssl/wolfcrypt/src/cmac.c ../src/third_party/wolfssl/wolfssl/wolfcrypt/src/signature.c ../src/third_party/wolfssl/wolfssl/wolfcrypt/src/sp_int.c ../src/third_party/wolfssl/wolfssl/wolfcrypt/src/md4.c ../src/third_party/wolfssl/wolfssl/wolfcrypt/src/wc_dsp.c ../src/third_party/wolfssl/wolfssl/wolfcrypt/src/sp_x86_64.c ../src/third_party/wolfssl/wolfssl/wolfcrypt/src/sp_sm2_armthumb.c ../src/third_party/wolfssl/wolfssl/wolfcrypt/src/asm.c ../src/third_party/wolfssl/wolfssl/wolfcrypt/src/poly1305.c ../src/third_party/wolfssl/wolfssl/wolfcrypt/src/hmac.c ../src/third_party/wolfssl/wolfssl/wolfcrypt/src/sm4.c ../src/third_party/wolfssl/wolfssl/wolfcrypt/src/compress.c ../src/third_party/wolfssl/wolfssl/wolfcrypt/src/hash.c ../src/third_party/wolfssl/wolfssl/wolfcrypt/src/asn.c ../src/third_party/wolfssl/wolfssl/wolfcrypt/src/pwdbased.c ../src/third_party/wolfssl/wolfssl/wolfcrypt/src/md2.c ../src/third_party/wolfssl/wolfssl/wolfcrypt/src/ext_lms.c ../src/third_party/wolfssl/wolfssl/wolfcrypt/src/sp_armthumb.c ../src/third_party/wolfssl/wolfssl/wolfcrypt/src/ed448.c ../src/third_party/wolfssl/wolfssl/wolfcrypt/src/coding.c ../src/third_party/wolfssl/wolfssl/wolfcrypt/src/ecc_fp.c ../src/third_party/wolfssl/wolfssl/wolfcrypt/src/kdf.c ../src/third_party/wolfssl/wolfssl/wolfcrypt/src/cpuid.c ../src/third_party/wolfssl/wolfssl/wolfcrypt/src/sm2.c ../src/third_party/wolfssl/wolfssl/wolfcrypt/src/ripemd.c ../src/third_party/wolfssl/wolfssl/wolfcrypt/src/sp_sm2_cortexm.c ../src/third_party/wolfssl/wolfssl/wolfcrypt/src/sp_sm2_x86_64.c ../src/third_party/wolfssl/wolfssl/wolfcrypt/src/sphincs.c ../src/third_party/wolfssl/wolfssl/wolfcrypt/src/fe_low_mem.c ../src/third_party/wolfssl/wolfssl/wolfcrypt/src/sm3.c ../src/third_party/wolfssl/wolfssl/wolfcrypt/src/pkcs12.c ../src/third_party/wolfssl/wolfssl/wolfcrypt/src/wolfmath.c ../src/third_party/wolfssl/wolfssl/wolfcrypt/src/sp_arm32.c ../src/third_party/wolfssl/wolfssl/wolfcrypt/src/chacha.c ../src/third_party/wolfssl/wolfssl/wolfcrypt/src/wc_xmss.c ../src/third_party/wolfssl/wolfssl/wolfcrypt/src/sha3.c ../src/third_party/wolfssl/wolfssl/wolfcrypt/src/fe_operations.c ../src/third_party/wolfssl/wolfssl/wolfcrypt/src/camellia.c ../src/third_party/wolfssl/wolfssl/wolfcrypt/src/cryptocb.c ../src/third_party/wolfssl/wolfssl/wolfcrypt/src/wc_xmss_impl.c ../src/third_party/wolfssl/wolfssl/wolfcrypt/src/des3.c ../src/third_party/wolfssl/wolfssl/wolfcrypt/src/ext_xmss.c ../src/third_party/wolfssl/wolfssl/wolfcrypt/src/ge_448.c ../src/third_party/wolfssl/wolfssl/wolfcrypt/src/pkcs7.c ../src/third_party/wolfssl/wolfssl/wolfcrypt/src/sp_cortexm.c ../src/third_party/wolfssl/wolfssl/wolfcrypt/src/wc_port.c ../src/third_party/wolfssl/wolfssl/wolfcrypt/src/ed25519.c ../src/third_party/wolfssl/wolfssl/wolfcrypt/src/sha512.c ../src/third_party/wolfssl/wolfssl/wolfcrypt/src/memory.c ../src/third_party/wolfssl/wolfssl/wolfcrypt/src/blake2b.c ../src/third_party/wolfssl/wolfssl/wolfcrypt/src/curve25519.c ../src/third_party/wolfssl/wolfssl/wolfcrypt/src/misc.c ../src/third_party/wolfssl/wolfssl/wolfcrypt/src/sp_sm2_c32.c ../src/third_party/wolfssl/wolfssl/wolfcrypt/src/random.c ../src/third_party/wolfssl/wolfssl/wolfcrypt/src/rc2.c ../src/third_party/wolfssl/wolfssl/wolfcrypt/src/ge_low_mem.c ../src/third_party/wolfssl/wolfssl/wolfcrypt/src/sp_sm2_arm32.c ../src/third_party/wolfssl/wolfssl/wolfcrypt/src/blake2s.c ../src/third_party/wolfssl/wolfssl/wolfcrypt/src/sp_sm2_c64.c ../src/third_party/wolfssl/wolfssl/wolfcrypt/src/sp_c64.c ../src/third_party/wolfssl/wolfssl/wolfcrypt/src/wc_encrypt.c ../src/third_party/wolfssl/wolfssl/wolfcrypt/src/wc_lms_impl.c ../src/third_party/wolfssl/wolfssl/wolfcrypt/src/hpke.c ../src/third_party/wolfssl/wolfssl/wolfcrypt/src/ecc.c ../src/third_party/wolfssl/wolfssl/wolfcrypt/src/evp.c ../src/third_party/wolfssl/wolfssl/wolfcrypt/src/sp_arm64.c ../src/third_party/wolfssl/wolfssl/wolfcrypt/src/wc_kyber.c ../src/third_party/wolfssl/wolfssl/wolfcrypt/src/wolfevent.c ../src/third_party/wolfssl/wolfssl/wolfcrypt/src/integer.c ../src/third_party/wolfssl/wolfssl/wolfcrypt/src/ge_operations.c ../src/third_party/wolfssl/wolfssl/wolfcrypt/src/sp_dsp32.c ../src/third_party/wolfssl/wolfssl/wolfcrypt/src/sp_c32.c ../src/third_party/wolfssl/wolfssl/wolfcrypt/src/dilithium.c ../src/third_party/wolfssl/wolfssl/wolfcrypt/src/chacha20_poly1305.c ../src/third_party/wolfssl/wolfssl/wolfcrypt/src/wc_pkcs11.c ../src/third_party/wolfssl/wolfssl/wolfcrypt/src/wc_kyber_poly.c ../src/third_party/wolfssl/wolfssl/wolfcrypt/src/curve448.c ../src/third_party/wolfssl/wolfssl/wolfcrypt/src/fe_448.c ../src/third_party/wolfssl/src/x509.c ../src/third_party/wolfssl/src/ssl_bn.c ../src/third_party/wolfssl/src/keys.c ../src/third_party/wolfssl/src/x509_str.c ../src/third_party/wolfssl/src/tls13.c ../src/third_party/wolfssl/src/ssl_certman.c ../src/third_party/wolfssl/src/ocsp.c ../src/third_party/wolfssl/src/internal.c ../src/third_party/wolfssl/src/pk.c ../src/third_party/wolfssl/src/quic.c ../src/third_party/wolfssl/src/ssl_crypto.c ../src/third_party/wolfssl/src/ssl_misc.c ../src/third_party/wolfssl/src/ssl.c ../src/third_party/wolfssl/src/wolfio.c ../src/third_party/wolfssl/src/sniffer.c ../src/third_party/wolfssl/src/ssl_asn1.c ../src/third_party/wolfssl/src/tls.c ../src/third_party/wolfssl/src/dtls13.c ../src/third_party/wolfssl/src/dtls.c ../src/third_party/wolfssl/src/crl.c ../src/third_party/wolfssl/src/conf.c ../src/third_party/zlib/zutil.c ../src/third_party/zlib/crc32.c ../src/third_party/zlib/deflate.c ../src/third_party/zlib/adler32.c ../src/third_party/zlib/uncompr.c ../src/third_party/zlib/inflate.c ../src/third_party/zlib/trees.c ../src/third_party/zlib/inffast.c ../src/third_party/zlib/infback.c ../src/third_party/zlib/compress.c ../src/third_party/zlib/gzclose.c ../src/third_party/zlib/inftrees.c ../src/main.c ../src/http_server_print.c ../src/custom_http_server_app.c ../src/custom_snmp_app.c ../src/app_mqtt_task.c ../src/custom_http_app.c ../src/http_print.c ../src/config/default/system/console/src/sys_console_uart.c ../src/config/default/driver/usb/usbfs/src/drv_usbfs_host.c ../src/config/default/system/debug/src/sys_debug.c
+SOURCEFILES_QUOTED_IF_SPACED=../src/config/default/bsp/bsp.c ../src/config/default/crypto/src/crypto.c ../src/config/default/driver/ethmac/src/dynamic/drv_eth_pic32_lib.c ../src/config/default/driver/ethmac/src/dynamic/drv_ethmac_lib.c ../src/config/default/driver/ethmac/src/dynamic/drv_ethmac.c ../src/config/default/driver/ethphy/src/dynamic/drv_ethphy.c ../src/config/default/driver/ethphy/src/dynamic/drv_extphy_dp83848.c ../src/config/default/driver/memory/src/drv_memory.c ../src/config/default/driver/miim/src/dynamic/drv_miim_pic32m.c ../src/config/default/driver/miim/src/dynamic/drv_miim.c ../src/config/default/driver/usb/usbfs/src/drv_usbfs.c ../src/config/default/library/cryptoauthlib/app/pkcs11/trust_pkcs11_config.c ../src/config/default/library/cryptoauthlib/atcacert/atcacert_pem.c ../src/config/default/library/cryptoauthlib/atcacert/atcacert_der.c ../src/config/default/library/cryptoauthlib/atcacert/atcacert_date.c ../src/config/default/library/cryptoauthlib/atcacert/atcacert_def.c ../src/config/default/library/cryptoauthlib/atcacert/atcacert_host_sw.c ../src/config/default/library/cryptoauthlib/atcacert/atcacert_host_hw.c ../src/config/default/library/cryptoauthlib/atcacert/atcacert_client.c ../src/config/default/library/cryptoauthlib/crypto/hashes/sha2_routines.c ../src/config/default/library/cryptoauthlib/crypto/hashes/sha1_routines.c ../src/config/default/library/cryptoauthlib/crypto/atca_crypto_hw_aes_ccm.c ../src/config/default/library/cryptoauthlib/crypto/atca_crypto_hw_aes_cbcmac.c ../src/config/default/library/cryptoauthlib/crypto/atca_crypto_sw_sha2.c ../src/config/default/library/cryptoauthlib/crypto/atca_crypto_pad.c ../src/config/default/library/cryptoauthlib/crypto/atca_crypto_sw_aes_cmac.c ../src/config/default/library/cryptoauthlib/crypto/atca_crypto_hw_aes_cmac.c ../src/config/default/library/cryptoauthlib/crypto/atca_crypto_pbkdf2.c ../src/config/default/library/cryptoauthlib/crypto/atca_crypto_sw_aes_gcm.c ../src/config/default/library/cryptoauthlib/crypto/atca_crypto_hw_aes_ctr.c ../src/config/default/library/cryptoauthlib/crypto/atca_crypto_sw_sha1.c ../src/config/default/library/cryptoauthlib/crypto/atca_crypto_hw_aes_cbc.c ../src/config/default/library/cryptoauthlib/hal/hal_gpio_harmony.c ../src/config/default/library/cryptoauthlib/hal/hal_pic32_delay.c ../src/config/default/library/cryptoauthlib/hal/kit_protocol.c ../src/config/default/library/cryptoauthlib/hal/atca_hal.c ../src/config/default/library/cryptoauthlib/hal/hal_freertos.c ../src/config/default/library/cryptoauthlib/jwt/atca_jwt.c ../src/config/default/library/cryptoauthlib/kit_host/ascii_kit_host.c ../src/config/default/library/cryptoauthlib/pkcs11/pkcs11_signature.c ../src/config/default/library/cryptoauthlib/pkcs11/pkcs11_attrib.c ../src/config/default/library/cryptoauthlib/pkcs11/pkcs11_key.c ../src/config/default/library/cryptoauthlib/pkcs11/pkcs11_debug.c ../src/config/default/library/cryptoauthlib/pkcs11/pkcs11_info.c ../src/config/default/library/cryptoauthlib/pkcs11/pkcs11_init.c ../src/config/default/library/cryptoauthlib/pkcs11/pkcs11_token.c ../src/config/default/library/cryptoauthlib/pkcs11/pkcs11_slot.c ../src/config/default/library/cryptoauthlib/pkcs11/pkcs11_main.c ../src/config/default/library/cryptoauthlib/pkcs11/pkcs11_encrypt.c ../src/config/default/library/cryptoauthlib/pkcs11/pkcs11_object.c ../src/config/default/library/cryptoauthlib/pkcs11/pkcs11_cert.c ../src/config/default/library/cryptoauthlib/pkcs11/pkcs11_util.c ../src/config/default/library/cryptoauthlib/pkcs11/pkcs11_os.c ../src/config/default/library/cryptoauthlib/pkcs11/pkcs11_config.c ../src/config/default/library/cryptoauthlib/pkcs11/pkcs11_session.c ../src/config/default/library/cryptoauthlib/pkcs11/pkcs11_find.c ../src/config/default/library/cryptoauthlib/pkcs11/pkcs11_mech.c ../src/config/default/library/cryptoauthlib/pkcs11/pkcs11_digest.c ../src/config/default/library/cryptoauthlib/test/api_atcab/atca_tests_updateextra.c ../src/config/default/library/cryptoauthlib/test/api_atcab/atca_tests_secureboot.c ../src/config/default/library/cryptoauthlib/test/api_atcab/atca_tests_hmac.c ../src/config/default/library/cryptoauthlib/test/api_atcab/test_atcab.c ../src/config/default/library/cryptoauthlib/test/api_atcab/atca_tests_ecdh.c ../src/config/default/library/cryptoauthlib/test/api_atcab/atca_tests_aes_cbcmac.c ../src/config/default/library/cryptoauthlib/test/api_atcab/atca_tests_info.c ../src/config/default/library/cryptoauthlib/test/api_atcab/atca_tests_sha.c ../src/config/default/library/cryptoauthlib/test/api_atcab/atca_tests_sign.c ../src/config/default/library/cryptoauthlib/test/api_atcab/atca_tests_privwrite.c ../src/config/default/library/cryptoauthlib/test/api_atcab/atca_tests_aes_ccm.c ../src/config/default/library/cryptoauthlib/test/api_atcab/atca_tests_read.c ../src/config/default/library/cryptoauthlib/test/api_atcab/atca_tests_aes_cmac.c ../src/config/default/library/cryptoauthlib/test/api_atcab/atca_tests_aes.c ../src/config/default/library/cryptoauthlib/test/api_atcab/atca_tests_write.c ../src/config/default/library/cryptoauthlib/test/api_atcab/atca_tests_random.c ../src/config/default/library/cryptoauthlib/test/api_atcab/atca_tests_lock.c ../src/config/default/library/cryptoauthlib/test/api_atcab/atca_tests_aes_cbc.c ../src/config/default/library/cryptoauthlib/test/api_atcab/atca_tests_aes_gcm.c ../src/config/default/library/cryptoauthlib/test/api_atcab/atca_tests_helper.c ../src/config/default/library/cryptoauthlib/test/api_atcab/atca_tests_kdf.c ../src/config/default/library/cryptoauthlib/test/api_atcab/atca_tests_mac.c ../src/config/default/library/cryptoauthlib/test/api_atcab/atca_tests_verify.c ../src/config/default/library/cryptoauthlib/test/api_atcab/atca_tests_aes_ctr.c ../src/config/default/library/cryptoauthlib/test/api_atcab/atca_tests_startup.c ../src/config/default/library/cryptoauthlib/test/api_atcab/atca_tests_derivekey.c ../src/config/default/library/cryptoauthlib/test/api_atcab/atca_tests_counter.c ../src/config/default/library/cryptoauthlib/test/api_atcab/atca_tests_nonce.c ../src/config/default/library/cryptoauthlib/test/api_atcab/atca_tests_genkey.c ../src/config/default/library/cryptoauthlib/test/api_atcab/atca_tests_buffer.c ../src/config/default/library/cryptoauthlib/test/api_atcab/atca_tests_gendig.c ../src/config/default/library/cryptoauthlib/test/api_atcab/atca_tests_otpzero.c ../src/config/default/library/cryptoauthlib/test/api_atcab/atca_tests_selftest.c ../src/config/default/library/cryptoauthlib/test/api_calib/test_calib.c ../src/config/default/library/cryptoauthlib/test/api_calib/test_calib_config.c ../src/config/default/library/cryptoauthlib/test/api_calib/test_calib_info.c ../src/config/default/library/cryptoauthlib/test/api_calib/test_calib_delete.c ../src/config/default/library/cryptoauthlib/test/api_crypto/test_crypto.c ../src/config/default/library/cryptoauthlib/test/api_crypto/test_crypto_pk.c ../src/config/default/library/cryptoauthlib/test/api_crypto/test_crypto_sha.c ../src/config/default/library/cryptoauthlib/test/api_crypto/test_crypto_aes.c ../src/config/default/library/cryptoauthlib/test/api_crypto/test_crypto_pbkdf2.c ../src/config/default/library/cryptoauthlib/test/api_crypto/test_crypto_pad.c ../src/config/default/library/cryptoauthlib/test/atcacert/test_cert_def_5_device.c ../src/config/default/library/cryptoauthlib/test/atcacert/test_cert_def_16_signer.c ../src/config/default/library/cryptoauthlib/test/atcacert/test_cert_def_12_device.c ../src/config/default/library/cryptoauthlib/test/atcacert/test_atcacert_client.c ../src/config/default/library/cryptoauthlib/test/atcacert/test_atcacert_date.c ../src/config/default/library/cryptoauthlib/test/atcacert/test_atcacert_der_integer.c ../src/config/default/library/cryptoauthlib/test/atcacert/test_cert_def_10_device.c ../src/config/default/library/cryptoauthlib/test/atcacert/test_cert_def_13_signer.c ../src/config/default/library/cryptoauthlib/test/atcacert/test_cert_def_1_signer.c ../src/config/default/library/cryptoauthlib/test/atcacert/test_cert_def_15_device_csr.c ../src/config/default/library/cryptoauthlib/test/atcacert/test_cert_def_11_signer.c ../src/config/default/library/cryptoauthlib/test/atcacert/test_cert_def_9_device.c ../src/config/default/library/cryptoauthlib/test/atcacert/test_cert_def_2_device_csr.c ../src/config/default/library/cryptoauthlib/test/atcacert/test_atcacert_der_ecdsa_sig_value.c ../src/config/default/library/cryptoauthlib/test/atcacert/test_atcacert_host_sw.c ../src/config/default/library/cryptoauthlib/test/atcacert/test_cert_def_7_signer.c ../src/config/default/library/cryptoauthlib/test/atcacert/test_atcacert_host_hw.c ../src/config/default/library/cryptoauthlib/test/atcacert/test_cert_def_4_device.c ../src/config/default/library/cryptoauthlib/test/atcacert/test_cert_def_14_device.c ../src/config/default/library/cryptoauthlib/test/atcacert/test_atcacert_def.c ../src/config/default/library/cryptoauthlib/test/atcacert/test_cert_def_6_device.c ../src/config/default/library/cryptoauthlib/test/atcacert/test_cert_def_3_device.c ../src/config/default/library/cryptoauthlib/test/atcacert/test_atcacert.c ../src/config/default/library/cryptoauthlib/test/atcacert/test_cert_def_0_device.c ../src/config/default/library/cryptoauthlib/test/atcacert/test_cert_def_8_signer.c ../src/config/default/library/cryptoauthlib/test/atcacert/test_atcacert_der_length.c ../src/config/default/library/cryptoauthlib/test/hal/test_hal_basic.c ../src/config/default/library/cryptoauthlib/test/hal/test_hal.c ../src/config/default/library/cryptoauthlib/test/integration/test_integration.c ../src/config/default/library/cryptoauthlib/test/integration/test_mbedtls.c ../src/config/default/library/cryptoauthlib/test/jwt/atca_jwt_test.c ../src/config/default/library/cryptoauthlib/test/vectors/aes_cmac_nist_vectors.c ../src/config/default/library/cryptoauthlib/test/vectors/pkcs7_pad_vectors.c ../src/config/default/library/cryptoauthlib/test/vectors/vector_utils.c ../src/config/default/library/cryptoauthlib/test/vectors/ecdsa_nist_vectors.c ../src/config/default/library/cryptoauthlib/test/vectors/aes_gcm_nist_vectors.c ../src/config/default/library/cryptoauthlib/test/vectors/pbkdf2_sha256_vectors.c ../src/config/default/library/cryptoauthlib/test/vectors/ecdh_nist_vectors.c ../src/config/default/library/cryptoauthlib/test/atca_test_console.c ../src/config/default/library/cryptoauthlib/test/cmd-processor.c ../src/config/default/library/cryptoauthlib/test/atca_test.c ../src/config/default/library/cryptoauthlib/test/atca_test_config.c ../src/config/default/library/cryptoauthlib/test/atca_utils_atecc608.c ../src/config/default/library/cryptoauthlib/third_party/unity/unity.c ../src/config/default/library/cryptoauthlib/third_party/unity/unity_memory.c ../src/config/default/library/cryptoauthlib/third_party/unity/unity_fixture.c ../src/config/default/library/cryptoauthlib/atca_cfgs.c ../src/config/default/library/cryptoauthlib/atca_helpers.c ../src/config/default/library/cryptoauthlib/atca_iface.c ../src/config/default/library/cryptoauthlib/atca_basic.c ../src/config/default/library/cryptoauthlib/atca_device.c ../src/config/default/library/cryptoauthlib/cal_buffer.c ../src/config/default/library/cryptoauthlib/atca_debug.c ../src/config/default/library/tcpip/src/helpers.c ../src/config/default/library/tcpip/src/common/sys_fs_shell.c ../src/config/default/library/tcpip/src/tcpip_heap_internal.c ../src/config/default/library/tcpip/src/tcpip_heap_class.c ../src/config/default/library/tcpip/src/tcpip_notify.c ../src/config/default/library/tcpip/src/tcpip_manager.c ../src/config/default/library/tcpip/src/oahash.c ../src/config/default/library/tcpip/src/tcpip_packet.c ../src/config/default/library/tcpip/src/tcpip_helpers.c ../src/config/default/library/tcpip/src/tcpip_helper_c32.S ../src/config/default/library/tcpip/src/tcpip_heap_alloc.c ../src/config/default/library/tcpip/src/hash_fnv.c ../src/config/default/library/tcpip/src/dhcp.c ../src/config/default/library/tcpip/src/dns.c ../src/config/default/library/tcpip/src/tcpip_commands.c ../src/config/default/library/tcpip/src/telnet.c ../src/config/default/library/tcpip/src/tcpip_announce.c ../src/config/default/library/tcpip/src/ipv4.c ../src/config/default/library/tcpip/src/udp.c ../src/config/default/library/tcpip/src/icmp.c ../src/config/default/library/tcpip/src/tcp.c ../src/config/default/library/tcpip/src/arp.c ../src/config/default/library/tcpip/src/http_server.c ../src/config/default/library/tcpip/src/berkeley_api.c ../src/config/default/library/tcpip/src/icmpv6.c ../src/config/default/library/tcpip/src/http.c ../src/config/default/library/tcpip/src/sntp.c ../src/config/default/library/tcpip/src/zero_conf_helper.c ../src/config/default/library/tcpip/src/ipv6.c ../src/config/default/library/tcpip/src/smtpc.c ../src/config/default/library/tcpip/src/dnss.c ../src/config/default/library/tcpip/src/dhcpv6.c ../src/config/default/library/tcpip/src/igmp.c ../src/config/default/library/tcpip/src/ftpc.c ../src/config/default/library/tcpip/src/zero_conf_multicast_dns.c ../src/config/default/library/tcpip/src/zero_conf_link_local.c ../src/config/default/library/tcpip/src/ndp.c ../src/config/default/library/tcpip/src/iperf.c ../src/config/default/library/tcpip/src/nbns.c ../src/config/default/library/tcpip/src/snmpv3.c ../src/config/default/library/tcpip/src/ftp.c ../src/config/default/library/tcpip/src/snmpv3_usm.c ../src/config/default/library/tcpip/src/ddns.c ../src/config/default/library/tcpip/src/snmp.c ../src/config/default/net_pres/pres/src/net_pres.c ../src/config/default/net_pres/pres/net_pres_enc_glue.c ../src/config/default/net_pres/pres/net_pres_cert_store.c ../src/config/default/ota_service/ota_service.c ../src/config/default/ota_service/ota_service_file_handler.c ../src/config/default/ota_service/ota_service_transport_ble.c ../src/config/default/peripheral/adc/plib_adc.c ../src/config/default/peripheral/clk/plib_clk.c ../src/config/default/peripheral/coretimer/plib_coretimer.c ../src/config/default/peripheral/evic/plib_evic.c ../src/config/default/peripheral/gpio/plib_gpio.c ../src/config/default/peripheral/nvm/plib_nvm.c ../src/config/default/peripheral/ram/plib_ram.c ../src/config/default/peripheral/uart/plib_uart1.c ../src/config/default/peripheral/uart/plib_uart2.c ../src/config/default/peripheral/uart/plib_uart3.c ../src/config/default/peripheral/uart/plib_uart4.c ../src/config/default/rnbd/rnbd_interface.c ../src/config/default/stdio/xc32_monitor.c ../src/config/default/system/command/src/sys_command.c ../src/config/default/system/console/src/sys_console_usb_cdc.c ../src/config/default/system/console/src/sys_console.c ../src/config/default/system/fs/fat_fs/file_system/ff.c ../src/config/default/system/fs/fat_fs/file_system/ffunicode.c ../src/config/default/system/fs/fat_fs/hardware_access/diskio.c ../src/config/default/system/fs/src/sys_fs_media_manager.c ../src/config/default/system/fs/src/sys_fs_fat_interface.c ../src/config/default/system/fs/src/sys_fs.c ../src/config/default/system/reset/sys_reset.c ../src/config/default/system/time/src/sys_time.c ../src/config/default/system/sys_time_h2_adapter.c ../src/config/default/third_party_adapter/wolfMQTT/src/mqtt_net_glue.c ../src/config/default/usb/src/usb_device_cdc.c ../src/config/default/usb/src/usb_device_cdc_acm.c ../src/config/default/usb/src/usb_device.c ../src/config/default/usb/src/usb_host_generic.c ../src/config/default/usb/src/usb_host_cdc.c ../src/config/default/usb/src/usb_host_cdc_acm.c ../src/config/default/usb/src/usb_host.c ../src/config/default/usb/src/usb_host_hid.c ../src/config/default/exceptions.c ../src/config/default/interrupts.c ../src/config/default/initialization.c ../src/config/default/interrupts_a.S ../src/config/default/freertos_hooks.c ../src/config/default/usb_device_init_data.c ../src/third_party/rtos/FreeRTOS/Source/portable/MemMang/heap_1.c ../src/third_party/rtos/FreeRTOS/Source/portable/MPLAB/PIC32MX/port.c ../src/third_party/rtos/FreeRTOS/Source/portable/MPLAB/PIC32MX/port_asm.S ../src/third_party/rtos/FreeRTOS/Source/list.c ../src/third_party/rtos/FreeRTOS/Source/timers.c ../src/third_party/rtos/FreeRTOS/Source/queue.c ../src/third_party/rtos/FreeRTOS/Source/event_groups.c ../src/third_party/rtos/FreeRTOS/Source/croutine.c ../src/third_party/rtos/FreeRTOS/Source/stream_buffer.c ../src/third_party/rtos/FreeRTOS/Source/FreeRTOS_tasks.c ../src/third_party/paho.mqtt.embedded-c/MQTTClient-C/Platforms/MCHP_pic32mzw1.c ../src/third_party/paho.mqtt.embedded-c/MQTTClient-C/src/MQTTClient.c ../src/third_party/paho.mqtt.embedded-c/MQTTPacket/src/MQTTConnectServer.c ../src/third_party/paho.mqtt.embedded-c/MQTTPacket/src/MQTTUnsubscribeServer.c ../src/third_party/paho.mqtt.embedded-c/MQTTPacket/src/MQTTUnsubscribeClient.c ../src/third_party/paho.mqtt.embedded-c/MQTTPacket/src/MQTTConnectClient.c ../src/third_party/paho.mqtt.embedded-c/MQTTPacket/src/MQTTPacket.c ../src/third_party/paho.mqtt.embedded-c/MQTTPacket/src/MQTTSubscribeServer.c ../src/third_party/paho.mqtt.embedded-c/MQTTPacket/src/MQTTDeserializePublish.c ../src/third_party/paho.mqtt.embedded-c/MQTTPacket/src/MQTTSubscribeClient.c ../src/third_party/paho.mqtt.embedded-c/MQTTPacket/src/MQTTFormat.c ../src/third_party/paho.mqtt.embedded-c/MQTTPacket/src/MQTTSerializePublish.c ../src/rnbd/rnbd.c ../src/third_party/wolfMQTT/src/mqtt_packet.c ../src/third_party/wolfMQTT/src/mqtt_socket.c ../src/third_party/wolfMQTT/src/mqtt_client.c ../src/third_party/wolfssl/wolfssl/wolfcrypt/src/port/pic32/crypt_sha1_sam11105.c ../src/third_party/wolfssl/wolfssl/wolfcrypt/src/port/pic32/crypt_sha512_sam6156.c ../src/third_party/wolfssl/wolfssl/wolfcrypt/src/port/pic32/crypt_rsa_pukcl.c ../src/third_party/wolfssl/wolfssl/wolfcrypt/src/port/pic32/crypt_sha384_sam6156.c ../src/third_party/wolfssl/wolfssl/wolfcrypt/src/port/pic32/crypt_ecc_ba414e.c ../src/third_party/wolfssl/wolfssl/wolfcrypt/src/port/pic32/crypt_pukcl_functions.c ../src/third_party/wolfssl/wolfssl/wolfcrypt/src/port/pic32/crypt_sha1_sam6156.c ../src/third_party/wolfssl/wolfssl/wolfcrypt/src/port/pic32/crypt_sam_u2803.c ../src/third_party/wolfssl/wolfssl/wolfcrypt/src/port/pic32/crypt_rng_u2242.c ../src/third_party/wolfssl/wolfssl/wolfcrypt/src/port/pic32/crypt_rng_sam6334.c ../src/third_party/wolfssl/wolfssl/wolfcrypt/src/port/pic32/pic32mz-crypt.c ../src/third_party/wolfssl/wolfssl/wolfcrypt/src/port/pic32/crypt_sha224_sam11105.c ../src/third_party/wolfssl/wolfssl/wolfcrypt/src/port/pic32/crypt_sha256_sam6156.c ../src/third_party/wolfssl/wolfssl/wolfcrypt/src/port/pic32/crypt_tdes_sam6150.c ../src/third_party/wolfssl/wolfssl/wolfcrypt/src/port/pic32/crypt_aes_sam6149.c ../src/third_party/wolfssl/wolfssl/wolfcrypt/src/port/pic32/crypt_aes_u2238.c ../src/third_party/wolfssl/wolfssl/wolfcrypt/src/port/pic32/crypt_ecc_pukcl.c ../src/third_party/wolfssl/wolfssl/wolfcrypt/src/port/pic32/crypt_wolfcryptcb.c ../src/third_party/wolfssl/wolfssl/wolfcrypt/src/port/pic32/crypt_sha256_sam11105.c ../src/third_party/wolfssl/wolfssl/wolfcrypt/src/port/pic32/crypt_sha224_sam6156.c ../src/third_party/wolfssl/wolfssl/wolfcrypt/src/siphash.c ../src/third_party/wolfssl/wolfssl/wolfcrypt/src/srp.c ../src/third_party/wolfssl/wolfssl/wolfcrypt/src/ext_kyber.c ../src/third_party/wolfssl/wolfssl/wolfcrypt/src/eccsi.c ../src/third_party/wolfssl/wolfssl/wolfcrypt/src/sha.c ../src/third_party/wolfssl/wolfssl/wolfcrypt/src/dsa.c ../src/third_party/wolfssl/wolfssl/wolfcrypt/src/falcon.c ../src/third_party/wolfssl/wolfssl/wolfcrypt/src/arc4.c ../src/third_party/wolfssl/wolfssl/wolfcrypt/src/sha256.c ../src/third_party/wolfssl/wolfssl/wolfcrypt/src/wc_lms.c ../src/third_party/wolfssl/wolfssl/wolfcrypt/src/rsa.c ../src/third_party/wolfssl/wolfssl/wolfcrypt/src/sakke.c ../src/third_party/wolfssl/wolfssl/wolfcrypt/src/error.c ../src/third_party/wolfssl/wolfssl/wolfcrypt/src/md5.c ../src/third_party/wolfssl/wolfssl/wolfcrypt/src/tfm.c ../src/third_party/wolfssl/wolfssl/wolfcrypt/src/aes.c ../src/third_party/wolfssl/wolfssl/wolfcrypt/src/sp_sm2_arm64.c ../src/third_party/wolfssl/wolfssl/wolfcrypt/src/logging.c ../src/third_party/wolfssl/wolfssl/wolfcrypt/src/dh.c ../src/third_party/wolfssl/wolfssl/wolfcrypt/src/cmac.c ../src/third_party/wolfssl/wolfssl/wolfcrypt/src/signature.c ../src/third_party/wolfssl/wolfssl/wolfcrypt/src/sp_int.c ../src/third_party/wolfssl/wolfssl/wolfcrypt/src/md4.c ../src/third_party/wolfssl/wolfssl/wolfcrypt/src/wc_dsp.c ../src/third_party/wolfssl/wolfssl/wolfcrypt/src/sp_x86_64.c ../src/third_party/wolfssl/wolfssl/wolfcrypt/src/sp_sm2_armthumb.c ../src/third_party/wolfssl/wolfssl/wolfcrypt/src/asm.c ../src/third_party/wolfssl/wolfssl/wolfcrypt/src/poly1305.c ../src/third_party/wolfssl/wolfssl/wolfcrypt/src/hmac.c ../src/third_party/wolfssl/wolfssl/wolfcrypt/src/sm4.c ../src/third_party/wolfssl/wolfssl/wolfcrypt/src/compress.c ../src/third_party/wolfssl/wolfssl/wolfcrypt/src/hash.c ../src/third_party/wolfssl/wolfssl/wolfcrypt/src/asn.c ../src/third_party/wolfssl/wolfssl/wolfcrypt/src/pwdbased.c ../src/third_party/wolfssl/wolfssl/wolfcrypt/src/md2.c ../src/third_party/wolfssl/wolfssl/wolfcrypt/src/ext_lms.c ../src/third_party/wolfssl/wolfssl/wolfcrypt/src/sp_armthumb.c ../src/third_party/wolfssl/wolfssl/wolfcrypt/src/ed448.c ../src/third_party/wolfssl/wolfssl/wolfcrypt/src/coding.c ../src/third_party/wolfssl/wolfssl/wolfcrypt/src/ecc_fp.c ../src/third_party/wolfssl/wolfssl/wolfcrypt/src/kdf.c ../src/third_party/wolfssl/wolfssl/wolfcrypt/src/cpuid.c ../src/third_party/wolfssl/wolfssl/wolfcrypt/src/sm2.c ../src/third_party/wolfssl/wolfssl/wolfcrypt/src/ripemd.c ../src/third_party/wolfssl/wolfssl/wolfcrypt/src/sp_sm2_cortexm.c ../src/third_party/wolfssl/wolfssl/wolfcrypt/src/sp_sm2_x86_64.c ../src/third_party/wolfssl/wolfssl/wolfcrypt/src/sphincs.c ../src/third_party/wolfssl/wolfssl/wolfcrypt/src/fe_low_mem.c ../src/third_party/wolfssl/wolfssl/wolfcrypt/src/sm3.c ../src/third_party/wolfssl/wolfssl/wolfcrypt/src/pkcs12.c ../src/third_party/wolfssl/wolfssl/wolfcrypt/src/wolfmath.c ../src/third_party/wolfssl/wolfssl/wolfcrypt/src/sp_arm32.c ../src/third_party/wolfssl/wolfssl/wolfcrypt/src/chacha.c ../src/third_party/wolfssl/wolfssl/wolfcrypt/src/wc_xmss.c ../src/third_party/wolfssl/wolfssl/wolfcrypt/src/sha3.c ../src/third_party/wolfssl/wolfssl/wolfcrypt/src/fe_operations.c ../src/third_party/wolfssl/wolfssl/wolfcrypt/src/camellia.c ../src/third_party/wolfssl/wolfssl/wolfcrypt/src/cryptocb.c ../src/third_party/wolfssl/wolfssl/wolfcrypt/src/wc_xmss_impl.c ../src/third_party/wolfssl/wolfssl/wolfcrypt/src/des3.c ../src/third_party/wolfssl/wolfssl/wolfcrypt/src/ext_xmss.c ../src/third_party/wolfssl/wolfssl/wolfcrypt/src/ge_448.c ../src/third_party/wolfssl/wolfssl/wolfcrypt/src/pkcs7.c ../src/third_party/wolfssl/wolfssl/wolfcrypt/src/sp_cortexm.c ../src/third_party/wolfssl/wolfssl/wolfcrypt/src/wc_port.c ../src/third_party/wolfssl/wolfssl/wolfcrypt/src/ed25519.c ../src/third_party/wolfssl/wolfssl/wolfcrypt/src/sha512.c ../src/third_party/wolfssl/wolfssl/wolfcrypt/src/memory.c ../src/third_party/wolfssl/wolfssl/wolfcrypt/src/blake2b.c ../src/third_party/wolfssl/wolfssl/wolfcrypt/src/curve25519.c ../src/third_party/wolfssl/wolfssl/wolfcrypt/src/misc.c ../src/third_party/wolfssl/wolfssl/wolfcrypt/src/sp_sm2_c32.c ../src/third_party/wolfssl/wolfssl/wolfcrypt/src/random.c ../src/third_party/wolfssl/wolfssl/wolfcrypt/src/rc2.c ../src/third_party/wolfssl/wolfssl/wolfcrypt/src/ge_low_mem.c ../src/third_party/wolfssl/wolfssl/wolfcrypt/src/sp_sm2_arm32.c ../src/third_party/wolfssl/wolfssl/wolfcrypt/src/blake2s.c ../src/third_party/wolfssl/wolfssl/wolfcrypt/src/sp_sm2_c64.c ../src/third_party/wolfssl/wolfssl/wolfcrypt/src/sp_c64.c ../src/third_party/wolfssl/wolfssl/wolfcrypt/src/wc_encrypt.c ../src/third_party/wolfssl/wolfssl/wolfcrypt/src/wc_lms_impl.c ../src/third_party/wolfssl/wolfssl/wolfcrypt/src/hpke.c ../src/third_party/wolfssl/wolfssl/wolfcrypt/src/ecc.c ../src/third_party/wolfssl/wolfssl/wolfcrypt/src/evp.c ../src/third_party/wolfssl/wolfssl/wolfcrypt/src/sp_arm64.c ../src/third_party/wolfssl/wolfssl/wolfcrypt/src/wc_kyber.c ../src/third_party/wolfssl/wolfssl/wolfcrypt/src/wolfevent.c ../src/third_party/wolfssl/wolfssl/wolfcrypt/src/integer.c ../src/third_party/wolfssl/wolfssl/wolfcrypt/src/ge_operations.c ../src/third_party/wolfssl/wolfssl/wolfcrypt/src/sp_dsp32.c ../src/third_party/wolfssl/wolfssl/wolfcrypt/src/sp_c32.c ../src/third_party/wolfssl/wolfssl/wolfcrypt/src/dilithium.c ../src/third_party/wolfssl/wolfssl/wolfcrypt/src/chacha20_poly1305.c ../src/third_party/wolfssl/wolfssl/wolfcrypt/src/wc_pkcs11.c ../src/third_party/wolfssl/wolfssl/wolfcrypt/src/wc_kyber_poly.c ../src/third_party/wolfssl/wolfssl/wolfcrypt/src/curve448.c ../src/third_party/wolfssl/wolfssl/wolfcrypt/src/fe_448.c ../src/third_party/wolfssl/src/x509.c ../src/third_party/wolfssl/src/ssl_bn.c ../src/third_party/wolfssl/src/keys.c ../src/third_party/wolfssl/src/x509_str.c ../src/third_party/wolfssl/src/tls13.c ../src/third_party/wolfssl/src/ssl_certman.c ../src/third_party/wolfssl/src/ocsp.c ../src/third_party/wolfssl/src/internal.c ../src/third_party/wolfssl/src/pk.c ../src/third_party/wolfssl/src/quic.c ../src/third_party/wolfssl/src/ssl_crypto.c ../src/third_party/wolfssl/src/ssl_misc.c ../src/third_party/wolfssl/src/ssl.c ../src/third_party/wolfssl/src/wolfio.c ../src/third_party/wolfssl/src/sniffer.c ../src/third_party/wolfssl/src/ssl_asn1.c ../src/third_party/wolfssl/src/tls.c ../src/third_party/wolfssl/src/dtls13.c ../src/third_party/wolfssl/src/dtls.c ../src/third_party/wolfssl/src/crl.c ../src/third_party/wolfssl/src/conf.c ../src/third_party/zlib/zutil.c ../src/third_party/zlib/crc32.c ../src/third_party/zlib/deflate.c ../src/third_party/zlib/adler32.c ../src/third_party/zlib/uncompr.c ../src/third_party/zlib/inflate.c ../src/third_party/zlib/trees.c ../src/third_party/zlib/inffast.c ../src/third_party/zlib/infback.c ../src/third_party/zlib/compress.c ../src/third_party/zlib/gzclose.c ../src/third_party/zlib/inftrees.c ../src/main.c ../src/http_server_print.c ../src/custom_http_server_app.c ../src/custom_snmp_app.c ../src/app_mqtt_task.c ../src/custom_http_app.c ../src/http_print.c ../src/config/default/system/console/src/sys_console_uart.c ../src/config/default/driver/usb/usbfs/src/drv_usbfs_host.c ../src/config/default/system/debug/src/sys_debug.c
 
 # Object Files Quoted if spaced
-OBJECTFILES_QUOTED_IF_SPACED=${OBJECTDIR}/_ext/1434821282/bsp.o ${OBJECTDIR}/_ext/1645245335/crypto.o ${OBJECTDIR}/_ext/732082881/drv_eth_pic32_lib.o ${OBJECTDIR}/_ext/732082881/drv_ethmac_lib.o ${OBJECTDIR}/_ext/732082881/drv_ethmac.o ${OBJECTDIR}/_ext/444070925/drv_ethphy.o ${OBJECTDIR}/_ext/444070925/drv_extphy_dp83848.o ${OBJECTDIR}/_ext/992804092/drv_memory.o ${OBJECTDIR}/_ext/438849557/drv_miim_pic32m.o ${OBJECTDIR}/_ext/438849557/drv_miim.o ${OBJECTDIR}/_ext/2128569739/drv_usbfs.o ${OBJECTDIR}/_ext/1433595199/trust_pkcs11_config.o ${OBJECTDIR}/_ext/35538813/atcacert_pem.o ${OBJECTDIR}/_ext/35538813/atcacert_der.o ${OBJECTDIR}/_ext/35538813/atcacert_date.o ${OBJECTDIR}/_ext/35538813/atcacert_def.o ${OBJECTDIR}/_ext/35538813/atcacert_host_sw.o ${OBJECTDIR}/_ext/35538813/atcacert_host_hw.o ${OBJECTDIR}/_ext/35538813/atcacert_client.o ${OBJECTDIR}/_ext/2017208766/sha2_routines.o ${OBJECTDIR}/_ext/2017208766/sha1_routines.o ${OBJECTDIR}/_ext/1352206537/atca_crypto_hw_aes_ccm.o ${OBJECTDIR}/_ext/1352206537/atca_crypto_hw_aes_cbcmac.o ${OBJECTDIR}/_ext/1352206537/atca_crypto_sw_sha2.o ${OBJECTDIR}/_ext/1352206537/atca_crypto_pad.o ${OBJECTDIR}/_ext/1352206537/atca_crypto_sw_aes_cmac.o ${OBJECTDIR}/_ext/1352206537/atca_crypto_hw_aes_cmac.o ${OBJECTDIR}/_ext/1352206537/atca_crypto_pbkdf2.o ${OBJECTDIR}/_ext/1352206537/atca_crypto_sw_aes_gcm.o ${OBJECTDIR}/_ext/1352206537/atca_crypto_hw_aes_ctr.o ${OBJECTDIR}/_ext/1352206537/atca_crypto_sw_sha1.o ${OBJECTDIR}/_ext/1352206537/atca_crypto_hw_aes_cbc.o ${OBJECTDIR}/_ext/1390037109/hal_gpio_harmony.o ${OBJECTDIR}/_ext/1390037109/hal_pic32_delay.o ${OBJECTDIR}/_ext/1390037109/kit_protocol.o ${OBJECTDIR}/_ext/1390037109/atca_hal.o ${OBJECTDIR}/_ext/1390037109/hal_freertos.o ${OBJECTDIR}/_ext/1390034497/atca_jwt.o ${OBJECTDIR}/_ext/403825799/ascii_kit_host.o ${OBJECTDIR}/_ext/1717266195/pkcs11_signature.o ${OBJECTDIR}/_ext/1717266195/pkcs11_attrib.o ${OBJECTDIR}/_ext/1717266195/pkcs11_key.o ${OBJECTDIR}/_ext/1717266195/pkcs11_debug.o ${OBJECTDIR}/_ext/1717266195/pkcs11_info.o ${OBJECTDIR}/_ext/1717266195/pkcs11_init.o ${OBJECTDIR}/_ext/1717266195/pkcs11_token.o ${OBJECTDIR}/_ext/1717266195/pkcs11_slot.o ${OBJECTDIR}/_ext/1717266195/pkcs11_main.o ${OBJECTDIR}/_ext/1717266195/pkcs11_encrypt.o ${OBJECTDIR}/_ext/1717266195/pkcs11_object.o ${OBJECTDIR}/_ext/1717266195/pkcs11_cert.o ${OBJECTDIR}/_ext/1717266195/pkcs11_util.o ${OBJECTDIR}/_ext/1717266195/pkcs11_os.o ${OBJECTDIR}/_ext/1717266195/pkcs11_config.o ${OBJECTDIR}/_ext/1717266195/pkcs11_session.o ${OBJECTDIR}/_ext/1717266195/pkcs11_find.o ${OBJECTDIR}/_ext/1717266195/pkcs11_mech.o ${OBJECTDIR}/_ext/1717266195/pkcs11_digest.o ${OBJECTDIR}/_ext/375000855/atca_tests_updateextra.o ${OBJECTDIR}/_ext/375000855/atca_tests_secureboot.o ${OBJECTDIR}/_ext/375000855/atca_tests_hmac.o ${OBJECTDIR}/_ext/375000855/test_atcab.o ${OBJECTDIR}/_ext/375000855/atca_tests_ecdh.o ${OBJECTDIR}/_ext/375000855/atca_tests_aes_cbcmac.o ${OBJECTDIR}/_ext/375000855/atca_tests_info.o ${OBJECTDIR}/_ext/375000855/atca_tests_sha.o ${OBJECTDIR}/_ext/375000855/atca_tests_sign.o ${OBJECTDIR}/_ext/375000855/atca_tests_privwrite.o ${OBJECTDIR}/_ext/375000855/atca_tests_aes_ccm.o ${OBJECTDIR}/_ext/375000855/atca_tests_read.o ${OBJECTDIR}/_ext/375000855/atca_tests_aes_cmac.o ${OBJECTDIR}/_ext/375000855/atca_tests_aes.o ${OBJECTDIR}/_ext/375000855/atca_tests_write.o ${OBJECTDIR}/_ext/375000855/atca_tests_random.o ${OBJECTDIR}/_ext/375000855/atca_tests_lock.o ${OBJECTDIR}/_ext/375000855/atca_tests_aes_cbc.o ${OBJECTDIR}/_ext/375000855/atca_tests_aes_gcm.o ${OBJECTDIR}/_ext/375000855/atca_tests_helper.o ${OBJECTDIR}/_ext/375000855/atca_tests_kdf.o ${OBJECTDIR}/_ext/375000855/atca_tests_mac.o ${OBJECTDIR}/_ext/375000855/atca_tests_verify.o ${OBJECTDIR}/_ext/375000855/atca_tests_aes_ctr.o ${OBJECTDIR}/_ext/375000855/atca_tests_startup.o ${OBJECTDIR}/_ext/375000855/atca_tests_derivekey.o ${OBJECTDIR}/_ext/375000855/atca_tests_counter.o ${OBJECTDIR}/_ext/375000855/atca_tests_nonce.o ${OBJECTDIR}/_ext/375000855/atca_tests_genkey.o ${OBJECTDIR}/_ext/375000855/atca_tests_buffer.o ${OBJECTDIR}/_ext/375000855/atca_tests_gendig.o ${OBJECTDIR}/_ext/375000855/atca_tests_otpzero.o ${OBJECTDIR}/_ext/375000855/atca_tests_selftest.o ${OBJECTDIR}/_ext/376290765/test_calib.o ${OBJECTDIR}/_ext/376290765/test_calib_config.o ${OBJECTDIR}/_ext/376290765/test_calib_info.o ${OBJECTDIR}/_ext/376290765/test_calib_delete.o ${OBJECTDIR}/_ext/1203793637/test_crypto.o ${OBJECTDIR}/_ext/1203793637/test_crypto_pk.o ${OBJECTDIR}/_ext/1203793637/test_crypto_sha.o ${OBJECTDIR}/_ext/1203793637/test_crypto_aes.o ${OBJECTDIR}/_ext/1203793637/test_crypto_pbkdf2.o ${OBJECTDIR}/_ext/1203793637/test_crypto_pad.o ${OBJECTDIR}/_ext/487095990/test_cert_def_5_device.o ${OBJECTDIR}/_ext/487095990/test_cert_def_16_signer.o ${OBJECTDIR}/_ext/487095990/test_cert_def_12_device.o ${OBJECTDIR}/_ext/487095990/test_atcacert_client.o ${OBJECTDIR}/_ext/487095990/test_atcacert_date.o ${OBJECTDIR}/_ext/487095990/test_atcacert_der_integer.o ${OBJECTDIR}/_ext/487095990/test_cert_def_10_device.o ${OBJECTDIR}/_ext/487095990/test_cert_def_13_signer.o ${OBJECTDIR}/_ext/487095990/test_cert_def_1_signer.o ${OBJECTDIR}/_ext/487095990/test_cert_def_15_device_csr.o ${OBJECTDIR}/_ext/487095990/test_cert_def_11_signer.o ${OBJECTDIR}/_ext/487095990/test_cert_def_9_device.o ${OBJECTDIR}/_ext/487095990/test_cert_def_2_device_csr.o ${OBJECTDIR}/_ext/487095990/test_atcacert_der_ecdsa_sig_value.o ${OBJECTDIR}/_ext/487095990/test_atcacert_host_sw.o ${OBJECTDIR}/_ext/487095990/test_cert_def_7_signer.o ${OBJECTDIR}/_ext/487095990/test_atcacert_host_hw.o ${OBJECTDIR}/_ext/487095990/test_cert_def_4_device.o ${OBJECTDIR}/_ext/487095990/test_cert_def_14_device.o ${OBJECTDIR}/_ext/487095990/test_atcacert_def.o ${OBJECTDIR}/_ext/487095990/test_cert_def_6_device.o ${OBJECTDIR}/_ext/487095990/test_cert_def_3_device.o ${OBJECTDIR}/_ext/487095990/test_atcacert.o ${OBJECTDIR}/_ext/487095990/test_cert_def_0_device.o ${OBJECTDIR}/_ext/487095990/test_cert_def_8_signer.o ${OBJECTDIR}/_ext/487095990/test_atcacert_der_length.o ${OBJECTDIR}/_ext/1164389986/test_hal_basic.o ${OBJECTDIR}/_ext/1164389986/test_hal.o ${OBJECTDIR}/_ext/1362789921/test_integration.o ${OBJECTDIR}/_ext/1362789921/test_mbedtls.o ${OBJECTDIR}/_ext/1164387374/atca_jwt_test.o ${OBJECTDIR}/_ext/597494043/aes_cmac_nist_vectors.o ${OBJECTDIR}/_ext/597494043/pkcs7_pad_vectors.o ${OBJECTDIR}/_ext/597494043/vector_utils.o ${OBJECTDIR}/_ext/597494043/ecdsa_nist_vectors.o ${OBJECTDIR}/_ext/597494043/aes_gcm_nist_vectors.o ${OBJECTDIR}/_ext/597494043/pbkdf2_sha256_vectors.o ${OBJECTDIR}/_ext/597494043/ecdh_nist_vectors.o ${OBJECTDIR}/_ext/141115750/atca_test_console.o ${OBJECTDIR}/_ext/141115750/cmd-processor.o ${OBJECTDIR}/_ext/141115750/atca_test.o ${OBJECTDIR}/_ext/141115750/atca_test_config.o ${OBJECTDIR}/_ext/141115750/atca_utils_atecc608.o ${OBJECTDIR}/_ext/1882585300/unity.o ${OBJECTDIR}/_ext/1882585300/unity_memory.o ${OBJECTDIR}/_ext/1882585300/unity_fixture.o ${OBJECTDIR}/_ext/701127929/atca_cfgs.o ${OBJECTDIR}/_ext/701127929/atca_helpers.o ${OBJECTDIR}/_ext/701127929/atca_iface.o ${OBJECTDIR}/_ext/701127929/atca_basic.o ${OBJECTDIR}/_ext/701127929/atca_device.o ${OBJECTDIR}/_ext/701127929/cal_buffer.o ${OBJECTDIR}/_ext/701127929/atca_debug.o ${OBJECTDIR}/_ext/1033058136/helpers.o ${OBJECTDIR}/_ext/1751889202/sys_fs_shell.o ${OBJECTDIR}/_ext/1033058136/tcpip_heap_internal.o ${OBJECTDIR}/_ext/1033058136/tcpip_notify.o ${OBJECTDIR}/_ext/1033058136/tcpip_manager.o ${OBJECTDIR}/_ext/1033058136/oahash.o ${OBJECTDIR}/_ext/1033058136/tcpip_packet.o ${OBJECTDIR}/_ext/1033058136/tcpip_helpers.o ${OBJECTDIR}/_ext/1033058136/tcpip_helper_c32.o ${OBJECTDIR}/_ext/1033058136/tcpip_heap_alloc.o ${OBJECTDIR}/_ext/1033058136/hash_fnv.o ${OBJECTDIR}/_ext/1033058136/dhcp.o ${OBJECTDIR}/_ext/1033058136/dns.o ${OBJECTDIR}/_ext/1033058136/tcpip_commands.o ${OBJECTDIR}/_ext/1033058136/telnet.o ${OBJECTDIR}/_ext/1033058136/tcpip_announce.o ${OBJECTDIR}/_ext/1033058136/ipv4.o ${OBJECTDIR}/_ext/1033058136/udp.o ${OBJECTDIR}/_ext/1033058136/icmp.o ${OBJECTDIR}/_ext/1033058136/tcp.o ${OBJECTDIR}/_ext/1033058136/arp.o ${OBJECTDIR}/_ext/1033058136/http_server.o ${OBJECTDIR}/_ext/1033058136/berkeley_api.o ${OBJECTDIR}/_ext/1033058136/icmpv6.o ${OBJECTDIR}/_ext/1033058136/http.o ${OBJECTDIR}/_ext/1033058136/sntp.o ${OBJECTDIR}/_ext/1033058136/zero_conf_helper.o ${OBJECTDIR}/_ext/1033058136/ipv6.o ${OBJECTDIR}/_ext/1033058136/smtpc.o ${OBJECTDIR}/_ext/1033058136/dnss.o ${OBJECTDIR}/_ext/1033058136/dhcpv6.o ${OBJECTDIR}/_ext/1033058136/igmp.o ${OBJECTDIR}/_ext/1033058136/ftpc.o ${OBJECTDIR}/_ext/1033058136/zero_conf_multicast_dns.o ${OBJECTDIR}/_ext/1033058136/zero_conf_link_local.o ${OBJECTDIR}/_ext/1033058136/ndp.o ${OBJECTDIR}/_ext/1033058136/iperf.o ${OBJECTDIR}/_ext/1033058136/nbns.o ${OBJECTDIR}/_ext/1033058136/snmpv3.o ${OBJECTDIR}/_ext/1033058136/ftp.o ${OBJECTDIR}/_ext/1033058136/snmpv3_usm.o ${OBJECTDIR}/_ext/1033058136/ddns.o ${OBJECTDIR}/_ext/1033058136/snmp.o ${OBJECTDIR}/_ext/1508031553/net_pres.o ${OBJECTDIR}/_ext/1640433940/net_pres_enc_glue.o ${OBJECTDIR}/_ext/1640433940/net_pres_cert_store.o ${OBJECTDIR}/_ext/1264217935/ota_service.o ${OBJECTDIR}/_ext/1264217935/ota_service_file_handler.o ${OBJECTDIR}/_ext/1264217935/ota_service_transport_ble.o ${OBJECTDIR}/_ext/60163342/plib_adc.o ${OBJECTDIR}/_ext/60165520/plib_clk.o ${OBJECTDIR}/_ext/1249264884/plib_coretimer.o ${OBJECTDIR}/_ext/1865200349/plib_evic.o ${OBJECTDIR}/_ext/1865254177/plib_gpio.o ${OBJECTDIR}/_ext/60176403/plib_nvm.o ${OBJECTDIR}/_ext/60179596/plib_ram.o ${OBJECTDIR}/_ext/1865657120/plib_uart1.o ${OBJECTDIR}/_ext/1865657120/plib_uart2.o ${OBJECTDIR}/_ext/1865657120/plib_uart3.o ${OBJECTDIR}/_ext/1865657120/plib_uart4.o ${OBJECTDIR}/_ext/1529315265/rnbd_interface.o ${OBJECTDIR}/_ext/163028504/xc32_monitor.o ${OBJECTDIR}/_ext/1376093119/sys_command.o ${OBJECTDIR}/_ext/1832805299/sys_console_usb_cdc.o ${OBJECTDIR}/_ext/1832805299/sys_console.o ${OBJECTDIR}/_ext/411819097/ff.o ${OBJECTDIR}/_ext/411819097/ffunicode.o ${OBJECTDIR}/_ext/565198302/diskio.o ${OBJECTDIR}/_ext/1269487135/sys_fs_media_manager.o ${OBJECTDIR}/_ext/1269487135/sys_fs_fat_interface.o ${OBJECTDIR}/_ext/1269487135/sys_fs.o ${OBJECTDIR}/_ext/1000052432/sys_reset.o ${OBJECTDIR}/_ext/101884895/sys_time.o ${OBJECTDIR}/_ext/753841488/sys_time_h2_adapter.o ${OBJECTDIR}/_ext/2056773213/mqtt_net_glue.o ${OBJECTDIR}/_ext/308758920/usb_device_cdc.o ${OBJECTDIR}/_ext/308758920/usb_device_cdc_acm.o ${OBJECTDIR}/_ext/308758920/usb_device.o ${OBJECTDIR}/_ext/308758920/usb_host_generic.o ${OBJECTDIR}/_ext/308758920/usb_host_cdc.o ${OBJECTDIR}/_ext/308758920/usb_host_cdc_acm.o ${OBJECTDIR}/_ext/308758920/usb_host.o ${OBJECTDIR}/_ext/308758920/usb_host_hid.o ${OBJECTDIR}/_ext/1171490990/exceptions.o ${OBJECTDIR}/_ext/1171490990/interrupts.o ${OBJECTDIR}/_ext/1171490990/initialization.o ${OBJECTDIR}/_ext/1171490990/interrupts_a.o ${OBJECTDIR}/_ext/1171490990/freertos_hooks.o ${OBJECTDIR}/_ext/1171490990/usb_device_init_data.o ${OBJECTDIR}/_ext/1665200909/heap_1.o ${OBJECTDIR}/_ext/951553248/port.o ${OBJECTDIR}/_ext/951553248/port_asm.o ${OBJECTDIR}/_ext/404212886/list.o ${OBJECTDIR}/_ext/404212886/timers.o ${OBJECTDIR}/_ext/404212886/queue.o ${OBJECTDIR}/_ext/404212886/event_groups.o ${OBJECTDIR}/_ext/404212886/croutine.o ${OBJECTDIR}/_ext/404212886/stream_buffer.o ${OBJECTDIR}/_ext/404212886/FreeRTOS_tasks.o ${OBJECTDIR}/_ext/603994634/MCHP_pic32mzw1.o ${OBJECTDIR}/_ext/741293594/MQTTClient.o ${OBJECTDIR}/_ext/980053345/MQTTConnectServer.o ${OBJECTDIR}/_ext/980053345/MQTTUnsubscribeServer.o ${OBJECTDIR}/_ext/980053345/MQTTUnsubscribeClient.o ${OBJECTDIR}/_ext/980053345/MQTTConnectClient.o ${OBJECTDIR}/_ext/980053345/MQTTPacket.o ${OBJECTDIR}/_ext/980053345/MQTTSubscribeServer.o ${OBJECTDIR}/_ext/980053345/MQTTDeserializePublish.o ${OBJECTDIR}/_ext/980053345/MQTTSubscribeClient.o ${OBJECTDIR}/_ext/980053345/MQTTFormat.o ${OBJECTDIR}/_ext/980053345/MQTTSerializePublish.o ${OBJECTDIR}/_ext/1018957768/rnbd.o ${OBJECTDIR}/_ext/751086310/mqtt_packet.o ${OBJECTDIR}/_ext/751086310/mqtt_socket.o ${OBJECTDIR}/_ext/751086310/mqtt_client.o ${OBJECTDIR}/_ext/172253694/crypt_sha1_sam11105.o ${OBJECTDIR}/_ext/172253694/crypt_sha512_sam6156.o ${OBJECTDIR}/_ext/172253694/crypt_rsa_pukcl.o ${OBJECTDIR}/_ext/172253694/crypt_sha384_sam6156.o ${OBJECTDIR}/_ext/172253694/crypt_ecc_ba414e.o ${OBJECTDIR}/_ext/172253694/crypt_pukcl_functions.o ${OBJECTDIR}/_ext/172253694/crypt_sha1_sam6156.o ${OBJECTDIR}/_ext/172253694/crypt_sam_u2803.o ${OBJECTDIR}/_ext/172253694/crypt_rng_u2242.o ${OBJECTDIR}/_ext/172253694/crypt_rng_sam6334.o ${OBJECTDIR}/_ext/172253694/pic32mz-crypt.o ${OBJECTDIR}/_ext/172253694/crypt_sha224_sam11105.o ${OBJECTDIR}/_ext/172253694/crypt_sha256_sam6156.o ${OBJECTDIR}/_ext/172253694/crypt_tdes_sam6150.o ${OBJECTDIR}/_ext/172253694/crypt_aes_sam6149.o ${OBJECTDIR}/_ext/172253694/crypt_aes_u2238.o ${OBJECTDIR}/_ext/172253694/crypt_ecc_pukcl.o ${OBJECTDIR}/_ext/172253694/crypt_wolfcryptcb.o ${OBJECTDIR}/_ext/172253694/crypt_sha256_sam11105.o ${OBJECTDIR}/_ext/172253694/crypt_sha224_sam6156.o ${OBJECTDIR}/_ext/1664057780/siphash.o ${OBJECTDIR}/_ext/1664057780/srp.o ${OBJECTDIR}/_ext/1664057780/ext_kyber.o ${OBJECTDIR}/_ext/1664057780/eccsi.o ${OBJECTDIR}/_ext/1664057780/sha.o ${OBJECTDIR}/_ext/1664057780/dsa.o ${OBJECTDIR}/_ext/1664057780/falcon.o ${OBJECTDIR}/_ext/1664057780/arc4.o ${OBJECTDIR}/_ext/1664057780/sha256.o ${OBJECTDIR}/_ext/1664057780/wc_lms.o ${OBJECTDIR}/_ext/1664057780/rsa.o ${OBJECTDIR}/_ext/1664057780/sakke.o ${OBJECTDIR}/_ext/1664057780/error.o ${OBJECTDIR}/_ext/1664057780/md5.o ${OBJECTDIR}/_ext/1664057780/tfm.o ${OBJECTDIR}/_ext/1664057780/aes.o ${OBJECTDIR}/_ext/1664057780/sp_sm2_arm64.o ${OBJECTDIR}/_ext/1664057780/logging.o ${OBJECTDIR}/_ext/1664057780/dh.o ${OBJECTDIR}/_ext/1664057780/cmac.o ${OBJECTDIR}/_ext/1664057780/signature.o ${OBJECTDIR}/_ext/1664057780/sp_int.o ${OBJECTDIR}/_ext/1664057780/md4.o ${OBJECTDIR}/_ext/1664057780/wc_dsp.o ${OBJECTDIR}/_ext/1664057780/sp_x86_64.o ${OBJECTDIR}/_ext/1664057780/sp_sm2_armthumb.o ${OBJECTDIR}/_ext/1664057780/asm.o ${OBJECTDIR}/_ext/1664057780/poly1305.o ${OBJECTDIR}/_ext/1664057780/hmac.o ${OBJECTDIR}/_ext/1664057780/sm4.o ${OBJECTDIR}/_ext/1664057780/compress.o ${OBJECTDIR}/_ext/1664057780/hash.o ${OBJECTDIR}/_ext/1664057780/asn.o ${OBJECTDIR}/_ext/1664057780/pwdbased.o ${OBJECTDIR}/_ext/1664057780/md2.o ${OBJECTDIR}/_ext/1664057780/ext_lms.o ${OBJECTDIR}/_ext/1664057780/sp_armthumb.o ${OBJECTDIR}/_ext/1664057780/ed448.o ${OBJECTDIR}/_ext/1664057780/coding.o ${OBJECTDIR}/_ext/1664057780/ecc_fp.o ${OBJECTDIR}/_ext/1664057780/kdf.o ${OBJECTDIR}/_ext/1664057780/cpuid.o ${OBJECTDIR}/_ext/1664057780/sm2.o ${OBJECTDIR}/_ext/1664057780/ripemd.o ${OBJECTDIR}/_ext/1664057780/sp_sm2_cortexm.o ${OBJECTDIR}/_ext/1664057780/sp_sm2_x86_64.o ${OBJECTDIR}/_ext/1664057780/sphincs.o ${OBJECTDIR}/_ext/1664057780/fe_low_mem.o ${OBJECTDIR}/_ext/1664057780/sm3.o ${OBJECTDIR}/_ext/1664057780/pkcs12.o ${OBJECTDIR}/_ext/1664057780/wolfmath.o ${OBJECTDIR}/_ext/1664057780/sp_arm32.o ${OBJECTDIR}/_ext/1664057780/chacha.o ${OBJECTDIR}/_ext/1664057780/wc_xmss.o ${OBJECTDIR}/_ext/1664057780/sha3.o ${OBJECTDIR}/_ext/1664057780/fe_operations.o ${OBJECTDIR}/_ext/1664057780/camellia.o ${OBJECTDIR}/_ext/1664057780/cryptocb.o ${OBJECTDIR}/_ext/1664057780/wc_xmss_impl.o ${OBJECTDIR}/_ext/1664057780/des3.o ${OBJECTDIR}/_ext/1664057780/ext_xmss.o ${OBJECTDIR}/_ext/1664057780/ge_448.o ${OBJECTDIR}/_ext/1664057780/pkcs7.o ${OBJECTDIR}/_ext/1664057780/sp_cortexm.o ${OBJECTDIR}/_ext/1664057780/wc_port.o ${OBJECTDIR}/_ext/1664057780/ed25519.o ${OBJECTDIR}/_ext/1664057780/sha512.o ${OBJECTDIR}/_ext/1664057780/memory.o ${OBJECTDIR}/_ext/1664057780/blake2b.o ${OBJECTDIR}/_ext/1664057780/curve25519.o ${OBJECTDIR}/_ext/1664057780/misc.o ${OBJECTDIR}/_ext/1664057780/sp_sm2_c32.o ${OBJECTDIR}/_ext/1664057780/random.o ${OBJECTDIR}/_ext/1664057780/rc2.o ${OBJECTDIR}/_ext/1664057780/ge_low_mem.o ${OBJECTDIR}/_ext/1664057780/sp_sm2_arm32.o ${OBJECTDIR}/_ext/1664057780/blake2s.o ${OBJECTDIR}/_ext/1664057780/sp_sm2_c64.o ${OBJECTDIR}/_ext/1664057780/sp_c64.o ${OBJECTDIR}/_ext/1664057780/wc_encrypt.o ${OBJECTDIR}/_ext/1664057780/wc_lms_impl.o ${OBJECTDIR}/_ext/1664057780/hpke.o ${OBJECTDIR}/_ext/1664057780/ecc.o ${OBJECTDIR}/_ext/1664057780/evp.o ${OBJECTDIR}/_ext/1664057780/sp_arm64.o ${OBJECTDIR}/_ext/1664057780/wc_kyber.o ${OBJECTDIR}/_ext/1664057780/wolfevent.o ${OBJECTDIR}/_ext/1664057780/integer.o ${OBJECTDIR}/_ext/1664057780/ge_operations.o ${OBJECTDIR}/_ext/1664057780/sp_dsp32.o ${OBJECTDIR}/_ext/1664057780/sp_c32.o ${OBJECTDIR}/_ext/1664057780/dilithium.o ${OBJECTDIR}/_ext/1664057780/chacha20_poly1305.o ${OBJECTDIR}/_ext/1664057780/wc_pkcs11.o ${OBJECTDIR}/_ext/1664057780/wc_kyber_poly.o ${OBJECTDIR}/_ext/1664057780/curve448.o ${OBJECTDIR}/_ext/1664057780/fe_448.o ${OBJECTDIR}/_ext/2046716756/x509.o ${OBJECTDIR}/_ext/2046716756/ssl_bn.o ${OBJECTDIR}/_ext/2046716756/keys.o ${OBJECTDIR}/_ext/2046716756/x509_str.o ${OBJECTDIR}/_ext/2046716756/tls13.o ${OBJECTDIR}/_ext/2046716756/ssl_certman.o ${OBJECTDIR}/_ext/2046716756/ocsp.o ${OBJECTDIR}/_ext/2046716756/internal.o ${OBJECTDIR}/_ext/2046716756/pk.o ${OBJECTDIR}/_ext/2046716756/quic.o ${OBJECTDIR}/_ext/2046716756/ssl_crypto.o ${OBJECTDIR}/_ext/2046716756/ssl_misc.o ${OBJECTDIR}/_ext/2046716756/ssl.o ${OBJECTDIR}/_ext/2046716756/wolfio.o ${OBJECTDIR}/_ext/2046716756/sniffer.o ${OBJECTDIR}/_ext/2046716756/ssl_asn1.o ${OBJECTDIR}/_ext/2046716756/tls.o ${OBJECTDIR}/_ext/2046716756/dtls13.o ${OBJECTDIR}/_ext/2046716756/dtls.o ${OBJECTDIR}/_ext/2046716756/crl.o ${OBJECTDIR}/_ext/2046716756/conf.o ${OBJECTDIR}/_ext/905221350/zutil.o ${OBJECTDIR}/_ext/905221350/crc32.o ${OBJECTDIR}/_ext/905221350/deflate.o ${OBJECTDIR}/_ext/905221350/adler32.o ${OBJECTDIR}/_ext/905221350/uncompr.o ${OBJECTDIR}/_ext/905221350/inflate.o ${OBJECTDIR}/_ext/905221350/trees.o ${OBJECTDIR}/_ext/905221350/inffast.o ${OBJECTDIR}/_ext/905221350/infback.o ${OBJECTDIR}/_ext/905221350/compress.o ${OBJECTDIR}/_ext/905221350/gzclose.o ${OBJECTDIR}/_ext/905221350/inftrees.o ${OBJECTDIR}/_ext/1360937237/main.o ${OBJECTDIR}/_ext/1360937237/http_server_print.o ${OBJECTDIR}/_ext/1360937237/custom_http_server_app.o ${OBJECTDIR}/_ext/1360937237/custom_snmp_app.o ${OBJECTDIR}/_ext/1360937237/app_mqtt_task.o ${OBJECTDIR}/_ext/1360937237/custom_http_app.o ${OBJECTDIR}/_ext/1360937237/http_print.o ${OBJECTDIR}/_ext/1832805299/sys_console_uart.o ${OBJECTDIR}/_ext/2128569739/drv_usbfs_host.o ${OBJECTDIR}/_ext/944882569/sys_debug.o
-POSSIBLE_DEPFILES=${OBJECTDIR}/_ext/1434821282/bsp.o.d ${OBJECTDIR}/_ext/1645245335/crypto.o.d ${OBJECTDIR}/_ext/732082881/drv_eth_pic32_lib.o.d ${OBJECTDIR}/_ext/732082881/drv_ethmac_lib.o.d ${OBJECTDIR}/_ext/732082881/drv_ethmac.o.d ${OBJECTDIR}/_ext/444070925/drv_ethphy.o.d ${OBJECTDIR}/_ext/444070925/drv_extphy_dp83848.o.d ${OBJECTDIR}/_ext/992804092/drv_memory.o.d ${OBJECTDIR}/_ext/438849557/drv_miim_pic32m.o.d ${OBJECTDIR}/_ext/438849557/drv_miim.o.d ${OBJECTDIR}/_ext/2128569739/drv_usbfs.o.d ${OBJECTDIR}/_ext/1433595199/trust_pkcs11_config.o.d ${OBJECTDIR}/_ext/35538813/atcacert_pem.o.d ${OBJECTDIR}/_ext/35538813/atcacert_der.o.d ${OBJECTDIR}/_ext/35538813/atcacert_date.o.d ${OBJECTDIR}/_ext/35538813/atcacert_def.o.d ${OBJECTDIR}/_ext/35538813/atcacert_host_sw.o.d ${OBJECTDIR}/_ext/35538813/atcacert_host_hw.o.d ${OBJECTDIR}/_ext/35538813/atcacert_client.o.d ${OBJECTDIR}/_ext/2017208766/sha2_routines.o.d ${OBJECTDIR}/_ext/2017208766/sha1_routines.o.d ${OBJECTDIR}/_ext/1352206537/atca_crypto_hw_aes_ccm.o.d ${OBJECTDIR}/_ext/1352206537/atca_crypto_hw_aes_cbcmac.o.d ${OBJECTDIR}/_ext/1352206537/atca_crypto_sw_sha2.o.d ${OBJECTDIR}/_ext/1352206537/atca_crypto_pad.o.d ${OBJECTDIR}/_ext/1352206537/atca_crypto_sw_aes_cmac.o.d ${OBJECTDIR}/_ext/1352206537/atca_crypto_hw_aes_cmac.o.d ${OBJECTDIR}/_ext/1352206537/atca_crypto_pbkdf2.o.d ${OBJECTDIR}/_ext/1352206537/atca_crypto_sw_aes_gcm.o.d ${OBJECTDIR}/_ext/1352206537/atca_crypto_hw_aes_ctr.o.d ${OBJECTDIR}/_ext/1352206537/atca_crypto_sw_sha1.o.d ${OBJECTDIR}/_ext/1352206537/atca_crypto_hw_aes_cbc.o.d ${OBJECTDIR}/_ext/1390037109/hal_gpio_harmony.o.d ${OBJECTDIR}/_ext/1390037109/hal_pic32_delay.o.d ${OBJECTDIR}/_ext/1390037109/kit_protocol.o.d ${OBJECTDIR}/_ext/1390037109/atca_hal.o.d ${OBJECTDIR}/_ext/1390037109/hal_freertos.o.d ${OBJECTDIR}/_ext/1390034497/atca_jwt.o.d ${OBJECTDIR}/_ext/403825799/ascii_kit_host.o.d ${OBJECTDIR}/_ext/1717266195/pkcs11_signature.o.d ${OBJECTDIR}/_ext/1717266195/pkcs11_attrib.o.d ${OBJECTDIR}/_ext/1717266195/pkcs11_key.o.d ${OBJECTDIR}/_ext/1717266195/pkcs11_debug.o.d ${OBJECTDIR}/_ext/1717266195/pkcs11_info.o.d ${OBJECTDIR}/_ext/1717266195/pkcs11_init.o.d ${OBJECTDIR}/_ext/1717266195/pkcs11_token.o.d ${OBJECTDIR}/_ext/1717266195/pkcs11_slot.o.d ${OBJECTDIR}/_ext/1717266195/pkcs11_main.o.d ${OBJECTDIR}/_ext/1717266195/pkcs11_encrypt.o.d ${OBJECTDIR}/_ext/1717266195/pkcs11_object.o.d ${OBJECTDIR}/_ext/1717266195/pkcs11_cert.o.d ${OBJECTDIR}/_ext/1717266195/pkcs11_util.o.d ${OBJECTDIR}/_ext/1717266195/pkcs11_os.o.d ${OBJECTDIR}/_ext/1717266195/pkcs11_config.o.d ${OBJECTDIR}/_ext/1717266195/pkcs11_session.o.d ${OBJECTDIR}/_ext/1717266195/pkcs11_find.o.d ${OBJECTDIR}/_ext/1717266195/pkcs11_mech.o.d ${OBJECTDIR}/_ext/1717266195/pkcs11_digest.o.d ${OBJECTDIR}/_ext/375000855/atca_tests_updateextra.o.d ${OBJECTDIR}/_ext/375000855/atca_tests_secureboot.o.d ${OBJECTDIR}/_ext/375000855/atca_tests_hmac.o.d ${OBJECTDIR}/_ext/375000855/test_atcab.o.d ${OBJECTDIR}/_ext/375000855/atca_tests_ecdh.o.d ${OBJECTDIR}/_ext/375000855/atca_tests_aes_cbcmac.o.d ${OBJECTDIR}/_ext/375000855/atca_tests_info.o.d ${OBJECTDIR}/_ext/375000855/atca_tests_sha.o.d ${OBJECTDIR}/_ext/375000855/atca_tests_sign.o.d ${OBJECTDIR}/_ext/375000855/atca_tests_privwrite.o.d ${OBJECTDIR}/_ext/375000855/atca_tests_aes_ccm.o.d ${OBJECTDIR}/_ext/375000855/atca_tests_read.o.d ${OBJECTDIR}/_ext/375000855/atca_tests_aes_cmac.o.d ${OBJECTDIR}/_ext/375000855/atca_tests_aes.o.d ${OBJECTDIR}/_ext/375000855/atca_tests_write.o.d ${OBJECTDIR}/_ext/375000855/atca_tests_random.o.d ${OBJECTDIR}/_ext/375000855/atca_tests_lock.o.d ${OBJECTDIR}/_ext/375000855/atca_tests_aes_cbc.o.d ${OBJECTDIR}/_ext/375000855/atca_tests_aes_gcm.o.d ${OBJECTDIR}/_ext/375000855/atca_tests_helper.o.d ${OBJECTDIR}/_ext/375000855/atca_tests_kdf.o.d ${OBJECTDIR}/_ext/375000855/atca_tests_mac.o.d ${OBJECTDIR}/_ext/375000855/atca_tests_verify.o.d ${OBJECTDIR}/_ext/375000855/atca_tests_aes_ctr.o.d ${OBJECTDIR}/_ext/375000855/atca_tests_startup.o.d ${OBJECTDIR}/_ext/375000855/atca_tests_derivekey.o.d ${OBJECTDIR}/_ext/375000855/atca_tests_counter.o.d ${OBJECTDIR}/_ext/375000855/atca_tests_nonce.o.d ${OBJECTDIR}/_ext/375000855/atca_tests_genkey.o.d ${OBJECTDIR}/_ext/375000855/atca_tests_buffer.o.d ${OBJECTDIR}/_ext/375000855/atca_tests_gendig.o.d ${OBJECTDIR}/_ext/375000855/atca_tests_otpzero.o.d ${OBJECTDIR}/_ext/375000855/atca_tests_selftest.o.d ${OBJECTDIR}/_ext/376290765/test_calib.o.d ${OBJECTDIR}/_ext/376290765/test_calib_config.o.d ${OBJECTDIR}/_ext/376290765/test_calib_info.o.d ${OBJECTDIR}/_ext/376290765/test_calib_delete.o.d ${OBJECTDIR}/_ext/1203793637/test_crypto.o.d ${OBJECTDIR}/_ext/1203793637/test_crypto_pk.o.d ${OBJECTDIR}/_ext/1203793637/test_crypto_sha.o.d ${OBJECTDIR}/_ext/1203793637/test_crypto_aes.o.d ${OBJECTDIR}/_ext/1203793637/test_crypto_pbkdf2.o.d ${OBJECTDIR}/_ext/1203793637/test_crypto_pad.o.d ${OBJECTDIR}/_ext/487095990/test_cert_def_5_device.o.d ${OBJECTDIR}/_ext/487095990/test_cert_def_16_signer.o.d ${OBJECTDIR}/_ext/487095990/test_cert_def_12_device.o.d ${OBJECTDIR}/_ext/487095990/test_atcacert_client.o.d ${OBJECTDIR}/_ext/487095990/test_atcacert_date.o.d ${OBJECTDIR}/_ext/487095990/test_atcacert_der_integer.o.d ${OBJECTDIR}/_ext/487095990/test_cert_def_10_device.o.d ${OBJECTDIR}/_ext/487095990/test_cert_def_13_signer.o.d ${OBJECTDIR}/_ext/487095990/test_cert_def_1_signer.o.d ${OBJECTDIR}/_ext/487095990/test_cert_def_15_device_csr.o.d ${OBJECTDIR}/_ext/487095990/test_cert_def_11_signer.o.d ${OBJECTDIR}/_ext/487095990/test_cert_def_9_device.o.d ${OBJECTDIR}/_ext/487095990/test_cert_def_2_device_csr.o.d ${OBJECTDIR}/_ext/487095990/test_atcacert_der_ecdsa_sig_value.o.d ${OBJECTDIR}/_ext/487095990/test_atcacert_host_sw.o.d ${OBJECTDIR}/_ext/487095990/test_cert_def_7_signer.o.d ${OBJECTDIR}/_ext/487095990/test_atcacert_host_hw.o.d ${OBJECTDIR}/_ext/487095990/test_cert_def_4_device.o.d ${OBJECTDIR}/_ext/487095990/test_cert_def_14_device.o.d ${OBJECTDIR}/_ext/487095990/test_atcacert_def.o.d ${OBJECTDIR}/_ext/487095990/test_cert_def_6_device.o.d ${OBJECTDIR}/_ext/487095990/test_cert_def_3_device.o.d ${OBJECTDIR}/_ext/487095990/test_atcacert.o.d ${OBJECTDIR}/_ext/487095990/test_cert_def_0_device.o.d ${OBJECTDIR}/_ext/487095990/test_cert_def_8_signer.o.d ${OBJECTDIR}/_ext/487095990/test_atcacert_der_length.o.d ${OBJECTDIR}/_ext/1164389986/test_hal_basic.o.d ${OBJECTDIR}/_ext/1164389986/test_hal.o.d ${OBJECTDIR}/_ext/1362789921/test_integration.o.d ${OBJECTDIR}/_ext/1362789921/test_mbedtls.o.d ${OBJECTDIR}/_ext/1164387374/atca_jwt_test.o.d ${OBJECTDIR}/_ext/597494043/aes_cmac_nist_vectors.o.d ${OBJECTDIR}/_ext/597494043/pkcs7_pad_vectors.o.d ${OBJECTDIR}/_ext/597494043/vector_utils.o.d ${OBJECTDIR}/_ext/597494043/ecdsa_nist_vectors.o.d ${OBJECTDIR}/_ext/597494043/aes_gcm_nist_vectors.o.d ${OBJECTDIR}/_ext/597494043/pbkdf2_sha256_vectors.o.d ${OBJECTDIR}/_ext/597494043/ecdh_nist_vectors.o.d ${OBJECTDIR}/_ext/141115750/atca_test_console.o.d ${OBJECTDIR}/_ext/141115750/cmd-processor.o.d ${OBJECTDIR}/_ext/141115750/atca_test.o.d ${OBJECTDIR}/_ext/141115750/atca_test_config.o.d ${OBJECTDIR}/_ext/141115750/atca_utils_atecc608.o.d ${OBJECTDIR}/_ext/1882585300/unity.o.d ${OBJECTDIR}/_ext/1882585300/unity_memory.o.d ${OBJECTDIR}/_ext/1882585300/unity_fixture.o.d ${OBJECTDIR}/_ext/701127929/atca_cfgs.o.d ${OBJECTDIR}/_ext/701127929/atca_helpers.o.d ${OBJECTDIR}/_ext/701127929/atca_iface.o.d ${OBJECTDIR}/_ext/701127929/atca_basic.o.d ${OBJECTDIR}/_ext/701127929/atca_device.o.d ${OBJECTDIR}/_ext/701127929/cal_buffer.o.d ${OBJECTDIR}/_ext/701127929/atca_debug.o.d ${OBJECTDIR}/_ext/1033058136/helpers.o.d ${OBJECTDIR}/_ext/1751889202/sys_fs_shell.o.d ${OBJECTDIR}/_ext/1033058136/tcpip_heap_internal.o.d ${OBJECTDIR}/_ext/1033058136/tcpip_notify.o.d ${OBJECTDIR}/_ext/1033058136/tcpip_manager.o.d ${OBJECTDIR}/_ext/1033058136/oahash.o.d ${OBJECTDIR}/_ext/1033058136/tcpip_packet.o.d ${OBJECTDIR}/_ext/1033058136/tcpip_helpers.o.d ${OBJECTDIR}/_ext/1033058136/tcpip_helper_c32.o.d ${OBJECTDIR}/_ext/1033058136/tcpip_heap_alloc.o.d ${OBJECTDIR}/_ext/1033058136/hash_fnv.o.d ${OBJECTDIR}/_ext/1033058136/dhcp.o.d ${OBJECTDIR}/_ext/1033058136/dns.o.d ${OBJECTDIR}/_ext/1033058136/tcpip_commands.o.d ${OBJECTDIR}/_ext/1033058136/telnet.o.d ${OBJECTDIR}/_ext/1033058136/tcpip_announce.o.d ${OBJECTDIR}/_ext/1033058136/ipv4.o.d ${OBJECTDIR}/_ext/1033058136/udp.o.d ${OBJECTDIR}/_ext/1033058136/icmp.o.d ${OBJECTDIR}/_ext/1033058136/tcp.o.d ${OBJECTDIR}/_ext/1033058136/arp.o.d ${OBJECTDIR}/_ext/1033058136/http_server.o.d ${OBJECTDIR}/_ext/1033058136/berkeley_api.o.d ${OBJECTDIR}/_ext/1033058136/icmpv6.o.d ${OBJECTDIR}/_ext/1033058136/http.o.d ${OBJECTDIR}/_ext/1033058136/sntp.o.d ${OBJECTDIR}/_ext/1033058136/zero_conf_helper.o.d ${OBJECTDIR}/_ext/1033058136/ipv6.o.d ${OBJECTDIR}/_ext/1033058136/smtpc.o.d ${OBJECTDIR}/_ext/1033058136/dnss.o.d ${OBJECTDIR}/_ext/1033058136/dhcpv6.o.d ${OBJECTDIR}/_ext/1033058136/igmp.o.d ${OBJECTDIR}/_ext/1033058136/ftpc.o.d ${OBJECTDIR}/_ext/1033058136/zero_conf_multicast_dns.o.d ${OBJECTDIR}/_ext/1033058136/zero_conf_link_local.o.d ${OBJECTDIR}/_ext/1033058136/ndp.o.d ${OBJECTDIR}/_ext/1033058136/iperf.o.d ${OBJECTDIR}/_ext/1033058136/nbns.o.d ${OBJECTDIR}/_ext/1033058136/snmpv3.o.d ${OBJECTDIR}/_ext/1033058136/ftp.o.d ${OBJECTDIR}/_ext/1033058136/snmpv3_usm.o.d ${OBJECTDIR}/_ext/1033058136/ddns.o.d ${OBJECTDIR}/_ext/1033058136/snmp.o.d ${OBJECTDIR}/_ext/1508031553/net_pres.o.d ${OBJECTDIR}/_ext/1640433940/net_pres_enc_glue.o.d ${OBJECTDIR}/_ext/1640433940/net_pres_cert_store.o.d ${OBJECTDIR}/_ext/1264217935/ota_service.o.d ${OBJECTDIR}/_ext/1264217935/ota_service_file_handler.o.d ${OBJECTDIR}/_ext/1264217935/ota_service_transport_ble.o.d ${OBJECTDIR}/_ext/60163342/plib_adc.o.d ${OBJECTDIR}/_ext/60165520/plib_clk.o.d ${OBJECTDIR}/_ext/1249264884/plib_coretimer.o.d ${OBJECTDIR}/_ext/1865200349/plib_evic.o.d ${OBJECTDIR}/_ext/1865254177/plib_gpio.o.d ${OBJECTDIR}/_ext/60176403/plib_nvm.o.d ${OBJECTDIR}/_ext/60179596/plib_ram.o.d ${OBJECTDIR}/_ext/1865657120/plib_uart1.o.d ${OBJECTDIR}/_ext/1865657120/plib_uart2.o.d ${OBJECTDIR}/_ext/1865657120/plib_uart3.o.d ${OBJECTDIR}/_ext/1865657120/plib_uart4.o.d ${OBJECTDIR}/_ext/1529315265/rnbd_interface.o.d ${OBJECTDIR}/_ext/163028504/xc32_monitor.o.d ${OBJECTDIR}/_ext/1376093119/sys_command.o.d ${OBJECTDIR}/_ext/1832805299/sys_console_usb_cdc.o.d ${OBJECTDIR}/_ext/1832805299/sys_console.o.d ${OBJECTDIR}/_ext/411819097/ff.o.d ${OBJECTDIR}/_ext/411819097/ffunicode.o.d ${OBJECTDIR}/_ext/565198302/diskio.o.d ${OBJECTDIR}/_ext/1269487135/sys_fs_media_manager.o.d ${OBJECTDIR}/_ext/1269487135/sys_fs_fat_interface.o.d ${OBJECTDIR}/_ext/1269487135/sys_fs.o.d ${OBJECTDIR}/_ext/1000052432/sys_reset.o.d ${OBJECTDIR}/_ext/101884895/sys_time.o.d ${OBJECTDIR}/_ext/753841488/sys_time_h2_adapter.o.d ${OBJECTDIR}/_ext/2056773213/mqtt_net_glue.o.d ${OBJECTDIR}/_ext/308758920/usb_device_cdc.o.d ${OBJECTDIR}/_ext/308758920/usb_device_cdc_acm.o.d ${OBJECTDIR}/_ext/308758920/usb_device.o.d ${OBJECTDIR}/_ext/308758920/usb_host_generic.o.d ${OBJECTDIR}/_ext/308758920/usb_host_cdc.o.d ${OBJECTDIR}/_ext/308758920/usb_host_cdc_acm.o.d ${OBJECTDIR}/_ext/308758920/usb_host.o.d ${OBJECTDIR}/_ext/308758920/usb_host_hid.o.d ${OBJECTDIR}/_ext/1171490990/exceptions.o.d ${OBJECTDIR}/_ext/1171490990/interrupts.o.d ${OBJECTDIR}/_ext/1171490990/initialization.o.d ${OBJECTDIR}/_ext/1171490990/interrupts_a.o.d ${OBJECTDIR}/_ext/1171490990/freertos_hooks.o.d ${OBJECTDIR}/_ext/1171490990/usb_device_init_data.o.d ${OBJECTDIR}/_ext/1665200909/heap_1.o.d ${OBJECTDIR}/_ext/951553248/port.o.d ${OBJECTDIR}/_ext/951553248/port_asm.o.d ${OBJECTDIR}/_ext/404212886/list.o.d ${OBJECTDIR}/_ext/404212886/timers.o.d ${OBJECTDIR}/_ext/404212886/queue.o.d ${OBJECTDIR}/_ext/404212886/event_groups.o.d ${OBJECTDIR}/_ext/404212886/croutine.o.d ${OBJECTDIR}/_ext/404212886/stream_buffer.o.d ${OBJECTDIR}/_ext/404212886/FreeRTOS_tasks.o.d ${OBJECTDIR}/_ext/603994634/MCHP_pic32mzw1.o.d ${OBJECTDIR}/_ext/741293594/MQTTClient.o.d ${OBJECTDIR}/_ext/980053345/MQTTConnectServer.o.d ${OBJECTDIR}/_ext/980053345/MQTTUnsubscribeServer.o.d ${OBJECTDIR}/_ext/980053345/MQTTUnsubscribeClient.o.d ${OBJECTDIR}/_ext/980053345/MQTTConnectClient.o.d ${OBJECTDIR}/_ext/980053345/MQTTPacket.o.d ${OBJECTDIR}/_ext/980053345/MQTTSubscribeServer.o.d ${OBJECTDIR}/_ext/980053345/MQTTDeserializePublish.o.d ${OBJECTDIR}/_ext/980053345/MQTTSubscribeClient.o.d ${OBJECTDIR}/_ext/980053345/MQTTFormat.o.d ${OBJECTDIR}/_ext/980053345/MQTTSerializePublish.o.d ${OBJECTDIR}/_ext/1018957768/rnbd.o.d ${OBJECTDIR}/_ext/751086310/mqtt_packet.o.d ${OBJECTDIR}/_ext/751086310/mqtt_socket.o.d ${OBJECTDIR}/_ext/751086310/mqtt_client.o.d ${OBJECTDIR}/_ext/172253694/crypt_sha1_sam11105.o.d ${OBJECTDIR}/_ext/172253694/crypt_sha512_sam6156.o.d ${OBJECTDIR}/_ext/172253694/crypt_rsa_pukcl.o.d ${OBJECTDIR}/_ext/172253694/crypt_sha384_sam6156.o.d ${OBJECTDIR}/_ext/172253694/crypt_ecc_ba414e.o.d ${OBJECTDIR}/_ext/172253694/crypt_pukcl_functions.o.d ${OBJECTDIR}/_ext/172253694/crypt_sha1_sam6156.o.d ${OBJECTDIR}/_ext/172253694/crypt_sam_u2803.o.d ${OBJECTDIR}/_ext/172253694/crypt_rng_u2242.o.d ${OBJECTDIR}/_ext/172253694/crypt_rng_sam6334.o.d ${OBJECTDIR}/_ext/172253694/pic32mz-crypt.o.d ${OBJECTDIR}/_ext/172253694/crypt_sha224_sam11105.o.d ${OBJECTDIR}/_ext/172253694/crypt_sha256_sam6156.o.d ${OBJECTDIR}/_ext/172253694/crypt_tdes_sam6150.o.d ${OBJECTDIR}/_ext/172253694/crypt_aes_sam6149.o.d ${OBJECTDIR}/_ext/172253694/crypt_aes_u2238.o.d ${OBJECTDIR}/_ext/172253694/crypt_ecc_pukcl.o.d ${OBJECTDIR}/_ext/172253694/crypt_wolfcryptcb.o.d ${OBJECTDIR}/_ext/172253694/crypt_sha256_sam11105.o.d ${OBJECTDIR}/_ext/172253694/crypt_sha224_sam6156.o.d ${OBJECTDIR}/_ext/1664057780/siphash.o.d ${OBJECTDIR}/_ext/1664057780/srp.o.d ${OBJECTDIR}/_ext/1664057780/ext_kyber.o.d ${OBJECTDIR}/_ext/1664057780/eccsi.o.d ${OBJECTDIR}/_ext/1664057780/sha.o.d ${OBJECTDIR}/_ext/1664057780/dsa.o.d ${OBJECTDIR}/_ext/1664057780/falcon.o.d ${OBJECTDIR}/_ext/1664057780/arc4.o.d ${OBJECTDIR}/_ext/1664057780/sha256.o.d ${OBJECTDIR}/_ext/1664057780/wc_lms.o.d ${OBJECTDIR}/_ext/1664057780/rsa.o.d ${OBJECTDIR}/_ext/1664057780/sakke.o.d ${OBJECTDIR}/_ext/1664057780/error.o.d ${OBJECTDIR}/_ext/1664057780/md5.o.d ${OBJECTDIR}/_ext/1664057780/tfm.o.d ${OBJECTDIR}/_ext/1664057780/aes.o.d ${OBJECTDIR}/_ext/1664057780/sp_sm2_arm64.o.d ${OBJECTDIR}/_ext/1664057780/logging.o.d ${OBJECTDIR}/_ext/1664057780/dh.o.d ${OBJECTDIR}/_ext/1664057780/cmac.o.d ${OBJECTDIR}/_ext/1664057780/signature.o.d ${OBJECTDIR}/_ext/1664057780/sp_int.o.d ${OBJECTDIR}/_ext/1664057780/md4.o.d ${OBJECTDIR}/_ext/1664057780/wc_dsp.o.d ${OBJECTDIR}/_ext/1664057780/sp_x86_64.o.d ${OBJECTDIR}/_ext/1664057780/sp_sm2_armthumb.o.d ${OBJECTDIR}/_ext/1664057780/asm.o.d ${OBJECTDIR}/_ext/1664057780/poly1305.o.d ${OBJECTDIR}/_ext/1664057780/hmac.o.d ${OBJECTDIR}/_ext/1664057780/sm4.o.d ${OBJECTDIR}/_ext/1664057780/compress.o.d ${OBJECTDIR}/_ext/1664057780/hash.o.d ${OBJECTDIR}/_ext/1664057780/asn.o.d ${OBJECTDIR}/_ext/1664057780/pwdbased.o.d ${OBJECTDIR}/_ext/1664057780/md2.o.d ${OBJECTDIR}/_ext/1664057780/ext_lms.o.d ${OBJECTDIR}/_ext/1664057780/sp_armthumb.o.d ${OBJECTDIR}/_ext/1664057780/ed448.o.d ${OBJECTDIR}/_ext/1664057780/coding.o.d ${OBJECTDIR}/_ext/1664057780/ecc_fp.o.d ${OBJECTDIR}/_ext/1664057780/kdf.o.d ${OBJECTDIR}/_ext/1664057780/cpuid.o.d ${OBJECTDIR}/_ext/1664057780/sm2.o.d ${OBJECTDIR}/_ext/1664057780/ripemd.o.d ${OBJECTDIR}/_ext/1664057780/sp_sm2_cortexm.o.d ${OBJECTDIR}/_ext/1664057780/sp_sm2_x86_64.o.d ${OBJECTDIR}/_ext/1664057780/sphincs.o.d ${OBJECTDIR}/_ext/1664057780/fe_low_mem.o.d ${OBJECTDIR}/_ext/1664057780/sm3.o.d ${OBJECTDIR}/_ext/1664057780/pkcs12.o.d ${OBJECTDIR}/_ext/1664057780/wolfmath.o.d ${OBJECTDIR}/_ext/1664057780/sp_arm32.o.d ${OBJECTDIR}/_ext/1664057780/chacha.o.d ${OBJECTDIR}/_ext/1664057780/wc_xmss.o.d ${OBJECTDIR}/_ext/1664057780/sha3.o.d ${OBJECTDIR}/_ext/1664057780/fe_operations.o.d ${OBJECTDIR}/_ext/1664057780/camellia.o.d ${OBJECTDIR}/_ext/1664057780/cryptocb.o.d ${OBJECTDIR}/_ext/1664057780/wc_xmss_impl.o.d ${OBJECTDIR}/_ext/1664057780/des3.o.d ${OBJECTDIR}/_ext/1664057780/ext_xmss.o.d ${OBJECTDIR}/_ext/1664057780/ge_448.o.d ${OBJECTDIR}/_ext/1664057780/pkcs7.o.d ${OBJECTDIR}/_ext/1664057780/sp_cortexm.o.d ${OBJECTDIR}/_ext/1664057780/wc_port.o.d ${OBJECTDIR}/_ext/1664057780/ed25519.o.d ${OBJECTDIR}/_ext/1664057780/sha512.o.d ${OBJECTDIR}/_ext/1664057780/memory.o.d ${OBJECTDIR}/_ext/1664057780/blake2b.o.d ${OBJECTDIR}/_ext/1664057780/curve25519.o.d ${OBJECTDIR}/_ext/1664057780/misc.o.d ${OBJECTDIR}/_ext/1664057780/sp_sm2_c32.o.d ${OBJECTDIR}/_ext/1664057780/random.o.d ${OBJECTDIR}/_ext/1664057780/rc2.o.d ${OBJECTDIR}/_ext/1664057780/ge_low_mem.o.d ${OBJECTDIR}/_ext/1664057780/sp_sm2_arm32.o.d ${OBJECTDIR}/_ext/1664057780/blake2s.o.d ${OBJECTDIR}/_ext/1664057780/sp_sm2_c64.o.d ${OBJECTDIR}/_ext/1664057780/sp_c64.o.d ${OBJECTDIR}/_ext/1664057780/wc_encrypt.o.d ${OBJECTDIR}/_ext/1664057780/wc_lms_impl.o.d ${OBJECTDIR}/_ext/1664057780/hpke.o.d ${OBJECTDIR}/_ext/1664057780/ecc.o.d ${OBJECTDIR}/_ext/1664057780/evp.o.d ${OBJECTDIR}/_ext/1664057780/sp_arm64.o.d ${OBJECTDIR}/_ext/1664057780/wc_kyber.o.d ${OBJECTDIR}/_ext/1664057780/wolfevent.o.d ${OBJECTDIR}/_ext/1664057780/integer.o.d ${OBJECTDIR}/_ext/1664057780/ge_operations.o.d ${OBJECTDIR}/_ext/1664057780/sp_dsp32.o.d ${OBJECTDIR}/_ext/1664057780/sp_c32.o.d ${OBJECTDIR}/_ext/1664057780/dilithium.o.d ${OBJECTDIR}/_ext/1664057780/chacha20_poly1305.o.d ${OBJECTDIR}/_ext/1664057780/wc_pkcs11.o.d ${OBJECTDIR}/_ext/1664057780/wc_kyber_poly.o.d ${OBJECTDIR}/_ext/1664057780/curve448.o.d ${OBJECTDIR}/_ext/1664057780/fe_448.o.d ${OBJECTDIR}/_ext/2046716756/x509.o.d ${OBJECTDIR}/_ext/2046716756/ssl_bn.o.d ${OBJECTDIR}/_ext/2046716756/keys.o.d ${OBJECTDIR}/_ext/2046716756/x509_str.o.d ${OBJECTDIR}/_ext/2046716756/tls13.o.d ${OBJECTDIR}/_ext/2046716756/ssl_certman.o.d ${OBJECTDIR}/_ext/2046716756/ocsp.o.d ${OBJECTDIR}/_ext/2046716756/internal.o.d ${OBJECTDIR}/_ext/2046716756/pk.o.d ${OBJECTDIR}/_ext/2046716756/quic.o.d ${OBJECTDIR}/_ext/2046716756/ssl_crypto.o.d ${OBJECTDIR}/_ext/2046716756/ssl_misc.o.d ${OBJECTDIR}/_ext/2046716756/ssl.o.d ${OBJECTDIR}/_ext/2046716756/wolfio.o.d ${OBJECTDIR}/_ext/2046716756/sniffer.o.d ${OBJECTDIR}/_ext/2046716756/ssl_asn1.o.d ${OBJECTDIR}/_ext/2046716756/tls.o.d ${OBJECTDIR}/_ext/2046716756/dtls13.o.d ${OBJECTDIR}/_ext/2046716756/dtls.o.d ${OBJECTDIR}/_ext/2046716756/crl.o.d ${OBJECTDIR}/_ext/2046716756/conf.o.d ${OBJECTDIR}/_ext/905221350/zutil.o.d ${OBJECTDIR}/_ext/905221350/crc32.o.d ${OBJECTDIR}/_ext/905221350/deflate.o.d ${OBJECTDIR}/_ext/905221350/adler32.o.d ${OBJECTDIR}/_ext/905221350/uncompr.o.d ${OBJECTDIR}/_ext/905221350/inflate.o.d ${OBJECTDIR}/_ext/905221350/trees.o.d ${OBJECTDIR}/_ext/905221350/inffast.o.d ${OBJECTDIR}/_ext/905221350/infback.o.d ${OBJECTDIR}/_ext/905221350/compress.o.d ${OBJECTDIR}/_ext/905221350/gzclose.o.d ${OBJECTDIR}/_ext/905221350/inftrees.o.d ${OBJECTDIR}/_ext/1360937237/main.o.d ${OBJECTDIR}/_ext/1360937237/http_server_print.o.d ${OBJECTDIR}/_ext/1360937237/custom_http_server_app.o.d ${OBJECTDIR}/_ext/1360937237/custom_snmp_app.o.d ${OBJECTDIR}/_ext/1360937237/app_mqtt_task.o.d ${OBJECTDIR}/_ext/1360937237/custom_http_app.o.d ${OBJECTDIR}/_ext/1360937237/http_print.o.d ${OBJECTDIR}/_ext/1832805299/sys_console_uart.o.d ${OBJECTDIR}/_ext/2128569739/drv_usbfs_host.o.d ${OBJECTDIR}/_ext/944882569/sys_debug.o.d
+OBJECTFILES_QUOTED_IF_SPACED=${OBJECTDIR}/_ext/1434821282/bsp.o ${OBJECTDIR}/_ext/1645245335/crypto.o ${OBJECTDIR}/_ext/732082881/drv_eth_pic32_lib.o ${OBJECTDIR}/_ext/732082881/drv_ethmac_lib.o ${OBJECTDIR}/_ext/732082881/drv_ethmac.o ${OBJECTDIR}/_ext/444070925/drv_ethphy.o ${OBJECTDIR}/_ext/444070925/drv_extphy_dp83848.o ${OBJECTDIR}/_ext/992804092/drv_memory.o ${OBJECTDIR}/_ext/438849557/drv_miim_pic32m.o ${OBJECTDIR}/_ext/438849557/drv_miim.o ${OBJECTDIR}/_ext/2128569739/drv_usbfs.o ${OBJECTDIR}/_ext/1433595199/trust_pkcs11_config.o ${OBJECTDIR}/_ext/35538813/atcacert_pem.o ${OBJECTDIR}/_ext/35538813/atcacert_der.o ${OBJECTDIR}/_ext/35538813/atcacert_date.o ${OBJECTDIR}/_ext/35538813/atcacert_def.o ${OBJECTDIR}/_ext/35538813/atcacert_host_sw.o ${OBJECTDIR}/_ext/35538813/atcacert_host_hw.o ${OBJECTDIR}/_ext/35538813/atcacert_client.o ${OBJECTDIR}/_ext/2017208766/sha2_routines.o ${OBJECTDIR}/_ext/2017208766/sha1_routines.o ${OBJECTDIR}/_ext/1352206537/atca_crypto_hw_aes_ccm.o ${OBJECTDIR}/_ext/1352206537/atca_crypto_hw_aes_cbcmac.o ${OBJECTDIR}/_ext/1352206537/atca_crypto_sw_sha2.o ${OBJECTDIR}/_ext/1352206537/atca_crypto_pad.o ${OBJECTDIR}/_ext/1352206537/atca_crypto_sw_aes_cmac.o ${OBJECTDIR}/_ext/1352206537/atca_crypto_hw_aes_cmac.o ${OBJECTDIR}/_ext/1352206537/atca_crypto_pbkdf2.o ${OBJECTDIR}/_ext/1352206537/atca_crypto_sw_aes_gcm.o ${OBJECTDIR}/_ext/1352206537/atca_crypto_hw_aes_ctr.o ${OBJECTDIR}/_ext/1352206537/atca_crypto_sw_sha1.o ${OBJECTDIR}/_ext/1352206537/atca_crypto_hw_aes_cbc.o ${OBJECTDIR}/_ext/1390037109/hal_gpio_harmony.o ${OBJECTDIR}/_ext/1390037109/hal_pic32_delay.o ${OBJECTDIR}/_ext/1390037109/kit_protocol.o ${OBJECTDIR}/_ext/1390037109/atca_hal.o ${OBJECTDIR}/_ext/1390037109/hal_freertos.o ${OBJECTDIR}/_ext/1390034497/atca_jwt.o ${OBJECTDIR}/_ext/403825799/ascii_kit_host.o ${OBJECTDIR}/_ext/1717266195/pkcs11_signature.o ${OBJECTDIR}/_ext/1717266195/pkcs11_attrib.o ${OBJECTDIR}/_ext/1717266195/pkcs11_key.o ${OBJECTDIR}/_ext/1717266195/pkcs11_debug.o ${OBJECTDIR}/_ext/1717266195/pkcs11_info.o ${OBJECTDIR}/_ext/1717266195/pkcs11_init.o ${OBJECTDIR}/_ext/1717266195/pkcs11_token.o ${OBJECTDIR}/_ext/1717266195/pkcs11_slot.o ${OBJECTDIR}/_ext/1717266195/pkcs11_main.o ${OBJECTDIR}/_ext/1717266195/pkcs11_encrypt.o ${OBJECTDIR}/_ext/1717266195/pkcs11_object.o ${OBJECTDIR}/_ext/1717266195/pkcs11_cert.o ${OBJECTDIR}/_ext/1717266195/pkcs11_util.o ${OBJECTDIR}/_ext/1717266195/pkcs11_os.o ${OBJECTDIR}/_ext/1717266195/pkcs11_config.o ${OBJECTDIR}/_ext/1717266195/pkcs11_session.o ${OBJECTDIR}/_ext/1717266195/pkcs11_find.o ${OBJECTDIR}/_ext/1717266195/pkcs11_mech.o ${OBJECTDIR}/_ext/1717266195/pkcs11_digest.o ${OBJECTDIR}/_ext/375000855/atca_tests_updateextra.o ${OBJECTDIR}/_ext/375000855/atca_tests_secureboot.o ${OBJECTDIR}/_ext/375000855/atca_tests_hmac.o ${OBJECTDIR}/_ext/375000855/test_atcab.o ${OBJECTDIR}/_ext/375000855/atca_tests_ecdh.o ${OBJECTDIR}/_ext/375000855/atca_tests_aes_cbcmac.o ${OBJECTDIR}/_ext/375000855/atca_tests_info.o ${OBJECTDIR}/_ext/375000855/atca_tests_sha.o ${OBJECTDIR}/_ext/375000855/atca_tests_sign.o ${OBJECTDIR}/_ext/375000855/atca_tests_privwrite.o ${OBJECTDIR}/_ext/375000855/atca_tests_aes_ccm.o ${OBJECTDIR}/_ext/375000855/atca_tests_read.o ${OBJECTDIR}/_ext/375000855/atca_tests_aes_cmac.o ${OBJECTDIR}/_ext/375000855/atca_tests_aes.o ${OBJECTDIR}/_ext/375000855/atca_tests_write.o ${OBJECTDIR}/_ext/375000855/atca_tests_random.o ${OBJECTDIR}/_ext/375000855/atca_tests_lock.o ${OBJECTDIR}/_ext/375000855/atca_tests_aes_cbc.o ${OBJECTDIR}/_ext/375000855/atca_tests_aes_gcm.o ${OBJECTDIR}/_ext/375000855/atca_tests_helper.o ${OBJECTDIR}/_ext/375000855/atca_tests_kdf.o ${OBJECTDIR}/_ext/375000855/atca_tests_mac.o ${OBJECTDIR}/_ext/375000855/atca_tests_verify.o ${OBJECTDIR}/_ext/375000855/atca_tests_aes_ctr.o ${OBJECTDIR}/_ext/375000855/atca_tests_startup.o ${OBJECTDIR}/_ext/375000855/atca_tests_derivekey.o ${OBJECTDIR}/_ext/375000855/atca_tests_counter.o ${OBJECTDIR}/_ext/375000855/atca_tests_nonce.o ${OBJECTDIR}/_ext/375000855/atca_tests_genkey.o ${OBJECTDIR}/_ext/375000855/atca_tests_buffer.o ${OBJECTDIR}/_ext/375000855/atca_tests_gendig.o ${OBJECTDIR}/_ext/375000855/atca_tests_otpzero.o ${OBJECTDIR}/_ext/375000855/atca_tests_selftest.o ${OBJECTDIR}/_ext/376290765/test_calib.o ${OBJECTDIR}/_ext/376290765/test_calib_config.o ${OBJECTDIR}/_ext/376290765/test_calib_info.o ${OBJECTDIR}/_ext/376290765/test_calib_delete.o ${OBJECTDIR}/_ext/1203793637/test_crypto.o ${OBJECTDIR}/_ext/1203793637/test_crypto_pk.o ${OBJECTDIR}/_ext/1203793637/test_crypto_sha.o ${OBJECTDIR}/_ext/1203793637/test_crypto_aes.o ${OBJECTDIR}/_ext/1203793637/test_crypto_pbkdf2.o ${OBJECTDIR}/_ext/1203793637/test_crypto_pad.o ${OBJECTDIR}/_ext/487095990/test_cert_def_5_device.o ${OBJECTDIR}/_ext/487095990/test_cert_def_16_signer.o ${OBJECTDIR}/_ext/487095990/test_cert_def_12_device.o ${OBJECTDIR}/_ext/487095990/test_atcacert_client.o ${OBJECTDIR}/_ext/487095990/test_atcacert_date.o ${OBJECTDIR}/_ext/487095990/test_atcacert_der_integer.o ${OBJECTDIR}/_ext/487095990/test_cert_def_10_device.o ${OBJECTDIR}/_ext/487095990/test_cert_def_13_signer.o ${OBJECTDIR}/_ext/487095990/test_cert_def_1_signer.o ${OBJECTDIR}/_ext/487095990/test_cert_def_15_device_csr.o ${OBJECTDIR}/_ext/487095990/test_cert_def_11_signer.o ${OBJECTDIR}/_ext/487095990/test_cert_def_9_device.o ${OBJECTDIR}/_ext/487095990/test_cert_def_2_device_csr.o ${OBJECTDIR}/_ext/487095990/test_atcacert_der_ecdsa_sig_value.o ${OBJECTDIR}/_ext/487095990/test_atcacert_host_sw.o ${OBJECTDIR}/_ext/487095990/test_cert_def_7_signer.o ${OBJECTDIR}/_ext/487095990/test_atcacert_host_hw.o ${OBJECTDIR}/_ext/487095990/test_cert_def_4_device.o ${OBJECTDIR}/_ext/487095990/test_cert_def_14_device.o ${OBJECTDIR}/_ext/487095990/test_atcacert_def.o ${OBJECTDIR}/_ext/487095990/test_cert_def_6_device.o ${OBJECTDIR}/_ext/487095990/test_cert_def_3_device.o ${OBJECTDIR}/_ext/487095990/test_atcacert.o ${OBJECTDIR}/_ext/487095990/test_cert_def_0_device.o ${OBJECTDIR}/_ext/487095990/test_cert_def_8_signer.o ${OBJECTDIR}/_ext/487095990/test_atcacert_der_length.o ${OBJECTDIR}/_ext/1164389986/test_hal_basic.o ${OBJECTDIR}/_ext/1164389986/test_hal.o ${OBJECTDIR}/_ext/1362789921/test_integration.o ${OBJECTDIR}/_ext/1362789921/test_mbedtls.o ${OBJECTDIR}/_ext/1164387374/atca_jwt_test.o ${OBJECTDIR}/_ext/597494043/aes_cmac_nist_vectors.o ${OBJECTDIR}/_ext/597494043/pkcs7_pad_vectors.o ${OBJECTDIR}/_ext/597494043/vector_utils.o ${OBJECTDIR}/_ext/597494043/ecdsa_nist_vectors.o ${OBJECTDIR}/_ext/597494043/aes_gcm_nist_vectors.o ${OBJECTDIR}/_ext/597494043/pbkdf2_sha256_vectors.o ${OBJECTDIR}/_ext/597494043/ecdh_nist_vectors.o ${OBJECTDIR}/_ext/141115750/atca_test_console.o ${OBJECTDIR}/_ext/141115750/cmd-processor.o ${OBJECTDIR}/_ext/141115750/atca_test.o ${OBJECTDIR}/_ext/141115750/atca_test_config.o ${OBJECTDIR}/_ext/141115750/atca_utils_atecc608.o ${OBJECTDIR}/_ext/1882585300/unity.o ${OBJECTDIR}/_ext/1882585300/unity_memory.o ${OBJECTDIR}/_ext/1882585300/unity_fixture.o ${OBJECTDIR}/_ext/701127929/atca_cfgs.o ${OBJECTDIR}/_ext/701127929/atca_helpers.o ${OBJECTDIR}/_ext/701127929/atca_iface.o ${OBJECTDIR}/_ext/701127929/atca_basic.o ${OBJECTDIR}/_ext/701127929/atca_device.o ${OBJECTDIR}/_ext/701127929/cal_buffer.o ${OBJECTDIR}/_ext/701127929/atca_debug.o ${OBJECTDIR}/_ext/1033058136/helpers.o ${OBJECTDIR}/_ext/1751889202/sys_fs_shell.o ${OBJECTDIR}/_ext/1033058136/tcpip_heap_internal.o ${OBJECTDIR}/_ext/1033058136/tcpip_heap_class.o ${OBJECTDIR}/_ext/1033058136/tcpip_notify.o ${OBJECTDIR}/_ext/1033058136/tcpip_manager.o ${OBJECTDIR}/_ext/1033058136/oahash.o ${OBJECTDIR}/_ext/1033058136/tcpip_packet.o ${OBJECTDIR}/_ext/1033058136/tcpip_helpers.o ${OBJECTDIR}/_ext/1033058136/tcpip_helper_c32.o ${OBJECTDIR}/_ext/1033058136/tcpip_heap_alloc.o ${OBJECTDIR}/_ext/1033058136/hash_fnv.o ${OBJECTDIR}/_ext/1033058136/dhcp.o ${OBJECTDIR}/_ext/1033058136/dns.o ${OBJECTDIR}/_ext/1033058136/tcpip_commands.o ${OBJECTDIR}/_ext/1033058136/telnet.o ${OBJECTDIR}/_ext/1033058136/tcpip_announce.o ${OBJECTDIR}/_ext/1033058136/ipv4.o ${OBJECTDIR}/_ext/1033058136/udp.o ${OBJECTDIR}/_ext/1033058136/icmp.o ${OBJECTDIR}/_ext/1033058136/tcp.o ${OBJECTDIR}/_ext/1033058136/arp.o ${OBJECTDIR}/_ext/1033058136/http_server.o ${OBJECTDIR}/_ext/1033058136/berkeley_api.o ${OBJECTDIR}/_ext/1033058136/icmpv6.o ${OBJECTDIR}/_ext/1033058136/http.o ${OBJECTDIR}/_ext/1033058136/sntp.o ${OBJECTDIR}/_ext/1033058136/zero_conf_helper.o ${OBJECTDIR}/_ext/1033058136/ipv6.o ${OBJECTDIR}/_ext/1033058136/smtpc.o ${OBJECTDIR}/_ext/1033058136/dnss.o ${OBJECTDIR}/_ext/1033058136/dhcpv6.o ${OBJECTDIR}/_ext/1033058136/igmp.o ${OBJECTDIR}/_ext/1033058136/ftpc.o ${OBJECTDIR}/_ext/1033058136/zero_conf_multicast_dns.o ${OBJECTDIR}/_ext/1033058136/zero_conf_link_local.o ${OBJECTDIR}/_ext/1033058136/ndp.o ${OBJECTDIR}/_ext/1033058136/iperf.o ${OBJECTDIR}/_ext/1033058136/nbns.o ${OBJECTDIR}/_ext/1033058136/snmpv3.o ${OBJECTDIR}/_ext/1033058136/ftp.o ${OBJECTDIR}/_ext/1033058136/snmpv3_usm.o ${OBJECTDIR}/_ext/1033058136/ddns.o ${OBJECTDIR}/_ext/1033058136/snmp.o ${OBJECTDIR}/_ext/1508031553/net_pres.o ${OBJECTDIR}/_ext/1640433940/net_pres_enc_glue.o ${OBJECTDIR}/_ext/1640433940/net_pres_cert_store.o ${OBJECTDIR}/_ext/1264217935/ota_service.o ${OBJECTDIR}/_ext/1264217935/ota_service_file_handler.o ${OBJECTDIR}/_ext/1264217935/ota_service_transport_ble.o ${OBJECTDIR}/_ext/60163342/plib_adc.o ${OBJECTDIR}/_ext/60165520/plib_clk.o ${OBJECTDIR}/_ext/1249264884/plib_coretimer.o ${OBJECTDIR}/_ext/1865200349/plib_evic.o ${OBJECTDIR}/_ext/1865254177/plib_gpio.o ${OBJECTDIR}/_ext/60176403/plib_nvm.o ${OBJECTDIR}/_ext/60179596/plib_ram.o ${OBJECTDIR}/_ext/1865657120/plib_uart1.o ${OBJECTDIR}/_ext/1865657120/plib_uart2.o ${OBJECTDIR}/_ext/1865657120/plib_uart3.o ${OBJECTDIR}/_ext/1865657120/plib_uart4.o ${OBJECTDIR}/_ext/1529315265/rnbd_interface.o ${OBJECTDIR}/_ext/163028504/xc32_monitor.o ${OBJECTDIR}/_ext/1376093119/sys_command.o ${OBJECTDIR}/_ext/1832805299/sys_console_usb_cdc.o ${OBJECTDIR}/_ext/1832805299/sys_console.o ${OBJECTDIR}/_ext/411819097/ff.o ${OBJECTDIR}/_ext/411819097/ffunicode.o ${OBJECTDIR}/_ext/565198302/diskio.o ${OBJECTDIR}/_ext/1269487135/sys_fs_media_manager.o ${OBJECTDIR}/_ext/1269487135/sys_fs_fat_interface.o ${OBJECTDIR}/_ext/1269487135/sys_fs.o ${OBJECTDIR}/_ext/1000052432/sys_reset.o ${OBJECTDIR}/_ext/101884895/sys_time.o ${OBJECTDIR}/_ext/753841488/sys_time_h2_adapter.o ${OBJECTDIR}/_ext/2056773213/mqtt_net_glue.o ${OBJECTDIR}/_ext/308758920/usb_device_cdc.o ${OBJECTDIR}/_ext/308758920/usb_device_cdc_acm.o ${OBJECTDIR}/_ext/308758920/usb_device.o ${OBJECTDIR}/_ext/308758920/usb_host_generic.o ${OBJECTDIR}/_ext/308758920/usb_host_cdc.o ${OBJECTDIR}/_ext/308758920/usb_host_cdc_acm.o ${OBJECTDIR}/_ext/308758920/usb_host.o ${OBJECTDIR}/_ext/308758920/usb_host_hid.o ${OBJECTDIR}/_ext/1171490990/exceptions.o ${OBJECTDIR}/_ext/1171490990/interrupts.o ${OBJECTDIR}/_ext/1171490990/initialization.o ${OBJECTDIR}/_ext/1171490990/interrupts_a.o ${OBJECTDIR}/_ext/1171490990/freertos_hooks.o ${OBJECTDIR}/_ext/1171490990/usb_device_init_data.o ${OBJECTDIR}/_ext/1665200909/heap_1.o ${OBJECTDIR}/_ext/951553248/port.o ${OBJECTDIR}/_ext/951553248/port_asm.o ${OBJECTDIR}/_ext/404212886/list.o ${OBJECTDIR}/_ext/404212886/timers.o ${OBJECTDIR}/_ext/404212886/queue.o ${OBJECTDIR}/_ext/404212886/event_groups.o ${OBJECTDIR}/_ext/404212886/croutine.o ${OBJECTDIR}/_ext/404212886/stream_buffer.o ${OBJECTDIR}/_ext/404212886/FreeRTOS_tasks.o ${OBJECTDIR}/_ext/603994634/MCHP_pic32mzw1.o ${OBJECTDIR}/_ext/741293594/MQTTClient.o ${OBJECTDIR}/_ext/980053345/MQTTConnectServer.o ${OBJECTDIR}/_ext/980053345/MQTTUnsubscribeServer.o ${OBJECTDIR}/_ext/980053345/MQTTUnsubscribeClient.o ${OBJECTDIR}/_ext/980053345/MQTTConnectClient.o ${OBJECTDIR}/_ext/980053345/MQTTPacket.o ${OBJECTDIR}/_ext/980053345/MQTTSubscribeServer.o ${OBJECTDIR}/_ext/980053345/MQTTDeserializePublish.o ${OBJECTDIR}/_ext/980053345/MQTTSubscribeClient.o ${OBJECTDIR}/_ext/980053345/MQTTFormat.o ${OBJECTDIR}/_ext/980053345/MQTTSerializePublish.o ${OBJECTDIR}/_ext/1018957768/rnbd.o ${OBJECTDIR}/_ext/751086310/mqtt_packet.o ${OBJECTDIR}/_ext/751086310/mqtt_socket.o ${OBJECTDIR}/_ext/751086310/mqtt_client.o ${OBJECTDIR}/_ext/172253694/crypt_sha1_sam11105.o ${OBJECTDIR}/_ext/172253694/crypt_sha512_sam6156.o ${OBJECTDIR}/_ext/172253694/crypt_rsa_pukcl.o ${OBJECTDIR}/_ext/172253694/crypt_sha384_sam6156.o ${OBJECTDIR}/_ext/172253694/crypt_ecc_ba414e.o ${OBJECTDIR}/_ext/172253694/crypt_pukcl_functions.o ${OBJECTDIR}/_ext/172253694/crypt_sha1_sam6156.o ${OBJECTDIR}/_ext/172253694/crypt_sam_u2803.o ${OBJECTDIR}/_ext/172253694/crypt_rng_u2242.o ${OBJECTDIR}/_ext/172253694/crypt_rng_sam6334.o ${OBJECTDIR}/_ext/172253694/pic32mz-crypt.o ${OBJECTDIR}/_ext/172253694/crypt_sha224_sam11105.o ${OBJECTDIR}/_ext/172253694/crypt_sha256_sam6156.o ${OBJECTDIR}/_ext/172253694/crypt_tdes_sam6150.o ${OBJECTDIR}/_ext/172253694/crypt_aes_sam6149.o ${OBJECTDIR}/_ext/172253694/crypt_aes_u2238.o ${OBJECTDIR}/_ext/172253694/crypt_ecc_pukcl.o ${OBJECTDIR}/_ext/172253694/crypt_wolfcryptcb.o ${OBJECTDIR}/_ext/172253694/crypt_sha256_sam11105.o ${OBJECTDIR}/_ext/172253694/crypt_sha224_sam6156.o ${OBJECTDIR}/_ext/1664057780/siphash.o ${OBJECTDIR}/_ext/1664057780/srp.o ${OBJECTDIR}/_ext/1664057780/ext_kyber.o ${OBJECTDIR}/_ext/1664057780/eccsi.o ${OBJECTDIR}/_ext/1664057780/sha.o ${OBJECTDIR}/_ext/1664057780/dsa.o ${OBJECTDIR}/_ext/1664057780/falcon.o ${OBJECTDIR}/_ext/1664057780/arc4.o ${OBJECTDIR}/_ext/1664057780/sha256.o ${OBJECTDIR}/_ext/1664057780/wc_lms.o ${OBJECTDIR}/_ext/1664057780/rsa.o ${OBJECTDIR}/_ext/1664057780/sakke.o ${OBJECTDIR}/_ext/1664057780/error.o ${OBJECTDIR}/_ext/1664057780/md5.o ${OBJECTDIR}/_ext/1664057780/tfm.o ${OBJECTDIR}/_ext/1664057780/aes.o ${OBJECTDIR}/_ext/1664057780/sp_sm2_arm64.o ${OBJECTDIR}/_ext/1664057780/logging.o ${OBJECTDIR}/_ext/1664057780/dh.o ${OBJECTDIR}/_ext/1664057780/cmac.o ${OBJECTDIR}/_ext/1664057780/signature.o ${OBJECTDIR}/_ext/1664057780/sp_int.o ${OBJECTDIR}/_ext/1664057780/md4.o ${OBJECTDIR}/_ext/1664057780/wc_dsp.o ${OBJECTDIR}/_ext/1664057780/sp_x86_64.o ${OBJECTDIR}/_ext/1664057780/sp_sm2_armthumb.o ${OBJECTDIR}/_ext/1664057780/asm.o ${OBJECTDIR}/_ext/1664057780/poly1305.o ${OBJECTDIR}/_ext/1664057780/hmac.o ${OBJECTDIR}/_ext/1664057780/sm4.o ${OBJECTDIR}/_ext/1664057780/compress.o ${OBJECTDIR}/_ext/1664057780/hash.o ${OBJECTDIR}/_ext/1664057780/asn.o ${OBJECTDIR}/_ext/1664057780/pwdbased.o ${OBJECTDIR}/_ext/1664057780/md2.o ${OBJECTDIR}/_ext/1664057780/ext_lms.o ${OBJECTDIR}/_ext/1664057780/sp_armthumb.o ${OBJECTDIR}/_ext/1664057780/ed448.o ${OBJECTDIR}/_ext/1664057780/coding.o ${OBJECTDIR}/_ext/1664057780/ecc_fp.o ${OBJECTDIR}/_ext/1664057780/kdf.o ${OBJECTDIR}/_ext/1664057780/cpuid.o ${OBJECTDIR}/_ext/1664057780/sm2.o ${OBJECTDIR}/_ext/1664057780/ripemd.o ${OBJECTDIR}/_ext/1664057780/sp_sm2_cortexm.o ${OBJECTDIR}/_ext/1664057780/sp_sm2_x86_64.o ${OBJECTDIR}/_ext/1664057780/sphincs.o ${OBJECTDIR}/_ext/1664057780/fe_low_mem.o ${OBJECTDIR}/_ext/1664057780/sm3.o ${OBJECTDIR}/_ext/1664057780/pkcs12.o ${OBJECTDIR}/_ext/1664057780/wolfmath.o ${OBJECTDIR}/_ext/1664057780/sp_arm32.o ${OBJECTDIR}/_ext/1664057780/chacha.o ${OBJECTDIR}/_ext/1664057780/wc_xmss.o ${OBJECTDIR}/_ext/1664057780/sha3.o ${OBJECTDIR}/_ext/1664057780/fe_operations.o ${OBJECTDIR}/_ext/1664057780/camellia.o ${OBJECTDIR}/_ext/1664057780/cryptocb.o ${OBJECTDIR}/_ext/1664057780/wc_xmss_impl.o ${OBJECTDIR}/_ext/1664057780/des3.o ${OBJECTDIR}/_ext/1664057780/ext_xmss.o ${OBJECTDIR}/_ext/1664057780/ge_448.o ${OBJECTDIR}/_ext/1664057780/pkcs7.o ${OBJECTDIR}/_ext/1664057780/sp_cortexm.o ${OBJECTDIR}/_ext/1664057780/wc_port.o ${OBJECTDIR}/_ext/1664057780/ed25519.o ${OBJECTDIR}/_ext/1664057780/sha512.o ${OBJECTDIR}/_ext/1664057780/memory.o ${OBJECTDIR}/_ext/1664057780/blake2b.o ${OBJECTDIR}/_ext/1664057780/curve25519.o ${OBJECTDIR}/_ext/1664057780/misc.o ${OBJECTDIR}/_ext/1664057780/sp_sm2_c32.o ${OBJECTDIR}/_ext/1664057780/random.o ${OBJECTDIR}/_ext/1664057780/rc2.o ${OBJECTDIR}/_ext/1664057780/ge_low_mem.o ${OBJECTDIR}/_ext/1664057780/sp_sm2_arm32.o ${OBJECTDIR}/_ext/1664057780/blake2s.o ${OBJECTDIR}/_ext/1664057780/sp_sm2_c64.o ${OBJECTDIR}/_ext/1664057780/sp_c64.o ${OBJECTDIR}/_ext/1664057780/wc_encrypt.o ${OBJECTDIR}/_ext/1664057780/wc_lms_impl.o ${OBJECTDIR}/_ext/1664057780/hpke.o ${OBJECTDIR}/_ext/1664057780/ecc.o ${OBJECTDIR}/_ext/1664057780/evp.o ${OBJECTDIR}/_ext/1664057780/sp_arm64.o ${OBJECTDIR}/_ext/1664057780/wc_kyber.o ${OBJECTDIR}/_ext/1664057780/wolfevent.o ${OBJECTDIR}/_ext/1664057780/integer.o ${OBJECTDIR}/_ext/1664057780/ge_operations.o ${OBJECTDIR}/_ext/1664057780/sp_dsp32.o ${OBJECTDIR}/_ext/1664057780/sp_c32.o ${OBJECTDIR}/_ext/1664057780/dilithium.o ${OBJECTDIR}/_ext/1664057780/chacha20_poly1305.o ${OBJECTDIR}/_ext/1664057780/wc_pkcs11.o ${OBJECTDIR}/_ext/1664057780/wc_kyber_poly.o ${OBJECTDIR}/_ext/1664057780/curve448.o ${OBJECTDIR}/_ext/1664057780/fe_448.o ${OBJECTDIR}/_ext/2046716756/x509.o ${OBJECTDIR}/_ext/2046716756/ssl_bn.o ${OBJECTDIR}/_ext/2046716756/keys.o ${OBJECTDIR}/_ext/2046716756/x509_str.o ${OBJECTDIR}/_ext/2046716756/tls13.o ${OBJECTDIR}/_ext/2046716756/ssl_certman.o ${OBJECTDIR}/_ext/2046716756/ocsp.o ${OBJECTDIR}/_ext/2046716756/internal.o ${OBJECTDIR}/_ext/2046716756/pk.o ${OBJECTDIR}/_ext/2046716756/quic.o ${OBJECTDIR}/_ext/2046716756/ssl_crypto.o ${OBJECTDIR}/_ext/2046716756/ssl_misc.o ${OBJECTDIR}/_ext/2046716756/ssl.o ${OBJECTDIR}/_ext/2046716756/wolfio.o ${OBJECTDIR}/_ext/2046716756/sniffer.o ${OBJECTDIR}/_ext/2046716756/ssl_asn1.o ${OBJECTDIR}/_ext/2046716756/tls.o ${OBJECTDIR}/_ext/2046716756/dtls13.o ${OBJECTDIR}/_ext/2046716756/dtls.o ${OBJECTDIR}/_ext/2046716756/crl.o ${OBJECTDIR}/_ext/2046716756/conf.o ${OBJECTDIR}/_ext/905221350/zutil.o ${OBJECTDIR}/_ext/905221350/crc32.o ${OBJECTDIR}/_ext/905221350/deflate.o ${OBJECTDIR}/_ext/905221350/adler32.o ${OBJECTDIR}/_ext/905221350/uncompr.o ${OBJECTDIR}/_ext/905221350/inflate.o ${OBJECTDIR}/_ext/905221350/trees.o ${OBJECTDIR}/_ext/905221350/inffast.o ${OBJECTDIR}/_ext/905221350/infback.o ${OBJECTDIR}/_ext/905221350/compress.o ${OBJECTDIR}/_ext/905221350/gzclose.o ${OBJECTDIR}/_ext/905221350/inftrees.o ${OBJECTDIR}/_ext/1360937237/main.o ${OBJECTDIR}/_ext/1360937237/http_server_print.o ${OBJECTDIR}/_ext/1360937237/custom_http_server_app.o ${OBJECTDIR}/_ext/1360937237/custom_snmp_app.o ${OBJECTDIR}/_ext/1360937237/app_mqtt_task.o ${OBJECTDIR}/_ext/1360937237/custom_http_app.o ${OBJECTDIR}/_ext/1360937237/http_print.o ${OBJECTDIR}/_ext/1832805299/sys_console_uart.o ${OBJECTDIR}/_ext/2128569739/drv_usbfs_host.o ${OBJECTDIR}/_ext/944882569/sys_debug.o
+POSSIBLE_DEPFILES=${OBJECTDIR}/_ext/1434821282/bsp.o.d ${OBJECTDIR}/_ext/1645245335/crypto.o.d ${OBJECTDIR}/_ext/732082881/drv_eth_pic32_lib.o.d ${OBJECTDIR}/_ext/732082881/drv_ethmac_lib.o.d ${OBJECTDIR}/_ext/732082881/drv_ethmac.o.d ${OBJECTDIR}/_ext/444070925/drv_ethphy.o.d ${OBJECTDIR}/_ext/444070925/drv_extphy_dp83848.o.d ${OBJECTDIR}/_ext/992804092/drv_memory.o.d ${OBJECTDIR}/_ext/438849557/drv_miim_pic32m.o.d ${OBJECTDIR}/_ext/438849557/drv_miim.o.d ${OBJECTDIR}/_ext/2128569739/drv_usbfs.o.d ${OBJECTDIR}/_ext/1433595199/trust_pkcs11_config.o.d ${OBJECTDIR}/_ext/35538813/atcacert_pem.o.d ${OBJECTDIR}/_ext/35538813/atcacert_der.o.d ${OBJECTDIR}/_ext/35538813/atcacert_date.o.d ${OBJECTDIR}/_ext/35538813/atcacert_def.o.d ${OBJECTDIR}/_ext/35538813/atcacert_host_sw.o.d ${OBJECTDIR}/_ext/35538813/atcacert_host_hw.o.d ${OBJECTDIR}/_ext/35538813/atcacert_client.o.d ${OBJECTDIR}/_ext/2017208766/sha2_routines.o.d ${OBJECTDIR}/_ext/2017208766/sha1_routines.o.d ${OBJECTDIR}/_ext/1352206537/atca_crypto_hw_aes_ccm.o.d ${OBJECTDIR}/_ext/1352206537/atca_crypto_hw_aes_cbcmac.o.d ${OBJECTDIR}/_ext/1352206537/atca_crypto_sw_sha2.o.d ${OBJECTDIR}/_ext/1352206537/atca_crypto_pad.o.d ${OBJECTDIR}/_ext/1352206537/atca_crypto_sw_aes_cmac.o.d ${OBJECTDIR}/_ext/1352206537/atca_crypto_hw_aes_cmac.o.d ${OBJECTDIR}/_ext/1352206537/atca_crypto_pbkdf2.o.d ${OBJECTDIR}/_ext/1352206537/atca_crypto_sw_aes_gcm.o.d ${OBJECTDIR}/_ext/1352206537/atca_crypto_hw_aes_ctr.o.d ${OBJECTDIR}/_ext/1352206537/atca_crypto_sw_sha1.o.d ${OBJECTDIR}/_ext/1352206537/atca_crypto_hw_aes_cbc.o.d ${OBJECTDIR}/_ext/1390037109/hal_gpio_harmony.o.d ${OBJECTDIR}/_ext/1390037109/hal_pic32_delay.o.d ${OBJECTDIR}/_ext/1390037109/kit_protocol.o.d ${OBJECTDIR}/_ext/1390037109/atca_hal.o.d ${OBJECTDIR}/_ext/1390037109/hal_freertos.o.d ${OBJECTDIR}/_ext/1390034497/atca_jwt.o.d ${OBJECTDIR}/_ext/403825799/ascii_kit_host.o.d ${OBJECTDIR}/_ext/1717266195/pkcs11_signature.o.d ${OBJECTDIR}/_ext/1717266195/pkcs11_attrib.o.d ${OBJECTDIR}/_ext/1717266195/pkcs11_key.o.d ${OBJECTDIR}/_ext/1717266195/pkcs11_debug.o.d ${OBJECTDIR}/_ext/1717266195/pkcs11_info.o.d ${OBJECTDIR}/_ext/1717266195/pkcs11_init.o.d ${OBJECTDIR}/_ext/1717266195/pkcs11_token.o.d ${OBJECTDIR}/_ext/1717266195/pkcs11_slot.o.d ${OBJECTDIR}/_ext/1717266195/pkcs11_main.o.d ${OBJECTDIR}/_ext/1717266195/pkcs11_encrypt.o.d ${OBJECTDIR}/_ext/1717266195/pkcs11_object.o.d ${OBJECTDIR}/_ext/1717266195/pkcs11_cert.o.d ${OBJECTDIR}/_ext/1717266195/pkcs11_util.o.d ${OBJECTDIR}/_ext/1717266195/pkcs11_os.o.d ${OBJECTDIR}/_ext/1717266195/pkcs11_config.o.d ${OBJECTDIR}/_ext/1717266195/pkcs11_session.o.d ${OBJECTDIR}/_ext/1717266195/pkcs11_find.o.d ${OBJECTDIR}/_ext/1717266195/pkcs11_mech.o.d ${OBJECTDIR}/_ext/1717266195/pkcs11_digest.o.d ${OBJECTDIR}/_ext/375000855/atca_tests_updateextra.o.d ${OBJECTDIR}/_ext/375000855/atca_tests_secureboot.o.d ${OBJECTDIR}/_ext/375000855/atca_tests_hmac.o.d ${OBJECTDIR}/_ext/375000855/test_atcab.o.d ${OBJECTDIR}/_ext/375000855/atca_tests_ecdh.o.d ${OBJECTDIR}/_ext/375000855/atca_tests_aes_cbcmac.o.d ${OBJECTDIR}/_ext/375000855/atca_tests_info.o.d ${OBJECTDIR}/_ext/375000855/atca_tests_sha.o.d ${OBJECTDIR}/_ext/375000855/atca_tests_sign.o.d ${OBJECTDIR}/_ext/375000855/atca_tests_privwrite.o.d ${OBJECTDIR}/_ext/375000855/atca_tests_aes_ccm.o.d ${OBJECTDIR}/_ext/375000855/atca_tests_read.o.d ${OBJECTDIR}/_ext/375000855/atca_tests_aes_cmac.o.d ${OBJECTDIR}/_ext/375000855/atca_tests_aes.o.d ${OBJECTDIR}/_ext/375000855/atca_tests_write.o.d ${OBJECTDIR}/_ext/375000855/atca_tests_random.o.d ${OBJECTDIR}/_ext/375000855/atca_tests_lock.o.d ${OBJECTDIR}/_ext/375000855/atca_tests_aes_cbc.o.d ${OBJECTDIR}/_ext/375000855/atca_tests_aes_gcm.o.d ${OBJECTDIR}/_ext/375000855/atca_tests_helper.o.d ${OBJECTDIR}/_ext/375000855/atca_tests_kdf.o.d ${OBJECTDIR}/_ext/375000855/atca_tests_mac.o.d ${OBJECTDIR}/_ext/375000855/atca_tests_verify.o.d ${OBJECTDIR}/_ext/375000855/atca_tests_aes_ctr.o.d ${OBJECTDIR}/_ext/375000855/atca_tests_startup.o.d ${OBJECTDIR}/_ext/375000855/atca_tests_derivekey.o.d ${OBJECTDIR}/_ext/375000855/atca_tests_counter.o.d ${OBJECTDIR}/_ext/375000855/atca_tests_nonce.o.d ${OBJECTDIR}/_ext/375000855/atca_tests_genkey.o.d ${OBJECTDIR}/_ext/375000855/atca_tests_buffer.o.d ${OBJECTDIR}/_ext/375000855/atca_tests_gendig.o.d ${OBJECTDIR}/_ext/375000855/atca_tests_otpzero.o.d ${OBJECTDIR}/_ext/375000855/atca_tests_selftest.o.d ${OBJECTDIR}/_ext/376290765/test_calib.o.d ${OBJECTDIR}/_ext/376290765/test_calib_config.o.d ${OBJECTDIR}/_ext/376290765/test_calib_info.o.d ${OBJECTDIR}/_ext/376290765/test_calib_delete.o.d ${OBJECTDIR}/_ext/1203793637/test_crypto.o.d ${OBJECTDIR}/_ext/1203793637/test_crypto_pk.o.d ${OBJECTDIR}/_ext/1203793637/test_crypto_sha.o.d ${OBJECTDIR}/_ext/1203793637/test_crypto_aes.o.d ${OBJECTDIR}/_ext/1203793637/test_crypto_pbkdf2.o.d ${OBJECTDIR}/_ext/1203793637/test_crypto_pad.o.d ${OBJECTDIR}/_ext/487095990/test_cert_def_5_device.o.d ${OBJECTDIR}/_ext/487095990/test_cert_def_16_signer.o.d ${OBJECTDIR}/_ext/487095990/test_cert_def_12_device.o.d ${OBJECTDIR}/_ext/487095990/test_atcacert_client.o.d ${OBJECTDIR}/_ext/487095990/test_atcacert_date.o.d ${OBJECTDIR}/_ext/487095990/test_atcacert_der_integer.o.d ${OBJECTDIR}/_ext/487095990/test_cert_def_10_device.o.d ${OBJECTDIR}/_ext/487095990/test_cert_def_13_signer.o.d ${OBJECTDIR}/_ext/487095990/test_cert_def_1_signer.o.d ${OBJECTDIR}/_ext/487095990/test_cert_def_15_device_csr.o.d ${OBJECTDIR}/_ext/487095990/test_cert_def_11_signer.o.d ${OBJECTDIR}/_ext/487095990/test_cert_def_9_device.o.d ${OBJECTDIR}/_ext/487095990/test_cert_def_2_device_csr.o.d ${OBJECTDIR}/_ext/487095990/test_atcacert_der_ecdsa_sig_value.o.d ${OBJECTDIR}/_ext/487095990/test_atcacert_host_sw.o.d ${OBJECTDIR}/_ext/487095990/test_cert_def_7_signer.o.d ${OBJECTDIR}/_ext/487095990/test_atcacert_host_hw.o.d ${OBJECTDIR}/_ext/487095990/test_cert_def_4_device.o.d ${OBJECTDIR}/_ext/487095990/test_cert_def_14_device.o.d ${OBJECTDIR}/_ext/487095990/test_atcacert_def.o.d ${OBJECTDIR}/_ext/487095990/test_cert_def_6_device.o.d ${OBJECTDIR}/_ext/487095990/test_cert_def_3_device.o.d ${OBJECTDIR}/_ext/487095990/test_atcacert.o.d ${OBJECTDIR}/_ext/487095990/test_cert_def_0_device.o.d ${OBJECTDIR}/_ext/487095990/test_cert_def_8_signer.o.d ${OBJECTDIR}/_ext/487095990/test_atcacert_der_length.o.d ${OBJECTDIR}/_ext/1164389986/test_hal_basic.o.d ${OBJECTDIR}/_ext/1164389986/test_hal.o.d ${OBJECTDIR}/_ext/1362789921/test_integration.o.d ${OBJECTDIR}/_ext/1362789921/test_mbedtls.o.d ${OBJECTDIR}/_ext/1164387374/atca_jwt_test.o.d ${OBJECTDIR}/_ext/597494043/aes_cmac_nist_vectors.o.d ${OBJECTDIR}/_ext/597494043/pkcs7_pad_vectors.o.d ${OBJECTDIR}/_ext/597494043/vector_utils.o.d ${OBJECTDIR}/_ext/597494043/ecdsa_nist_vectors.o.d ${OBJECTDIR}/_ext/597494043/aes_gcm_nist_vectors.o.d ${OBJECTDIR}/_ext/597494043/pbkdf2_sha256_vectors.o.d ${OBJECTDIR}/_ext/597494043/ecdh_nist_vectors.o.d ${OBJECTDIR}/_ext/141115750/atca_test_console.o.d ${OBJECTDIR}/_ext/141115750/cmd-processor.o.d ${OBJECTDIR}/_ext/141115750/atca_test.o.d ${OBJECTDIR}/_ext/141115750/atca_test_config.o.d ${OBJECTDIR}/_ext/141115750/atca_utils_atecc608.o.d ${OBJECTDIR}/_ext/1882585300/unity.o.d ${OBJECTDIR}/_ext/1882585300/unity_memory.o.d ${OBJECTDIR}/_ext/1882585300/unity_fixture.o.d ${OBJECTDIR}/_ext/701127929/atca_cfgs.o.d ${OBJECTDIR}/_ext/701127929/atca_helpers.o.d ${OBJECTDIR}/_ext/701127929/atca_iface.o.d ${OBJECTDIR}/_ext/701127929/atca_basic.o.d ${OBJECTDIR}/_ext/701127929/atca_device.o.d ${OBJECTDIR}/_ext/701127929/cal_buffer.o.d ${OBJECTDIR}/_ext/701127929/atca_debug.o.d ${OBJECTDIR}/_ext/1033058136/helpers.o.d ${OBJECTDIR}/_ext/1751889202/sys_fs_shell.o.d ${OBJECTDIR}/_ext/1033058136/tcpip_heap_internal.o.d ${OBJECTDIR}/_ext/1033058136/tcpip_heap_class.o.d ${OBJECTDIR}/_ext/1033058136/tcpip_notify.o.d ${OBJECTDIR}/_ext/1033058136/tcpip_manager.o.d ${OBJECTDIR}/_ext/1033058136/oahash.o.d ${OBJECTDIR}/_ext/1033058136/tcpip_packet.o.d ${OBJECTDIR}/_ext/1033058136/tcpip_helpers.o.d ${OBJECTDIR}/_ext/1033058136/tcpip_helper_c32.o.d ${OBJECTDIR}/_ext/1033058136/tcpip_heap_alloc.o.d ${OBJECTDIR}/_ext/1033058136/hash_fnv.o.d ${OBJECTDIR}/_ext/1033058136/dhcp.o.d ${OBJECTDIR}/_ext/1033058136/dns.o.d ${OBJECTDIR}/_ext/1033058136/tcpip_commands.o.d ${OBJECTDIR}/_ext/1033058136/telnet.o.d ${OBJECTDIR}/_ext/1033058136/tcpip_announce.o.d ${OBJECTDIR}/_ext/1033058136/ipv4.o.d ${OBJECTDIR}/_ext/1033058136/udp.o.d ${OBJECTDIR}/_ext/1033058136/icmp.o.d ${OBJECTDIR}/_ext/1033058136/tcp.o.d ${OBJECTDIR}/_ext/1033058136/arp.o.d ${OBJECTDIR}/_ext/1033058136/http_server.o.d ${OBJECTDIR}/_ext/1033058136/berkeley_api.o.d ${OBJECTDIR}/_ext/1033058136/icmpv6.o.d ${OBJECTDIR}/_ext/1033058136/http.o.d ${OBJECTDIR}/_ext/1033058136/sntp.o.d ${OBJECTDIR}/_ext/1033058136/zero_conf_helper.o.d ${OBJECTDIR}/_ext/1033058136/ipv6.o.d ${OBJECTDIR}/_ext/1033058136/smtpc.o.d ${OBJECTDIR}/_ext/1033058136/dnss.o.d ${OBJECTDIR}/_ext/1033058136/dhcpv6.o.d ${OBJECTDIR}/_ext/1033058136/igmp.o.d ${OBJECTDIR}/_ext/1033058136/ftpc.o.d ${OBJECTDIR}/_ext/1033058136/zero_conf_multicast_dns.o.d ${OBJECTDIR}/_ext/1033058136/zero_conf_link_local.o.d ${OBJECTDIR}/_ext/1033058136/ndp.o.d ${OBJECTDIR}/_ext/1033058136/iperf.o.d ${OBJECTDIR}/_ext/1033058136/nbns.o.d ${OBJECTDIR}/_ext/1033058136/snmpv3.o.d ${OBJECTDIR}/_ext/1033058136/ftp.o.d ${OBJECTDIR}/_ext/1033058136/snmpv3_usm.o.d ${OBJECTDIR}/_ext/1033058136/ddns.o.d ${OBJECTDIR}/_ext/1033058136/snmp.o.d ${OBJECTDIR}/_ext/1508031553/net_pres.o.d ${OBJECTDIR}/_ext/1640433940/net_pres_enc_glue.o.d ${OBJECTDIR}/_ext/1640433940/net_pres_cert_store.o.d ${OBJECTDIR}/_ext/1264217935/ota_service.o.d ${OBJECTDIR}/_ext/1264217935/ota_service_file_handler.o.d ${OBJECTDIR}/_ext/1264217935/ota_service_transport_ble.o.d ${OBJECTDIR}/_ext/60163342/plib_adc.o.d ${OBJECTDIR}/_ext/60165520/plib_clk.o.d ${OBJECTDIR}/_ext/1249264884/plib_coretimer.o.d ${OBJECTDIR}/_ext/1865200349/plib_evic.o.d ${OBJECTDIR}/_ext/1865254177/plib_gpio.o.d ${OBJECTDIR}/_ext/60176403/plib_nvm.o.d ${OBJECTDIR}/_ext/60179596/plib_ram.o.d ${OBJECTDIR}/_ext/1865657120/plib_uart1.o.d ${OBJECTDIR}/_ext/1865657120/plib_uart2.o.d ${OBJECTDIR}/_ext/1865657120/plib_uart3.o.d ${OBJECTDIR}/_ext/1865657120/plib_uart4.o.d ${OBJECTDIR}/_ext/1529315265/rnbd_interface.o.d ${OBJECTDIR}/_ext/163028504/xc32_monitor.o.d ${OBJECTDIR}/_ext/1376093119/sys_command.o.d ${OBJECTDIR}/_ext/1832805299/sys_console_usb_cdc.o.d ${OBJECTDIR}/_ext/1832805299/sys_console.o.d ${OBJECTDIR}/_ext/411819097/ff.o.d ${OBJECTDIR}/_ext/411819097/ffunicode.o.d ${OBJECTDIR}/_ext/565198302/diskio.o.d ${OBJECTDIR}/_ext/1269487135/sys_fs_media_manager.o.d ${OBJECTDIR}/_ext/1269487135/sys_fs_fat_interface.o.d ${OBJECTDIR}/_ext/1269487135/sys_fs.o.d ${OBJECTDIR}/_ext/1000052432/sys_reset.o.d ${OBJECTDIR}/_ext/101884895/sys_time.o.d ${OBJECTDIR}/_ext/753841488/sys_time_h2_adapter.o.d ${OBJECTDIR}/_ext/2056773213/mqtt_net_glue.o.d ${OBJECTDIR}/_ext/308758920/usb_device_cdc.o.d ${OBJECTDIR}/_ext/308758920/usb_device_cdc_acm.o.d ${OBJECTDIR}/_ext/308758920/usb_device.o.d ${OBJECTDIR}/_ext/308758920/usb_host_generic.o.d ${OBJECTDIR}/_ext/308758920/usb_host_cdc.o.d ${OBJECTDIR}/_ext/308758920/usb_host_cdc_acm.o.d ${OBJECTDIR}/_ext/308758920/usb_host.o.d ${OBJECTDIR}/_ext/308758920/usb_host_hid.o.d ${OBJECTDIR}/_ext/1171490990/exceptions.o.d ${OBJECTDIR}/_ext/1171490990/interrupts.o.d ${OBJECTDIR}/_ext/1171490990/initialization.o.d ${OBJECTDIR}/_ext/1171490990/interrupts_a.o.d ${OBJECTDIR}/_ext/1171490990/freertos_hooks.o.d ${OBJECTDIR}/_ext/1171490990/usb_device_init_data.o.d ${OBJECTDIR}/_ext/1665200909/heap_1.o.d ${OBJECTDIR}/_ext/951553248/port.o.d ${OBJECTDIR}/_ext/951553248/port_asm.o.d ${OBJECTDIR}/_ext/404212886/list.o.d ${OBJECTDIR}/_ext/404212886/timers.o.d ${OBJECTDIR}/_ext/404212886/queue.o.d ${OBJECTDIR}/_ext/404212886/event_groups.o.d ${OBJECTDIR}/_ext/404212886/croutine.o.d ${OBJECTDIR}/_ext/404212886/stream_buffer.o.d ${OBJECTDIR}/_ext/404212886/FreeRTOS_tasks.o.d ${OBJECTDIR}/_ext/603994634/MCHP_pic32mzw1.o.d ${OBJECTDIR}/_ext/741293594/MQTTClient.o.d ${OBJECTDIR}/_ext/980053345/MQTTConnectServer.o.d ${OBJECTDIR}/_ext/980053345/MQTTUnsubscribeServer.o.d ${OBJECTDIR}/_ext/980053345/MQTTUnsubscribeClient.o.d ${OBJECTDIR}/_ext/980053345/MQTTConnectClient.o.d ${OBJECTDIR}/_ext/980053345/MQTTPacket.o.d ${OBJECTDIR}/_ext/980053345/MQTTSubscribeServer.o.d ${OBJECTDIR}/_ext/980053345/MQTTDeserializePublish.o.d ${OBJECTDIR}/_ext/980053345/MQTTSubscribeClient.o.d ${OBJECTDIR}/_ext/980053345/MQTTFormat.o.d ${OBJECTDIR}/_ext/980053345/MQTTSerializePublish.o.d ${OBJECTDIR}/_ext/1018957768/rnbd.o.d ${OBJECTDIR}/_ext/751086310/mqtt_packet.o.d ${OBJECTDIR}/_ext/751086310/mqtt_socket.o.d ${OBJECTDIR}/_ext/751086310/mqtt_client.o.d ${OBJECTDIR}/_ext/172253694/crypt_sha1_sam11105.o.d ${OBJECTDIR}/_ext/172253694/crypt_sha512_sam6156.o.d ${OBJECTDIR}/_ext/172253694/crypt_rsa_pukcl.o.d ${OBJECTDIR}/_ext/172253694/crypt_sha384_sam6156.o.d ${OBJECTDIR}/_ext/172253694/crypt_ecc_ba414e.o.d ${OBJECTDIR}/_ext/172253694/crypt_pukcl_functions.o.d ${OBJECTDIR}/_ext/172253694/crypt_sha1_sam6156.o.d ${OBJECTDIR}/_ext/172253694/crypt_sam_u2803.o.d ${OBJECTDIR}/_ext/172253694/crypt_rng_u2242.o.d ${OBJECTDIR}/_ext/172253694/crypt_rng_sam6334.o.d ${OBJECTDIR}/_ext/172253694/pic32mz-crypt.o.d ${OBJECTDIR}/_ext/172253694/crypt_sha224_sam11105.o.d ${OBJECTDIR}/_ext/172253694/crypt_sha256_sam6156.o.d ${OBJECTDIR}/_ext/172253694/crypt_tdes_sam6150.o.d ${OBJECTDIR}/_ext/172253694/crypt_aes_sam6149.o.d ${OBJECTDIR}/_ext/172253694/crypt_aes_u2238.o.d ${OBJECTDIR}/_ext/172253694/crypt_ecc_pukcl.o.d ${OBJECTDIR}/_ext/172253694/crypt_wolfcryptcb.o.d ${OBJECTDIR}/_ext/172253694/crypt_sha256_sam11105.o.d ${OBJECTDIR}/_ext/172253694/crypt_sha224_sam6156.o.d ${OBJECTDIR}/_ext/1664057780/siphash.o.d ${OBJECTDIR}/_ext/1664057780/srp.o.d ${OBJECTDIR}/_ext/1664057780/ext_kyber.o.d ${OBJECTDIR}/_ext/1664057780/eccsi.o.d ${OBJECTDIR}/_ext/1664057780/sha.o.d ${OBJECTDIR}/_ext/1664057780/dsa.o.d ${OBJECTDIR}/_ext/1664057780/falcon.o.d ${OBJECTDIR}/_ext/1664057780/arc4.o.d ${OBJECTDIR}/_ext/1664057780/sha256.o.d ${OBJECTDIR}/_ext/1664057780/wc_lms.o.d ${OBJECTDIR}/_ext/1664057780/rsa.o.d ${OBJECTDIR}/_ext/1664057780/sakke.o.d ${OBJECTDIR}/_ext/1664057780/error.o.d ${OBJECTDIR}/_ext/1664057780/md5.o.d ${OBJECTDIR}/_ext/1664057780/tfm.o.d ${OBJECTDIR}/_ext/1664057780/aes.o.d ${OBJECTDIR}/_ext/1664057780/sp_sm2_arm64.o.d ${OBJECTDIR}/_ext/1664057780/logging.o.d ${OBJECTDIR}/_ext/1664057780/dh.o.d ${OBJECTDIR}/_ext/1664057780/cmac.o.d ${OBJECTDIR}/_ext/1664057780/signature.o.d ${OBJECTDIR}/_ext/1664057780/sp_int.o.d ${OBJECTDIR}/_ext/1664057780/md4.o.d ${OBJECTDIR}/_ext/1664057780/wc_dsp.o.d ${OBJECTDIR}/_ext/1664057780/sp_x86_64.o.d ${OBJECTDIR}/_ext/1664057780/sp_sm2_armthumb.o.d ${OBJECTDIR}/_ext/1664057780/asm.o.d ${OBJECTDIR}/_ext/1664057780/poly1305.o.d ${OBJECTDIR}/_ext/1664057780/hmac.o.d ${OBJECTDIR}/_ext/1664057780/sm4.o.d ${OBJECTDIR}/_ext/1664057780/compress.o.d ${OBJECTDIR}/_ext/1664057780/hash.o.d ${OBJECTDIR}/_ext/1664057780/asn.o.d ${OBJECTDIR}/_ext/1664057780/pwdbased.o.d ${OBJECTDIR}/_ext/1664057780/md2.o.d ${OBJECTDIR}/_ext/1664057780/ext_lms.o.d ${OBJECTDIR}/_ext/1664057780/sp_armthumb.o.d ${OBJECTDIR}/_ext/1664057780/ed448.o.d ${OBJECTDIR}/_ext/1664057780/coding.o.d ${OBJECTDIR}/_ext/1664057780/ecc_fp.o.d ${OBJECTDIR}/_ext/1664057780/kdf.o.d ${OBJECTDIR}/_ext/1664057780/cpuid.o.d ${OBJECTDIR}/_ext/1664057780/sm2.o.d ${OBJECTDIR}/_ext/1664057780/ripemd.o.d ${OBJECTDIR}/_ext/1664057780/sp_sm2_cortexm.o.d ${OBJECTDIR}/_ext/1664057780/sp_sm2_x86_64.o.d ${OBJECTDIR}/_ext/1664057780/sphincs.o.d ${OBJECTDIR}/_ext/1664057780/fe_low_mem.o.d ${OBJECTDIR}/_ext/1664057780/sm3.o.d ${OBJECTDIR}/_ext/1664057780/pkcs12.o.d ${OBJECTDIR}/_ext/1664057780/wolfmath.o.d ${OBJECTDIR}/_ext/1664057780/sp_arm32.o.d ${OBJECTDIR}/_ext/1664057780/chacha.o.d ${OBJECTDIR}/_ext/1664057780/wc_xmss.o.d ${OBJECTDIR}/_ext/1664057780/sha3.o.d ${OBJECTDIR}/_ext/1664057780/fe_operations.o.d ${OBJECTDIR}/_ext/1664057780/camellia.o.d ${OBJECTDIR}/_ext/1664057780/cryptocb.o.d ${OBJECTDIR}/_ext/1664057780/wc_xmss_impl.o.d ${OBJECTDIR}/_ext/1664057780/des3.o.d ${OBJECTDIR}/_ext/1664057780/ext_xmss.o.d ${OBJECTDIR}/_ext/1664057780/ge_448.o.d ${OBJECTDIR}/_ext/1664057780/pkcs7.o.d ${OBJECTDIR}/_ext/1664057780/sp_cortexm.o.d ${OBJECTDIR}/_ext/1664057780/wc_port.o.d ${OBJECTDIR}/_ext/1664057780/ed25519.o.d ${OBJECTDIR}/_ext/1664057780/sha512.o.d ${OBJECTDIR}/_ext/1664057780/memory.o.d ${OBJECTDIR}/_ext/1664057780/blake2b.o.d ${OBJECTDIR}/_ext/1664057780/curve25519.o.d ${OBJECTDIR}/_ext/1664057780/misc.o.d ${OBJECTDIR}/_ext/1664057780/sp_sm2_c32.o.d ${OBJECTDIR}/_ext/1664057780/random.o.d ${OBJECTDIR}/_ext/1664057780/rc2.o.d ${OBJECTDIR}/_ext/1664057780/ge_low_mem.o.d ${OBJECTDIR}/_ext/1664057780/sp_sm2_arm32.o.d ${OBJECTDIR}/_ext/1664057780/blake2s.o.d ${OBJECTDIR}/_ext/1664057780/sp_sm2_c64.o.d ${OBJECTDIR}/_ext/1664057780/sp_c64.o.d ${OBJECTDIR}/_ext/1664057780/wc_encrypt.o.d ${OBJECTDIR}/_ext/1664057780/wc_lms_impl.o.d ${OBJECTDIR}/_ext/1664057780/hpke.o.d ${OBJECTDIR}/_ext/1664057780/ecc.o.d ${OBJECTDIR}/_ext/1664057780/evp.o.d ${OBJECTDIR}/_ext/1664057780/sp_arm64.o.d ${OBJECTDIR}/_ext/1664057780/wc_kyber.o.d ${OBJECTDIR}/_ext/1664057780/wolfevent.o.d ${OBJECTDIR}/_ext/1664057780/integer.o.d ${OBJECTDIR}/_ext/1664057780/ge_operations.o.d ${OBJECTDIR}/_ext/1664057780/sp_dsp32.o.d ${OBJECTDIR}/_ext/1664057780/sp_c32.o.d ${OBJECTDIR}/_ext/1664057780/dilithium.o.d ${OBJECTDIR}/_ext/1664057780/chacha20_poly1305.o.d ${OBJECTDIR}/_ext/1664057780/wc_pkcs11.o.d ${OBJECTDIR}/_ext/1664057780/wc_kyber_poly.o.d ${OBJECTDIR}/_ext/1664057780/curve448.o.d ${OBJECTDIR}/_ext/1664057780/fe_448.o.d ${OBJECTDIR}/_ext/2046716756/x509.o.d ${OBJECTDIR}/_ext/2046716756/ssl_bn.o.d ${OBJECTDIR}/_ext/2046716756/keys.o.d ${OBJECTDIR}/_ext/2046716756/x509_str.o.d ${OBJECTDIR}/_ext/2046716756/tls13.o.d ${OBJECTDIR}/_ext/2046716756/ssl_certman.o.d ${OBJECTDIR}/_ext/2046716756/ocsp.o.d ${OBJECTDIR}/_ext/2046716756/internal.o.d ${OBJECTDIR}/_ext/2046716756/pk.o.d ${OBJECTDIR}/_ext/2046716756/quic.o.d ${OBJECTDIR}/_ext/2046716756/ssl_crypto.o.d ${OBJECTDIR}/_ext/2046716756/ssl_misc.o.d ${OBJECTDIR}/_ext/2046716756/ssl.o.d ${OBJECTDIR}/_ext/2046716756/wolfio.o.d ${OBJECTDIR}/_ext/2046716756/sniffer.o.d ${OBJECTDIR}/_ext/2046716756/ssl_asn1.o.d ${OBJECTDIR}/_ext/2046716756/tls.o.d ${OBJECTDIR}/_ext/2046716756/dtls13.o.d ${OBJECTDIR}/_ext/2046716756/dtls.o.d ${OBJECTDIR}/_ext/2046716756/crl.o.d ${OBJECTDIR}/_ext/2046716756/conf.o.d ${OBJECTDIR}/_ext/905221350/zutil.o.d ${OBJECTDIR}/_ext/905221350/crc32.o.d ${OBJECTDIR}/_ext/905221350/deflate.o.d ${OBJECTDIR}/_ext/905221350/adler32.o.d ${OBJECTDIR}/_ext/905221350/uncompr.o.d ${OBJECTDIR}/_ext/905221350/inflate.o.d ${OBJECTDIR}/_ext/905221350/trees.o.d ${OBJECTDIR}/_ext/905221350/inffast.o.d ${OBJECTDIR}/_ext/905221350/infback.o.d ${OBJECTDIR}/_ext/905221350/compress.o.d ${OBJECTDIR}/_ext/905221350/gzclose.o.d ${OBJECTDIR}/_ext/905221350/inftrees.o.d ${OBJECTDIR}/_ext/1360937237/main.o.d ${OBJECTDIR}/_ext/1360937237/http_server_print.o.d ${OBJECTDIR}/_ext/1360937237/custom_http_server_app.o.d ${OBJECTDIR}/_ext/1360937237/custom_snmp_app.o.d ${OBJECTDIR}/_ext/1360937237/app_mqtt_task.o.d ${OBJECTDIR}/_ext/1360937237/custom_http_app.o.d ${OBJECTDIR}/_ext/1360937237/http_print.o.d ${OBJECTDIR}/_ext/1832805299/sys_console_uart.o.d ${OBJECTDIR}/_ext/2128569739/drv_usbfs_host.o.d ${OBJECTDIR}/_ext/944882569/sys_debug.o.d
 
 # Object Files
-OBJECTFILES=${OBJECTDIR}/_ext/1434821282/bsp.o ${OBJECTDIR}/_ext/1645245335/crypto.o ${OBJECTDIR}/_ext/732082881/drv_eth_pic32_lib.o ${OBJECTDIR}/_ext/732082881/drv_ethmac_lib.o ${OBJECTDIR}/_ext/732082881/drv_ethmac.o ${OBJECTDIR}/_ext/444070925/drv_ethphy.o ${OBJECTDIR}/_ext/444070925/drv_extphy_dp83848.o ${OBJECTDIR}/_ext/992804092/drv_memory.o ${OBJECTDIR}/_ext/438849557/drv_miim_pic32m.o ${OBJECTDIR}/_ext/438849557/drv_miim.o ${OBJECTDIR}/_ext/2128569739/drv_usbfs.o ${OBJECTDIR}/_ext/1433595199/trust_pkcs11_config.o ${OBJECTDIR}/_ext/35538813/atcacert_pem.o ${OBJECTDIR}/_ext/35538813/atcacert_der.o ${OBJECTDIR}/_ext/35538813/atcacert_date.o ${OBJECTDIR}/_ext/35538813/atcacert_def.o ${OBJECTDIR}/_ext/35538813/atcacert_host_sw.o ${OBJECTDIR}/_ext/35538813/atcacert_host_hw.o ${OBJECTDIR}/_ext/35538813/atcacert_client.o ${OBJECTDIR}/_ext/2017208766/sha2_routines.o ${OBJECTDIR}/_ext/2017208766/sha1_routines.o ${OBJECTDIR}/_ext/1352206537/atca_crypto_hw_aes_ccm.o ${OBJECTDIR}/_ext/1352206537/atca_crypto_hw_aes_cbcmac.o ${OBJECTDIR}/_ext/1352206537/atca_crypto_sw_sha2.o ${OBJECTDIR}/_ext/1352206537/atca_crypto_pad.o ${OBJECTDIR}/_ext/1352206537/atca_crypto_sw_aes_cmac.o ${OBJECTDIR}/_ext/1352206537/atca_crypto_hw_aes_cmac.o ${OBJECTDIR}/_ext/1352206537/atca_crypto_pbkdf2.o ${OBJECTDIR}/_ext/1352206537/atca_crypto_sw_aes_gcm.o ${OBJECTDIR}/_ext/1352206537/atca_crypto_hw_aes_ctr.o ${OBJECTDIR}/_ext/1352206537/atca_crypto_sw_sha1.o ${OBJECTDIR}/_ext/1352206537/atca_crypto_hw_aes_cbc.o ${OBJECTDIR}/_ext/1390037109/hal_gpio_harmony.o ${OBJECTDIR}/_ext/1390037109/hal_pic32_delay.o ${OBJECTDIR}/_ext/1390037109/kit_protocol.o ${OBJECTDIR}/_ext/1390037109/atca_hal.o ${OBJECTDIR}/_ext/1390037109/hal_freertos.o ${OBJECTDIR}/_ext/1390034497/atca_jwt.o ${OBJECTDIR}/_ext/403825799/ascii_kit_host.o ${OBJECTDIR}/_ext/1717266195/pkcs11_signature.o ${OBJECTDIR}/_ext/1717266195/pkcs11_attrib.o ${OBJECTDIR}/_ext/1717266195/pkcs11_key.o ${OBJECTDIR}/_ext/1717266195/pkcs11_debug.o ${OBJECTDIR}/_ext/1717266195/pkcs11_info.o ${OBJECTDIR}/_ext/1717266195/pkcs11_init.o ${OBJECTDIR}/_ext/1717266195/pkcs11_token.o ${OBJECTDIR}/_ext/1717266195/pkcs11_slot.o ${OBJECTDIR}/_ext/1717266195/pkcs11_main.o ${OBJECTDIR}/_ext/1717266195/pkcs11_encrypt.o ${OBJECTDIR}/_ext/1717266195/pkcs11_object.o ${OBJECTDIR}/_ext/1717266195/pkcs11_cert.o ${OBJECTDIR}/_ext/1717266195/pkcs11_util.o ${OBJECTDIR}/_ext/1717266195/pkcs11_os.o ${OBJECTDIR}/_ext/1717266195/pkcs11_config.o ${OBJECTDIR}/_ext/1717266195/pkcs11_session.o ${OBJECTDIR}/_ext/1717266195/pkcs11_find.o ${OBJECTDIR}/_ext/1717266195/pkcs11_mech.o ${OBJECTDIR}/_ext/1717266195/pkcs11_digest.o ${OBJECTDIR}/_ext/375000855/atca_tests_updateextra.o ${OBJECTDIR}/_ext/375000855/atca_tests_secureboot.o ${OBJECTDIR}/_ext/375000855/atca_tests_hmac.o ${OBJECTDIR}/_ext/375000855/test_atcab.o ${OBJECTDIR}/_ext/375000855/atca_tests_ecdh.o ${OBJECTDIR}/_ext/375000855/atca_tests_aes_cbcmac.o ${OBJECTDIR}/_ext/375000855/atca_tests_info.o ${OBJECTDIR}/_ext/375000855/atca_tests_sha.o ${OBJECTDIR}/_ext/375000855/atca_tests_sign.o ${OBJECTDIR}/_ext/375000855/atca_tests_privwrite.o ${OBJECTDIR}/_ext/375000855/atca_tests_aes_ccm.o ${OBJECTDIR}/_ext/375000855/atca_tests_read.o ${OBJECTDIR}/_ext/375000855/atca_tests_aes_cmac.o ${OBJECTDIR}/_ext/375000855/atca_tests_aes.o ${OBJECTDIR}/_ext/375000855/atca_tests_write.o ${OBJECTDIR}/_ext/375000855/atca_tests_random.o ${OBJECTDIR}/_ext/375000855/atca_tests_lock.o ${OBJECTDIR}/_ext/375000855/atca_tests_aes_cbc.o ${OBJECTDIR}/_ext/375000855/atca_tests_aes_gcm.o ${OBJECTDIR}/_ext/375000855/atca_tests_helper.o ${OBJECTDIR}/_ext/375000855/atca_tests_kdf.o ${OBJECTDIR}/_ext/375000855/atca_tests_mac.o ${OBJECTDIR}/_ext/375000855/atca_tests_verify.o ${OBJECTDIR}/_ext/375000855/atca_tests_aes_ctr.o ${OBJECTDIR}/_ext/375000855/atca_tests_startup.o ${OBJECTDIR}/_ext/375000855/atca_tests_derivekey.o ${OBJECTDIR}/_ext/375000855/atca_tests_counter.o ${OBJECTDIR}/_ext/375000855/atca_tests_nonce.o ${OBJECTDIR}/_ext/375000855/atca_tests_genkey.o ${OBJECTDIR}/_ext/375000855/atca_tests_buffer.o ${OBJECTDIR}/_ext/375000855/atca_tests_gendig.o ${OBJECTDIR}/_ext/375000855/atca_tests_otpzero.o ${OBJECTDIR}/_ext/375000855/atca_tests_selftest.o ${OBJECTDIR}/_ext/376290765/test_calib.o ${OBJECTDIR}/_ext/376290765/test_calib_config.o ${OBJECTDIR}/_ext/376290765/test_calib_info.o ${OBJECTDIR}/_ext/376290765/test_calib_delete.o ${OBJECTDIR}/_ext/1203793637/test_crypto.o ${OBJECTDIR}/_ext/1203793637/test_crypto_pk.o ${OBJECTDIR}/_ext/1203793637/test_crypto_sha.o ${OBJECTDIR}/_ext/1203793637/test_crypto_aes.o ${OBJECTDIR}/_ext/1203793637/test_crypto_pbkdf2.o ${OBJECTDIR}/_ext/1203793637/test_crypto_pad.o ${OBJECTDIR}/_ext/487095990/test_cert_def_5_device.o ${OBJECTDIR}/_ext/487095990/test_cert_def_16_signer.o ${OBJECTDIR}/_ext/487095990/test_cert_def_12_device.o ${OBJECTDIR}/_ext/487095990/test_atcacert_client.o ${OBJECTDIR}/_ext/487095990/test_atcacert_date.o ${OBJECTDIR}/_ext/487095990/test_atcacert_der_integer.o ${OBJECTDIR}/_ext/487095990/test_cert_def_10_device.o ${OBJECTDIR}/_ext/487095990/test_cert_def_13_signer.o ${OBJECTDIR}/_ext/487095990/test_cert_def_1_signer.o ${OBJECTDIR}/_ext/487095990/test_cert_def_15_device_csr.o ${OBJECTDIR}/_ext/487095990/test_cert_def_11_signer.o ${OBJECTDIR}/_ext/487095990/test_cert_def_9_device.o ${OBJECTDIR}/_ext/487095990/test_cert_def_2_device_csr.o ${OBJECTDIR}/_ext/487095990/test_atcacert_der_ecdsa_sig_value.o ${OBJECTDIR}/_ext/487095990/test_atcacert_host_sw.o ${OBJECTDIR}/_ext/487095990/test_cert_def_7_signer.o ${OBJECTDIR}/_ext/487095990/test_atcacert_host_hw.o ${OBJECTDIR}/_ext/487095990/test_cert_def_4_device.o ${OBJECTDIR}/_ext/487095990/test_cert_def_14_device.o ${OBJECTDIR}/_ext/487095990/test_atcacert_def.o ${OBJECTDIR}/_ext/487095990/test_cert_def_6_device.o ${OBJECTDIR}/_ext/487095990/test_cert_def_3_device.o ${OBJECTDIR}/_ext/487095990/test_atcacert.o ${OBJECTDIR}/_ext/487095990/test_cert_def_0_device.o ${OBJECTDIR}/_ext/487095990/test_cert_def_8_signer.o ${OBJECTDIR}/_ext/487095990/test_atcacert_der_length.o ${OBJECTDIR}/_ext/1164389986/test_hal_basic.o ${OBJECTDIR}/_ext/1164389986/test_hal.o ${OBJECTDIR}/_ext/1362789921/test_integration.o ${OBJECTDIR}/_ext/1362789921/test_mbedtls.o ${OBJECTDIR}/_ext/1164387374/atca_jwt_test.o ${OBJECTDIR}/_ext/597494043/aes_cmac_nist_vectors.o ${OBJECTDIR}/_ext/597494043/pkcs7_pad_vectors.o ${OBJECTDIR}/_ext/597494043/vector_utils.o ${OBJECTDIR}/_ext/597494043/ecdsa_nist_vectors.o ${OBJECTDIR}/_ext/597494043/aes_gcm_nist_vectors.o ${OBJECTDIR}/_ext/597494043/pbkdf2_sha256_vectors.o ${OBJECTDIR}/_ext/597494043/ecdh_nist_vectors.o ${OBJECTDIR}/_ext/141115750/atca_test_console.o ${OBJECTDIR}/_ext/141115750/cmd-processor.o ${OBJECTDIR}/_ext/141115750/atca_test.o ${OBJECTDIR}/_ext/141115750/atca_test_config.o ${OBJECTDIR}/_ext/141115750/atca_utils_atecc608.o ${OBJECTDIR}/_ext/1882585300/unity.o ${OBJECTDIR}/_ext/1882585300/unity_memory.o ${OBJECTDIR}/_ext/1882585300/unity_fixture.o ${OBJECTDIR}/_ext/701127929/atca_cfgs.o ${OBJECTDIR}/_ext/701127929/atca_helpers.o ${OBJECTDIR}/_ext/701127929/atca_iface.o ${OBJECTDIR}/_ext/701127929/atca_basic.o ${OBJECTDIR}/_ext/701127929/atca_device.o ${OBJECTDIR}/_ext/701127929/cal_buffer.o ${OBJECTDIR}/_ext/701127929/atca_debug.o ${OBJECTDIR}/_ext/1033058136/helpers.o ${OBJECTDIR}/_ext/1751889202/sys_fs_shell.o ${OBJECTDIR}/_ext/1033058136/tcpip_heap_internal.o ${OBJECTDIR}/_ext/1033058136/tcpip_notify.o ${OBJECTDIR}/_ext/1033058136/tcpip_manager.o ${OBJECTDIR}/_ext/1033058136/oahash.o ${OBJECTDIR}/_ext/1033058136/tcpip_packet.o ${OBJECTDIR}/_ext/1033058136/tcpip_helpers.o ${OBJECTDIR}/_ext/1033058136/tcpip_helper_c32.o ${OBJECTDIR}/_ext/1033058136/tcpip_heap_alloc.o ${OBJECTDIR}/_ext/1033058136/hash_fnv.o ${OBJECTDIR}/_ext/1033058136/dhcp.o ${OBJECTDIR}/_ext/1033058136/dns.o ${OBJECTDIR}/_ext/1033058136/tcpip_commands.o ${OBJECTDIR}/_ext/1033058136/telnet.o ${OBJECTDIR}/_ext/1033058136/tcpip_announce.o ${OBJECTDIR}/_ext/1033058136/ipv4.o ${OBJECTDIR}/_ext/1033058136/udp.o ${OBJECTDIR}/_ext/1033058136/icmp.o ${OBJECTDIR}/_ext/1033058136/tcp.o ${OBJECTDIR}/_ext/1033058136/arp.o ${OBJECTDIR}/_ext/1033058136/http_server.o ${OBJECTDIR}/_ext/1033058136/berkeley_api.o ${OBJECTDIR}/_ext/1033058136/icmpv6.o ${OBJECTDIR}/_ext/1033058136/http.o ${OBJECTDIR}/_ext/1033058136/sntp.o ${OBJECTDIR}/_ext/1033058136/zero_conf_helper.o ${OBJECTDIR}/_ext/1033058136/ipv6.o ${OBJECTDIR}/_ext/1033058136/smtpc.o ${OBJECTDIR}/_ext/1033058136/dnss.o ${OBJECTDIR}/_ext/1033058136/dhcpv6.o ${OBJECTDIR}/_ext/1033058136/igmp.o ${OBJECTDIR}/_ext/1033058136/ftpc.o ${OBJECTDIR}/_ext/1033058136/zero_conf_multicast_dns.o ${OBJECTDIR}/_ext/1033058136/zero_conf_link_local.o ${OBJECTDIR}/_ext/1033058136/ndp.o ${OBJECTDIR}/_ext/1033058136/iperf.o ${OBJECTDIR}/_ext/1033058136/nbns.o ${OBJECTDIR}/_ext/1033058136/snmpv3.o ${OBJECTDIR}/_ext/1033058136/ftp.o ${OBJECTDIR}/_ext/1033058136/snmpv3_usm.o ${OBJECTDIR}/_ext/1033058136/ddns.o ${OBJECTDIR}/_ext/1033058136/snmp.o ${OBJECTDIR}/_ext/1508031553/net_pres.o ${OBJECTDIR}/_ext/1640433940/net_pres_enc_glue.o ${OBJECTDIR}/_ext/1640433940/net_pres_cert_store.o ${OBJECTDIR}/_ext/1264217935/ota_service.o ${OBJECTDIR}/_ext/1264217935/ota_service_file_handler.o ${OBJECTDIR}/_ext/1264217935/ota_service_transport_ble.o ${OBJECTDIR}/_ext/60163342/plib_adc.o ${OBJECTDIR}/_ext/60165520/plib_clk.o ${OBJECTDIR}/_ext/1249264884/plib_coretimer.o ${OBJECTDIR}/_ext/1865200349/plib_evic.o ${OBJECTDIR}/_ext/1865254177/plib_gpio.o ${OBJECTDIR}/_ext/60176403/plib_nvm.o ${OBJECTDIR}/_ext/60179596/plib_ram.o ${OBJECTDIR}/_ext/1865657120/plib_uart1.o ${OBJECTDIR}/_ext/1865657120/plib_uart2.o ${OBJECTDIR}/_ext/1865657120/plib_uart3.o ${OBJECTDIR}/_ext/1865657120/plib_uart4.o ${OBJECTDIR}/_ext/1529315265/rnbd_interface.o ${OBJECTDIR}/_ext/163028504/xc32_monitor.o ${OBJECTDIR}/_ext/1376093119/sys_command.o ${OBJECTDIR}/_ext/1832805299/sys_console_usb_cdc.o ${OBJECTDIR}/_ext/1832805299/sys_console.o ${OBJECTDIR}/_ext/411819097/ff.o ${OBJECTDIR}/_ext/411819097/ffunicode.o ${OBJECTDIR}/_ext/565198302/diskio.o ${OBJECTDIR}/_ext/1269487135/sys_fs_media_manager.o ${OBJECTDIR}/_ext/1269487135/sys_fs_fat_interface.o ${OBJECTDIR}/_ext/1269487135/sys_fs.o ${OBJECTDIR}/_ext/1000052432/sys_reset.o ${OBJECTDIR}/_ext/101884895/sys_time.o ${OBJECTDIR}/_ext/753841488/sys_time_h2_adapter.o ${OBJECTDIR}/_ext/2056773213/mqtt_net_glue.o ${OBJECTDIR}/_ext/308758920/usb_device_cdc.o ${OBJECTDIR}/_ext/308758920/usb_device_cdc_acm.o ${OBJECTDIR}/_ext/308758920/usb_device.o ${OBJECTDIR}/_ext/308758920/usb_host_generic.o ${OBJECTDIR}/_ext/308758920/usb_host_cdc.o ${OBJECTDIR}/_ext/308758920/usb_host_cdc_acm.o ${OBJECTDIR}/_ext/308758920/usb_host.o ${OBJECTDIR}/_ext/308758920/usb_host_hid.o ${OBJECTDIR}/_ext/1171490990/exceptions.o ${OBJECTDIR}/_ext/1171490990/interrupts.o ${OBJECTDIR}/_ext/1171490990/initialization.o ${OBJECTDIR}/_ext/1171490990/interrupts_a.o ${OBJECTDIR}/_ext/1171490990/freertos_hooks.o ${OBJECTDIR}/_ext/1171490990/usb_device_init_data.o ${OBJECTDIR}/_ext/1665200909/heap_1.o ${OBJECTDIR}/_ext/951553248/port.o ${OBJECTDIR}/_ext/951553248/port_asm.o ${OBJECTDIR}/_ext/404212886/list.o ${OBJECTDIR}/_ext/404212886/timers.o ${OBJECTDIR}/_ext/404212886/queue.o ${OBJECTDIR}/_ext/404212886/event_groups.o ${OBJECTDIR}/_ext/404212886/croutine.o ${OBJECTDIR}/_ext/404212886/stream_buffer.o ${OBJECTDIR}/_ext/404212886/FreeRTOS_tasks.o ${OBJECTDIR}/_ext/603994634/MCHP_pic32mzw1.o ${OBJECTDIR}/_ext/741293594/MQTTClient.o ${OBJECTDIR}/_ext/980053345/MQTTConnectServer.o ${OBJECTDIR}/_ext/980053345/MQTTUnsubscribeServer.o ${OBJECTDIR}/_ext/980053345/MQTTUnsubscribeClient.o ${OBJECTDIR}/_ext/980053345/MQTTConnectClient.o ${OBJECTDIR}/_ext/980053345/MQTTPacket.o ${OBJECTDIR}/_ext/980053345/MQTTSubscribeServer.o ${OBJECTDIR}/_ext/980053345/MQTTDeserializePublish.o ${OBJECTDIR}/_ext/980053345/MQTTSubscribeClient.o ${OBJECTDIR}/_ext/980053345/MQTTFormat.o ${OBJECTDIR}/_ext/980053345/MQTTSerializePublish.o ${OBJECTDIR}/_ext/1018957768/rnbd.o ${OBJECTDIR}/_ext/751086310/mqtt_packet.o ${OBJECTDIR}/_ext/751086310/mqtt_socket.o ${OBJECTDIR}/_ext/751086310/mqtt_client.o ${OBJECTDIR}/_ext/172253694/crypt_sha1_sam11105.o ${OBJECTDIR}/_ext/172253694/crypt_sha512_sam6156.o ${OBJECTDIR}/_ext/172253694/crypt_rsa_pukcl.o ${OBJECTDIR}/_ext/172253694/crypt_sha384_sam6156.o ${OBJECTDIR}/_ext/172253694/crypt_ecc_ba414e.o ${OBJECTDIR}/_ext/172253694/crypt_pukcl_functions.o ${OBJECTDIR}/_ext/172253694/crypt_sha1_sam6156.o ${OBJECTDIR}/_ext/172253694/crypt_sam_u2803.o ${OBJECTDIR}/_ext/172253694/crypt_rng_u2242.o ${OBJECTDIR}/_ext/172253694/crypt_rng_sam6334.o ${OBJECTDIR}/_ext/172253694/pic32mz-crypt.o ${OBJECTDIR}/_ext/172253694/crypt_sha224_sam11105.o ${OBJECTDIR}/_ext/172253694/crypt_sha256_sam6156.o ${OBJECTDIR}/_ext/172253694/crypt_tdes_sam6150.o ${OBJECTDIR}/_ext/172253694/crypt_aes_sam6149.o ${OBJECTDIR}/_ext/172253694/crypt_aes_u2238.o ${OBJECTDIR}/_ext/172253694/crypt_ecc_pukcl.o ${OBJECTDIR}/_ext/172253694/crypt_wolfcryptcb.o ${OBJECTDIR}/_ext/172253694/crypt_sha256_sam11105.o ${OBJECTDIR}/_ext/172253694/crypt_sha224_sam6156.o ${OBJECTDIR}/_ext/1664057780/siphash.o ${OBJECTDIR}/_ext/1664057780/srp.o ${OBJECTDIR}/_ext/1664057780/ext_kyber.o ${OBJECTDIR}/_ext/1664057780/eccsi.o ${OBJECTDIR}/_ext/1664057780/sha.o ${OBJECTDIR}/_ext/1664057780/dsa.o ${OBJECTDIR}/_ext/1664057780/falcon.o ${OBJECTDIR}/_ext/1664057780/arc4.o ${OBJECTDIR}/_ext/1664057780/sha256.o ${OBJECTDIR}/_ext/1664057780/wc_lms.o ${OBJECTDIR}/_ext/1664057780/rsa.o ${OBJECTDIR}/_ext/1664057780/sakke.o ${OBJECTDIR}/_ext/1664057780/error.o ${OBJECTDIR}/_ext/1664057780/md5.o ${OBJECTDIR}/_ext/1664057780/tfm.o ${OBJECTDIR}/_ext/1664057780/aes.o ${OBJECTDIR}/_ext/1664057780/sp_sm2_arm64.o ${OBJECTDIR}/_ext/1664057780/logging.o ${OBJECTDIR}/_ext/1664057780/dh.o ${OBJECTDIR}/_ext/1664057780/cmac.o ${OBJECTDIR}/_ext/1664057780/signature.o ${OBJECTDIR}/_ext/1664057780/sp_int.o ${OBJECTDIR}/_ext/1664057780/md4.o ${OBJECTDIR}/_ext/1664057780/wc_dsp.o ${OBJECTDIR}/_ext/1664057780/sp_x86_64.o ${OBJECTDIR}/_ext/1664057780/sp_sm2_armthumb.o ${OBJECTDIR}/_ext/1664057780/asm.o ${OBJECTDIR}/_ext/1664057780/poly1305.o ${OBJECTDIR}/_ext/1664057780/hmac.o ${OBJECTDIR}/_ext/1664057780/sm4.o ${OBJECTDIR}/_ext/1664057780/compress.o ${OBJECTDIR}/_ext/1664057780/hash.o ${OBJECTDIR}/_ext/1664057780/asn.o ${OBJECTDIR}/_ext/1664057780/pwdbased.o ${OBJECTDIR}/_ext/1664057780/md2.o ${OBJECTDIR}/_ext/1664057780/ext_lms.o ${OBJECTDIR}/_ext/1664057780/sp_armthumb.o ${OBJECTDIR}/_ext/1664057780/ed448.o ${OBJECTDIR}/_ext/1664057780/coding.o ${OBJECTDIR}/_ext/1664057780/ecc_fp.o ${OBJECTDIR}/_ext/1664057780/kdf.o ${OBJECTDIR}/_ext/1664057780/cpuid.o ${OBJECTDIR}/_ext/1664057780/sm2.o ${OBJECTDIR}/_ext/1664057780/ripemd.o ${OBJECTDIR}/_ext/1664057780/sp_sm2_cortexm.o ${OBJECTDIR}/_ext/1664057780/sp_sm2_x86_64.o ${OBJECTDIR}/_ext/1664057780/sphincs.o ${OBJECTDIR}/_ext/1664057780/fe_low_mem.o ${OBJECTDIR}/_ext/1664057780/sm3.o ${OBJECTDIR}/_ext/1664057780/pkcs12.o ${OBJECTDIR}/_ext/1664057780/wolfmath.o ${OBJECTDIR}/_ext/1664057780/sp_arm32.o ${OBJECTDIR}/_ext/1664057780/chacha.o ${OBJECTDIR}/_ext/1664057780/wc_xmss.o ${OBJECTDIR}/_ext/1664057780/sha3.o ${OBJECTDIR}/_ext/1664057780/fe_operations.o ${OBJECTDIR}/_ext/1664057780/camellia.o ${OBJECTDIR}/_ext/1664057780/cryptocb.o ${OBJECTDIR}/_ext/1664057780/wc_xmss_impl.o ${OBJECTDIR}/_ext/1664057780/des3.o ${OBJECTDIR}/_ext/1664057780/ext_xmss.o ${OBJECTDIR}/_ext/1664057780/ge_448.o ${OBJECTDIR}/_ext/1664057780/pkcs7.o ${OBJECTDIR}/_ext/1664057780/sp_cortexm.o ${OBJECTDIR}/_ext/1664057780/wc_port.o ${OBJECTDIR}/_ext/1664057780/ed25519.o ${OBJECTDIR}/_ext/1664057780/sha512.o ${OBJECTDIR}/_ext/1664057780/memory.o ${OBJECTDIR}/_ext/1664057780/blake2b.o ${OBJECTDIR}/_ext/1664057780/curve25519.o ${OBJECTDIR}/_ext/1664057780/misc.o ${OBJECTDIR}/_ext/1664057780/sp_sm2_c32.o ${OBJECTDIR}/_ext/1664057780/random.o ${OBJECTDIR}/_ext/1664057780/rc2.o ${OBJECTDIR}/_ext/1664057780/ge_low_mem.o ${OBJECTDIR}/_ext/1664057780/sp_sm2_arm32.o ${OBJECTDIR}/_ext/1664057780/blake2s.o ${OBJECTDIR}/_ext/1664057780/sp_sm2_c64.o ${OBJECTDIR}/_ext/1664057780/sp_c64.o ${OBJECTDIR}/_ext/1664057780/wc_encrypt.o ${OBJECTDIR}/_ext/1664057780/wc_lms_impl.o ${OBJECTDIR}/_ext/1664057780/hpke.o ${OBJECTDIR}/_ext/1664057780/ecc.o ${OBJECTDIR}/_ext/1664057780/evp.o ${OBJECTDIR}/_ext/1664057780/sp_arm64.o ${OBJECTDIR}/_ext/1664057780/wc_kyber.o ${OBJECTDIR}/_ext/1664057780/wolfevent.o ${OBJECTDIR}/_ext/1664057780/integer.o ${OBJECTDIR}/_ext/1664057780/ge_operations.o ${OBJECTDIR}/_ext/1664057780/sp_dsp32.o ${OBJECTDIR}/_ext/1664057780/sp_c32.o ${OBJECTDIR}/_ext/1664057780/dilithium.o ${OBJECTDIR}/_ext/1664057780/chacha20_poly1305.o ${OBJECTDIR}/_ext/1664057780/wc_pkcs11.o ${OBJECTDIR}/_ext/1664057780/wc_kyber_poly.o ${OBJECTDIR}/_ext/1664057780/curve448.o ${OBJECTDIR}/_ext/1664057780/fe_448.o ${OBJECTDIR}/_ext/2046716756/x509.o ${OBJECTDIR}/_ext/2046716756/ssl_bn.o ${OBJECTDIR}/_ext/2046716756/keys.o ${OBJECTDIR}/_ext/2046716756/x509_str.o ${OBJECTDIR}/_ext/2046716756/tls13.o ${OBJECTDIR}/_ext/2046716756/ssl_certman.o ${OBJECTDIR}/_ext/2046716756/ocsp.o ${OBJECTDIR}/_ext/2046716756/internal.o ${OBJECTDIR}/_ext/2046716756/pk.o ${OBJECTDIR}/_ext/2046716756/quic.o ${OBJECTDIR}/_ext/2046716756/ssl_crypto.o ${OBJECTDIR}/_ext/2046716756/ssl_misc.o ${OBJECTDIR}/_ext/2046716756/ssl.o ${OBJECTDIR}/_ext/2046716756/wolfio.o ${OBJECTDIR}/_ext/2046716756/sniffer.o ${OBJECTDIR}/_ext/2046716756/ssl_asn1.o ${OBJECTDIR}/_ext/2046716756/tls.o ${OBJECTDIR}/_ext/2046716756/dtls13.o ${OBJECTDIR}/_ext/2046716756/dtls.o ${OBJECTDIR}/_ext/2046716756/crl.o ${OBJECTDIR}/_ext/2046716756/conf.o ${OBJECTDIR}/_ext/905221350/zutil.o ${OBJECTDIR}/_ext/905221350/crc32.o ${OBJECTDIR}/_ext/905221350/deflate.o ${OBJECTDIR}/_ext/905221350/adler32.o ${OBJECTDIR}/_ext/905221350/uncompr.o ${OBJECTDIR}/_ext/905221350/inflate.o ${OBJECTDIR}/_ext/905221350/trees.o ${OBJECTDIR}/_ext/905221350/inffast.o ${OBJECTDIR}/_ext/905221350/infback.o ${OBJECTDIR}/_ext/905221350/compress.o ${OBJECTDIR}/_ext/905221350/gzclose.o ${OBJECTDIR}/_ext/905221350/inftrees.o ${OBJECTDIR}/_ext/1360937237/main.o ${OBJECTDIR}/_ext/1360937237/http_server_print.o ${OBJECTDIR}/_ext/1360937237/custom_http_server_app.o ${OBJECTDIR}/_ext/1360937237/custom_snmp_app.o ${OBJECTDIR}/_ext/1360937237/app_mqtt_task.o ${OBJECTDIR}/_ext/1360937237/custom_http_app.o ${OBJECTDIR}/_ext/1360937237/http_print.o ${OBJECTDIR}/_ext/1832805299/sys_console_uart.o ${OBJECTDIR}/_ext/2128569739/drv_usbfs_host.o ${OBJECTDIR}/_ext/944882569/sys_debug.o
+OBJECTFILES=${OBJECTDIR}/_ext/1434821282/bsp.o ${OBJECTDIR}/_ext/1645245335/crypto.o ${OBJECTDIR}/_ext/732082881/drv_eth_pic32_lib.o ${OBJECTDIR}/_ext/732082881/drv_ethmac_lib.o ${OBJECTDIR}/_ext/732082881/drv_ethmac.o ${OBJECTDIR}/_ext/444070925/drv_ethphy.o ${OBJECTDIR}/_ext/444070925/drv_extphy_dp83848.o ${OBJECTDIR}/_ext/992804092/drv_memory.o ${OBJECTDIR}/_ext/438849557/drv_miim_pic32m.o ${OBJECTDIR}/_ext/438849557/drv_miim.o ${OBJECTDIR}/_ext/2128569739/drv_usbfs.o ${OBJECTDIR}/_ext/1433595199/trust_pkcs11_config.o ${OBJECTDIR}/_ext/35538813/atcacert_pem.o ${OBJECTDIR}/_ext/35538813/atcacert_der.o ${OBJECTDIR}/_ext/35538813/atcacert_date.o ${OBJECTDIR}/_ext/35538813/atcacert_def.o ${OBJECTDIR}/_ext/35538813/atcacert_host_sw.o ${OBJECTDIR}/_ext/35538813/atcacert_host_hw.o ${OBJECTDIR}/_ext/35538813/atcacert_client.o ${OBJECTDIR}/_ext/2017208766/sha2_routines.o ${OBJECTDIR}/_ext/2017208766/sha1_routines.o ${OBJECTDIR}/_ext/1352206537/atca_crypto_hw_aes_ccm.o ${OBJECTDIR}/_ext/1352206537/atca_crypto_hw_aes_cbcmac.o ${OBJECTDIR}/_ext/1352206537/atca_crypto_sw_sha2.o ${OBJECTDIR}/_ext/1352206537/atca_crypto_pad.o ${OBJECTDIR}/_ext/1352206537/atca_crypto_sw_aes_cmac.o ${OBJECTDIR}/_ext/1352206537/atca_crypto_hw_aes_cmac.o ${OBJECTDIR}/_ext/1352206537/atca_crypto_pbkdf2.o ${OBJECTDIR}/_ext/1352206537/atca_crypto_sw_aes_gcm.o ${OBJECTDIR}/_ext/1352206537/atca_crypto_hw_aes_ctr.o ${OBJECTDIR}/_ext/1352206537/atca_crypto_sw_sha1.o ${OBJECTDIR}/_ext/1352206537/atca_crypto_hw_aes_cbc.o ${OBJECTDIR}/_ext/1390037109/hal_gpio_harmony.o ${OBJECTDIR}/_ext/1390037109/hal_pic32_delay.o ${OBJECTDIR}/_ext/1390037109/kit_protocol.o ${OBJECTDIR}/_ext/1390037109/atca_hal.o ${OBJECTDIR}/_ext/1390037109/hal_freertos.o ${OBJECTDIR}/_ext/1390034497/atca_jwt.o ${OBJECTDIR}/_ext/403825799/ascii_kit_host.o ${OBJECTDIR}/_ext/1717266195/pkcs11_signature.o ${OBJECTDIR}/_ext/1717266195/pkcs11_attrib.o ${OBJECTDIR}/_ext/1717266195/pkcs11_key.o ${OBJECTDIR}/_ext/1717266195/pkcs11_debug.o ${OBJECTDIR}/_ext/1717266195/pkcs11_info.o ${OBJECTDIR}/_ext/1717266195/pkcs11_init.o ${OBJECTDIR}/_ext/1717266195/pkcs11_token.o ${OBJECTDIR}/_ext/1717266195/pkcs11_slot.o ${OBJECTDIR}/_ext/1717266195/pkcs11_main.o ${OBJECTDIR}/_ext/1717266195/pkcs11_encrypt.o ${OBJECTDIR}/_ext/1717266195/pkcs11_object.o ${OBJECTDIR}/_ext/1717266195/pkcs11_cert.o ${OBJECTDIR}/_ext/1717266195/pkcs11_util.o ${OBJECTDIR}/_ext/1717266195/pkcs11_os.o ${OBJECTDIR}/_ext/1717266195/pkcs11_config.o ${OBJECTDIR}/_ext/1717266195/pkcs11_session.o ${OBJECTDIR}/_ext/1717266195/pkcs11_find.o ${OBJECTDIR}/_ext/1717266195/pkcs11_mech.o ${OBJECTDIR}/_ext/1717266195/pkcs11_digest.o ${OBJECTDIR}/_ext/375000855/atca_tests_updateextra.o ${OBJECTDIR}/_ext/375000855/atca_tests_secureboot.o ${OBJECTDIR}/_ext/375000855/atca_tests_hmac.o ${OBJECTDIR}/_ext/375000855/test_atcab.o ${OBJECTDIR}/_ext/375000855/atca_tests_ecdh.o ${OBJECTDIR}/_ext/375000855/atca_tests_aes_cbcmac.o ${OBJECTDIR}/_ext/375000855/atca_tests_info.o ${OBJECTDIR}/_ext/375000855/atca_tests_sha.o ${OBJECTDIR}/_ext/375000855/atca_tests_sign.o ${OBJECTDIR}/_ext/375000855/atca_tests_privwrite.o ${OBJECTDIR}/_ext/375000855/atca_tests_aes_ccm.o ${OBJECTDIR}/_ext/375000855/atca_tests_read.o ${OBJECTDIR}/_ext/375000855/atca_tests_aes_cmac.o ${OBJECTDIR}/_ext/375000855/atca_tests_aes.o ${OBJECTDIR}/_ext/375000855/atca_tests_write.o ${OBJECTDIR}/_ext/375000855/atca_tests_random.o ${OBJECTDIR}/_ext/375000855/atca_tests_lock.o ${OBJECTDIR}/_ext/375000855/atca_tests_aes_cbc.o ${OBJECTDIR}/_ext/375000855/atca_tests_aes_gcm.o ${OBJECTDIR}/_ext/375000855/atca_tests_helper.o ${OBJECTDIR}/_ext/375000855/atca_tests_kdf.o ${OBJECTDIR}/_ext/375000855/atca_tests_mac.o ${OBJECTDIR}/_ext/375000855/atca_tests_verify.o ${OBJECTDIR}/_ext/375000855/atca_tests_aes_ctr.o ${OBJECTDIR}/_ext/375000855/atca_tests_startup.o ${OBJECTDIR}/_ext/375000855/atca_tests_derivekey.o ${OBJECTDIR}/_ext/375000855/atca_tests_counter.o ${OBJECTDIR}/_ext/375000855/atca_tests_nonce.o ${OBJECTDIR}/_ext/375000855/atca_tests_genkey.o ${OBJECTDIR}/_ext/375000855/atca_tests_buffer.o ${OBJECTDIR}/_ext/375000855/atca_tests_gendig.o ${OBJECTDIR}/_ext/375000855/atca_tests_otpzero.o ${OBJECTDIR}/_ext/375000855/atca_tests_selftest.o ${OBJECTDIR}/_ext/376290765/test_calib.o ${OBJECTDIR}/_ext/376290765/test_calib_config.o ${OBJECTDIR}/_ext/376290765/test_calib_info.o ${OBJECTDIR}/_ext/376290765/test_calib_delete.o ${OBJECTDIR}/_ext/1203793637/test_crypto.o ${OBJECTDIR}/_ext/1203793637/test_crypto_pk.o ${OBJECTDIR}/_ext/1203793637/test_crypto_sha.o ${OBJECTDIR}/_ext/1203793637/test_crypto_aes.o ${OBJECTDIR}/_ext/1203793637/test_crypto_pbkdf2.o ${OBJECTDIR}/_ext/1203793637/test_crypto_pad.o ${OBJECTDIR}/_ext/487095990/test_cert_def_5_device.o ${OBJECTDIR}/_ext/487095990/test_cert_def_16_signer.o ${OBJECTDIR}/_ext/487095990/test_cert_def_12_device.o ${OBJECTDIR}/_ext/487095990/test_atcacert_client.o ${OBJECTDIR}/_ext/487095990/test_atcacert_date.o ${OBJECTDIR}/_ext/487095990/test_atcacert_der_integer.o ${OBJECTDIR}/_ext/487095990/test_cert_def_10_device.o ${OBJECTDIR}/_ext/487095990/test_cert_def_13_signer.o ${OBJECTDIR}/_ext/487095990/test_cert_def_1_signer.o ${OBJECTDIR}/_ext/487095990/test_cert_def_15_device_csr.o ${OBJECTDIR}/_ext/487095990/test_cert_def_11_signer.o ${OBJECTDIR}/_ext/487095990/test_cert_def_9_device.o ${OBJECTDIR}/_ext/487095990/test_cert_def_2_device_csr.o ${OBJECTDIR}/_ext/487095990/test_atcacert_der_ecdsa_sig_value.o ${OBJECTDIR}/_ext/487095990/test_atcacert_host_sw.o ${OBJECTDIR}/_ext/487095990/test_cert_def_7_signer.o ${OBJECTDIR}/_ext/487095990/test_atcacert_host_hw.o ${OBJECTDIR}/_ext/487095990/test_cert_def_4_device.o ${OBJECTDIR}/_ext/487095990/test_cert_def_14_device.o ${OBJECTDIR}/_ext/487095990/test_atcacert_def.o ${OBJECTDIR}/_ext/487095990/test_cert_def_6_device.o ${OBJECTDIR}/_ext/487095990/test_cert_def_3_device.o ${OBJECTDIR}/_ext/487095990/test_atcacert.o ${OBJECTDIR}/_ext/487095990/test_cert_def_0_device.o ${OBJECTDIR}/_ext/487095990/test_cert_def_8_signer.o ${OBJECTDIR}/_ext/487095990/test_atcacert_der_length.o ${OBJECTDIR}/_ext/1164389986/test_hal_basic.o ${OBJECTDIR}/_ext/1164389986/test_hal.o ${OBJECTDIR}/_ext/1362789921/test_integration.o ${OBJECTDIR}/_ext/1362789921/test_mbedtls.o ${OBJECTDIR}/_ext/1164387374/atca_jwt_test.o ${OBJECTDIR}/_ext/597494043/aes_cmac_nist_vectors.o ${OBJECTDIR}/_ext/597494043/pkcs7_pad_vectors.o ${OBJECTDIR}/_ext/597494043/vector_utils.o ${OBJECTDIR}/_ext/597494043/ecdsa_nist_vectors.o ${OBJECTDIR}/_ext/597494043/aes_gcm_nist_vectors.o ${OBJECTDIR}/_ext/597494043/pbkdf2_sha256_vectors.o ${OBJECTDIR}/_ext/597494043/ecdh_nist_vectors.o ${OBJECTDIR}/_ext/141115750/atca_test_console.o ${OBJECTDIR}/_ext/141115750/cmd-processor.o ${OBJECTDIR}/_ext/141115750/atca_test.o ${OBJECTDIR}/_ext/141115750/atca_test_config.o ${OBJECTDIR}/_ext/141115750/atca_utils_atecc608.o ${OBJECTDIR}/_ext/1882585300/unity.o ${OBJECTDIR}/_ext/1882585300/unity_memory.o ${OBJECTDIR}/_ext/1882585300/unity_fixture.o ${OBJECTDIR}/_ext/701127929/atca_cfgs.o ${OBJECTDIR}/_ext/701127929/atca_helpers.o ${OBJECTDIR}/_ext/701127929/atca_iface.o ${OBJECTDIR}/_ext/701127929/atca_basic.o ${OBJECTDIR}/_ext/701127929/atca_device.o ${OBJECTDIR}/_ext/701127929/cal_buffer.o ${OBJECTDIR}/_ext/701127929/atca_debug.o ${OBJECTDIR}/_ext/1033058136/helpers.o ${OBJECTDIR}/_ext/1751889202/sys_fs_shell.o ${OBJECTDIR}/_ext/1033058136/tcpip_heap_internal.o ${OBJECTDIR}/_ext/1033058136/tcpip_heap_class.o ${OBJECTDIR}/_ext/1033058136/tcpip_notify.o ${OBJECTDIR}/_ext/1033058136/tcpip_manager.o ${OBJECTDIR}/_ext/1033058136/oahash.o ${OBJECTDIR}/_ext/1033058136/tcpip_packet.o ${OBJECTDIR}/_ext/1033058136/tcpip_helpers.o ${OBJECTDIR}/_ext/1033058136/tcpip_helper_c32.o ${OBJECTDIR}/_ext/1033058136/tcpip_heap_alloc.o ${OBJECTDIR}/_ext/1033058136/hash_fnv.o ${OBJECTDIR}/_ext/1033058136/dhcp.o ${OBJECTDIR}/_ext/1033058136/dns.o ${OBJECTDIR}/_ext/1033058136/tcpip_commands.o ${OBJECTDIR}/_ext/1033058136/telnet.o ${OBJECTDIR}/_ext/1033058136/tcpip_announce.o ${OBJECTDIR}/_ext/1033058136/ipv4.o ${OBJECTDIR}/_ext/1033058136/udp.o ${OBJECTDIR}/_ext/1033058136/icmp.o ${OBJECTDIR}/_ext/1033058136/tcp.o ${OBJECTDIR}/_ext/1033058136/arp.o ${OBJECTDIR}/_ext/1033058136/http_server.o ${OBJECTDIR}/_ext/1033058136/berkeley_api.o ${OBJECTDIR}/_ext/1033058136/icmpv6.o ${OBJECTDIR}/_ext/1033058136/http.o ${OBJECTDIR}/_ext/1033058136/sntp.o ${OBJECTDIR}/_ext/1033058136/zero_conf_helper.o ${OBJECTDIR}/_ext/1033058136/ipv6.o ${OBJECTDIR}/_ext/1033058136/smtpc.o ${OBJECTDIR}/_ext/1033058136/dnss.o ${OBJECTDIR}/_ext/1033058136/dhcpv6.o ${OBJECTDIR}/_ext/1033058136/igmp.o ${OBJECTDIR}/_ext/1033058136/ftpc.o ${OBJECTDIR}/_ext/1033058136/zero_conf_multicast_dns.o ${OBJECTDIR}/_ext/1033058136/zero_conf_link_local.o ${OBJECTDIR}/_ext/1033058136/ndp.o ${OBJECTDIR}/_ext/1033058136/iperf.o ${OBJECTDIR}/_ext/1033058136/nbns.o ${OBJECTDIR}/_ext/1033058136/snmpv3.o ${OBJECTDIR}/_ext/1033058136/ftp.o ${OBJECTDIR}/_ext/1033058136/snmpv3_usm.o ${OBJECTDIR}/_ext/1033058136/ddns.o ${OBJECTDIR}/_ext/1033058136/snmp.o ${OBJECTDIR}/_ext/1508031553/net_pres.o ${OBJECTDIR}/_ext/1640433940/net_pres_enc_glue.o ${OBJECTDIR}/_ext/1640433940/net_pres_cert_store.o ${OBJECTDIR}/_ext/1264217935/ota_service.o ${OBJECTDIR}/_ext/1264217935/ota_service_file_handler.o ${OBJECTDIR}/_ext/1264217935/ota_service_transport_ble.o ${OBJECTDIR}/_ext/60163342/plib_adc.o ${OBJECTDIR}/_ext/60165520/plib_clk.o ${OBJECTDIR}/_ext/1249264884/plib_coretimer.o ${OBJECTDIR}/_ext/1865200349/plib_evic.o ${OBJECTDIR}/_ext/1865254177/plib_gpio.o ${OBJECTDIR}/_ext/60176403/plib_nvm.o ${OBJECTDIR}/_ext/60179596/plib_ram.o ${OBJECTDIR}/_ext/1865657120/plib_uart1.o ${OBJECTDIR}/_ext/1865657120/plib_uart2.o ${OBJECTDIR}/_ext/1865657120/plib_uart3.o ${OBJECTDIR}/_ext/1865657120/plib_uart4.o ${OBJECTDIR}/_ext/1529315265/rnbd_interface.o ${OBJECTDIR}/_ext/163028504/xc32_monitor.o ${OBJECTDIR}/_ext/1376093119/sys_command.o ${OBJECTDIR}/_ext/1832805299/sys_console_usb_cdc.o ${OBJECTDIR}/_ext/1832805299/sys_console.o ${OBJECTDIR}/_ext/411819097/ff.o ${OBJECTDIR}/_ext/411819097/ffunicode.o ${OBJECTDIR}/_ext/565198302/diskio.o ${OBJECTDIR}/_ext/1269487135/sys_fs_media_manager.o ${OBJECTDIR}/_ext/1269487135/sys_fs_fat_interface.o ${OBJECTDIR}/_ext/1269487135/sys_fs.o ${OBJECTDIR}/_ext/1000052432/sys_reset.o ${OBJECTDIR}/_ext/101884895/sys_time.o ${OBJECTDIR}/_ext/753841488/sys_time_h2_adapter.o ${OBJECTDIR}/_ext/2056773213/mqtt_net_glue.o ${OBJECTDIR}/_ext/308758920/usb_device_cdc.o ${OBJECTDIR}/_ext/308758920/usb_device_cdc_acm.o ${OBJECTDIR}/_ext/308758920/usb_device.o ${OBJECTDIR}/_ext/308758920/usb_host_generic.o ${OBJECTDIR}/_ext/308758920/usb_host_cdc.o ${OBJECTDIR}/_ext/308758920/usb_host_cdc_acm.o ${OBJECTDIR}/_ext/308758920/usb_host.o ${OBJECTDIR}/_ext/308758920/usb_host_hid.o ${OBJECTDIR}/_ext/1171490990/exceptions.o ${OBJECTDIR}/_ext/1171490990/interrupts.o ${OBJECTDIR}/_ext/1171490990/initialization.o ${OBJECTDIR}/_ext/1171490990/interrupts_a.o ${OBJECTDIR}/_ext/1171490990/freertos_hooks.o ${OBJECTDIR}/_ext/1171490990/usb_device_init_data.o ${OBJECTDIR}/_ext/1665200909/heap_1.o ${OBJECTDIR}/_ext/951553248/port.o ${OBJECTDIR}/_ext/951553248/port_asm.o ${OBJECTDIR}/_ext/404212886/list.o ${OBJECTDIR}/_ext/404212886/timers.o ${OBJECTDIR}/_ext/404212886/queue.o ${OBJECTDIR}/_ext/404212886/event_groups.o ${OBJECTDIR}/_ext/404212886/croutine.o ${OBJECTDIR}/_ext/404212886/stream_buffer.o ${OBJECTDIR}/_ext/404212886/FreeRTOS_tasks.o ${OBJECTDIR}/_ext/603994634/MCHP_pic32mzw1.o ${OBJECTDIR}/_ext/741293594/MQTTClient.o ${OBJECTDIR}/_ext/980053345/MQTTConnectServer.o ${OBJECTDIR}/_ext/980053345/MQTTUnsubscribeServer.o ${OBJECTDIR}/_ext/980053345/MQTTUnsubscribeClient.o ${OBJECTDIR}/_ext/980053345/MQTTConnectClient.o ${OBJECTDIR}/_ext/980053345/MQTTPacket.o ${OBJECTDIR}/_ext/980053345/MQTTSubscribeServer.o ${OBJECTDIR}/_ext/980053345/MQTTDeserializePublish.o ${OBJECTDIR}/_ext/980053345/MQTTSubscribeClient.o ${OBJECTDIR}/_ext/980053345/MQTTFormat.o ${OBJECTDIR}/_ext/980053345/MQTTSerializePublish.o ${OBJECTDIR}/_ext/1018957768/rnbd.o ${OBJECTDIR}/_ext/751086310/mqtt_packet.o ${OBJECTDIR}/_ext/751086310/mqtt_socket.o ${OBJECTDIR}/_ext/751086310/mqtt_client.o ${OBJECTDIR}/_ext/172253694/crypt_sha1_sam11105.o ${OBJECTDIR}/_ext/172253694/crypt_sha512_sam6156.o ${OBJECTDIR}/_ext/172253694/crypt_rsa_pukcl.o ${OBJECTDIR}/_ext/172253694/crypt_sha384_sam6156.o ${OBJECTDIR}/_ext/172253694/crypt_ecc_ba414e.o ${OBJECTDIR}/_ext/172253694/crypt_pukcl_functions.o ${OBJECTDIR}/_ext/172253694/crypt_sha1_sam6156.o ${OBJECTDIR}/_ext/172253694/crypt_sam_u2803.o ${OBJECTDIR}/_ext/172253694/crypt_rng_u2242.o ${OBJECTDIR}/_ext/172253694/crypt_rng_sam6334.o ${OBJECTDIR}/_ext/172253694/pic32mz-crypt.o ${OBJECTDIR}/_ext/172253694/crypt_sha224_sam11105.o ${OBJECTDIR}/_ext/172253694/crypt_sha256_sam6156.o ${OBJECTDIR}/_ext/172253694/crypt_tdes_sam6150.o ${OBJECTDIR}/_ext/172253694/crypt_aes_sam6149.o ${OBJECTDIR}/_ext/172253694/crypt_aes_u2238.o ${OBJECTDIR}/_ext/172253694/crypt_ecc_pukcl.o ${OBJECTDIR}/_ext/172253694/crypt_wolfcryptcb.o ${OBJECTDIR}/_ext/172253694/crypt_sha256_sam11105.o ${OBJECTDIR}/_ext/172253694/crypt_sha224_sam6156.o ${OBJECTDIR}/_ext/1664057780/siphash.o ${OBJECTDIR}/_ext/1664057780/srp.o ${OBJECTDIR}/_ext/1664057780/ext_kyber.o ${OBJECTDIR}/_ext/1664057780/eccsi.o ${OBJECTDIR}/_ext/1664057780/sha.o ${OBJECTDIR}/_ext/1664057780/dsa.o ${OBJECTDIR}/_ext/1664057780/falcon.o ${OBJECTDIR}/_ext/1664057780/arc4.o ${OBJECTDIR}/_ext/1664057780/sha256.o ${OBJECTDIR}/_ext/1664057780/wc_lms.o ${OBJECTDIR}/_ext/1664057780/rsa.o ${OBJECTDIR}/_ext/1664057780/sakke.o ${OBJECTDIR}/_ext/1664057780/error.o ${OBJECTDIR}/_ext/1664057780/md5.o ${OBJECTDIR}/_ext/1664057780/tfm.o ${OBJECTDIR}/_ext/1664057780/aes.o ${OBJECTDIR}/_ext/1664057780/sp_sm2_arm64.o ${OBJECTDIR}/_ext/1664057780/logging.o ${OBJECTDIR}/_ext/1664057780/dh.o ${OBJECTDIR}/_ext/1664057780/cmac.o ${OBJECTDIR}/_ext/1664057780/signature.o ${OBJECTDIR}/_ext/1664057780/sp_int.o ${OBJECTDIR}/_ext/1664057780/md4.o ${OBJECTDIR}/_ext/1664057780/wc_dsp.o ${OBJECTDIR}/_ext/1664057780/sp_x86_64.o ${OBJECTDIR}/_ext/1664057780/sp_sm2_armthumb.o ${OBJECTDIR}/_ext/1664057780/asm.o ${OBJECTDIR}/_ext/1664057780/poly1305.o ${OBJECTDIR}/_ext/1664057780/hmac.o ${OBJECTDIR}/_ext/1664057780/sm4.o ${OBJECTDIR}/_ext/1664057780/compress.o ${OBJECTDIR}/_ext/1664057780/hash.o ${OBJECTDIR}/_ext/1664057780/asn.o ${OBJECTDIR}/_ext/1664057780/pwdbased.o ${OBJECTDIR}/_ext/1664057780/md2.o ${OBJECTDIR}/_ext/1664057780/ext_lms.o ${OBJECTDIR}/_ext/1664057780/sp_armthumb.o ${OBJECTDIR}/_ext/1664057780/ed448.o ${OBJECTDIR}/_ext/1664057780/coding.o ${OBJECTDIR}/_ext/1664057780/ecc_fp.o ${OBJECTDIR}/_ext/1664057780/kdf.o ${OBJECTDIR}/_ext/1664057780/cpuid.o ${OBJECTDIR}/_ext/1664057780/sm2.o ${OBJECTDIR}/_ext/1664057780/ripemd.o ${OBJECTDIR}/_ext/1664057780/sp_sm2_cortexm.o ${OBJECTDIR}/_ext/1664057780/sp_sm2_x86_64.o ${OBJECTDIR}/_ext/1664057780/sphincs.o ${OBJECTDIR}/_ext/1664057780/fe_low_mem.o ${OBJECTDIR}/_ext/1664057780/sm3.o ${OBJECTDIR}/_ext/1664057780/pkcs12.o ${OBJECTDIR}/_ext/1664057780/wolfmath.o ${OBJECTDIR}/_ext/1664057780/sp_arm32.o ${OBJECTDIR}/_ext/1664057780/chacha.o ${OBJECTDIR}/_ext/1664057780/wc_xmss.o ${OBJECTDIR}/_ext/1664057780/sha3.o ${OBJECTDIR}/_ext/1664057780/fe_operations.o ${OBJECTDIR}/_ext/1664057780/camellia.o ${OBJECTDIR}/_ext/1664057780/cryptocb.o ${OBJECTDIR}/_ext/1664057780/wc_xmss_impl.o ${OBJECTDIR}/_ext/1664057780/des3.o ${OBJECTDIR}/_ext/1664057780/ext_xmss.o ${OBJECTDIR}/_ext/1664057780/ge_448.o ${OBJECTDIR}/_ext/1664057780/pkcs7.o ${OBJECTDIR}/_ext/1664057780/sp_cortexm.o ${OBJECTDIR}/_ext/1664057780/wc_port.o ${OBJECTDIR}/_ext/1664057780/ed25519.o ${OBJECTDIR}/_ext/1664057780/sha512.o ${OBJECTDIR}/_ext/1664057780/memory.o ${OBJECTDIR}/_ext/1664057780/blake2b.o ${OBJECTDIR}/_ext/1664057780/curve25519.o ${OBJECTDIR}/_ext/1664057780/misc.o ${OBJECTDIR}/_ext/1664057780/sp_sm2_c32.o ${OBJECTDIR}/_ext/1664057780/random.o ${OBJECTDIR}/_ext/1664057780/rc2.o ${OBJECTDIR}/_ext/1664057780/ge_low_mem.o ${OBJECTDIR}/_ext/1664057780/sp_sm2_arm32.o ${OBJECTDIR}/_ext/1664057780/blake2s.o ${OBJECTDIR}/_ext/1664057780/sp_sm2_c64.o ${OBJECTDIR}/_ext/1664057780/sp_c64.o ${OBJECTDIR}/_ext/1664057780/wc_encrypt.o ${OBJECTDIR}/_ext/1664057780/wc_lms_impl.o ${OBJECTDIR}/_ext/1664057780/hpke.o ${OBJECTDIR}/_ext/1664057780/ecc.o ${OBJECTDIR}/_ext/1664057780/evp.o ${OBJECTDIR}/_ext/1664057780/sp_arm64.o ${OBJECTDIR}/_ext/1664057780/wc_kyber.o ${OBJECTDIR}/_ext/1664057780/wolfevent.o ${OBJECTDIR}/_ext/1664057780/integer.o ${OBJECTDIR}/_ext/1664057780/ge_operations.o ${OBJECTDIR}/_ext/1664057780/sp_dsp32.o ${OBJECTDIR}/_ext/1664057780/sp_c32.o ${OBJECTDIR}/_ext/1664057780/dilithium.o ${OBJECTDIR}/_ext/1664057780/chacha20_poly1305.o ${OBJECTDIR}/_ext/1664057780/wc_pkcs11.o ${OBJECTDIR}/_ext/1664057780/wc_kyber_poly.o ${OBJECTDIR}/_ext/1664057780/curve448.o ${OBJECTDIR}/_ext/1664057780/fe_448.o ${OBJECTDIR}/_ext/2046716756/x509.o ${OBJECTDIR}/_ext/2046716756/ssl_bn.o ${OBJECTDIR}/_ext/2046716756/keys.o ${OBJECTDIR}/_ext/2046716756/x509_str.o ${OBJECTDIR}/_ext/2046716756/tls13.o ${OBJECTDIR}/_ext/2046716756/ssl_certman.o ${OBJECTDIR}/_ext/2046716756/ocsp.o ${OBJECTDIR}/_ext/2046716756/internal.o ${OBJECTDIR}/_ext/2046716756/pk.o ${OBJECTDIR}/_ext/2046716756/quic.o ${OBJECTDIR}/_ext/2046716756/ssl_crypto.o ${OBJECTDIR}/_ext/2046716756/ssl_misc.o ${OBJECTDIR}/_ext/2046716756/ssl.o ${OBJECTDIR}/_ext/2046716756/wolfio.o ${OBJECTDIR}/_ext/2046716756/sniffer.o ${OBJECTDIR}/_ext/2046716756/ssl_asn1.o ${OBJECTDIR}/_ext/2046716756/tls.o ${OBJECTDIR}/_ext/2046716756/dtls13.o ${OBJECTDIR}/_ext/2046716756/dtls.o ${OBJECTDIR}/_ext/2046716756/crl.o ${OBJECTDIR}/_ext/2046716756/conf.o ${OBJECTDIR}/_ext/905221350/zutil.o ${OBJECTDIR}/_ext/905221350/crc32.o ${OBJECTDIR}/_ext/905221350/deflate.o ${OBJECTDIR}/_ext/905221350/adler32.o ${OBJECTDIR}/_ext/905221350/uncompr.o ${OBJECTDIR}/_ext/905221350/inflate.o ${OBJECTDIR}/_ext/905221350/trees.o ${OBJECTDIR}/_ext/905221350/inffast.o ${OBJECTDIR}/_ext/905221350/infback.o ${OBJECTDIR}/_ext/905221350/compress.o ${OBJECTDIR}/_ext/905221350/gzclose.o ${OBJECTDIR}/_ext/905221350/inftrees.o ${OBJECTDIR}/_ext/1360937237/main.o ${OBJECTDIR}/_ext/1360937237/http_server_print.o ${OBJECTDIR}/_ext/1360937237/custom_http_server_app.o ${OBJECTDIR}/_ext/1360937237/custom_snmp_app.o ${OBJECTDIR}/_ext/1360937237/app_mqtt_task.o ${OBJECTDIR}/_ext/1360937237/custom_http_app.o ${OBJECTDIR}/_ext/1360937237/http_print.o ${OBJECTDIR}/_ext/1832805299/sys_console_uart.o ${OBJECTDIR}/_ext/2128569739/drv_usbfs_host.o ${OBJECTDIR}/_ext/944882569/sys_debug.o
 
 # Source Files
-SOURCEFILES=../src/config/default/bsp/bsp.c ../src/config/default/crypto/src/crypto.c ../src/config/default/driver/ethmac/src/dynamic/drv_eth_pic32_lib.c ../src/config/default/driver/ethmac/src/dynamic/drv_ethmac_lib.c ../src/config/default/driver/ethmac/src/dynamic/drv_ethmac.c ../src/config/default/driver/ethphy/src/dynamic/drv_ethphy.c ../src/config/default/driver/ethphy/src/dynamic/drv_extphy_dp83848.c ../src/config/default/driver/memory/src/drv_memory.c ../src/config/default/driver/miim/src/dynamic/drv_miim_pic32m.c ../src/config/default/driver/miim/src/dynamic/drv_miim.c ../src/config/default/driver/usb/usbfs/src/drv_usbfs.c ../src/config/default/library/cryptoauthlib/app/pkcs11/trust_pkcs11_config.c ../src/config/default/library/cryptoauthlib/atcacert/atcacert_pem.c ../src/config/default/library/cryptoauthlib/atcacert/atcacert_der.c ../src/config/default/library/cryptoauthlib/atcacert/atcacert_date.c ../src/config/default/library/cryptoauthlib/atcacert/atcacert_def.c ../src/config/default/library/cryptoauthlib/atcacert/atcacert_host_sw.c ../src/config/default/library/cryptoauthlib/atcacert/atcacert_host_hw.c ../src/config/default/library/cryptoauthlib/atcacert/atcacert_client.c ../src/config/default/library/cryptoauthlib/crypto/hashes/sha2_routines.c ../src/config/default/library/cryptoauthlib/crypto/hashes/sha1_routines.c ../src/config/default/library/cryptoauthlib/crypto/atca_crypto_hw_aes_ccm.c ../src/config/default/library/cryptoauthlib/crypto/atca_crypto_hw_aes_cbcmac.c ../src/config/default/library/cryptoauthlib/crypto/atca_crypto_sw_sha2.c ../src/config/default/library/cryptoauthlib/crypto/atca_crypto_pad.c ../src/config/default/library/cryptoauthlib/crypto/atca_crypto_sw_aes_cmac.c ../src/config/default/library/cryptoauthlib/crypto/atca_crypto_hw_aes_cmac.c ../src/config/default/library/cryptoauthlib/crypto/atca_crypto_pbkdf2.c ../src/config/default/library/cryptoauthlib/crypto/atca_crypto_sw_aes_gcm.c ../src/config/default/library/cryptoauthlib/crypto/atca_crypto_hw_aes_ctr.c ../src/config/default/library/cryptoauthlib/crypto/atca_crypto_sw_sha1.c ../src/config/default/library/cryptoauthlib/crypto/atca_crypto_hw_aes_cbc.c ../src/config/default/library/cryptoauthlib/hal/hal_gpio_harmony.c ../src/config/default/library/cryptoauthlib/hal/hal_pic32_delay.c ../src/config/default/library/cryptoauthlib/hal/kit_protocol.c ../src/config/default/library/cryptoauthlib/hal/atca_hal.c ../src/config/default/library/cryptoauthlib/hal/hal_freertos.c ../src/config/default/library/cryptoauthlib/jwt/atca_jwt.c ../src/config/default/library/cryptoauthlib/kit_host/ascii_kit_host.c ../src/config/default/library/cryptoauthlib/pkcs11/pkcs11_signature.c ../src/config/default/library/cryptoauthlib/pkcs11/pkcs11_attrib.c ../src/config/default/library/cryptoauthlib/pkcs11/pkcs11_key.c ../src/config/default/library/cryptoauthlib/pkcs11/pkcs11_debug.c ../src/config/default/library/cryptoauthlib/pkcs11/pkcs11_info.c ../src/config/default/library/cryptoauthlib/pkcs11/pkcs11_init.c ../src/config/default/library/cryptoauthlib/pkcs11/pkcs11_token.c ../src/config/default/library/cryptoauthlib/pkcs11/pkcs11_slot.c ../src/config/default/library/cryptoauthlib/pkcs11/pkcs11_main.c ../src/config/default/library/cryptoauthlib/pkcs11/pkcs11_encrypt.c ../src/config/default/library/cryptoauthlib/pkcs11/pkcs11_object.c ../src/config/default/library/cryptoauthlib/pkcs11/pkcs11_cert.c ../src/config/default/library/cryptoauthlib/pkcs11/pkcs11_util.c ../src/config/default/library/cryptoauthlib/pkcs11/pkcs11_os.c ../src/config/default/library/cryptoauthlib/pkcs11/pkcs11_config.c ../src/config/default/library/cryptoauthlib/pkcs11/pkcs11_session.c ../src/config/default/library/cryptoauthlib/pkcs11/pkcs11_find.c ../src/config/default/library/cryptoauthlib/pkcs11/pkcs11_mech.c ../src/config/default/library/cryptoauthlib/pkcs11/pkcs11_digest.c ../src/config/default/library/cryptoauthlib/test/api_atcab/atca_tests_updateextra.c ../src/config/default/library/cryptoauthlib/test/api_atcab/atca_tests_secureboot.c ../src/config/default/library/cryptoauthlib/test/api_atcab/atca_tests_hmac.c ../src/config/default/library/cryptoauthlib/test/api_atcab/test_atcab.c ../src/config/default/library/cryptoauthlib/test/api_atcab/atca_tests_ecdh.c ../src/config/default/library/cryptoauthlib/test/api_atcab/atca_tests_aes_cbcmac.c ../src/config/default/library/cryptoauthlib/test/api_atcab/atca_tests_info.c ../src/config/default/library/cryptoauthlib/test/api_atcab/atca_tests_sha.c ../src/config/default/library/cryptoauthlib/test/api_atcab/atca_tests_sign.c ../src/config/default/library/cryptoauthlib/test/api_atcab/atca_tests_privwrite.c ../src/config/default/library/cryptoauthlib/test/api_atcab/atca_tests_aes_ccm.c ../src/config/default/library/cryptoauthlib/test/api_atcab/atca_tests_read.c ../src/config/default/library/cryptoauthlib/test/api_atcab/atca_tests_aes_cmac.c ../src/config/default/library/cryptoauthlib/test/api_atcab/atca_tests_aes.c ../src/config/default/library/cryptoauthlib/test/api_atcab/atca_tests_write.c ../src/config/default/library/cryptoauthlib/test/api_atcab/atca_tests_random.c ../src/config/default/library/cryptoauthlib/test/api_atcab/atca_tests_lock.c ../src/config/default/library/cryptoauthlib/test/api_atcab/atca_tests_aes_cbc.c ../src/config/default/library/cryptoauthlib/test/api_atcab/atca_tests_aes_gcm.c ../src/config/default/library/cryptoauthlib/test/api_atcab/atca_tests_helper.c ../src/config/default/library/cryptoauthlib/test/api_atcab/atca_tests_kdf.c ../src/config/default/library/cryptoauthlib/test/api_atcab/atca_tests_mac.c ../src/config/default/library/cryptoauthlib/test/api_atcab/atca_tests_verify.c ../src/config/default/library/cryptoauthlib/test/api_atcab/atca_tests_aes_ctr.c ../src/config/default/library/cryptoauthlib/test/api_atcab/atca_tests_startup.c ../src/config/default/library/cryptoauthlib/test/api_atcab/atca_tests_derivekey.c ../src/config/default/library/cryptoauthlib/test/api_atcab/atca_tests_counter.c ../src/config/default/library/cryptoauthlib/test/api_atcab/atca_tests_nonce.c ../src/config/default/library/cryptoauthlib/test/api_atcab/atca_tests_genkey.c ../src/config/default/library/cryptoauthlib/test/api_atcab/atca_tests_buffer.c ../src/config/default/library/cryptoauthlib/test/api_atcab/atca_tests_gendig.c ../src/config/default/library/cryptoauthlib/test/api_atcab/atca_tests_otpzero.c ../src/config/default/library/cryptoauthlib/test/api_atcab/atca_tests_selftest.c ../src/config/default/library/cryptoauthlib/test/api_calib/test_calib.c ../src/config/default/library/cryptoauthlib/test/api_calib/test_calib_config.c ../src/config/default/library/cryptoauthlib/test/api_calib/test_calib_info.c ../src/config/default/library/cryptoauthlib/test/api_calib/test_calib_delete.c ../src/config/default/library/cryptoauthlib/test/api_crypto/test_crypto.c ../src/config/default/library/cryptoauthlib/test/api_crypto/test_crypto_pk.c ../src/config/default/library/cryptoauthlib/test/api_crypto/test_crypto_sha.c ../src/config/default/library/cryptoauthlib/test/api_crypto/test_crypto_aes.c ../src/config/default/library/cryptoauthlib/test/api_crypto/test_crypto_pbkdf2.c ../src/config/default/library/cryptoauthlib/test/api_crypto/test_crypto_pad.c ../src/config/default/library/cryptoauthlib/test/atcacert/test_cert_def_5_device.c ../src/config/default/library/cryptoauthlib/test/atcacert/test_cert_def_16_signer.c ../src/config/default/library/cryptoauthlib/test/atcacert/test_cert_def_12_device.c ../src/config/default/library/cryptoauthlib/test/atcacert/test_atcacert_client.c ../src/config/default/library/cryptoauthlib/test/atcacert/test_atcacert_date.c ../src/config/default/library/cryptoauthlib/test/atcacert/test_atcacert_der_integer.c ../src/config/default/library/cryptoauthlib/test/atcacert/test_cert_def_10_device.c ../src/config/default/library/cryptoauthlib/test/atcacert/test_cert_def_13_signer.c ../src/config/default/library/cryptoauthlib/test/atcacert/test_cert_def_1_signer.c ../src/config/default/library/cryptoauthlib/test/atcacert/test_cert_def_15_device_csr.c ../src/config/default/library/cryptoauthlib/test/atcacert/test_cert_def_11_signer.c ../src/config/default/library/cryptoauthlib/test/atcacert/test_cert_def_9_device.c ../src/config/default/library/cryptoauthlib/test/atcacert/test_cert_def_2_device_csr.c ../src/config/default/library/cryptoauthlib/test/atcacert/test_atcacert_der_ecdsa_sig_value.c ../src/config/default/library/cryptoauthlib/test/atcacert/test_atcacert_host_sw.c ../src/config/default/library/cryptoauthlib/test/atcacert/test_cert_def_7_signer.c ../src/config/default/library/cryptoauthlib/test/atcacert/test_atcacert_host_hw.c ../src/config/default/library/cryptoauthlib/test/atcacert/test_cert_def_4_device.c ../src/config/default/library/cryptoauthlib/test/atcacert/test_cert_def_14_device.c ../src/config/default/library/cryptoauthlib/test/atcacert/test_atcacert_def.c ../src/config/default/library/cryptoauthlib/test/atcacert/test_cert_def_6_device.c ../src/config/default/library/cryptoauthlib/test/atcacert/test_cert_def_3_device.c ../src/config/default/library/cryptoauthlib/test/atcacert/test_atcacert.c ../src/config/default/library/cryptoauthlib/test/atcacert/test_cert_def_0_device.c ../src/config/default/library/cryptoauthlib/test/atcacert/test_cert_def_8_signer.c ../src/config/default/library/cryptoauthlib/test/atcacert/test_atcacert_der_length.c ../src/config/default/library/cryptoauthlib/test/hal/test_hal_basic.c ../src/config/default/library/cryptoauthlib/test/hal/test_hal.c ../src/config/default/library/cryptoauthlib/test/integration/test_integration.c ../src/config/default/library/cryptoauthlib/test/integration/test_mbedtls.c ../src/config/default/library/cryptoauthlib/test/jwt/atca_jwt_test.c ../src/config/default/library/cryptoauthlib/test/vectors/aes_cmac_nist_vectors.c ../src/config/default/library/cryptoauthlib/test/vectors/pkcs7_pad_vectors.c ../src/config/default/library/cryptoauthlib/test/vectors/vector_utils.c ../src/config/default/library/cryptoauthlib/test/vectors/ecdsa_nist_vectors.c ../src/config/default/library/cryptoauthlib/test/vectors/aes_gcm_nist_vectors.c ../src/config/default/library/cryptoauthlib/test/vectors/pbkdf2_sha256_vectors.c ../src/config/default/library/cryptoauthlib/test/vectors/ecdh_nist_vectors.c ../src/config/default/library/cryptoauthlib/test/atca_test_console.c ../src/config/default/library/cryptoauthlib/test/cmd-processor.c ../src/config/default/library/cryptoauthlib/test/atca_test.c ../src/config/default/library/cryptoauthlib/test/atca_test_config.c ../src/config/default/library/cryptoauthlib/test/atca_utils_atecc608.c ../src/config/default/library/cryptoauthlib/third_party/unity/unity.c ../src/config/default/library/cryptoauthlib/third_party/unity/unity_memory.c ../src/config/default/library/cryptoauthlib/third_party/unity/unity_fixture.c ../src/config/default/library/cryptoauthlib/atca_cfgs.c ../src/config/default/library/cryptoauthlib/atca_helpers.c ../src/config/default/library/cryptoauthlib/atca_iface.c ../src/config/default/library/cryptoauthlib/atca_basic.c ../src/config/default/library/cryptoauthlib/atca_device.c ../src/config/default/library/cryptoauthlib/cal_buffer.c ../src/config/default/library/cryptoauthlib/atca_debug.c ../src/config/default/library/tcpip/src/helpers.c ../src/config/default/library/tcpip/src/common/sys_fs_shell.c ../src/config/default/library/tcpip/src/tcpip_heap_internal.c ../src/config/default/library/tcpip/src/tcpip_notify.c ../src/config/default/library/tcpip/src/tcpip_manager.c ../src/config/default/library/tcpip/src/oahash.c ../src/config/default/library/tcpip/src/tcpip_packet.c ../src/config/default/library/tcpip/src/tcpip_helpers.c ../src/config/default/library/tcpip/src/tcpip_helper_c32.S ../src/config/default/library/tcpip/src/tcpip_heap_alloc.c ../src/config/default/library/tcpip/src/hash_fnv.c ../src/config/default/library/tcpip/src/dhcp.c ../src/config/default/library/tcpip/src/dns.c ../src/config/default/library/tcpip/src/tcpip_commands.c ../src/config/default/library/tcpip/src/telnet.c ../src/config/default/library/tcpip/src/tcpip_announce.c ../src/config/default/library/tcpip/src/ipv4.c ../src/config/default/library/tcpip/src/udp.c ../src/config/default/library/tcpip/src/icmp.c ../src/config/default/library/tcpip/src/tcp.c ../src/config/default/library/tcpip/src/arp.c ../src/config/default/library/tcpip/src/http_server.c ../src/config/default/library/tcpip/src/berkeley_api.c ../src/config/default/library/tcpip/src/icmpv6.c ../src/config/default/library/tcpip/src/http.c ../src/config/default/library/tcpip/src/sntp.c ../src/config/default/library/tcpip/src/zero_conf_helper.c ../src/config/default/library/tcpip/src/ipv6.c ../src/config/default/library/tcpip/src/smtpc.c ../src/config/default/library/tcpip/src/dnss.c ../src/config/default/library/tcpip/src/dhcpv6.c ../src/config/default/library/tcpip/src/igmp.c ../src/config/default/library/tcpip/src/ftpc.c ../src/config/default/library/tcpip/src/zero_conf_multicast_dns.c ../src/config/default/library/tcpip/src/zero_conf_link_local.c ../src/config/default/library/tcpip/src/ndp.c ../src/config/default/library/tcpip/src/iperf.c ../src/config/default/library/tcpip/src/nbns.c ../src/config/default/library/tcpip/src/snmpv3.c ../src/config/default/library/tcpip/src/ftp.c ../src/config/default/library/tcpip/src/snmpv3_usm.c ../src/config/default/library/tcpip/src/ddns.c ../src/config/default/library/tcpip/src/snmp.c ../src/config/default/net_pres/pres/src/net_pres.c ../src/config/default/net_pres/pres/net_pres_enc_glue.c ../src/config/default/net_pres/pres/net_pres_cert_store.c ../src/config/default/ota_service/ota_service.c ../src/config/default/ota_service/ota_service_file_handler.c ../src/config/default/ota_service/ota_service_transport_ble.c ../src/config/default/peripheral/adc/plib_adc.c ../src/config/default/peripheral/clk/plib_clk.c ../src/config/default/peripheral/coretimer/plib_coretimer.c ../src/config/default/peripheral/evic/plib_evic.c ../src/config/default/peripheral/gpio/plib_gpio.c ../src/config/default/peripheral/nvm/plib_nvm.c ../src/config/default/peripheral/ram/plib_ram.c ../src/config/default/peripheral/uart/plib_uart1.c ../src/config/default/peripheral/uart/plib_uart2.c ../src/config/default/peripheral/uart/plib_uart3.c ../src/config/default/peripheral/uart/plib_uart4.c ../src/config/default/rnbd/rnbd_interface.c ../src/config/default/stdio/xc32_monitor.c ../src/config/default/system/command/src/sys_command.c ../src/config/default/system/console/src/sys_console_usb_cdc.c ../src/config/default/system/console/src/sys_console.c ../src/config/default/system/fs/fat_fs/file_system/ff.c ../src/config/default/system/fs/fat_fs/file_system/ffunicode.c ../src/config/default/system/fs/fat_fs/hardware_access/diskio.c ../src/config/default/system/fs/src/sys_fs_media_manager.c ../src/config/default/system/fs/src/sys_fs_fat_interface.c ../src/config/default/system/fs/src/sys_fs.c ../src/config/default/system/reset/sys_reset.c ../src/config/default/system/time/src/sys_time.c ../src/config/default/system/sys_time_h2_adapter.c ../src/config/default/third_party_adapter/wolfMQTT/src/mqtt_net_glue.c ../src/config/default/usb/src/usb_device_cdc.c ../src/config/default/usb/src/usb_device_cdc_acm.c ../src/config/default/usb/src/usb_device.c ../src/config/default/usb/src/usb_host_generic.c ../src/config/default/usb/src/usb_host_cdc.c ../src/config/default/usb/src/usb_host_cdc_acm.c ../src/config/default/usb/src/usb_host.c ../src/config/default/usb/src/usb_host_hid.c ../src/config/default/exceptions.c ../src/config/default/interrupts.c ../src/config/default/initialization.c ../src/config/default/interrupts_a.S ../src/config/default/freertos_hooks.c ../src/config/default/usb_device_init_data.c ../src/third_party/rtos/FreeRTOS/Source/portable/MemMang/heap_1.c ../src/third_party/rtos/FreeRTOS/Source/portable/MPLAB/PIC32MX/port.c ../src/third_party/rtos/FreeRTOS/Source/portable/MPLAB/PIC32MX/port_asm.S ../src/third_party/rtos/FreeRTOS/Source/list.c ../src/third_party/rtos/FreeRTOS/Source/timers.c ../src/third_party/rtos/FreeRTOS/Source/queue.c ../src/third_party/rtos/FreeRTOS/Source/event_groups.c ../src/third_party/rtos/FreeRTOS/Source/croutine.c ../src/third_party/rtos/FreeRTOS/Source/stream_buffer.c ../src/third_party/rtos/FreeRTOS/Source/FreeRTOS_tasks.c ../src/third_party/paho.mqtt.embedded-c/MQTTClient-C/Platforms/MCHP_pic32mzw1.c ../src/third_party/paho.mqtt.embedded-c/MQTTClient-C/src/MQTTClient.c ../src/third_party/paho.mqtt.embedded-c/MQTTPacket/src/MQTTConnectServer.c ../src/third_party/paho.mqtt.embedded-c/MQTTPacket/src/MQTTUnsubscribeServer.c ../src/third_party/paho.mqtt.embedded-c/MQTTPacket/src/MQTTUnsubscribeClient.c ../src/third_party/paho.mqtt.embedded-c/MQTTPacket/src/MQTTConnectClient.c ../src/third_party/paho.mqtt.embedded-c/MQTTPacket/src/MQTTPacket.c ../src/third_party/paho.mqtt.embedded-c/MQTTPacket/src/MQTTSubscribeServer.c ../src/third_party/paho.mqtt.embedded-c/MQTTPacket/src/MQTTDeserializePublish.c ../src/third_party/paho.mqtt.embedded-c/MQTTPacket/src/MQTTSubscribeClient.c ../src/third_party/paho.mqtt.embedded-c/MQTTPacket/src/MQTTFormat.c ../src/third_party/paho.mqtt.embedded-c/MQTTPacket/src/MQTTSerializePublish.c ../src/rnbd/rnbd.c ../src/third_party/wolfMQTT/src/mqtt_packet.c ../src/third_party/wolfMQTT/src/mqtt_socket.c ../src/third_party/wolfMQTT/src/mqtt_client.c ../src/third_party/wolfssl/wolfssl/wolfcrypt/src/port/pic32/crypt_sha1_sam11105.c ../src/third_party/wolfssl/wolfssl/wolfcrypt/src/port/pic32/crypt_sha512_sam6156.c ../src/third_party/wolfssl/wolfssl/wolfcrypt/src/port/pic32/crypt_rsa_pukcl.c ../src/third_party/wolfssl/wolfssl/wolfcrypt/src/port/pic32/crypt_sha384_sam6156.c ../src/third_party/wolfssl/wolfssl/wolfcrypt/src/port/pic32/crypt_ecc_ba414e.c ../src/third_party/wolfssl/wolfssl/wolfcrypt/src/port/pic32/crypt_pukcl_functions.c ../src/third_party/wolfssl/wolfssl/wolfcrypt/src/port/pic32/crypt_sha1_sam6156.c ../src/third_party/wolfssl/wolfssl/wolfcrypt/src/port/pic32/crypt_sam_u2803.c ../src/third_party/wolfssl/wolfssl/wolfcrypt/src/port/pic32/crypt_rng_u2242.c ../src/third_party/wolfssl/wolfssl/wolfcrypt/src/port/pic32/crypt_rng_sam6334.c ../src/third_party/wolfssl/wolfssl/wolfcrypt/src/port/pic32/pic32mz-crypt.c ../src/third_party/wolfssl/wolfssl/wolfcrypt/src/port/pic32/crypt_sha224_sam11105.c ../src/third_party/wolfssl/wolfssl/wolfcrypt/src/port/pic32/crypt_sha256_sam6156.c ../src/third_party/wolfssl/wolfssl/wolfcrypt/src/port/pic32/crypt_tdes_sam6150.c ../src/third_party/wolfssl/wolfssl/wolfcrypt/src/port/pic32/crypt_aes_sam6149.c ../src/third_party/wolfssl/wolfssl/wolfcrypt/src/port/pic32/crypt_aes_u2238.c ../src/third_party/wolfssl/wolfssl/wolfcrypt/src/port/pic32/crypt_ecc_pukcl.c ../src/third_party/wolfssl/wolfssl/wolfcrypt/src/port/pic32/crypt_wolfcryptcb.c ../src/third_party/wolfssl/wolfssl/wolfcrypt/src/port/pic32/crypt_sha256_sam11105.c ../src/third_party/wolfssl/wolfssl/wolfcrypt/src/port/pic32/crypt_sha224_sam6156.c ../src/third_party/wolfssl/wolfssl/wolfcrypt/src/siphash.c ../src/third_party/wolfssl/wolfssl/wolfcrypt/src/srp.c ../src/third_party/wolfssl/wolfssl/wolfcrypt/src/ext_kyber.c ../src/third_party/wolfssl/wolfssl/wolfcrypt/src/eccsi.c ../src/third_party/wolfssl/wolfssl/wolfcrypt/src/sha.c ../src/third_party/wolfssl/wolfssl/wolfcrypt/src/dsa.c ../src/third_party/wolfssl/wolfssl/wolfcrypt/src/falcon.c ../src/third_party/wolfssl/wolfssl/wolfcrypt/src/arc4.c ../src/third_party/wolfssl/wolfssl/wolfcrypt/src/sha256.c ../src/third_party/wolfssl/wolfssl/wolfcrypt/src/wc_lms.c ../src/third_party/wolfssl/wolfssl/wolfcrypt/src/rsa.c ../src/third_party/wolfssl/wolfssl/wolfcrypt/src/sakke.c ../src/third_party/wolfssl/wolfssl/wolfcrypt/src/error.c ../src/third_party/wolfssl/wolfssl/wolfcrypt/src/md5.c ../src/third_party/wolfssl/wolfssl/wolfcrypt/src/tfm.c ../src/third_party/wolfssl/wolfssl/wolfcrypt/src/aes.c ../src/third_party/wolfssl/wolfssl/wolfcrypt/src/sp_sm2_arm64.c ../src/third_party/wolfssl/wolfssl/wolfcrypt/src/logging.c ../src/third_party/wolfssl/wolfssl/wolfcrypt/src/dh.c ../src/third_party/wolfssl/wolfssl/wolfcrypt/src/cmac.c ../src/third_party/wolfssl/wolfssl/wolfcrypt/src/signature.c ../src/third_party/wolfssl/wolfssl/wolfcrypt/src/sp_int.c ../src/third_party/wolfssl/wolfssl/wolfcrypt/src/md4.c ../src/third_party/wolfssl/wolfssl/wolfcrypt/src/wc_dsp.c ../src/third_party/wolfssl/wolfssl/wolfcrypt/src/sp_x86_64.c ../src/third_party/wolfssl/wolfssl/wolfcrypt/src/sp_sm2_armthumb.c ../src/third_party/wolfssl/wolfssl/wolfcrypt/src/asm.c ../src/third_party/wolfssl/wolfssl/wolfcrypt/src/poly1305.c ../src/third_party/wolfssl/wolfssl/wolfcrypt/src/hmac.c ../src/third_party/wolfssl/wolfssl/wolfcrypt/src/sm4.c ../src/third_party/wolfssl/wolfssl/wolfcrypt/src/compress.c ../src/third_party/wolfssl/wolfssl/wolfcrypt/src/hash.c ../src/third_party/wolfssl/wolfssl/wolfcrypt/src/asn.c ../src/third_party/wolfssl/wolfssl/wolfcrypt/src/pwdbased.c ../src/third_party/wolfssl/wolfssl/wolfcrypt/src/md2.c ../src/third_party/wolfssl/wolfssl/wolfcrypt/src/ext_lms.c ../src/third_party/wolfssl/wolfssl/wolfcrypt/src/sp_armthumb.c ../src/third_party/wolfssl/wolfssl/wolfcrypt/src/ed448.c ../src/third_party/wolfssl/wolfssl/wolfcrypt/src/coding.c ../src/third_party/wolfssl/wolfssl/wolfcrypt/src/ecc_fp.c ../src/third_party/wolfssl/wolfssl/wolfcrypt/src/kdf.c ../src/third_party/wolfssl/wolfssl/wolfcrypt/src/cpuid.c ../src/third_party/wolfssl/wolfssl/wolfcrypt/src/sm2.c ../src/third_party/wolfssl/wolfssl/wolfcrypt/src/ripemd.c ../src/third_party/wolfssl/wolfssl/wolfcrypt/src/sp_sm2_cortexm.c ../src/third_party/wolfssl/wolfssl/wolfcrypt/src/sp_sm2_x86_64.c ../src/third_party/wolfssl/wolfssl/wolfcrypt/src/sphincs.c ../src/third_party/wolfssl/wolfssl/wolfcrypt/src/fe_low_mem.c ../src/third_party/wolfssl/wolfssl/wolfcrypt/src/sm3.c ../src/third_party/wolfssl/wolfssl/wolfcrypt/src/pkcs12.c ../src/third_party/wolfssl/wolfssl/wolfcrypt/src/wolfmath.c ../src/third_party/wolfssl/wolfssl/wolfcrypt/src/sp_arm32.c ../src/third_party/wolfssl/wolfssl/wolfcrypt/src/chacha.c ../src/third_party/wolfssl/wolfssl/wolfcrypt/src/wc_xmss.c ../src/third_party/wolfssl/wolfssl/wolfcrypt/src/sha3.c ../src/third_party/wolfssl/wolfssl/wolfcrypt/src/fe_operations.c ../src/third_party/wolfssl/wolfssl/wolfcrypt/src/camellia.c ../src/third_party/wolfssl/wolfssl/wolfcrypt/src/cryptocb.c ../src/third_party/wolfssl/wolfssl/wolfcrypt/src/wc_xmss_impl.c ../src/third_party/wolfssl/wolfssl/wolfcrypt/src/des3.c ../src/third_party/wolfssl/wolfssl/wolfcrypt/src/ext_xmss.c ../src/third_party/wolfssl/wolfssl/wolfcrypt/src/ge_448.c ../src/third_party/wolfssl/wolfssl/wolfcrypt/src/pkcs7.c ../src/third_party/wolfssl/wolfssl/wolfcrypt/src/sp_cortexm.c ../src/third_party/wolfssl/wolfssl/wolfcrypt/src/wc_port.c ../src/third_party/wolfssl/wolfssl/wolfcrypt/src/ed25519.c ../src/third_party/wolfssl/wolfssl/wolfcrypt/src/sha512.c ../src/third_party/wolfssl/wolfssl/wolfcrypt/src/memory.c ../src/third_party/wolfssl/wolfssl/wolfcrypt/src/blake2b.c ../src/third_party/wolfssl/wolfssl/wolfcrypt/src/curve25519.c ../src/third_party/wolfssl/wolfssl/wolfcrypt/src/misc.c ../src/third_party/wolfssl/wolfssl/wolfcrypt/src/sp_sm2_c32.c ../src/third_party/wolfssl/wolfssl/wolfcrypt/src/random.c ../src/third_party/wolfssl/wolfssl/wolfcrypt/src/rc2.c ../src/third_party/wolfssl/wolfssl/wolfcrypt/src/ge_low_mem.c ../src/third_party/wolfssl/wolfssl/wolfcrypt/src/sp_sm2_arm32.c ../src/third_party/wolfssl/wolfssl/wolfcrypt/src/blake2s.c ../src/third_party/wolfssl/wolfssl/wolfcrypt/src/sp_sm2_c64.c ../src/third_party/wolfssl/wolfssl/wolfcrypt/src/sp_c64.c ../src/third_party/wolfssl/wolfssl/wolfcrypt/src/wc_encrypt.c ../src/third_party/wolfssl/wolfssl/wolfcrypt/src/wc_lms_impl.c ../src/third_party/wolfssl/wolfssl/wolfcrypt/src/hpke.c ../src/third_party/wolfssl/wolfssl/wolfcrypt/src/ecc.c ../src/third_party/wolfssl/wolfssl/wolfcrypt/src/evp.c ../src/third_party/wolfssl/wolfssl/wolfcrypt/src/sp_arm64.c ../src/third_party/wolfssl/wolfssl/wolfcrypt/src/wc_kyber.c ../src/third_party/wolfssl/wolfssl/wolfcrypt/src/wolfevent.c ../src/third_party/wolfssl/wolfssl/wolfcrypt/src/integer.c ../src/third_party/wolfssl/wolfssl/wolfcrypt/src/ge_operations.c ../src/third_party/wolfssl/wolfssl/wolfcrypt/src/sp_dsp32.c ../src/third_party/wolfssl/wolfssl/wolfcrypt/src/sp_c32.c ../src/third_party/wolfssl/wolfssl/wolfcrypt/src/dilithium.c ../src/third_party/wolfssl/wolfssl/wolfcrypt/src/chacha20_poly1305.c ../src/third_party/wolfssl/wolfssl/wolfcrypt/src/wc_pkcs11.c ../src/third_party/wolfssl/wolfssl/wolfcrypt/src/wc_kyber_poly.c ../src/third_party/wolfssl/wolfssl/wolfcrypt/src/curve448.c ../src/third_party/wolfssl/wolfssl/wolfcrypt/src/fe_448.c ../src/third_party/wolfssl/src/x509.c ../src/third_party/wolfssl/src/ssl_bn.c ../src/third_party/wolfssl/src/keys.c ../src/third_party/wolfssl/src/x509_str.c ../src/third_party/wolfssl/src/tls13.c ../src/third_party/wolfssl/src/ssl_certman.c ../src/third_party/wolfssl/src/ocsp.c ../src/third_party/wolfssl/src/internal.c ../src/third_party/wolfssl/src/pk.c ../src/third_party/wolfssl/src/quic.c ../src/third_party/wolfssl/src/ssl_crypto.c ../src/third_party/wolfssl/src/ssl_misc.c ../src/third_party/wolfssl/src/ssl.c ../src/third_party/wolfssl/src/wolfio.c ../src/third_party/wolfssl/src/sniffer.c ../src/third_party/wolfssl/src/ssl_asn1.c ../src/third_party/wolfssl/src/tls.c ../src/third_party/wolfssl/src/dtls13.c ../src/third_party/wolfssl/src/dtls.c ../src/third_party/wolfssl/src/crl.c ../src/third_party/wolfssl/src/conf.c ../src/third_party/zlib/zutil.c ../src/third_party/zlib/crc32.c ../src/third_party/zlib/deflate.c ../src/third_party/zlib/adler32.c ../src/third_party/zlib/uncompr.c ../src/third_party/zlib/inflate.c ../src/third_party/zlib/trees.c ../src/third_party/zlib/inffast.c ../src/third_party/zlib/infback.c ../src/third_party/zlib/compress.c ../src/third_party/zlib/gzclose.c ../src/third_party/zlib/inftrees.c ../src/main.c ../src/http_server_print.c ../src/custom_http_server_app.c ../src/custom_snmp_app.c ../src/app_mqtt_task.c ../src/custom_http_app.c ../src/http_print.c ../src/config/default/system/console/src/sys_console_uart.c ../src/config/default/driver/usb/usbfs/src/drv_usbfs_host.c ../src/config/default/system/debug/src/sys_debug.c
+SOURCEFILES=../src/config/default/bsp/bsp.c ../src/config/default/crypto/src/crypto.c ../src/config/default/driver/ethmac/src/dynamic/drv_eth_pic32_lib.c ../src/config/default/driver/ethmac/src/dynamic/drv_ethmac_lib.c ../src/config/default/driver/ethmac/src/dynamic/drv_ethmac.c ../src/config/default/driver/ethphy/src/dynamic/drv_ethphy.c ../src/config/default/driver/ethphy/src/dynamic/drv_extphy_dp83848.c ../src/config/default/driver/memory/src/drv_memory.c ../src/config/default/driver/miim/src/dynamic/drv_miim_pic32m.c ../src/config/default/driver/miim/src/dynamic/drv_miim.c ../src/config/default/driver/usb/usbfs/src/drv_usbfs.c ../src/config/default/library/cryptoauthlib/app/pkcs11/trust_pkcs11_config.c ../src/config/default/library/cryptoauthlib/atcacert/atcacert_pem.c ../src/config/default/library/cryptoauthlib/atcacert/atcacert_der.c ../src/config/default/library/cryptoauthlib/atcacert/atcacert_date.c ../src/config/default/library/cryptoauthlib/atcacert/atcacert_def.c ../src/config/default/library/cryptoauthlib/atcacert/atcacert_host_sw.c ../src/config/default/library/cryptoauthlib/atcacert/atcacert_host_hw.c ../src/config/default/library/cryptoauthlib/atcacert/atcacert_client.c ../src/config/default/library/cryptoauthlib/crypto/hashes/sha2_routines.c ../src/config/default/library/cryptoauthlib/crypto/hashes/sha1_routines.c ../src/config/default/library/cryptoauthlib/crypto/atca_crypto_hw_aes_ccm.c ../src/config/default/library/cryptoauthlib/crypto/atca_crypto_hw_aes_cbcmac.c ../src/config/default/library/cryptoauthlib/crypto/atca_crypto_sw_sha2.c ../src/config/default/library/cryptoauthlib/crypto/atca_crypto_pad.c ../src/config/default/library/cryptoauthlib/crypto/atca_crypto_sw_aes_cmac.c ../src/config/default/library/cryptoauthlib/crypto/atca_crypto_hw_aes_cmac.c ../src/config/default/library/cryptoauthlib/crypto/atca_crypto_pbkdf2.c ../src/config/default/library/cryptoauthlib/crypto/atca_crypto_sw_aes_gcm.c ../src/config/default/library/cryptoauthlib/crypto/atca_crypto_hw_aes_ctr.c ../src/config/default/library/cryptoauthlib/crypto/atca_crypto_sw_sha1.c ../src/config/default/library/cryptoauthlib/crypto/atca_crypto_hw_aes_cbc.c ../src/config/default/library/cryptoauthlib/hal/hal_gpio_harmony.c ../src/config/default/library/cryptoauthlib/hal/hal_pic32_delay.c ../src/config/default/library/cryptoauthlib/hal/kit_protocol.c ../src/config/default/library/cryptoauthlib/hal/atca_hal.c ../src/config/default/library/cryptoauthlib/hal/hal_freertos.c ../src/config/default/library/cryptoauthlib/jwt/atca_jwt.c ../src/config/default/library/cryptoauthlib/kit_host/ascii_kit_host.c ../src/config/default/library/cryptoauthlib/pkcs11/pkcs11_signature.c ../src/config/default/library/cryptoauthlib/pkcs11/pkcs11_attrib.c ../src/config/default/library/cryptoauthlib/pkcs11/pkcs11_key.c ../src/config/default/library/cryptoauthlib/pkcs11/pkcs11_debug.c ../src/config/default/library/cryptoauthlib/pkcs11/pkcs11_info.c ../src/config/default/library/cryptoauthlib/pkcs11/pkcs11_init.c ../src/config/default/library/cryptoauthlib/pkcs11/pkcs11_token.c ../src/config/default/library/cryptoauthlib/pkcs11/pkcs11_slot.c ../src/config/default/library/cryptoauthlib/pkcs11/pkcs11_main.c ../src/config/default/library/cryptoauthlib/pkcs11/pkcs11_encrypt.c ../src/config/default/library/cryptoauthlib/pkcs11/pkcs11_object.c ../src/config/default/library/cryptoauthlib/pkcs11/pkcs11_cert.c ../src/config/default/library/cryptoauthlib/pkcs11/pkcs11_util.c ../src/config/default/library/cryptoauthlib/pkcs11/pkcs11_os.c ../src/config/default/library/cryptoauthlib/pkcs11/pkcs11_config.c ../src/config/default/library/cryptoauthlib/pkcs11/pkcs11_session.c ../src/config/default/library/cryptoauthlib/pkcs11/pkcs11_find.c ../src/config/default/library/cryptoauthlib/pkcs11/pkcs11_mech.c ../src/config/default/library/cryptoauthlib/pkcs11/pkcs11_digest.c ../src/config/default/library/cryptoauthlib/test/api_atcab/atca_tests_updateextra.c ../src/config/default/library/cryptoauthlib/test/api_atcab/atca_tests_secureboot.c ../src/config/default/library/cryptoauthlib/test/api_atcab/atca_tests_hmac.c ../src/config/default/library/cryptoauthlib/test/api_atcab/test_atcab.c ../src/config/default/library/cryptoauthlib/test/api_atcab/atca_tests_ecdh.c ../src/config/default/library/cryptoauthlib/test/api_atcab/atca_tests_aes_cbcmac.c ../src/config/default/library/cryptoauthlib/test/api_atcab/atca_tests_info.c ../src/config/default/library/cryptoauthlib/test/api_atcab/atca_tests_sha.c ../src/config/default/library/cryptoauthlib/test/api_atcab/atca_tests_sign.c ../src/config/default/library/cryptoauthlib/test/api_atcab/atca_tests_privwrite.c ../src/config/default/library/cryptoauthlib/test/api_atcab/atca_tests_aes_ccm.c ../src/config/default/library/cryptoauthlib/test/api_atcab/atca_tests_read.c ../src/config/default/library/cryptoauthlib/test/api_atcab/atca_tests_aes_cmac.c ../src/config/default/library/cryptoauthlib/test/api_atcab/atca_tests_aes.c ../src/config/default/library/cryptoauthlib/test/api_atcab/atca_tests_write.c ../src/config/default/library/cryptoauthlib/test/api_atcab/atca_tests_random.c ../src/config/default/library/cryptoauthlib/test/api_atcab/atca_tests_lock.c ../src/config/default/library/cryptoauthlib/test/api_atcab/atca_tests_aes_cbc.c ../src/config/default/library/cryptoauthlib/test/api_atcab/atca_tests_aes_gcm.c ../src/config/default/library/cryptoauthlib/test/api_atcab/atca_tests_helper.c ../src/config/default/library/cryptoauthlib/test/api_atcab/atca_tests_kdf.c ../src/config/default/library/cryptoauthlib/test/api_atcab/atca_tests_mac.c ../src/config/default/library/cryptoauthlib/test/api_atcab/atca_tests_verify.c ../src/config/default/library/cryptoauthlib/test/api_atcab/atca_tests_aes_ctr.c ../src/config/default/library/cryptoauthlib/test/api_atcab/atca_tests_startup.c ../src/config/default/library/cryptoauthlib/test/api_atcab/atca_tests_derivekey.c ../src/config/default/library/cryptoauthlib/test/api_atcab/atca_tests_counter.c ../src/config/default/library/cryptoauthlib/test/api_atcab/atca_tests_nonce.c ../src/config/default/library/cryptoauthlib/test/api_atcab/atca_tests_genkey.c ../src/config/default/library/cryptoauthlib/test/api_atcab/atca_tests_buffer.c ../src/config/default/library/cryptoauthlib/test/api_atcab/atca_tests_gendig.c ../src/config/default/library/cryptoauthlib/test/api_atcab/atca_tests_otpzero.c ../src/config/default/library/cryptoauthlib/test/api_atcab/atca_tests_selftest.c ../src/config/default/library/cryptoauthlib/test/api_calib/test_calib.c ../src/config/default/library/cryptoauthlib/test/api_calib/test_calib_config.c ../src/config/default/library/cryptoauthlib/test/api_calib/test_calib_info.c ../src/config/default/library/cryptoauthlib/test/api_calib/test_calib_delete.c ../src/config/default/library/cryptoauthlib/test/api_crypto/test_crypto.c ../src/config/default/library/cryptoauthlib/test/api_crypto/test_crypto_pk.c ../src/config/default/library/cryptoauthlib/test/api_crypto/test_crypto_sha.c ../src/config/default/library/cryptoauthlib/test/api_crypto/test_crypto_aes.c ../src/config/default/library/cryptoauthlib/test/api_crypto/test_crypto_pbkdf2.c ../src/config/default/library/cryptoauthlib/test/api_crypto/test_crypto_pad.c ../src/config/default/library/cryptoauthlib/test/atcacert/test_cert_def_5_device.c ../src/config/default/library/cryptoauthlib/test/atcacert/test_cert_def_16_signer.c ../src/config/default/library/cryptoauthlib/test/atcacert/test_cert_def_12_device.c ../src/config/default/library/cryptoauthlib/test/atcacert/test_atcacert_client.c ../src/config/default/library/cryptoauthlib/test/atcacert/test_atcacert_date.c ../src/config/default/library/cryptoauthlib/test/atcacert/test_atcacert_der_integer.c ../src/config/default/library/cryptoauthlib/test/atcacert/test_cert_def_10_device.c ../src/config/default/library/cryptoauthlib/test/atcacert/test_cert_def_13_signer.c ../src/config/default/library/cryptoauthlib/test/atcacert/test_cert_def_1_signer.c ../src/config/default/library/cryptoauthlib/test/atcacert/test_cert_def_15_device_csr.c ../src/config/default/library/cryptoauthlib/test/atcacert/test_cert_def_11_signer.c ../src/config/default/library/cryptoauthlib/test/atcacert/test_cert_def_9_device.c ../src/config/default/library/cryptoauthlib/test/atcacert/test_cert_def_2_device_csr.c ../src/config/default/library/cryptoauthlib/test/atcacert/test_atcacert_der_ecdsa_sig_value.c ../src/config/default/library/cryptoauthlib/test/atcacert/test_atcacert_host_sw.c ../src/config/default/library/cryptoauthlib/test/atcacert/test_cert_def_7_signer.c ../src/config/default/library/cryptoauthlib/test/atcacert/test_atcacert_host_hw.c ../src/config/default/library/cryptoauthlib/test/atcacert/test_cert_def_4_device.c ../src/config/default/library/cryptoauthlib/test/atcacert/test_cert_def_14_device.c ../src/config/default/library/cryptoauthlib/test/atcacert/test_atcacert_def.c ../src/config/default/library/cryptoauthlib/test/atcacert/test_cert_def_6_device.c ../src/config/default/library/cryptoauthlib/test/atcacert/test_cert_def_3_device.c ../src/config/default/library/cryptoauthlib/test/atcacert/test_atcacert.c ../src/config/default/library/cryptoauthlib/test/atcacert/test_cert_def_0_device.c ../src/config/default/library/cryptoauthlib/test/atcacert/test_cert_def_8_signer.c ../src/config/default/library/cryptoauthlib/test/atcacert/test_atcacert_der_length.c ../src/config/default/library/cryptoauthlib/test/hal/test_hal_basic.c ../src/config/default/library/cryptoauthlib/test/hal/test_hal.c ../src/config/default/library/cryptoauthlib/test/integration/test_integration.c ../src/config/default/library/cryptoauthlib/test/integration/test_mbedtls.c ../src/config/default/library/cryptoauthlib/test/jwt/atca_jwt_test.c ../src/config/default/library/cryptoauthlib/test/vectors/aes_cmac_nist_vectors.c ../src/config/default/library/cryptoauthlib/test/vectors/pkcs7_pad_vectors.c ../src/config/default/library/cryptoauthlib/test/vectors/vector_utils.c ../src/config/default/library/cryptoauthlib/test/vectors/ecdsa_nist_vectors.c ../src/config/default/library/cryptoauthlib/test/vectors/aes_gcm_nist_vectors.c ../src/config/default/library/cryptoauthlib/test/vectors/pbkdf2_sha256_vectors.c ../src/config/default/library/cryptoauthlib/test/vectors/ecdh_nist_vectors.c ../src/config/default/library/cryptoauthlib/test/atca_test_console.c ../src/config/default/library/cryptoauthlib/test/cmd-processor.c ../src/config/default/library/cryptoauthlib/test/atca_test.c ../src/config/default/library/cryptoauthlib/test/atca_test_config.c ../src/config/default/library/cryptoauthlib/test/atca_utils_atecc608.c ../src/config/default/library/cryptoauthlib/third_party/unity/unity.c ../src/config/default/library/cryptoauthlib/third_party/unity/unity_memory.c ../src/config/default/library/cryptoauthlib/third_party/unity/unity_fixture.c ../src/config/default/library/cryptoauthlib/atca_cfgs.c ../src/config/default/library/cryptoauthlib/atca_helpers.c ../src/config/default/library/cryptoauthlib/atca_iface.c ../src/config/default/library/cryptoauthlib/atca_basic.c ../src/config/default/library/cryptoauthlib/atca_device.c ../src/config/default/library/cryptoauthlib/cal_buffer.c ../src/config/default/library/cryptoauthlib/atca_debug.c ../src/config/default/library/tcpip/src/helpers.c ../src/config/default/library/tcpip/src/common/sys_fs_shell.c ../src/config/default/library/tcpip/src/tcpip_heap_internal.c ../src/config/default/library/tcpip/src/tcpip_heap_class.c ../src/config/default/library/tcpip/src/tcpip_notify.c ../src/config/default/library/tcpip/src/tcpip_manager.c ../src/config/default/library/tcpip/src/oahash.c ../src/config/default/library/tcpip/src/tcpip_packet.c ../src/config/default/library/tcpip/src/tcpip_helpers.c ../src/config/default/library/tcpip/src/tcpip_helper_c32.S ../src/config/default/library/tcpip/src/tcpip_heap_alloc.c ../src/config/default/library/tcpip/src/hash_fnv.c ../src/config/default/library/tcpip/src/dhcp.c ../src/config/default/library/tcpip/src/dns.c ../src/config/default/library/tcpip/src/tcpip_commands.c ../src/config/default/library/tcpip/src/telnet.c ../src/config/default/library/tcpip/src/tcpip_announce.c ../src/config/default/library/tcpip/src/ipv4.c ../src/config/default/library/tcpip/src/udp.c ../src/config/default/library/tcpip/src/icmp.c ../src/config/default/library/tcpip/src/tcp.c ../src/config/default/library/tcpip/src/arp.c ../src/config/default/library/tcpip/src/http_server.c ../src/config/default/library/tcpip/src/berkeley_api.c ../src/config/default/library/tcpip/src/icmpv6.c ../src/config/default/library/tcpip/src/http.c ../src/config/default/library/tcpip/src/sntp.c ../src/config/default/library/tcpip/src/zero_conf_helper.c ../src/config/default/library/tcpip/src/ipv6.c ../src/config/default/library/tcpip/src/smtpc.c ../src/config/default/library/tcpip/src/dnss.c ../src/config/default/library/tcpip/src/dhcpv6.c ../src/config/default/library/tcpip/src/igmp.c ../src/config/default/library/tcpip/src/ftpc.c ../src/config/default/library/tcpip/src/zero_conf_multicast_dns.c ../src/config/default/library/tcpip/src/zero_conf_link_local.c ../src/config/default/library/tcpip/src/ndp.c ../src/config/default/library/tcpip/src/iperf.c ../src/config/default/library/tcpip/src/nbns.c ../src/config/default/library/tcpip/src/snmpv3.c ../src/config/default/library/tcpip/src/ftp.c ../src/config/default/library/tcpip/src/snmpv3_usm.c ../src/config/default/library/tcpip/src/ddns.c ../src/config/default/library/tcpip/src/snmp.c ../src/config/default/net_pres/pres/src/net_pres.c ../src/config/default/net_pres/pres/net_pres_enc_glue.c ../src/config/default/net_pres/pres/net_pres_cert_store.c ../src/config/default/ota_service/ota_service.c ../src/config/default/ota_service/ota_service_file_handler.c ../src/config/default/ota_service/ota_service_transport_ble.c ../src/config/default/peripheral/adc/plib_adc.c ../src/config/default/peripheral/clk/plib_clk.c ../src/config/default/peripheral/coretimer/plib_coretimer.c ../src/config/default/peripheral/evic/plib_evic.c ../src/config/default/peripheral/gpio/plib_gpio.c ../src/config/default/peripheral/nvm/plib_nvm.c ../src/config/default/peripheral/ram/plib_ram.c ../src/config/default/peripheral/uart/plib_uart1.c ../src/config/default/peripheral/uart/plib_uart2.c ../src/config/default/peripheral/uart/plib_uart3.c ../src/config/default/peripheral/uart/plib_uart4.c ../src/config/default/rnbd/rnbd_interface.c ../src/config/default/stdio/xc32_monitor.c ../src/config/default/system/command/src/sys_command.c ../src/config/default/system/console/src/sys_console_usb_cdc.c ../src/config/default/system/console/src/sys_console.c ../src/config/default/system/fs/fat_fs/file_system/ff.c ../src/config/default/system/fs/fat_fs/file_system/ffunicode.c ../src/config/default/system/fs/fat_fs/hardware_access/diskio.c ../src/config/default/system/fs/src/sys_fs_media_manager.c ../src/config/default/system/fs/src/sys_fs_fat_interface.c ../src/config/default/system/fs/src/sys_fs.c ../src/config/default/system/reset/sys_reset.c ../src/config/default/system/time/src/sys_time.c ../src/config/default/system/sys_time_h2_adapter.c ../src/config/default/third_party_adapter/wolfMQTT/src/mqtt_net_glue.c ../src/config/default/usb/src/usb_device_cdc.c ../src/config/default/usb/src/usb_device_cdc_acm.c ../src/config/default/usb/src/usb_device.c ../src/config/default/usb/src/usb_host_generic.c ../src/config/default/usb/src/usb_host_cdc.c ../src/config/default/usb/src/usb_host_cdc_acm.c ../src/config/default/usb/src/usb_host.c ../src/config/default/usb/src/usb_host_hid.c ../src/config/default/exceptions.c ../src/config/default/interrupts.c ../src/config/default/initialization.c ../src/config/default/interrupts_a.S ../src/config/default/freertos_hooks.c ../src/config/default/usb_device_init_data.c ../src/third_party/rtos/FreeRTOS/Source/portable/MemMang/heap_1.c ../src/third_party/rtos/FreeRTOS/Source/portable/MPLAB/PIC32MX/port.c ../src/third_party/rtos/FreeRTOS/Source/portable/MPLAB/PIC32MX/port_asm.S ../src/third_party/rtos/FreeRTOS/Source/list.c ../src/third_party/rtos/FreeRTOS/Source/timers.c ../src/third_party/rtos/FreeRTOS/Source/queue.c ../src/third_party/rtos/FreeRTOS/Source/event_groups.c ../src/third_party/rtos/FreeRTOS/Source/croutine.c ../src/third_party/rtos/FreeRTOS/Source/stream_buffer.c ../src/third_party/rtos/FreeRTOS/Source/FreeRTOS_tasks.c ../src/third_party/paho.mqtt.embedded-c/MQTTClient-C/Platforms/MCHP_pic32mzw1.c ../src/third_party/paho.mqtt.embedded-c/MQTTClient-C/src/MQTTClient.c ../src/third_party/paho.mqtt.embedded-c/MQTTPacket/src/MQTTConnectServer.c ../src/third_party/paho.mqtt.embedded-c/MQTTPacket/src/MQTTUnsubscribeServer.c ../src/third_party/paho.mqtt.embedded-c/MQTTPacket/src/MQTTUnsubscribeClient.c ../src/third_party/paho.mqtt.embedded-c/MQTTPacket/src/MQTTConnectClient.c ../src/third_party/paho.mqtt.embedded-c/MQTTPacket/src/MQTTPacket.c ../src/third_party/paho.mqtt.embedded-c/MQTTPacket/src/MQTTSubscribeServer.c ../src/third_party/paho.mqtt.embedded-c/MQTTPacket/src/MQTTDeserializePublish.c ../src/third_party/paho.mqtt.embedded-c/MQTTPacket/src/MQTTSubscribeClient.c ../src/third_party/paho.mqtt.embedded-c/MQTTPacket/src/MQTTFormat.c ../src/third_party/paho.mqtt.embedded-c/MQTTPacket/src/MQTTSerializePublish.c ../src/rnbd/rnbd.c ../src/third_party/wolfMQTT/src/mqtt_packet.c ../src/third_party/wolfMQTT/src/mqtt_socket.c ../src/third_party/wolfMQTT/src/mqtt_client.c ../src/third_party/wolfssl/wolfssl/wolfcrypt/src/port/pic32/crypt_sha1_sam11105.c ../src/third_party/wolfssl/wolfssl/wolfcrypt/src/port/pic32/crypt_sha512_sam6156.c ../src/third_party/wolfssl/wolfssl/wolfcrypt/src/port/pic32/crypt_rsa_pukcl.c ../src/third_party/wolfssl/wolfssl/wolfcrypt/src/port/pic32/crypt_sha384_sam6156.c ../src/third_party/wolfssl/wolfssl/wolfcrypt/src/port/pic32/crypt_ecc_ba414e.c ../src/third_party/wolfssl/wolfssl/wolfcrypt/src/port/pic32/crypt_pukcl_functions.c ../src/third_party/wolfssl/wolfssl/wolfcrypt/src/port/pic32/crypt_sha1_sam6156.c ../src/third_party/wolfssl/wolfssl/wolfcrypt/src/port/pic32/crypt_sam_u2803.c ../src/third_party/wolfssl/wolfssl/wolfcrypt/src/port/pic32/crypt_rng_u2242.c ../src/third_party/wolfssl/wolfssl/wolfcrypt/src/port/pic32/crypt_rng_sam6334.c ../src/third_party/wolfssl/wolfssl/wolfcrypt/src/port/pic32/pic32mz-crypt.c ../src/third_party/wolfssl/wolfssl/wolfcrypt/src/port/pic32/crypt_sha224_sam11105.c ../src/third_party/wolfssl/wolfssl/wolfcrypt/src/port/pic32/crypt_sha256_sam6156.c ../src/third_party/wolfssl/wolfssl/wolfcrypt/src/port/pic32/crypt_tdes_sam6150.c ../src/third_party/wolfssl/wolfssl/wolfcrypt/src/port/pic32/crypt_aes_sam6149.c ../src/third_party/wolfssl/wolfssl/wolfcrypt/src/port/pic32/crypt_aes_u2238.c ../src/third_party/wolfssl/wolfssl/wolfcrypt/src/port/pic32/crypt_ecc_pukcl.c ../src/third_party/wolfssl/wolfssl/wolfcrypt/src/port/pic32/crypt_wolfcryptcb.c ../src/third_party/wolfssl/wolfssl/wolfcrypt/src/port/pic32/crypt_sha256_sam11105.c ../src/third_party/wolfssl/wolfssl/wolfcrypt/src/port/pic32/crypt_sha224_sam6156.c ../src/third_party/wolfssl/wolfssl/wolfcrypt/src/siphash.c ../src/third_party/wolfssl/wolfssl/wolfcrypt/src/srp.c ../src/third_party/wolfssl/wolfssl/wolfcrypt/src/ext_kyber.c ../src/third_party/wolfssl/wolfssl/wolfcrypt/src/eccsi.c ../src/third_party/wolfssl/wolfssl/wolfcrypt/src/sha.c ../src/third_party/wolfssl/wolfssl/wolfcrypt/src/dsa.c ../src/third_party/wolfssl/wolfssl/wolfcrypt/src/falcon.c ../src/third_party/wolfssl/wolfssl/wolfcrypt/src/arc4.c ../src/third_party/wolfssl/wolfssl/wolfcrypt/src/sha256.c ../src/third_party/wolfssl/wolfssl/wolfcrypt/src/wc_lms.c ../src/third_party/wolfssl/wolfssl/wolfcrypt/src/rsa.c ../src/third_party/wolfssl/wolfssl/wolfcrypt/src/sakke.c ../src/third_party/wolfssl/wolfssl/wolfcrypt/src/error.c ../src/third_party/wolfssl/wolfssl/wolfcrypt/src/md5.c ../src/third_party/wolfssl/wolfssl/wolfcrypt/src/tfm.c ../src/third_party/wolfssl/wolfssl/wolfcrypt/src/aes.c ../src/third_party/wolfssl/wolfssl/wolfcrypt/src/sp_sm2_arm64.c ../src/third_party/wolfssl/wolfssl/wolfcrypt/src/logging.c ../src/third_party/wolfssl/wolfssl/wolfcrypt/src/dh.c ../src/third_party/wolfssl/wolfssl/wolfcrypt/src/cmac.c ../src/third_party/wolfssl/wolfssl/wolfcrypt/src/signature.c ../src/third_party/wolfssl/wolfssl/wolfcrypt/src/sp_int.c ../src/third_party/wolfssl/wolfssl/wolfcrypt/src/md4.c ../src/third_party/wolfssl/wolfssl/wolfcrypt/src/wc_dsp.c ../src/third_party/wolfssl/wolfssl/wolfcrypt/src/sp_x86_64.c ../src/third_party/wolfssl/wolfssl/wolfcrypt/src/sp_sm2_armthumb.c ../src/third_party/wolfssl/wolfssl/wolfcrypt/src/asm.c ../src/third_party/wolfssl/wolfssl/wolfcrypt/src/poly1305.c ../src/third_party/wolfssl/wolfssl/wolfcrypt/src/hmac.c ../src/third_party/wolfssl/wolfssl/wolfcrypt/src/sm4.c ../src/third_party/wolfssl/wolfssl/wolfcrypt/src/compress.c ../src/third_party/wolfssl/wolfssl/wolfcrypt/src/hash.c ../src/third_party/wolfssl/wolfssl/wolfcrypt/src/asn.c ../src/third_party/wolfssl/wolfssl/wolfcrypt/src/pwdbased.c ../src/third_party/wolfssl/wolfssl/wolfcrypt/src/md2.c ../src/third_party/wolfssl/wolfssl/wolfcrypt/src/ext_lms.c ../src/third_party/wolfssl/wolfssl/wolfcrypt/src/sp_armthumb.c ../src/third_party/wolfssl/wolfssl/wolfcrypt/src/ed448.c ../src/third_party/wolfssl/wolfssl/wolfcrypt/src/coding.c ../src/third_party/wolfssl/wolfssl/wolfcrypt/src/ecc_fp.c ../src/third_party/wolfssl/wolfssl/wolfcrypt/src/kdf.c ../src/third_party/wolfssl/wolfssl/wolfcrypt/src/cpuid.c ../src/third_party/wolfssl/wolfssl/wolfcrypt/src/sm2.c ../src/third_party/wolfssl/wolfssl/wolfcrypt/src/ripemd.c ../src/third_party/wolfssl/wolfssl/wolfcrypt/src/sp_sm2_cortexm.c ../src/third_party/wolfssl/wolfssl/wolfcrypt/src/sp_sm2_x86_64.c ../src/third_party/wolfssl/wolfssl/wolfcrypt/src/sphincs.c ../src/third_party/wolfssl/wolfssl/wolfcrypt/src/fe_low_mem.c ../src/third_party/wolfssl/wolfssl/wolfcrypt/src/sm3.c ../src/third_party/wolfssl/wolfssl/wolfcrypt/src/pkcs12.c ../src/third_party/wolfssl/wolfssl/wolfcrypt/src/wolfmath.c ../src/third_party/wolfssl/wolfssl/wolfcrypt/src/sp_arm32.c ../src/third_party/wolfssl/wolfssl/wolfcrypt/src/chacha.c ../src/third_party/wolfssl/wolfssl/wolfcrypt/src/wc_xmss.c ../src/third_party/wolfssl/wolfssl/wolfcrypt/src/sha3.c ../src/third_party/wolfssl/wolfssl/wolfcrypt/src/fe_operations.c ../src/third_party/wolfssl/wolfssl/wolfcrypt/src/camellia.c ../src/third_party/wolfssl/wolfssl/wolfcrypt/src/cryptocb.c ../src/third_party/wolfssl/wolfssl/wolfcrypt/src/wc_xmss_impl.c ../src/third_party/wolfssl/wolfssl/wolfcrypt/src/des3.c ../src/third_party/wolfssl/wolfssl/wolfcrypt/src/ext_xmss.c ../src/third_party/wolfssl/wolfssl/wolfcrypt/src/ge_448.c ../src/third_party/wolfssl/wolfssl/wolfcrypt/src/pkcs7.c ../src/third_party/wolfssl/wolfssl/wolfcrypt/src/sp_cortexm.c ../src/third_party/wolfssl/wolfssl/wolfcrypt/src/wc_port.c ../src/third_party/wolfssl/wolfssl/wolfcrypt/src/ed25519.c ../src/third_party/wolfssl/wolfssl/wolfcrypt/src/sha512.c ../src/third_party/wolfssl/wolfssl/wolfcrypt/src/memory.c ../src/third_party/wolfssl/wolfssl/wolfcrypt/src/blake2b.c ../src/third_party/wolfssl/wolfssl/wolfcrypt/src/curve25519.c ../src/third_party/wolfssl/wolfssl/wolfcrypt/src/misc.c ../src/third_party/wolfssl/wolfssl/wolfcrypt/src/sp_sm2_c32.c ../src/third_party/wolfssl/wolfssl/wolfcrypt/src/random.c ../src/third_party/wolfssl/wolfssl/wolfcrypt/src/rc2.c ../src/third_party/wolfssl/wolfssl/wolfcrypt/src/ge_low_mem.c ../src/third_party/wolfssl/wolfssl/wolfcrypt/src/sp_sm2_arm32.c ../src/third_party/wolfssl/wolfssl/wolfcrypt/src/blake2s.c ../src/third_party/wolfssl/wolfssl/wolfcrypt/src/sp_sm2_c64.c ../src/third_party/wolfssl/wolfssl/wolfcrypt/src/sp_c64.c ../src/third_party/wolfssl/wolfssl/wolfcrypt/src/wc_encrypt.c ../src/third_party/wolfssl/wolfssl/wolfcrypt/src/wc_lms_impl.c ../src/third_party/wolfssl/wolfssl/wolfcrypt/src/hpke.c ../src/third_party/wolfssl/wolfssl/wolfcrypt/src/ecc.c ../src/third_party/wolfssl/wolfssl/wolfcrypt/src/evp.c ../src/third_party/wolfssl/wolfssl/wolfcrypt/src/sp_arm64.c ../src/third_party/wolfssl/wolfssl/wolfcrypt/src/wc_kyber.c ../src/third_party/wolfssl/wolfssl/wolfcrypt/src/wolfevent.c ../src/third_party/wolfssl/wolfssl/wolfcrypt/src/integer.c ../src/third_party/wolfssl/wolfssl/wolfcrypt/src/ge_operations.c ../src/third_party/wolfssl/wolfssl/wolfcrypt/src/sp_dsp32.c ../src/third_party/wolfssl/wolfssl/wolfcrypt/src/sp_c32.c ../src/third_party/wolfssl/wolfssl/wolfcrypt/src/dilithium.c ../src/third_party/wolfssl/wolfssl/wolfcrypt/src/chacha20_poly1305.c ../src/third_party/wolfssl/wolfssl/wolfcrypt/src/wc_pkcs11.c ../src/third_party/wolfssl/wolfssl/wolfcrypt/src/wc_kyber_poly.c ../src/third_party/wolfssl/wolfssl/wolfcrypt/src/curve448.c ../src/third_party/wolfssl/wolfssl/wolfcrypt/src/fe_448.c ../src/third_party/wolfssl/src/x509.c ../src/third_party/wolfssl/src/ssl_bn.c ../src/third_party/wolfssl/src/keys.c ../src/third_party/wolfssl/src/x509_str.c ../src/third_party/wolfssl/src/tls13.c ../src/third_party/wolfssl/src/ssl_certman.c ../src/third_party/wolfssl/src/ocsp.c ../src/third_party/wolfssl/src/internal.c ../src/third_party/wolfssl/src/pk.c ../src/third_party/wolfssl/src/quic.c ../src/third_party/wolfssl/src/ssl_crypto.c ../src/third_party/wolfssl/src/ssl_misc.c ../src/third_party/wolfssl/src/ssl.c ../src/third_party/wolfssl/src/wolfio.c ../src/third_party/wolfssl/src/sniffer.c ../src/third_party/wolfssl/src/ssl_asn1.c ../src/third_party/wolfssl/src/tls.c ../src/third_party/wolfssl/src/dtls13.c ../src/third_party/wolfssl/src/dtls.c ../src/third_party/wolfssl/src/crl.c ../src/third_party/wolfssl/src/conf.c ../src/third_party/zlib/zutil.c ../src/third_party/zlib/crc32.c ../src/third_party/zlib/deflate.c ../src/third_party/zlib/adler32.c ../src/third_party/zlib/uncompr.c ../src/third_party/zlib/inflate.c ../src/third_party/zlib/trees.c ../src/third_party/zlib/inffast.c ../src/third_party/zlib/infback.c ../src/third_party/zlib/compress.c ../src/third_party/zlib/gzclose.c ../src/third_party/zlib/inftrees.c ../src/main.c ../src/http_server_print.c ../src/custom_http_server_app.c ../src/custom_snmp_app.c ../src/app_mqtt_task.c ../src/custom_http_app.c ../src/http_print.c ../src/config/default/system/console/src/sys_console_uart.c ../src/config/default/driver/usb/usbfs/src/drv_usbfs_host.c ../src/config/default/system/debug/src/sys_debug.c
 
 
 
@@ -1091,6 +1091,12 @@ ${OBJECTDIR}/_ext/1033058136/tcpip_heap_internal.o: ../src/config/default/librar
 	@${RM} ${OBJECTDIR}/_ext/1033058136/tcpip_heap_internal.o 
 	${MP_CC}  $(MP_EXTRA_CC_PRE) -g -D__DEBUG -D__MPLAB_DEBUGGER_PIC32MXSK=1  -fframe-base-loclist  -x c -c -mprocessor=$(MP_PROCESSOR_OPTION)  -ffunction-sections -fdata-sections -O1 -fno-common -DHAVE_CONFIG_H -DWOLFSSL_IGNORE_FILE_WARN -I"../src" -I"../src/config/default" -I"../src/config/default/library" -I"../src/config/default/library/cryptoauthlib" -I"../src/config/default/library/cryptoauthlib/crypto" -I"../src/config/default/library/cryptoauthlib/pkcs11" -I"../src/config/default/library/cryptoauthlib/test" -I"../src/config/default/library/tcpip/src" -I"../src/config/default/library/tcpip/src/common" -I"../src/config/default/system/fs/fat_fs/file_system" -I"../src/config/default/system/fs/fat_fs/hardware_access" -I"../src/config/default/third_party_adapter/wolfMQTT/src/" -I"../src/third_party/paho.mqtt.embedded-c" -I"../src/third_party/rtos/FreeRTOS/Source/include" -I"../src/third_party/rtos/FreeRTOS/Source/portable/MPLAB/PIC32MX" -I"../src/third_party/wolfMQTT" -I"../src/third_party/wolfssl" -I"../src/third_party/wolfssl/wolfssl" -I"../src/third_party/zlib" -Werror -Wall -MP -MMD -MF "${OBJECTDIR}/_ext/1033058136/tcpip_heap_internal.o.d" -o ${OBJECTDIR}/_ext/1033058136/tcpip_heap_internal.o ../src/config/default/library/tcpip/src/tcpip_heap_internal.c    -DXPRJ_default=$(CND_CONF)    $(COMPARISON_BUILD)  -mdfp="${DFP_DIR}"  
 	
+${OBJECTDIR}/_ext/1033058136/tcpip_heap_class.o: ../src/config/default/library/tcpip/src/tcpip_heap_class.c  .generated_files/flags/default/a9f4aa64769209c0d02b9ff90c0e1ec774a76b18 .generated_files/flags/default/da39a3ee5e6b4b0d3255bfef95601890afd80709
+	@${MKDIR} "${OBJECTDIR}/_ext/1033058136" 
+	@${RM} ${OBJECTDIR}/_ext/1033058136/tcpip_heap_class.o.d 
+	@${RM} ${OBJECTDIR}/_ext/1033058136/tcpip_heap_class.o 
+	${MP_CC}  $(MP_EXTRA_CC_PRE) -g -D__DEBUG -D__MPLAB_DEBUGGER_PIC32MXSK=1  -fframe-base-loclist  -x c -c -mprocessor=$(MP_PROCESSOR_OPTION)  -ffunction-sections -fdata-sections -O1 -fno-common -DHAVE_CONFIG_H -DWOLFSSL_IGNORE_FILE_WARN -I"../src" -I"../src/config/default" -I"../src/config/default/library" -I"../src/config/default/library/cryptoauthlib" -I"../src/config/default/library/cryptoauthlib/crypto" -I"../src/config/default/library/cryptoauthlib/pkcs11" -I"../src/config/default/library/cryptoauthlib/test" -I"../src/config/default/library/tcpip/src" -I"../src/config/default/library/tcpip/src/common" -I"../src/config/default/system/fs/fat_fs/file_system" -I"../src/config/default/system/fs/fat_fs/hardware_access" -I"../src/config/default/third_party_adapter/wolfMQTT/src/" -I"../src/third_party/paho.mqtt.embedded-c" -I"../src/third_party/rtos/FreeRTOS/Source/include" -I"../src/third_party/rtos/FreeRTOS/Source/portable/MPLAB/PIC32MX" -I"../src/third_party/wolfMQTT" -I"../src/third_party/wolfssl" -I"../src/third_party/wolfssl/wolfssl" -I"../src/third_party/zlib" -Werror -Wall -MP -MMD -MF "${OBJECTDIR}/_ext/1033058136/tcpip_heap_class.o.d" -o ${OBJECTDIR}/_ext/1033058136/tcpip_heap_class.o ../src/config/default/library/tcpip/src/tcpip_heap_class.c    -DXPRJ_default=$(CND_CONF)    $(COMPARISON_BUILD)  -mdfp="${DFP_DIR}"  
+	
 ${OBJECTDIR}/_ext/1033058136/tcpip_notify.o: ../src/config/default/library/tcpip/src/tcpip_notify.c  .generated_files/flags/default/111d181c1db03c38dd4470fd4035f4e18fa4bae3 .generated_files/flags/default/da39a3ee5e6b4b0d3255bfef95601890afd80709
 	@${MKDIR} "${OBJECTDIR}/_ext/1033058136" 
 	@${RM} ${OBJECTDIR}/_ext/1033058136/tcpip_notify.o.d 
@@ -3648,6 +3654,12 @@ ${OBJECTDIR}/_ext/1033058136/tcpip_heap_internal.o: ../src/config/default/librar
 	@${RM} ${OBJECTDIR}/_ext/1033058136/tcpip_heap_internal.o 
 	${MP_CC}  $(MP_EXTRA_CC_PRE)  -g -x c -c -mprocessor=$(MP_PROCESSOR_OPTION)  -ffunction-sections -fdata-sections -O1 -fno-common -DHAVE_CONFIG_H -DWOLFSSL_IGNORE_FILE_WARN -I"../src" -I"../src/config/default" -I"../src/config/default/library" -I"../src/config/default/library/cryptoauthlib" -I"../src/config/default/library/cryptoauthlib/crypto" -I"../src/config/default/library/cryptoauthlib/pkcs11" -I"../src/config/default/library/cryptoauthlib/test" -I"../src/config/default/library/tcpip/src" -I"../src/config/default/library/tcpip/src/common" -I"../src/config/default/system/fs/fat_fs/file_system" -I"../src/config/default/system/fs/fat_fs/hardware_access" -I"../src/config/default/third_party_adapter/wolfMQTT/src/" -I"../src/third_party/paho.mqtt.embedded-c" -I"../src/third_party/rtos/FreeRTOS/Source/include" -I"../src/third_party/rtos/FreeRTOS/Source/portable/MPLAB/PIC32MX" -I"../src/third_party/wolfMQTT" -I"../src/third_party/wolfssl" -I"../src/third_party/wolfssl/wolfssl" -I"../src/third_party/zlib" -Werror -Wall -MP -MMD -MF "${OBJECTDIR}/_ext/1033058136/tcpip_heap_internal.o.d" -o ${OBJECTDIR}/_ext/1033058136/tcpip_heap_internal.o ../src/config/default/library/tcpip/src/tcpip_heap_internal.c    -DXPRJ_default=$(CND_CONF)    $(COMPARISON_BUILD)  -mdfp="${DFP_DIR}"  
 	
+${OBJECTDIR}/_ext/1033058136/tcpip_heap_class.o: ../src/config/default/library/tcpip/src/tcpip_heap_class.c  .generated_files/flags/default/1a6a893b006fcda3dad27a24bfd6fb55974bc673 .generated_files/flags/default/da39a3ee5e6b4b0d3255bfef95601890afd80709
+	@${MKDIR} "${OBJECTDIR}/_ext/1033058136" 
+	@${RM} ${OBJECTDIR}/_ext/1033058136/tcpip_heap_class.o.d 
+	@${RM} ${OBJECTDIR}/_ext/1033058136/tcpip_heap_class.o 
+	${MP_CC}  $(MP_EXTRA_CC_PRE)  -g -x c -c -mprocessor=$(MP_PROCESSOR_OPTION)  -ffunction-sections -fdata-sections -O1 -fno-common -DHAVE_CONFIG_H -DWOLFSSL_IGNORE_FILE_WARN -I"../src" -I"../src/config/default" -I"../src/config/default/library" -I"../src/config/default/library/cryptoauthlib" -I"../src/config/default/library/cryptoauthlib/crypto" -I"../src/config/default/library/cryptoauthlib/pkcs11" -I"../src/config/default/library/cryptoauthlib/test" -I"../src/config/default/library/tcpip/src" -I"../src/config/default/library/tcpip/src/common" -I"../src/config/default/system/fs/fat_fs/file_system" -I"../src/config/default/system/fs/fat_fs/hardware_access" -I"../src/config/default/third_party_adapter/wolfMQTT/src/" -I"../src/third_party/paho.mqtt.embedded-c" -I"../src/third_party/rtos/FreeRTOS/Source/include" -I"../src/third_party/rtos/FreeRTOS/Source/portable/MPLAB/PIC32MX" -I"../src/third_party/wolfMQTT" -I"../src/third_party/wolfssl" -I"../src/third_party/wolfssl/wolfssl" -I"../src/third_party/zlib" -Werror -Wall -MP -MMD -MF "${OBJECTDIR}/_ext/1033058136/tcpip_heap_class.o.d" -o ${OBJECTDIR}/_ext/1033058136/tcpip_heap_class.o ../src/config/default/library/tcpip/src/tcpip_heap_class.c    -DXPRJ_default=$(CND_CONF)    $(COMPARISON_BUILD)  -mdfp="${DFP_DIR}"  
+	
 ${OBJECTDIR}/_ext/1033058136/tcpip_notify.o: ../src/config/default/library/tcpip/src/tcpip_notify.c  .generated_files/flags/default/d47cf4a1f2e0ad3c87dbc994362c0911ba9c16ad .generated_files/flags/default/da39a3ee5e6b4b0d3255bfef95601890afd80709
 	@${MKDIR} "${OBJECTDIR}/_ext/1033058136" 
 	@${RM} ${OBJECTDIR}/_ext/1033058136/tcpip_notify.o.d 
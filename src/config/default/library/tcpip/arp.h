@@ -106,6 +106,7 @@ typedef enum
     ARP_RES_BAD_TYPE            = -7,   // no such type is valid/exists   
     ARP_RES_CONFIGURE_ERR       = -8,   // interface is configuring now, no ARP probes
     ARP_RES_PROBE_FAILED        = -9,   // requested probe failed
+    ARP_RES_HOST_UNREACHABLE    = -10,  // address recently failed to resolve, no ARP query sent
 }TCPIP_ARP_RESULT;
 
 
@@ -359,11 +360,17 @@ bool            TCPIP_ARP_HandlerDeRegister(TCPIP_ARP_HANDLE hArp);
                                was added (and queued for resolving)
     ARP_RES_CACHE_FULL       - if new entry could not be inserted,
                                the cache was full
+    ARP_RES_HOST_UNREACHABLE - the address recently failed to resolve
     ARP_RES_BAD_ADDRESS      - bad address specified
     ARP_RES_NO_INTERFACE     - no such interface
 
   Remarks:
     To retrieve the ARP query result, call the TCPIP_ARP_IsResolved function.
+
+    An address that could not be resolved is remembered for TCPIP_ARP_NEGATIVE_TMO seconds.
+    During this time no new ARP query is sent for it and ARP_RES_HOST_UNREACHABLE is returned.
+    Receiving an ARP packet from that host or removing the entry
+    with TCPIP_ARP_EntryRemove() clears the condition.
     
 */
 TCPIP_ARP_RESULT      TCPIP_ARP_Resolve(TCPIP_NET_HANDLE hNet, const IPV4_ADDR* IPAddr);
@@ -437,6 +444,7 @@ bool            TCPIP_ARP_IsResolved(TCPIP_NET_HANDLE hNet, const IPV4_ADDR* IPA
                                  was added (and queued for resolving)
     - ARP_RES_CACHE_FULL       - if new entry could not be inserted,
                                  the cache was full
+    - ARP_RES_HOST_UNREACHABLE - the address recently failed to resolve
     - ARP_RES_BAD_ADDRESS      - bad address specified
     - ARP_RES_NO_INTERFACE     - no such interface
 
@@ -448,6 +456,9 @@ bool            TCPIP_ARP_IsResolved(TCPIP_NET_HANDLE hNet, const IPV4_ADDR* IPA
 
     No check is done for IPAddr to be valid.
 
+    A probe using ARP_OPERATION_CONFIGURE or ARP_OPERATION_GRATUITOUS
+    is always sent, even if the address recently failed to resolve.
+
     To retrieve the ARP query result, call the TCPIP_ARP_IsResolved function.
 */
 TCPIP_ARP_RESULT TCPIP_ARP_Probe(TCPIP_NET_HANDLE hNet
@@ -519,6 +530,11 @@ TCPIP_ARP_RESULT      TCPIP_ARP_EntrySet(TCPIP_NET_HANDLE hNet, const IPV4_ADDR*
         - If the hardware address exists in the cache, the result is written to pHwAdd
         and no network ARP request is sent
 
+    An entry that exceeded TCPIP_ARP_CACHE_SOLVED_ENTRY_TMO is still returned
+    for TCPIP_ARP_STALE_TMO seconds.
+    When such a stale entry is used, a unicast ARP request is sent to the cached
+    hardware address to revalidate it, without delaying the traffic.
+
   Precondition:
     The ARP module should have been initialized.
 
@@ -536,6 +552,7 @@ TCPIP_ARP_RESULT      TCPIP_ARP_EntrySet(TCPIP_NET_HANDLE hNet, const IPV4_ADDR*
     - ARP_RES_CACHE_FULL       - if new entry could not be inserted,
                                  the cache was full
     - ARP_RES_NO_ENTRY         - no such address found in cache
+    - ARP_RES_HOST_UNREACHABLE - the address recently failed to resolve
     - ARP_RES_BAD_ADDRESS      - bad address specified
     - ARP_RES_NO_INTERFACE     - no such interface
     - ARP_RES_CONFIGURE_ERR    - interface not ready yet
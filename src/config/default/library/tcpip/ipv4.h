@@ -321,6 +321,7 @@ typedef struct
     unsigned int fwdPackets;        // total should be forwarded packets
     unsigned int fwdQueuedPackets;  // queued packets (forwarded and then processed internally)
     unsigned int macPackets;        // packets actually forwarded to MAC
+    unsigned int flowPackets;       // packets that used a resolved flow cache entry
 }TCPIP_IPV4_FORWARD_STAT;
 
 // *****************************************************************************
@@ -347,6 +348,55 @@ typedef struct
     size_t totFailed;   // total failed 
 }TCPIP_IPV4_ARP_QUEUE_STAT;
 
+// *****************************************************************************
+/* IPv4 ARP destination statistics data
+
+  Summary:
+    Structure describing the statistics of a destination waiting for ARP resolution
+
+  Description:
+    Data structure updated by the IPv4 ARP process for each destination
+    that had packets queued while the ARP resolution was in progress
+
+  Remarks:
+    A destination slot is reused when a new destination needs to be queued.
+    The counters are reset when the slot is reused.
+*/
+typedef struct
+{
+    IPV4_ADDR       arpTarget;  // ARP resolution target: destination or gateway
+    int             netIx;      // index of the interface the packets are queued on
+    unsigned int    pending;    // packets currently waiting for resolution
+    unsigned int    queued;     // packets queued for this destination
+    unsigned int    flushed;    // packets transmitted when the ARP was resolved
+    unsigned int    dropped;    // packets discarded: oldest dropped, ARP failure or TX error
+}TCPIP_IPV4_ARP_DEST_STAT;
+
+// *****************************************************************************
+/* IPv4 NAPT statistics data
+
+  Summary:
+    Structure describing the NAPT statistics maintained by the IPv4 module
+
+  Description:
+    Data structure updated by the IPv4 NAPT process
+
+  Remarks:
+    None
+*/
+typedef struct
+{
+    unsigned int entries;           // translations currently in use
+    unsigned int newEntries;        // translations created
+    unsigned int expiredEntries;    // translations removed after a timeout
+    unsigned int outPackets;        // outbound packets translated
+    unsigned int inPackets;         // inbound packets translated
+    unsigned int failFull;          // outbound packets dropped: translation table full
+    unsigned int failFragment;      // outbound packets dropped: fragments cannot be translated
+    unsigned int failProtocol;      // outbound packets dropped: protocol or ICMP type not translated
+    unsigned int failFormat;        // outbound packets dropped: transport header not in the 1st segment
+}TCPIP_IPV4_NAPT_STAT;
+
 // *****************************************************************************
 /* IPv4 configuration
 
@@ -428,6 +478,8 @@ typedef enum
     TCPIP_IPV4_RES_FWD_TABLE_ERR    = -12,      // invalid forwarding table - forwarding not enabled/existing
     TCPIP_IPV4_RES_FWD_LOCK_ERR     = -13,      // lock of the forwarding table could not be created/obtained
     TCPIP_IPV4_RES_FWD_NO_ENTRY_ERR = -14,      // no such entry exists
+    TCPIP_IPV4_RES_ACL_RULE_ERR     = -15,      // invalid ACL rule
+    TCPIP_IPV4_RES_NAPT_ERR         = -16,      // NAPT not available: not enabled or no forwarding
 
 
 }TCPIP_IPV4_RES;
@@ -860,8 +912,11 @@ void    TCPIP_IPV4_PacketFormatTx(IPV4_PACKET* pPkt, uint8_t protocol, uint16_t
     - false - the packet cannot be transmitted (wrong interface, etc.) 
       
   Remarks:
-    Only single packets can be transmitted.
-    Chained packets are not supported for now.
+    A burst of packets for the same destination can be chained using the
+    macPkt.next field. The burst is handed to the MAC in one call
+    if the destination MAC address is resolved and no fragmentation is needed.
+    Otherwise the call returns false and nothing is transmitted:
+    the packets need to be transmitted one by one.
  */
 bool    TCPIP_IPV4_PacketTransmit(IPV4_PACKET* pPkt);
 
@@ -1059,6 +1114,148 @@ TCPIP_IPV4_FILTER_TYPE    TCPIP_IPV4_PacketFilterSet(TCPIP_IPV4_FILTER_TYPE filt
  */
 TCPIP_IPV4_FILTER_TYPE    TCPIP_IPV4_PacketFilterClear(TCPIP_IPV4_FILTER_TYPE filtType);
 
+// *****************************************************************************
+/* IPv4 ACL rule action
+
+  Summary:
+    Action taken when an IPv4 ACL rule matches
+
+  Description:
+    List of the actions that an ACL rule can take for a matching packet.
+
+  Remarks:
+    None.
+ */
+typedef enum
+{
+    TCPIP_IPV4_ACL_ACTION_PERMIT    = 0,    // the packet is accepted and goes through the normal processing
+    TCPIP_IPV4_ACL_ACTION_DENY      = 1,    // the packet is discarded
+}TCPIP_IPV4_ACL_ACTION;
+
+// *****************************************************************************
+/* IPv4 ACL rule
+
+  Summary:
+    Definition of an IPv4 ACL rule
+
+  Description:
+    An ACL rule matches an incoming IPv4 packet when all its fields match.
+
+  Remarks:
+    The ports are checked only for TCP and UDP packets.
+    Packets without port information (other protocols, non initial fragments)
+    are evaluated with the ports set to 0.
+ */
+typedef struct
+{
+    /* source address to match, network order */
+    uint32_t            srcAddress;
+    /* source address mask, network order; 0 matches any source */
+    uint32_t            srcMask;
+    /* destination address to match, network order */
+    uint32_t            destAddress;
+    /* destination address mask, network order; 0 matches any destination */
+    uint32_t            destMask;
+    /* source port range, host order; srcPortMin == srcPortMax == 0 matches any port */
+    uint16_t            srcPortMin;
+    uint16_t            srcPortMax;
+    /* destination port range, host order; destPortMin == destPortMax == 0 matches any port */
+    uint16_t            destPortMin;
+    uint16_t            destPortMax;
+    /* interface the packet arrived on; 0 matches any interface */
+    TCPIP_NET_HANDLE    netH;
+    /* IPv4 protocol: IP_PROT_TCP, IP_PROT_UDP, etc.; 0 matches any protocol */
+    uint8_t             protocol;
+    /* a TCPIP_IPV4_ACL_ACTION value */
+    uint8_t             action;
+}TCPIP_IPV4_ACL_RULE;
+
+// *****************************************************************************
+/*
+  Function:
+    TCPIP_IPV4_RES TCPIP_IPV4_AclSet(const TCPIP_IPV4_ACL_RULE* pRules, size_t nRules, TCPIP_IPV4_ACL_ACTION defAction);
+
+  Summary:
+    Sets the IPv4 ACL rules
+
+  Description:
+    The function replaces the current IPv4 ACL with a new set of rules.
+    An ACL with up to TCPIP_IPV4_ACL_LINEAR_RULES rules is stored as is
+    and the rules are checked one by one for each received packet.
+    A larger ACL is compiled into a lookup structure when the function is called,
+    so the cost per received packet depends very little on the number of rules.
+
+    The rules are evaluated in order and the 1st matching rule selects the action.
+    If no rule matches, the default action is taken.
+
+  Precondition:
+    IPv4 properly initialized
+        
+
+  Parameters:
+    pRules      - array of rules
+    nRules      - number of rules in the array
+                  0 removes the current ACL
+    defAction   - action to take when no rule matches
+
+
+  Returns:
+    - TCPIP_IPV4_RES_OK if operation successful
+    - TCPIP_IPV4_RES_ACL_RULE_ERR if a rule is invalid
+    - TCPIP_IPV4_RES_MASK_ERR if a rule mask is not contiguous
+    - TCPIP_IPV4_RES_IF_ERR if a rule interface is invalid
+    - TCPIP_IPV4_RES_MEM_ERR if there's not enough memory
+      
+  Remarks:
+    The ACL is a build time option, enabled by TCPIP_IPV4_ACL_ENABLE.
+    The maximum number of rules is TCPIP_IPV4_ACL_MAX_RULES.
+
+    The linear scan costs more as the matching rule is further down the list
+    but it has little fixed overhead, so it is the faster of the two for short lists.
+    The compiled lookup has a higher fixed cost per packet
+    (a search and a bitmap per packet field that the rules set)
+    and uses more RAM, but it scales with the number of rules.
+    TCPIP_IPV4_ACL_LINEAR_RULES (default 8) selects where the switch happens;
+    0 always compiles the rules.
+
+    The rule hit counters are cleared when a new ACL is set.
+
+    The ACL is checked before the TCPIP_IPV4_FILTER_TYPE filters.
+ */
+TCPIP_IPV4_RES TCPIP_IPV4_AclSet(const TCPIP_IPV4_ACL_RULE* pRules, size_t nRules, TCPIP_IPV4_ACL_ACTION defAction);
+
+// *****************************************************************************
+/*
+  Function:
+    bool TCPIP_IPV4_AclRuleHitsGet(size_t ruleIx, uint32_t* pHits, bool clear);
+
+  Summary:
+    Returns the hit counter of an IPv4 ACL rule
+
+  Description:
+    The function returns the number of packets that matched an ACL rule.
+
+  Precondition:
+    IPv4 properly initialized
+    ACL set
+        
+
+  Parameters:
+    ruleIx  - index of the rule, as passed to TCPIP_IPV4_AclSet
+              an index equal to the number of rules returns the default action hits
+    pHits   - address to store the number of hits
+    clear   - if true, the counter is cleared after the read
+
+
+  Returns:
+    - true if the rule exists and pHits was updated
+    - false if no ACL is set or the index is invalid
+      
+  Remarks:
+    None.
+ */
+bool TCPIP_IPV4_AclRuleHitsGet(size_t ruleIx, uint32_t* pHits, bool clear);
+
 
 // *****************************************************************************
 /*
@@ -1701,6 +1898,81 @@ bool TCPIP_IPV4_ForwadTableEntryGet(TCPIP_NET_HANDLE netH, size_t index, TCPIP_I
  */
 bool TCPIP_IPv4_ForwardStatGet(size_t index, TCPIP_IPV4_FORWARD_STAT* pStat, bool clear);
 
+// *****************************************************************************
+/*
+  Function:
+    TCPIP_IPV4_RES TCPIP_IPV4_NaptSet(TCPIP_NET_HANDLE netH);
+
+  Summary:
+    Selects the NAPT outside interface
+   
+  Description:
+    The function enables the network address and port translation (NAPT)
+    for the packets forwarded to the selected interface.
+    The source address of these packets is replaced with the interface address
+    and the source port (or ICMP echo identifier) with a port allocated for the connection.
+    The replies received on this interface for a translated connection
+    are translated back and forwarded to the inside host.
+   
+  Precondition:
+    IPv4 properly initialized
+    IPv4 forwarding enabled
+        
+
+  Parameters:
+    netH        - outside network interface handle
+                  0 disables the translation
+
+  Returns:
+    - TCPIP_IPV4_RES_OK if operation successful
+    - TCPIP_IPV4_RES_IF_ERR if the interface is invalid
+    - TCPIP_IPV4_RES_NAPT_ERR if NAPT is not available
+      
+  Remarks:
+    The NAPT is a build time option, enabled by TCPIP_IPV4_NAPT_ENABLE.
+    The translation table has TCPIP_IPV4_NAPT_ENTRIES entries, allocated at initialization.
+
+    Only TCP, UDP and ICMP echo are translated.
+    Other packets forwarded to the outside interface from the inside interfaces,
+    including fragments, are discarded.
+
+    The inbound packets to the outside interface address that do not match a translation
+    are processed locally, as usual.
+
+    Changing the outside interface removes all the current translations.
+ */
+TCPIP_IPV4_RES TCPIP_IPV4_NaptSet(TCPIP_NET_HANDLE netH);
+
+// *****************************************************************************
+/*
+  Function:
+    bool TCPIP_IPV4_NaptStatGet(TCPIP_IPV4_NAPT_STAT* pStat, bool clear);
+
+  Summary:
+    Helper to get the NAPT statistics
+   
+  Description:
+    The function is a helper that returns the contents of the NAPT statistics
+    maintained by the IPv4 module
+   
+  Precondition:
+    IPv4 properly initialized
+    IPv4 NAPT enabled
+        
+
+  Parameters:
+    pStat   - pointer to a structure to store the NAPT statistics
+    clear   - if true, the statistics are cleared
+
+  Returns:
+    - true if the statistics were updated
+    - false if NAPT is not available
+      
+  Remarks:
+    Clearing the statistics does not clear the number of entries in use.
+ */
+bool TCPIP_IPV4_NaptStatGet(TCPIP_IPV4_NAPT_STAT* pStat, bool clear);
+
 // *****************************************************************************
 /*
   Function:
@@ -1732,6 +2004,42 @@ bool TCPIP_IPv4_ForwardStatGet(size_t index, TCPIP_IPV4_FORWARD_STAT* pStat, boo
  */
 bool TCPIP_IPv4_ArpStatGet(TCPIP_IPV4_ARP_QUEUE_STAT* pStat, bool clear);
 
+// *****************************************************************************
+/*
+  Function:
+    bool TCPIP_IPV4_ArpQueueStatGet(size_t index, TCPIP_IPV4_ARP_DEST_STAT* pStat, bool clear);
+
+  Summary:
+    Helper to get the statistics of a destination waiting for ARP resolution
+   
+  Description:
+    The function is a helper that returns the packet counters
+    of a destination that had packets queued while ARP was resolving
+   
+  Precondition:
+    IPv4 properly initialized
+        
+
+  Parameters:
+    index   - index of the destination slot
+              0 <= index < TCPIP_IPV4_ARP_QUEUE_DESTINATIONS
+    pStat   - pointer to a structure to store the destination statistics
+              could be NULL
+    clear   - if true, the destination counters are cleared
+
+  Returns:
+    - true if success
+    - false if the index is out of range or the slot was never used
+      
+  Remarks:
+    Each destination can queue up to TCPIP_IPV4_ARP_QUEUE_DEST_PACKETS packets.
+    When the limit is reached the oldest queued packet is dropped.
+
+    The destination slots are used in order, starting with index 0.
+    Clearing the counters does not affect the pending packets.
+ */
+bool TCPIP_IPV4_ArpQueueStatGet(size_t index, TCPIP_IPV4_ARP_DEST_STAT* pStat, bool clear);
+
 
 // *****************************************************************************
 /*
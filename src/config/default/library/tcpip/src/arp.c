@@ -124,6 +124,10 @@ static void         _ARPNotifyClients(TCPIP_NET_IF* pNetIf, const IPV4_ADDR* ipA
 
 static TCPIP_ARP_RESULT   _ARPProbeAddress(TCPIP_NET_IF* pIf, const IPV4_ADDR* IPAddr, const IPV4_ADDR* srcAddr, TCPIP_ARP_OPERATION_TYPE opType, TCPIP_MAC_ADDR* pHwAdd);
 
+static OA_HASH_ENTRY*   _ARPCacheLookup(ARP_CACHE_DCPT* pArpDcpt, const uint32_t* pIpAdd, bool insert);
+
+static void         _ARPUseEntry(TCPIP_NET_IF* pIf, ARP_CACHE_DCPT* pArpDcpt, ARP_HASH_ENTRY* arpHE);
+
 static TCPIP_MAC_PACKET* _ARPAllocateTxPacket(void);
 
 static void         _ARPTxAckFnc (TCPIP_MAC_PACKET * pPkt, const void * param);
@@ -145,7 +149,7 @@ void TCPIP_ARP_HashKeyCopy(OA_HASH_DCPT* pOH, OA_HASH_ENTRY* dstEntry, const voi
 /*static __inline__*/static  void /*__attribute__((always_inline))*/ _ARPSetEntry(ARP_HASH_ENTRY* arpHE, ARP_ENTRY_FLAGS newFlags,
                                                                       const TCPIP_MAC_ADDR* hwAdd, PROTECTED_SINGLE_LIST* addList)
 {
-    arpHE->hEntry.flags.value &= ~ARP_FLAG_ENTRY_VALID_MASK;
+    arpHE->hEntry.flags.value &= ~(ARP_FLAG_ENTRY_VALID_MASK | ARP_FLAG_ENTRY_STATE_MASK);
     arpHE->hEntry.flags.value |= newFlags;
     
     if(hwAdd)
@@ -179,26 +183,40 @@ void TCPIP_ARP_HashKeyCopy(OA_HASH_DCPT* pOH, OA_HASH_ENTRY* dstEntry, const voi
         TCPIP_Helper_ProtectedSingleListRemoveAll(&pArpDcpt->incompleteList);
         TCPIP_Helper_ProtectedSingleListRemoveAll(&pArpDcpt->completeList);
         TCPIP_Helper_ProtectedSingleListRemoveAll(&pArpDcpt->permList);
+        TCPIP_Helper_ProtectedSingleListRemoveAll(&pArpDcpt->staleList);
+        TCPIP_Helper_ProtectedSingleListRemoveAll(&pArpDcpt->negativeList);
     }
 }
 
-static  void _ARPRemoveEntry(ARP_CACHE_DCPT* pArpDcpt, OA_HASH_ENTRY* hE)
+// returns the list an entry belongs to, based on its flags
+static PROTECTED_SINGLE_LIST* _ARPEntryList(ARP_CACHE_DCPT* pArpDcpt, uint16_t entryFlags)
 {
-    PROTECTED_SINGLE_LIST     *remList;
-
-    if((hE->flags.value & ARP_FLAG_ENTRY_PERM) != 0 )
+    if((entryFlags & ARP_FLAG_ENTRY_PERM) != 0 )
     {
-        remList =  &pArpDcpt->permList;
+        return &pArpDcpt->permList;
     }
-    else if((hE->flags.value & ARP_FLAG_ENTRY_COMPLETE) != 0 )
+    else if((entryFlags & ARP_FLAG_ENTRY_STALE) != 0 )
     {
-        remList =  &pArpDcpt->completeList;
+        return &pArpDcpt->staleList;
     }
-    else
+    else if((entryFlags & ARP_FLAG_ENTRY_COMPLETE) != 0 )
+    {
+        return &pArpDcpt->completeList;
+    }
+    else if((entryFlags & ARP_FLAG_ENTRY_NEGATIVE) != 0 )
     {
-        remList =  &pArpDcpt->incompleteList;
+        return &pArpDcpt->negativeList;
     }
 
+    return &pArpDcpt->incompleteList;
+}
+
+static  void _ARPRemoveEntry(ARP_CACHE_DCPT* pArpDcpt, OA_HASH_ENTRY* hE)
+{
+    PROTECTED_SINGLE_LIST     *remList;
+
+    remList = _ARPEntryList(pArpDcpt, hE->flags.value);
+
     TCPIP_Helper_ProtectedSingleListNodeRemove(remList, (SGL_LIST_NODE*)&((ARP_HASH_ENTRY*)hE)->next);
 
     TCPIP_OAHASH_EntryRemove(pArpDcpt->hashDcpt, hE);
@@ -466,14 +484,15 @@ static void _ARPUpdateEntry(TCPIP_NET_IF* pIf, ARP_HASH_ENTRY* arpHE, const TCPI
 
         if((arpHE->hEntry.flags.value & ARP_FLAG_ENTRY_COMPLETE) == 0)
         {   // was waiting for this one, it was queued
+            // or it was a negative entry and the host is now alive
             evType = ARP_EVENT_SOLVED;
-            TCPIP_Helper_ProtectedSingleListNodeRemove(&pArpDcpt->incompleteList, (SGL_LIST_NODE*)&arpHE->next);
         }
         else
         {   // completed entry, but now updated
+            // stale entries get revalidated
             evType = ARP_EVENT_UPDATED;
-            TCPIP_Helper_ProtectedSingleListNodeRemove(&pArpDcpt->completeList, (SGL_LIST_NODE*)&arpHE->next);
         }
+        TCPIP_Helper_ProtectedSingleListNodeRemove(_ARPEntryList(pArpDcpt, arpHE->hEntry.flags.value), (SGL_LIST_NODE*)&arpHE->next);
         
         // move to tail, updated
         _ARPSetEntry(arpHE, ARP_FLAG_ENTRY_COMPLETE, hwAdd, &pArpDcpt->completeList);
@@ -689,7 +708,17 @@ bool TCPIP_ARP_Initialize(const TCPIP_STACK_MODULE_CTRL* const stackCtrl, const
                         break;
                     }
 
-                    iniRes = TCPIP_Helper_ProtectedSingleListInitialize(&pArpDcpt->incompleteList);
+                    if((iniRes = TCPIP_Helper_ProtectedSingleListInitialize(&pArpDcpt->incompleteList)) == false)
+                    {
+                        break;
+                    }
+
+                    if((iniRes = TCPIP_Helper_ProtectedSingleListInitialize(&pArpDcpt->staleList)) == false)
+                    {
+                        break;
+                    }
+
+                    iniRes = TCPIP_Helper_ProtectedSingleListInitialize(&pArpDcpt->negativeList);
                     break;
                 }
 
@@ -820,6 +849,8 @@ static void _ARPDeleteCache(ARP_CACHE_DCPT* pArpDcpt)
         TCPIP_Helper_ProtectedSingleListDeinitialize(&pArpDcpt->incompleteList);
         TCPIP_Helper_ProtectedSingleListDeinitialize(&pArpDcpt->completeList);
         TCPIP_Helper_ProtectedSingleListDeinitialize(&pArpDcpt->permList);
+        TCPIP_Helper_ProtectedSingleListDeinitialize(&pArpDcpt->staleList);
+        TCPIP_Helper_ProtectedSingleListDeinitialize(&pArpDcpt->negativeList);
         
         TCPIP_HEAP_Free(arpMod.memH, pArpDcpt->hashDcpt);
         pArpDcpt->hashDcpt = 0;
@@ -962,7 +993,7 @@ static void TCPIP_ARP_Timeout(void)
     int netIx, purgeIx;
     ARP_HASH_ENTRY  *pE;
     ARP_CACHE_DCPT  *pArpDcpt;
-    SGL_LIST_NODE   *pN;
+    SGL_LIST_NODE   *pN, *pNext;
     TCPIP_NET_IF *pIf;
     int         nArpIfs;
     bool        isConfig;
@@ -991,8 +1022,15 @@ static void TCPIP_ARP_Timeout(void)
             pE = (ARP_HASH_ENTRY*) ((uint8_t*)pN - offsetof(struct _TAG_ARP_HASH_ENTRY, next));
             if( (arpMod.timeSeconds - pE->tInsert) >= arpMod.entryPendingTmo)
             {   // expired, remove it
-                TCPIP_OAHASH_EntryRemove(pArpDcpt->hashDcpt, &pE->hEntry);
                 TCPIP_Helper_ProtectedSingleListHeadRemove(&pArpDcpt->incompleteList);
+                if(_TCPIP_ARP_NEGATIVE_TMO != 0 && (pE->hEntry.flags.value & (ARP_FLAG_ENTRY_CONFIGURE | ARP_FLAG_ENTRY_GRATUITOUS)) == 0)
+                {   // regular query that failed; keep it so that new look ups fail fast
+                    _ARPSetEntry(pE, ARP_FLAG_ENTRY_NEGATIVE, 0, &pArpDcpt->negativeList);
+                }
+                else
+                {
+                    TCPIP_OAHASH_EntryRemove(pArpDcpt->hashDcpt, &pE->hEntry);
+                }
                 _ARPNotifyClients(pIf, &pE->ipAddress, 0, ARP_EVENT_REMOVED_TMO);
             }
             else
@@ -1025,14 +1063,54 @@ static void TCPIP_ARP_Timeout(void)
             }
         }
 
+        // the negative entries are simply discarded when they expire
+        while( (pN = pArpDcpt->negativeList.list.head) != 0)
+        {
+            pE = (ARP_HASH_ENTRY*) ((uint8_t*)pN - offsetof(struct _TAG_ARP_HASH_ENTRY, next));
+            if( (arpMod.timeSeconds - pE->tInsert) >= _TCPIP_ARP_NEGATIVE_TMO)
+            {   // expired, remove it; clients already notified
+                TCPIP_OAHASH_EntryRemove(pArpDcpt->hashDcpt, &pE->hEntry);
+                TCPIP_Helper_ProtectedSingleListHeadRemove(&pArpDcpt->negativeList);
+            }
+            else
+            {   // this list is ordered, we can safely break out
+                break;
+            }
+        }
+
         // see the completed entries queue
         while( (pN = pArpDcpt->completeList.list.head) != 0)
         {
             pE = (ARP_HASH_ENTRY*) ((uint8_t*)pN - offsetof(struct _TAG_ARP_HASH_ENTRY, next));
             if( (arpMod.timeSeconds - pE->tInsert) >= arpMod.entrySolvedTmo)
-            {   // expired, remove it
-                TCPIP_OAHASH_EntryRemove(pArpDcpt->hashDcpt, &pE->hEntry);
+            {   // expired
                 TCPIP_Helper_ProtectedSingleListHeadRemove(&pArpDcpt->completeList);
+                if(_TCPIP_ARP_STALE_TMO != 0)
+                {   // keep using it; it will be revalidated when needed
+                    pE->hEntry.flags.value |= ARP_FLAG_ENTRY_STALE;
+                    pE->tInsert = arpMod.timeSeconds;
+                    TCPIP_Helper_ProtectedSingleListTailAdd(&pArpDcpt->staleList, pN);
+                }
+                else
+                {   // remove it
+                    TCPIP_OAHASH_EntryRemove(pArpDcpt->hashDcpt, &pE->hEntry);
+                    _ARPNotifyClients(pIf, &pE->ipAddress, 0, ARP_EVENT_REMOVED_EXPIRED);
+                }
+            }
+            else
+            {   // this list is ordered, we can safely break out
+                break;
+            }
+        }
+
+        // see the stale entries queue
+        while( (pN = pArpDcpt->staleList.list.head) != 0)
+        {
+            pE = (ARP_HASH_ENTRY*) ((uint8_t*)pN - offsetof(struct _TAG_ARP_HASH_ENTRY, next));
+            if( (arpMod.timeSeconds - pE->tInsert) >= _TCPIP_ARP_STALE_TMO)
+            {   // not used or not revalidated in time, remove it
+                TCPIP_OAHASH_EntryRemove(pArpDcpt->hashDcpt, &pE->hEntry);
+                TCPIP_Helper_ProtectedSingleListHeadRemove(&pArpDcpt->staleList);
                 _ARPNotifyClients(pIf, &pE->ipAddress, 0, ARP_EVENT_REMOVED_EXPIRED);
             }
             else
@@ -1041,12 +1119,39 @@ static void TCPIP_ARP_Timeout(void)
             }
         }
 
+        // retry the revalidation of the stale entries that are in use
+        for(pN = pArpDcpt->staleList.list.head; pN != 0 && isConfig == false; pN = pNext)
+        {
+            pNext = pN->next;
+            pE = (ARP_HASH_ENTRY*) ((uint8_t*)pN - offsetof(struct _TAG_ARP_HASH_ENTRY, next));
+            if((pE->hEntry.flags.value & ARP_FLAG_ENTRY_REFRESH) != 0 && (arpMod.timeSeconds - pE->tInsert) >= pE->nRetries * arpMod.entryRetryTmo)
+            {
+                if(pE->nRetries < arpMod.entryRetries)
+                {   // unicast to the known hardware address
+                    _ARPSendIfPkt(pIf, ARP_OPERATION_REQ, (uint32_t)pIf->netIPAddr.Val, pE->ipAddress.Val, &pE->hwAdd, 0);
+                    pE->nRetries++;
+                }
+                else
+                {   // no answer; remove it, a new look up will broadcast
+                    TCPIP_OAHASH_EntryRemove(pArpDcpt->hashDcpt, &pE->hEntry);
+                    TCPIP_Helper_ProtectedSingleListNodeRemove(&pArpDcpt->staleList, pN);
+                    _ARPNotifyClients(pIf, &pE->ipAddress, 0, ARP_EVENT_REMOVED_EXPIRED);
+                }
+            }
+        }
+
         // finally purge, if needed
         if(pArpDcpt->hashDcpt->fullSlots >= pArpDcpt->purgeThres)
         {
             for(purgeIx = 0; purgeIx < pArpDcpt->purgeQuanta; purgeIx++)
-            {
-                pN = TCPIP_Helper_ProtectedSingleListHeadRemove(&pArpDcpt->completeList);
+            {   // the negative and stale entries go first
+                if((pN = TCPIP_Helper_ProtectedSingleListHeadRemove(&pArpDcpt->negativeList)) == 0)
+                {
+                    if((pN = TCPIP_Helper_ProtectedSingleListHeadRemove(&pArpDcpt->staleList)) == 0)
+                    {
+                        pN = TCPIP_Helper_ProtectedSingleListHeadRemove(&pArpDcpt->completeList);
+                    }
+                }
                 if(pN)
                 {
                     pE = (ARP_HASH_ENTRY*) ((uint8_t*)pN - offsetof(struct _TAG_ARP_HASH_ENTRY, next));
@@ -1239,6 +1344,7 @@ static TCPIP_ARP_RESULT _ARPProbeAddress(TCPIP_NET_IF* pIf, const IPV4_ADDR* IPA
 {
     ARP_CACHE_DCPT  *pArpDcpt;
     OA_HASH_ENTRY   *hE;
+    bool            newQuery;
    
      
     if((opType & ARP_OPERATION_PROBE_ONLY) != 0)
@@ -1248,13 +1354,25 @@ static TCPIP_ARP_RESULT _ARPProbeAddress(TCPIP_NET_IF* pIf, const IPV4_ADDR* IPA
 
     pArpDcpt = _ARPGetIfDcpt(pIf);
 
-    hE = TCPIP_OAHASH_EntryLookupOrInsert(pArpDcpt->hashDcpt, &IPAddr->Val);
+    hE = _ARPCacheLookup(pArpDcpt, &IPAddr->Val, true);
     if(hE == 0)
     {   // oops!
         return ARP_RES_CACHE_FULL;
     }
         
-    if(hE->flags.newEntry != 0)
+    newQuery = hE->flags.newEntry != 0;
+    if(!newQuery && (hE->flags.value & ARP_FLAG_ENTRY_NEGATIVE) != 0)
+    {   // this address recently failed to resolve
+        if((opType & (ARP_OPERATION_CONFIGURE | ARP_OPERATION_GRATUITOUS)) == 0)
+        {   // do not query again until the negative entry expires
+            return ARP_RES_HOST_UNREACHABLE;
+        }
+        // explicit probe: start over
+        TCPIP_Helper_ProtectedSingleListNodeRemove(&pArpDcpt->negativeList, (SGL_LIST_NODE*)&((ARP_HASH_ENTRY*)hE)->next);
+        newQuery = true;
+    }
+
+    if(newQuery)
     {   // new entry; add it to the not done list 
         ARP_ENTRY_FLAGS newFlags = (opType & ARP_OPERATION_CONFIGURE) != 0 ? ARP_FLAG_ENTRY_CONFIGURE : 0;
         if((opType & ARP_OPERATION_GRATUITOUS) != 0) 
@@ -1277,10 +1395,7 @@ static TCPIP_ARP_RESULT _ARPProbeAddress(TCPIP_NET_IF* pIf, const IPV4_ADDR* IPA
         {
             *pHwAdd = arpHE->hwAdd;
         }
-        if((hE->flags.value & ARP_FLAG_ENTRY_COMPLETE) != 0 )
-        {   // an existent entry, re-used, gets refreshed
-            _ARPRefreshEntry(arpHE, &pArpDcpt->completeList);
-        }
+        _ARPUseEntry(pIf, pArpDcpt, arpHE);
         return ARP_RES_ENTRY_SOLVED;
     }
     
@@ -1290,6 +1405,74 @@ static TCPIP_ARP_RESULT _ARPProbeAddress(TCPIP_NET_IF* pIf, const IPV4_ADDR* IPA
 
 }
 
+// looks up an address in the interface cache
+// the most recently used entries are checked before searching the hash
+// if insert == true, a new entry is created when the address is not found
+static OA_HASH_ENTRY* _ARPCacheLookup(ARP_CACHE_DCPT* pArpDcpt, const uint32_t* pIpAdd, bool insert)
+{
+    OA_HASH_ENTRY   *hE;
+
+#if (_TCPIP_ARP_HIT_CACHE_SIZE != 0)
+    int             ix;
+    ARP_HASH_ENTRY  *arpHE;
+
+    for(ix = 0; ix < _TCPIP_ARP_HIT_CACHE_SIZE; ix++)
+    {
+        arpHE = pArpDcpt->hitCache[ix];
+        if(arpHE != 0 && arpHE->hEntry.flags.busy != 0 && arpHE->ipAddress.Val == *pIpAdd)
+        {   // the hash keys are unique, so this is the entry for this address
+            // even if its slot has been reused in the meantime
+            arpHE->hEntry.flags.newEntry = 0;
+            return &arpHE->hEntry;
+        }
+    }
+#endif  // (_TCPIP_ARP_HIT_CACHE_SIZE != 0)
+
+    if(insert)
+    {
+        hE = TCPIP_OAHASH_EntryLookupOrInsert(pArpDcpt->hashDcpt, pIpAdd);
+    }
+    else
+    {
+        hE = TCPIP_OAHASH_EntryLookup(pArpDcpt->hashDcpt, pIpAdd);
+    }
+
+#if (_TCPIP_ARP_HIT_CACHE_SIZE != 0)
+    if(hE != 0 && hE->flags.newEntry == 0 && (hE->flags.value & ARP_FLAG_ENTRY_VALID_MASK) != 0)
+    {   // remember it for the next look up; replace the oldest one
+        pArpDcpt->hitCache[pArpDcpt->hitIx] = (ARP_HASH_ENTRY*)hE;
+        if(++pArpDcpt->hitIx == _TCPIP_ARP_HIT_CACHE_SIZE)
+        {
+            pArpDcpt->hitIx = 0;
+        }
+    }
+#endif  // (_TCPIP_ARP_HIT_CACHE_SIZE != 0)
+
+    return hE;
+}
+
+// a valid entry is used for transmission
+// a complete entry is refreshed
+// a stale entry keeps being used with its old hardware address
+// while a unicast ARP request revalidates it
+static void _ARPUseEntry(TCPIP_NET_IF* pIf, ARP_CACHE_DCPT* pArpDcpt, ARP_HASH_ENTRY* arpHE)
+{
+    if((arpHE->hEntry.flags.value & ARP_FLAG_ENTRY_STALE) != 0)
+    {
+        if((arpHE->hEntry.flags.value & ARP_FLAG_ENTRY_REFRESH) == 0 && !_TCPIPStackIsConfig(pIf))
+        {   // first use since it went stale; TCPIP_ARP_Task will retry
+            arpHE->hEntry.flags.value |= ARP_FLAG_ENTRY_REFRESH;
+            arpHE->nRetries = 1;
+            _ARPRefreshEntry(arpHE, &pArpDcpt->staleList);
+            _ARPSendIfPkt(pIf, ARP_OPERATION_REQ, (uint32_t)pIf->netIPAddr.Val, arpHE->ipAddress.Val, &arpHE->hwAdd, 0);
+        }
+    }
+    else if((arpHE->hEntry.flags.value & ARP_FLAG_ENTRY_COMPLETE) != 0 )
+    {   // an existent entry, re-used, gets refreshed
+        _ARPRefreshEntry(arpHE, &pArpDcpt->completeList);
+    }
+}
+
 bool TCPIP_ARP_IsResolved(TCPIP_NET_HANDLE hNet, const IPV4_ADDR* IPAddr, TCPIP_MAC_ADDR* MACAddr)
 {
     OA_HASH_ENTRY   *hE;
@@ -1310,7 +1493,7 @@ bool TCPIP_ARP_IsResolved(TCPIP_NET_HANDLE hNet, const IPV4_ADDR* IPAddr, TCPIP_
 
     pArpDcpt = _ARPGetIfDcpt(pIf);
     
-    hE = TCPIP_OAHASH_EntryLookup(pArpDcpt->hashDcpt, &IPAddr->Val);
+    hE = _ARPCacheLookup(pArpDcpt, &IPAddr->Val, false);
     if(hE != 0 && (hE->flags.value & ARP_FLAG_ENTRY_VALID_MASK) != 0 )
     {   // found address in cache
         ARP_HASH_ENTRY  *arpHE = (ARP_HASH_ENTRY*)hE;
@@ -1318,10 +1501,7 @@ bool TCPIP_ARP_IsResolved(TCPIP_NET_HANDLE hNet, const IPV4_ADDR* IPAddr, TCPIP_
         {
             *MACAddr = arpHE->hwAdd;
         }
-        if((hE->flags.value & ARP_FLAG_ENTRY_COMPLETE) != 0 )
-        {   // an existent entry, re-used, gets refreshed
-            _ARPRefreshEntry(arpHE, &pArpDcpt->completeList);
-        }
+        _ARPUseEntry(pIf, pArpDcpt, arpHE);
         return true;
     }
     
@@ -1401,18 +1581,7 @@ TCPIP_ARP_RESULT TCPIP_ARP_EntrySet(TCPIP_NET_HANDLE hNet, const IPV4_ADDR* ipAd
    
     if(hE->flags.newEntry == 0)
     {   // existent entry
-        if( (hE->flags.value & ARP_FLAG_ENTRY_PERM) != 0 )
-        {
-            oldList =  &pArpDcpt->permList;
-        }
-        else if( (hE->flags.value & ARP_FLAG_ENTRY_COMPLETE) != 0 )
-        {
-            oldList =  &pArpDcpt->completeList;
-        }
-        else
-        {
-            oldList =  &pArpDcpt->incompleteList;
-        }
+        oldList = _ARPEntryList(pArpDcpt, hE->flags.value);
 
         if(newList != oldList)
         {   // remove from the old list
@@ -1690,10 +1859,10 @@ size_t TCPIP_ARP_CacheEntriesNoGet(TCPIP_NET_HANDLE hNet, TCPIP_ARP_ENTRY_TYPE t
            return TCPIP_Helper_ProtectedSingleListCount(&pArpDcpt->permList);
 
         case ARP_ENTRY_TYPE_COMPLETE:
-           return TCPIP_Helper_ProtectedSingleListCount(&pArpDcpt->completeList);
+           return TCPIP_Helper_ProtectedSingleListCount(&pArpDcpt->completeList) + TCPIP_Helper_ProtectedSingleListCount(&pArpDcpt->staleList);
 
         case ARP_ENTRY_TYPE_INCOMPLETE:
-           return TCPIP_Helper_ProtectedSingleListCount(&pArpDcpt->incompleteList);
+           return TCPIP_Helper_ProtectedSingleListCount(&pArpDcpt->incompleteList) + TCPIP_Helper_ProtectedSingleListCount(&pArpDcpt->negativeList);
 
         case ARP_ENTRY_TYPE_ANY:
            return pOH->fullSlots;
@@ -1823,7 +1992,11 @@ OA_HASH_ENTRY* TCPIP_ARP_HashEntryDelete(OA_HASH_DCPT* pOH)
     
     pArpDcpt = (ARP_CACHE_DCPT*)pOH->hParam;
 
-    if( (pN = pArpDcpt->incompleteList.list.head) != 0)
+    if(pArpDcpt->negativeList.list.head != 0)
+    {   // negative entries are the first to go
+        pRemList = &pArpDcpt->negativeList;
+    }
+    else if( (pN = pArpDcpt->incompleteList.list.head) != 0)
     {
         pE = (ARP_HASH_ENTRY*) ((uint8_t*)pN - offsetof(struct _TAG_ARP_HASH_ENTRY, next));
         if( (arpMod.timeSeconds - pE->tInsert) >= arpMod.entryPendingTmo)
@@ -1833,8 +2006,8 @@ OA_HASH_ENTRY* TCPIP_ARP_HashEntryDelete(OA_HASH_DCPT* pOH)
     }
 
     if(pRemList == 0)
-    {   // no luck with the incomplete list; use the complete one
-            pRemList = &pArpDcpt->completeList;
+    {   // no luck with the incomplete list; use the stale or the complete one
+        pRemList = pArpDcpt->staleList.list.head != 0 ? &pArpDcpt->staleList : &pArpDcpt->completeList;
     }
 
     pN = TCPIP_Helper_ProtectedSingleListHeadRemove(pRemList);
@@ -64,6 +64,35 @@ Microchip or any third party.
 #define ARP_DEBUG_MASK          0
 
 
+// number of seconds a solved entry that expired is still used
+// while a unicast ARP request is sent to revalidate it
+// 0 disables the stale-while-revalidate behavior:
+// the entry is removed as soon as TCPIP_ARP_CACHE_SOLVED_ENTRY_TMO expires
+#if defined(TCPIP_ARP_STALE_TMO)
+#define _TCPIP_ARP_STALE_TMO            TCPIP_ARP_STALE_TMO
+#else
+#define _TCPIP_ARP_STALE_TMO            30      // default value
+#endif
+
+// number of seconds an address that could not be resolved is remembered
+// so that further lookups fail immediately instead of re-querying
+// 0 disables the negative caching
+#if defined(TCPIP_ARP_NEGATIVE_TMO)
+#define _TCPIP_ARP_NEGATIVE_TMO         TCPIP_ARP_NEGATIVE_TMO
+#else
+#define _TCPIP_ARP_NEGATIVE_TMO         10      // default value
+#endif
+
+// number of the most recently used entries kept per interface
+// in front of the ARP hash
+// 0 disables the hit cache
+#if defined(TCPIP_ARP_HIT_CACHE_SIZE)
+#define _TCPIP_ARP_HIT_CACHE_SIZE       TCPIP_ARP_HIT_CACHE_SIZE
+#else
+#define _TCPIP_ARP_HIT_CACHE_SIZE       4       // default value
+#endif
+
+
 #define HW_ETHERNET             (0x0001u)   // ARP Hardware type as defined by IEEE 802.3
 #define ARP_IP                  (0x0800u)   // ARP IP packet type as defined by IEEE 802.3
 
@@ -108,7 +137,11 @@ typedef enum
                                                    //
     ARP_FLAG_ENTRY_CONFIGURE    = 0x0100,          // configuration query, transmit always
     ARP_FLAG_ENTRY_GRATUITOUS   = 0x0200,          // gratuitous ARP query, use different retry number                                                   
-    ARP_FLAG_ENTRY_VALID_MASK   = (ARP_FLAG_ENTRY_PERM | ARP_FLAG_ENTRY_COMPLETE )
+    ARP_FLAG_ENTRY_STALE        = 0x0400,          // complete entry that expired, still used until revalidated
+    ARP_FLAG_ENTRY_REFRESH      = 0x0800,          // stale entry, unicast revalidation in progress
+    ARP_FLAG_ENTRY_NEGATIVE     = 0x1000,          // entry that could not be resolved, lookups fail
+    ARP_FLAG_ENTRY_VALID_MASK   = (ARP_FLAG_ENTRY_PERM | ARP_FLAG_ENTRY_COMPLETE ),
+    ARP_FLAG_ENTRY_STATE_MASK   = (ARP_FLAG_ENTRY_STALE | ARP_FLAG_ENTRY_REFRESH | ARP_FLAG_ENTRY_NEGATIVE),
                                                      
                                                   
 }ARP_ENTRY_FLAGS;
@@ -128,8 +161,14 @@ typedef struct
     PROTECTED_SINGLE_LIST         permList;       // list of active entries that never expire
     PROTECTED_SINGLE_LIST         completeList;   // list of completed, valid entries
     PROTECTED_SINGLE_LIST         incompleteList; // list of not completed yet entries
+    PROTECTED_SINGLE_LIST         staleList;      // list of completed entries that expired, waiting revalidation
+    PROTECTED_SINGLE_LIST         negativeList;   // list of entries that could not be resolved
     size_t              purgeThres;     // threshold to start cache purging
     size_t              purgeQuanta;    // how many entries to purge
+#if (_TCPIP_ARP_HIT_CACHE_SIZE != 0)
+    ARP_HASH_ENTRY*     hitCache[_TCPIP_ARP_HIT_CACHE_SIZE];    // last valid entries looked up
+    size_t              hitIx;          // next hit cache slot to be replaced
+#endif  // (_TCPIP_ARP_HIT_CACHE_SIZE != 0)
 }ARP_CACHE_DCPT;
 
 // ARP unaligned key
@@ -61,10 +61,13 @@ static const void*          ipv4MemH = 0;                 // memory handle
 
 static tcpipSignalHandle    signalHandle = 0;
 
-static PROTECTED_SINGLE_LIST ipv4ArpQueue = { {0} };    // queue of packets waiting for ARP resolution
+static PROTECTED_SINGLE_LIST ipv4ArpQueue = { {0} };    // queue of destinations with packets waiting for ARP resolution
 static SINGLE_LIST          ipv4ArpPool = {0};          // pool of ARP entries
                                                         // access protected by ipv4ArpQueue!
 static IPV4_ARP_ENTRY*      ipv4ArpEntries = 0;         // allocated nodes for ipv4ArpPool 
+static SINGLE_LIST          ipv4ArpDestPool = {0};      // idle destinations, least recently used first
+                                                        // access protected by ipv4ArpQueue!
+static IPV4_ARP_DEST        ipv4ArpDests[_TCPIP_IPV4_ARP_QUEUE_DESTINATIONS];   // nodes for ipv4ArpDestPool 
 
 static TCPIP_ARP_HANDLE     ipv4ArpHandle = 0;          // ARP registration handle
 
@@ -76,6 +79,11 @@ static volatile uint32_t    ipv4ActFilterCount = 0;    // counter of active filt
 
 static TCPIP_IPV4_FILTER_TYPE ipv4FilterType = 0;       // IPv4 current filter
 
+#if (_TCPIP_IPV4_ACL_ENABLE != 0)
+static IPV4_ACL_TABLE*      ipv4AclTable = 0;           // current compiled ACL
+                                                        // access protected by critical section
+#endif  // (_TCPIP_IPV4_ACL_ENABLE != 0)
+
 #if defined(TCPIP_IPV4_FRAGMENTATION) && (TCPIP_IPV4_FRAGMENTATION != 0)
 #define _TCPIP_IPV4_FRAGMENTATION    1
 #else
@@ -83,7 +91,12 @@ static TCPIP_IPV4_FILTER_TYPE ipv4FilterType = 0;       // IPv4 current filter
 #endif
 
 #if (_TCPIP_IPV4_FRAGMENTATION != 0)
-static SINGLE_LIST          ipv4FragmentQueue = {0};  // IPv4 fragments to be processed
+static SINGLE_LIST          ipv4FragmentHash[_TCPIP_IPV4_FRAGMENT_HASH_BUCKETS];    // IPv4 fragments to be processed
+                                                                                    // hashed by (source, dest, id, protocol)
+static uint16_t             ipv4FragmentStreams = 0;    // current number of reassembly streams
+static IPV4_FRAGMENT_SOURCE ipv4FragmentSources[TCPIP_IPV4_FRAGMENT_MAX_STREAMS];   // source accounting
+
+#define _IPv4FragmentHash(pHdr) (((pHdr)->SourceAddress.Val ^ (pHdr)->DestAddress.Val ^ (pHdr)->Identification ^ (pHdr)->Protocol) % _TCPIP_IPV4_FRAGMENT_HASH_BUCKETS)
 #endif  // (_TCPIP_IPV4_FRAGMENTATION != 0)
 
 typedef enum
@@ -110,6 +123,9 @@ static DOUBLE_LIST              ipv4ForwardQueue;       // list of forward nodes
 #if (TCPIP_IPV4_FORWARDING_DYNAMIC_API != 0)
 OSAL_MUTEX_DECLARE(ipv4ForwardMux);
 #endif  // (TCPIP_IPV4_FORWARDING_DYNAMIC_API != 0)
+#if (_TCPIP_IPV4_NAPT_ENABLE != 0)
+static IPV4_NAPT_DCPT*          ipv4Napt = 0;           // NAPT translation table
+#endif  // (_TCPIP_IPV4_NAPT_ENABLE != 0)
 
 #endif  // (TCPIP_IPV4_FORWARDING_ENABLE != 0)
 
@@ -301,10 +317,16 @@ static TCPIP_IPV4_ARP_QUEUE_STAT _ipv4_arp_stat = {0};
 
 bool TCPIP_IPv4_ArpStatGet(TCPIP_IPV4_ARP_QUEUE_STAT* pStat, bool clear)
 {
+    size_t ix;
+
     if(pStat)
     {
         _ipv4_arp_stat.nPool = TCPIP_Helper_SingleListCount(&ipv4ArpPool); 
-        _ipv4_arp_stat.nPend = TCPIP_Helper_SingleListCount(&ipv4ArpQueue.list); 
+        _ipv4_arp_stat.nPend = 0;
+        for(ix = 0; ix < sizeof(ipv4ArpDests) / sizeof(*ipv4ArpDests); ix++)
+        {
+            _ipv4_arp_stat.nPend += TCPIP_Helper_SingleListCount(&ipv4ArpDests[ix].pktList); 
+        }
 
         *pStat = _ipv4_arp_stat;
     }
@@ -413,14 +435,31 @@ static void _IPv4FiltCountDbg(const char* msg)
 
 static bool TCPIP_IPV4_QueueArpPacket(void* pPkt, int arpIfIx, IPV4_ARP_PKT_TYPE type, IPV4_ADDR* arpTarget);
 
+static TCPIP_MAC_PACKET* _IPv4ArpEntryPacket(IPV4_ARP_ENTRY* pEntry);
+
+static void _IPv4ArpEntryDiscard(IPV4_ARP_ENTRY* pEntry, TCPIP_MAC_PKT_ACK_RES ackRes);
+
+static IPV4_ARP_DEST* _IPv4ArpDestGet(const IPV4_ADDR* arpTarget, int arpIfIx);
+
+static void _IPv4ArpDestFlush(IPV4_ARP_DEST* pDest, const TCPIP_MAC_ADDR* pMacDst);
+
+static void _IPv4ArpBurstTx(IPV4_ARP_DEST* pDest, TCPIP_NET_IF* pPktIf, TCPIP_MAC_PACKET* pBurst);
+
 static void TCPIP_IPV4_ArpHandler(TCPIP_NET_HANDLE hNet, const IPV4_ADDR* ipAdd, const TCPIP_MAC_ADDR* MACAddr, TCPIP_ARP_EVENT_TYPE evType, const void* param);
 
 static IPV4_PKT_PROC_TYPE TCPIP_IPV4_VerifyPktHost(TCPIP_NET_IF* pNetIf, IPV4_HEADER* pHeader, TCPIP_MAC_PACKET* pRxPkt);
 
-static TCPIP_NET_IF* TCPIP_IPV4_CheckPktTx(TCPIP_NET_HANDLE hNet, TCPIP_MAC_PACKET* pPkt);
+static TCPIP_NET_IF* TCPIP_IPV4_CheckPktTx(TCPIP_NET_HANDLE hNet, TCPIP_MAC_PACKET* pPkt, bool burstOk);
 
 static bool TCPIP_IPV4_VerifyPktFilters(TCPIP_MAC_PACKET* pRxPkt, uint8_t hdrlen);
 
+#if (_TCPIP_IPV4_ACL_ENABLE != 0)
+static bool TCPIP_IPV4_AclVerify(TCPIP_MAC_PACKET* pRxPkt, IPV4_HEADER* pCHeader, uint8_t hdrlen);
+static TCPIP_IPV4_RES IPv4_AclRuleRanges(const TCPIP_IPV4_ACL_RULE* pRule, IPV4_ACL_RANGE* pRanges);
+static IPV4_ACL_TABLE* IPv4_AclCompile(const TCPIP_IPV4_ACL_RULE* pRules, size_t nRules, TCPIP_IPV4_ACL_ACTION defAction, TCPIP_IPV4_RES* pRes);
+static IPV4_ACL_TABLE* IPv4_AclCompileIntervals(const IPV4_ACL_RANGE* pRanges, uint32_t* pTmpBounds, size_t nRules, size_t aclSize, uint32_t** pAclData);
+#endif  // (_TCPIP_IPV4_ACL_ENABLE != 0)
+
 static TCPIP_STACK_MODULE TCPIP_IPV4_FrameDestination(IPV4_HEADER* pHeader);
 
 #if (_TCPIP_IPV4_FRAGMENTATION != 0)
@@ -430,6 +469,7 @@ static void TCPIP_IPV4_Timeout(void);
 static TCPIP_MAC_PKT_ACK_RES    TCPIP_IPV4_RxFragmentInsert(TCPIP_MAC_PACKET* pRxPkt, IPV4_FRAGMENT_NODE **ppFrag);
 static void                     TCPIP_IPV4_RxFragmentDiscard(IPV4_FRAGMENT_NODE* pFrag, TCPIP_MAC_PKT_ACK_RES ackRes);
 static void                     TCPIP_IPV4_RxFragmentListPurge(SINGLE_LIST* pL);
+static IPV4_FRAGMENT_SOURCE*    TCPIP_IPV4_RxFragmentSource(const IPV4_ADDR* pSrcAdd);
 
 
 // TX fragmentation
@@ -463,9 +503,13 @@ static __inline__ void __attribute__((always_inline)) TCPIP_IPV4_FragmentTxInser
 
 static TCPIP_IPV4_DEST_TYPE TCPIP_IPV4_PktMacDestination(IPV4_PACKET* pPkt, const IPV4_ADDR* pIpAdd, TCPIP_MAC_ADDR** ppMacAdd, IPV4_ADDR* arpTarget);
 
+static bool TCPIP_IPV4_BurstFormat(TCPIP_MAC_PACKET* pMacPkt, const TCPIP_MAC_ADDR* pMacDst, TCPIP_NET_IF* pNetIf);
+
 static void TCPIP_IPV4_Process(void);
 
-static TCPIP_MAC_PKT_ACK_RES TCPIP_IPV4_DispatchPacket(TCPIP_MAC_PACKET* pRxPkt);
+static TCPIP_MAC_PKT_ACK_RES TCPIP_IPV4_DispatchPacket(TCPIP_MAC_PACKET* pRxPkt, bool rxInline);
+
+static TCPIP_MAC_PKT_ACK_RES TCPIP_IPV4_RxPacketProcess(TCPIP_MAC_PACKET* pRxPkt, bool rxInline);
 
 static IPV4_OPTION_FIELD* _IPv4CheckPacketOption(TCPIP_MAC_PACKET* pRxPkt, int* pOptLen);
 
@@ -479,12 +523,22 @@ static void TCPIP_IPV4_ArpListPurge(TCPIP_NET_IF* pNetIf);
 #if (TCPIP_IPV4_FORWARDING_ENABLE != 0)
 static TCPIP_IPV4_RES IPV4_BuildForwardTables(const TCPIP_IPV4_MODULE_CONFIG* pIpInit, const void* memH, int nIfs);
 static TCPIP_IPV4_DEST_TYPE TCPIP_IPV4_FwdPktMacDestination(TCPIP_MAC_PACKET* pFwdPkt, const IPV4_ROUTE_TABLE_ENTRY* pEntry, TCPIP_MAC_ADDR** ppMacAdd, IPV4_ADDR* arpTarget);
-static bool TCPIP_IPV4_ForwardPkt(TCPIP_MAC_PACKET* pFwdPkt, const IPV4_ROUTE_TABLE_ENTRY* pEntry, IPV4_PKT_PROC_TYPE procType);
+static bool TCPIP_IPV4_ForwardPkt(TCPIP_MAC_PACKET* pFwdPkt, const IPV4_ROUTE_TABLE_ENTRY* pEntry, IPV4_PKT_PROC_TYPE procType, IPV4_FWD_FLOW_ENTRY* pFlow);
 static bool TCPIP_IPV4_ProcessExtPkt(TCPIP_NET_IF* pNetIf, TCPIP_MAC_PACKET* pRxPkt, IPV4_PKT_PROC_TYPE procType);
-static const IPV4_ROUTE_TABLE_ENTRY* TCPIP_IPV4_FindFwdRoute(IPV4_FORWARD_DESCRIPTOR* pFDcpt, TCPIP_MAC_PACKET* pRxPkt);
+static const IPV4_ROUTE_TABLE_ENTRY* TCPIP_IPV4_FindFwdRoute(IPV4_FORWARD_DESCRIPTOR* pFDcpt, TCPIP_MAC_PACKET* pRxPkt, IPV4_FWD_FLOW_ENTRY** ppFlow);
+static void TCPIP_IPV4_FwdFlowSet(IPV4_FWD_FLOW_ENTRY* pFlow, const IPV4_ROUTE_TABLE_ENTRY* pEntry, const TCPIP_MAC_ADDR* pMacDst, const IPV4_ADDR* arpTarget);
+static void TCPIP_IPV4_FwdFlowArpEvent(TCPIP_NET_HANDLE hNet, const IPV4_ADDR* ipAdd, TCPIP_ARP_EVENT_TYPE evType);
+static void TCPIP_IPV4_FwdFlowInvalidate(int netIx, const IPV4_ADDR* ipAdd);
 static uint32_t IPV4_32TrailZeros(uint32_t v);
 static uint32_t IPV4_32LeadingZeros(uint32_t v);
 
+#if (_TCPIP_IPV4_NAPT_ENABLE != 0)
+static TCPIP_IPV4_RES IPv4_NaptInitialize(const void* memH);
+static bool TCPIP_IPV4_NaptOutbound(TCPIP_MAC_PACKET* pFwdPkt, TCPIP_NET_IF* pOutIf);
+static void TCPIP_IPV4_NaptInbound(TCPIP_NET_IF* pNetIf, TCPIP_MAC_PACKET* pRxPkt, IPV4_HEADER* pCHeader, uint8_t headerLen);
+static void TCPIP_IPV4_NaptTimeout(void);
+#endif  // (_TCPIP_IPV4_NAPT_ENABLE != 0)
+
 #if (TCPIP_IPV4_FORWARDING_TABLE_ASCII != 0)
 static TCPIP_IPV4_RES IPv4_BuildAsciiTable(IPV4_FORWARD_DESCRIPTOR* pFDcpt, const TCPIP_IPV4_FORWARD_ENTRY_ASCII* pAEntry, size_t nEntries);
 static TCPIP_IPV4_RES IPv4_AsciiToBinEntry(const TCPIP_IPV4_FORWARD_ENTRY_ASCII* pAEntry, TCPIP_IPV4_FORWARD_ENTRY_BIN* pBEntry, size_t nEntries);
@@ -503,6 +557,8 @@ static TCPIP_IPV4_RES IPv4_BuildBinaryTable(IPV4_FORWARD_DESCRIPTOR* pFDcpt, con
 static TCPIP_IPV4_RES IPv4_AddBinaryTableEntry(IPV4_FORWARD_DESCRIPTOR* pFwdDcpt, const TCPIP_IPV4_FORWARD_ENTRY_BIN* pBEntry);
 
 static void IPv4_SortFwdTable(IPV4_ROUTE_TABLE_ENTRY* pTable, size_t tableEntries);
+static void IPv4_UpdateFwdTable(IPV4_FORWARD_DESCRIPTOR* pFDcpt);
+static void IPv4_FwdTrieInsert(IPV4_FORWARD_DESCRIPTOR* pFDcpt, uint32_t prefix, uint8_t prefixLen, int16_t routeIx);
 static IPV4_FORWARD_NODE* TCPIP_IPV4_Forward_QueuePacket(TCPIP_MAC_PACKET* pFwdPkt, IPV4_PKT_PROC_TYPE procType);
 static bool TCPIP_IPV4_Forward_DequeuePacket(IPV4_FORWARD_NODE* pFwdNode, bool aliveCheck);
 static void TCPIP_IPV4_ForwardAckFunc(TCPIP_MAC_PACKET* pkt,  const void* param);
@@ -546,6 +602,10 @@ bool TCPIP_IPV4_Initialize(const TCPIP_STACK_MODULE_CTRL* const stackInit, const
 
     if(stackInit->stackAction == TCPIP_STACK_ACTION_IF_UP)
     {   // interface restart
+#if (TCPIP_IPV4_FORWARDING_ENABLE != 0)
+        // the ARP cache of the interface was cleared
+        TCPIP_IPV4_FwdFlowInvalidate(_TCPIPStackNetIxGet(stackInit->pNetIf), 0);
+#endif  // (TCPIP_IPV4_FORWARDING_ENABLE != 0)
         return true;
     }
 
@@ -562,14 +622,22 @@ bool TCPIP_IPV4_Initialize(const TCPIP_STACK_MODULE_CTRL* const stackInit, const
             memset(&ipv4ArpQueue, 0, sizeof(ipv4ArpQueue));
             memset(&ipv4ArpPool, 0, sizeof(ipv4ArpPool));
             ipv4ArpEntries = 0;
+            memset(&ipv4ArpDestPool, 0, sizeof(ipv4ArpDestPool));
+            memset(ipv4ArpDests, 0, sizeof(ipv4ArpDests));
             memset(&ipv4PacketFilters, 0, sizeof(ipv4PacketFilters));
             ipv4ActFilterCount = 0;
+#if (_TCPIP_IPV4_ACL_ENABLE != 0)
+            ipv4AclTable = 0;
+#endif  // (_TCPIP_IPV4_ACL_ENABLE != 0)
 #if (TCPIP_IPV4_FORWARDING_ENABLE != 0)
             ipv4ForwardDcpt = 0;
             ipv4ForwardIfs = 0;
             ipv4ForwardNodes = 0;
             TCPIP_Helper_DoubleListInitialize(&ipv4ForwardPool); 
             TCPIP_Helper_DoubleListInitialize(&ipv4ForwardQueue); 
+#if (_TCPIP_IPV4_NAPT_ENABLE != 0)
+            ipv4Napt = 0;
+#endif  // (_TCPIP_IPV4_NAPT_ENABLE != 0)
 #endif  // (TCPIP_IPV4_FORWARDING_ENABLE != 0)
 
             // check initialization data is provided and minimal sanity check
@@ -579,11 +647,18 @@ bool TCPIP_IPV4_Initialize(const TCPIP_STACK_MODULE_CTRL* const stackInit, const
                 break;
             }
 #if (_TCPIP_IPV4_FRAGMENTATION != 0)
-            TCPIP_Helper_SingleListInitialize(&ipv4FragmentQueue);
+            for(ix = 0; ix < sizeof(ipv4FragmentHash) / sizeof(*ipv4FragmentHash); ix++)
+            {
+                TCPIP_Helper_SingleListInitialize(ipv4FragmentHash + ix);
+            }
+            ipv4FragmentStreams = 0;
+            memset(ipv4FragmentSources, 0, sizeof(ipv4FragmentSources));
+#endif  // (_TCPIP_IPV4_FRAGMENTATION != 0)
+#if (_TCPIP_IPV4_FRAGMENTATION != 0) || (_TCPIP_IPV4_NAPT_ENABLE != 0)
             signalHandle =_TCPIPStackSignalHandlerRegister(TCPIP_THIS_MODULE_ID, TCPIP_IPV4_Task, TCPIP_IPV4_TASK_TICK_RATE);
 #else
             signalHandle =_TCPIPStackSignalHandlerRegister(TCPIP_THIS_MODULE_ID, TCPIP_IPV4_Task, 0);
-#endif  // (_TCPIP_IPV4_FRAGMENTATION != 0)
+#endif  // (_TCPIP_IPV4_FRAGMENTATION != 0) || (_TCPIP_IPV4_NAPT_ENABLE != 0)
             if(signalHandle == 0)
             {
                 iniRes = TCPIP_IPV4_RES_SIGNAL_ERR;
@@ -615,6 +690,12 @@ bool TCPIP_IPV4_Initialize(const TCPIP_STACK_MODULE_CTRL* const stackInit, const
             {
                 TCPIP_Helper_SingleListTailAdd(&ipv4ArpPool, (SGL_LIST_NODE*)pEntry); 
             }
+            // and the destinations pool
+            TCPIP_Helper_SingleListInitialize(&ipv4ArpDestPool);
+            for(ix = 0; ix < sizeof(ipv4ArpDests) / sizeof(*ipv4ArpDests); ix++)
+            {
+                TCPIP_Helper_SingleListTailAdd(&ipv4ArpDestPool, (SGL_LIST_NODE*)(ipv4ArpDests + ix)); 
+            }
 
 
 #if (TCPIP_IPV4_EXTERN_PACKET_PROCESS != 0)
@@ -643,6 +724,13 @@ bool TCPIP_IPV4_Initialize(const TCPIP_STACK_MODULE_CTRL* const stackInit, const
                     break;
                 }
 #endif  // (TCPIP_IPV4_FORWARDING_DYNAMIC_API != 0)
+
+#if (_TCPIP_IPV4_NAPT_ENABLE != 0)
+                if((iniRes = IPv4_NaptInitialize(ipv4MemH)) < 0)
+                {   // failed
+                    break;
+                }
+#endif  // (_TCPIP_IPV4_NAPT_ENABLE != 0)
             }
 #endif  // (TCPIP_IPV4_FORWARDING_ENABLE != 0)
 
@@ -694,10 +782,18 @@ void TCPIP_IPV4_Deinitialize(const TCPIP_STACK_MODULE_CTRL* const stackCtrl)
     {   // up and running
         // one way or another this interface is going down
 #if (_TCPIP_IPV4_FRAGMENTATION != 0)
-        TCPIP_IPV4_RxFragmentListPurge(&ipv4FragmentQueue);
+        int ix;
+        for(ix = 0; ix < sizeof(ipv4FragmentHash) / sizeof(*ipv4FragmentHash); ix++)
+        {
+            TCPIP_IPV4_RxFragmentListPurge(ipv4FragmentHash + ix);
+        }
 #endif  // (_TCPIP_IPV4_FRAGMENTATION != 0)
 
         TCPIP_IPV4_ArpListPurge(stackCtrl->pNetIf);
+#if (TCPIP_IPV4_FORWARDING_ENABLE != 0)
+        // the ARP cache of the interface is cleared without notifications
+        TCPIP_IPV4_FwdFlowInvalidate(_TCPIPStackNetIxGet(stackCtrl->pNetIf), 0);
+#endif  // (TCPIP_IPV4_FORWARDING_ENABLE != 0)
 
         if(stackCtrl->stackAction == TCPIP_STACK_ACTION_DEINIT)
         {   // stack shut down
@@ -721,6 +817,14 @@ static void TCPIP_IPV4_Cleanup(void)
     TCPIP_Notification_Deinitialize(&ipv4PacketFilters, ipv4MemH);
     ipv4ActFilterCount = 0;
 
+#if (_TCPIP_IPV4_ACL_ENABLE != 0)
+    if(ipv4AclTable != 0)
+    {
+        TCPIP_HEAP_Free(ipv4MemH, ipv4AclTable);
+        ipv4AclTable = 0;
+    }
+#endif  // (_TCPIP_IPV4_ACL_ENABLE != 0)
+
     TCPIP_Helper_ProtectedSingleListDeinitialize(&ipv4ArpQueue);
 
     if(signalHandle)
@@ -748,6 +852,13 @@ static void TCPIP_IPV4_Cleanup(void)
         ipv4ForwardNodes = 0;
     }
     ipv4ForwardIfs = 0;
+#if (_TCPIP_IPV4_NAPT_ENABLE != 0)
+    if(ipv4Napt != 0)
+    {
+        TCPIP_HEAP_Free(ipv4MemH, ipv4Napt);
+        ipv4Napt = 0;
+    }
+#endif  // (_TCPIP_IPV4_NAPT_ENABLE != 0)
 #if (TCPIP_IPV4_FORWARDING_DYNAMIC_API != 0)
     OSAL_MUTEX_Delete(&ipv4ForwardMux);
 #endif  // (TCPIP_IPV4_FORWARDING_DYNAMIC_API != 0)
@@ -762,8 +873,8 @@ static void TCPIP_IPV4_Cleanup(void)
 static void TCPIP_IPV4_ArpListPurge(TCPIP_NET_IF* pNetIf)
 {
     SINGLE_LIST         newList;
+    IPV4_ARP_DEST*      pDest;
     IPV4_ARP_ENTRY*     pEntry;
-    TCPIP_MAC_PACKET*   pMacPkt;
     TCPIP_NET_IF*       pPktIf;
     
 
@@ -772,50 +883,25 @@ static void TCPIP_IPV4_ArpListPurge(TCPIP_NET_IF* pNetIf)
     PROTECTED_SINGLE_LIST* pList = &ipv4ArpQueue;
     TCPIP_Helper_ProtectedSingleListLock(pList);
     // traverse the list
-    // and find all the packets matching the pNetIf
+    // and find all the destinations matching the pNetIf
 
-    while((pEntry = (IPV4_ARP_ENTRY*)TCPIP_Helper_SingleListHeadRemove(&pList->list)) != 0)
+    while((pDest = (IPV4_ARP_DEST*)TCPIP_Helper_SingleListHeadRemove(&pList->list)) != 0)
     {
-        if(pEntry->type == IPV4_ARP_PKT_TYPE_TX)
-        {   // IPV4_PACKET*
-            pMacPkt = &pEntry->pTxPkt->macPkt;
-        }
-        else if(pEntry->type == IPV4_ARP_PKT_TYPE_MAC)
-        {   // TCPIP_MAC_PACKET*
-            pMacPkt = pEntry->pMacPkt; 
-        }
-#if (TCPIP_IPV4_FORWARDING_ENABLE != 0)
-        else if(pEntry->type == IPV4_ARP_PKT_TYPE_FWD)
-        {   // TCPIP_MAC_PACKET*
-            pMacPkt = pEntry->pFwdPkt; 
-        }
-#endif  // (TCPIP_IPV4_FORWARDING_ENABLE != 0)
-        else
-        {   // should not happen!
-            _IPv4AssertCond(false, __func__, __LINE__);
-            return;
-        }
-
-        pPktIf = (TCPIP_NET_IF*)TCPIP_STACK_IndexToNet(pEntry->arpIfIx);
+        pPktIf = (TCPIP_NET_IF*)TCPIP_STACK_IndexToNet(pDest->arpIfIx);
 
         if(pNetIf == 0 || pNetIf == pPktIf)
-        {   // match
-            if(pEntry->type == IPV4_ARP_PKT_TYPE_TX || pEntry->type == IPV4_ARP_PKT_TYPE_MAC)
-            {   // IPV4_PACKET TX packet 
-                TCPIP_IPV4_FragmentTxAcknowledge(pMacPkt, TCPIP_MAC_PKT_ACK_ARP_NET_ERR, IPV4_FRAG_TX_ACK_HEAD | IPV4_FRAG_TX_ACK_FRAGS);
-            }
-#if (TCPIP_IPV4_FORWARDING_ENABLE != 0)
-            else if(pEntry->type == IPV4_ARP_PKT_TYPE_FWD)
-            {   // FWD Packet
-                TCPIP_PKT_PacketAcknowledge(pMacPkt, TCPIP_MAC_PKT_ACK_ARP_NET_ERR);
+        {   // match; discard all the destination packets
+            while((pEntry = (IPV4_ARP_ENTRY*)TCPIP_Helper_SingleListHeadRemove(&pDest->pktList)) != 0)
+            {
+                _IPv4ArpEntryDiscard(pEntry, TCPIP_MAC_PKT_ACK_ARP_NET_ERR);
+                pDest->nDropped++;
             }
-#endif  // (TCPIP_IPV4_FORWARDING_ENABLE != 0)
             // back to pool
-            TCPIP_Helper_SingleListTailAdd(&ipv4ArpPool, (SGL_LIST_NODE*)pEntry); 
+            TCPIP_Helper_SingleListTailAdd(&ipv4ArpDestPool, (SGL_LIST_NODE*)pDest); 
         }
         else
         {
-            TCPIP_Helper_SingleListTailAdd(&newList, (SGL_LIST_NODE*)pEntry);
+            TCPIP_Helper_SingleListTailAdd(&newList, (SGL_LIST_NODE*)pDest);
         }
     }
 
@@ -852,10 +938,11 @@ static bool TCPIP_IPV4_ProcessExtPkt(TCPIP_NET_IF* pNetIf, TCPIP_MAC_PACKET* pRx
         _IPv4ProcessExtPktDbg(pRxPkt);
 
         // find route
-        const IPV4_ROUTE_TABLE_ENTRY* pEntry = TCPIP_IPV4_FindFwdRoute(pFDcpt, pRxPkt);
+        IPV4_FWD_FLOW_ENTRY* pFlow;
+        const IPV4_ROUTE_TABLE_ENTRY* pEntry = TCPIP_IPV4_FindFwdRoute(pFDcpt, pRxPkt, &pFlow);
         if(pEntry)
         {   // found it
-            return TCPIP_IPV4_ForwardPkt(pRxPkt, pEntry, procType);
+            return TCPIP_IPV4_ForwardPkt(pRxPkt, pEntry, procType, pFlow);
         }
 
         // no route
@@ -869,28 +956,125 @@ static bool TCPIP_IPV4_ProcessExtPkt(TCPIP_NET_IF* pNetIf, TCPIP_MAC_PACKET* pRx
     return false;
 }
 
+// mask for the leading prefixLen bits of a host order address
+#define _IPv4FwdPrefixMask(prefixLen)   ((prefixLen) == 0 ? 0 : 0xffffffff << (32 - (prefixLen)))
+
+// bit following the leading prefixLen bits of a host order address
+#define _IPv4FwdPrefixBit(add, prefixLen) (((add) >> (31 - (prefixLen))) & 1)
+
+#define _IPv4FwdFlowCacheIx(add)  (((add) ^ ((add) >> 8) ^ ((add) >> 16) ^ ((add) >> 24)) % _TCPIP_IPV4_FWD_FLOW_CACHE_SIZE)
+
 // Finds the entry in the routing table that routes this packet
-// Select the entry from the table, based on the number of leading ones
-// For now, simple linear search...
-static const IPV4_ROUTE_TABLE_ENTRY* TCPIP_IPV4_FindFwdRoute(IPV4_FORWARD_DESCRIPTOR* pFDcpt, TCPIP_MAC_PACKET* pRxPkt)
+// The destination flow cache is checked first.
+// Otherwise the longest prefix match trie is walked, keeping the last matching route:
+// the route with the largest number of leading ones and, for equal prefixes, the best metric
+// ppFlow is updated with the flow cache entry for this destination
+static const IPV4_ROUTE_TABLE_ENTRY* TCPIP_IPV4_FindFwdRoute(IPV4_FORWARD_DESCRIPTOR* pFDcpt, TCPIP_MAC_PACKET* pRxPkt, IPV4_FWD_FLOW_ENTRY** ppFlow)
 {
-    int ix;
-    const IPV4_ROUTE_TABLE_ENTRY* pEntry = pFDcpt->fwdTable;
+    int16_t nodeIx, routeIx;
+    uint32_t hostAdd;
+    const IPV4_FWD_TRIE_NODE* pNode;
     // packet destination
     const IPV4_ADDR* dstAdd = TCPIP_IPV4_PacketGetDestAddress(pRxPkt);
 
-    for(ix = 0; ix < pFDcpt->usedEntries; ix++, pEntry++)
+    IPV4_FWD_FLOW_ENTRY* pFlow = pFDcpt->flowCache + _IPv4FwdFlowCacheIx(dstAdd->Val);
+    *ppFlow = pFlow;
+    if(pFlow->routeIx >= 0 && pFlow->destAddress == dstAdd->Val)
+    {   // cache hit
+        return pFDcpt->fwdTable + pFlow->routeIx;
+    }
+
+    hostAdd = TCPIP_Helper_ntohl(dstAdd->Val);
+    routeIx = -1;
+    for(nodeIx = 0; nodeIx >= 0; )
     {
-        if((dstAdd->Val & pEntry->netMask) == pEntry->netAddress)
-        {   // found it
-            return pEntry;
+        pNode = pFDcpt->fwdTrie + nodeIx;
+        if((hostAdd & _IPv4FwdPrefixMask(pNode->prefixLen)) != pNode->prefix)
+        {   // diverged
+            break;
+        }
+
+        if(pNode->routeIx >= 0)
+        {   // longer match
+            routeIx = pNode->routeIx;
+        }
+
+        if(pNode->prefixLen == 32)
+        {   // host route; nothing longer
+            break;
         }
+        nodeIx = pNode->child[_IPv4FwdPrefixBit(hostAdd, pNode->prefixLen)];
     }
 
-    // no route
-    return 0;
+    if(routeIx < 0)
+    {   // no route
+        *ppFlow = 0;
+        return 0;
+    }
+
+    // replace the flow; the MAC address is not known yet
+    pFlow->destAddress = dstAdd->Val;
+    pFlow->routeIx = routeIx;
+    pFlow->macValid = 0;
+    return pFDcpt->fwdTable + routeIx;
 } 
 
+// stores the resolved next hop MAC address in a flow cache entry
+static void TCPIP_IPV4_FwdFlowSet(IPV4_FWD_FLOW_ENTRY* pFlow, const IPV4_ROUTE_TABLE_ENTRY* pEntry, const TCPIP_MAC_ADDR* pMacDst, const IPV4_ADDR* arpTarget)
+{
+    if(ipv4ArpHandle == 0)
+    {   // the ARP notifications are needed to invalidate the entry
+        if((ipv4ArpHandle = TCPIP_ARP_HandlerRegister(0, TCPIP_IPV4_ArpHandler, 0)) == 0)
+        {
+            return;
+        }
+    }
+
+    pFlow->nextHop = arpTarget->Val;
+    pFlow->outIfIx = pEntry->outIfIx;
+    memcpy(&pFlow->destMacAdd, pMacDst, sizeof(pFlow->destMacAdd));
+    pFlow->macValid = 1;
+}
+
+// ARP event for a next hop
+// invalidates the MAC address of the flows that use it
+static void TCPIP_IPV4_FwdFlowArpEvent(TCPIP_NET_HANDLE hNet, const IPV4_ADDR* ipAdd, TCPIP_ARP_EVENT_TYPE evType)
+{
+    if(evType == ARP_EVENT_SOLVED)
+    {   // a new entry; no change for the existing flows
+        return;
+    }
+
+    TCPIP_IPV4_FwdFlowInvalidate(TCPIP_STACK_NetIxGet(_TCPIPStackHandleToNet(hNet)), ipAdd);
+}
+
+// invalidates the MAC address of the flows going out on the netIx interface
+// through the ipAdd next hop or through any next hop if ipAdd == 0
+static void TCPIP_IPV4_FwdFlowInvalidate(int netIx, const IPV4_ADDR* ipAdd)
+{
+    int ix, jx;
+    IPV4_FORWARD_DESCRIPTOR* pFDcpt;
+    IPV4_FWD_FLOW_ENTRY* pFlow;
+
+    if(ipv4ForwardDcpt == 0)
+    {   // nothing cached
+        return;
+    }
+
+    pFDcpt = ipv4ForwardDcpt;
+    for(ix = 0; ix < ipv4ForwardIfs; ix++, pFDcpt++)
+    {
+        pFlow = pFDcpt->flowCache;
+        for(jx = 0; jx < sizeof(pFDcpt->flowCache) / sizeof(*pFDcpt->flowCache); jx++, pFlow++)
+        {
+            if(pFlow->macValid != 0 && pFlow->outIfIx == netIx && (ipAdd == 0 || pFlow->nextHop == ipAdd->Val))
+            {   // the route is still good
+                pFlow->macValid = 0;
+            }
+        }
+    }
+}
+
 // select destination MAC address
 // for an externally forwarded packet
 // ppMacAdd is set to 0 if the MAC address is not available yet (ARP)
@@ -983,7 +1167,7 @@ static TCPIP_IPV4_DEST_TYPE TCPIP_IPV4_FwdPktMacDestination(TCPIP_MAC_PACKET* pF
 // forwards a packet over a network
 // returns true if success
 // false otherwise
-static bool TCPIP_IPV4_ForwardPkt(TCPIP_MAC_PACKET* pFwdPkt, const IPV4_ROUTE_TABLE_ENTRY* pEntry, IPV4_PKT_PROC_TYPE procType)
+static bool TCPIP_IPV4_ForwardPkt(TCPIP_MAC_PACKET* pFwdPkt, const IPV4_ROUTE_TABLE_ENTRY* pEntry, IPV4_PKT_PROC_TYPE procType, IPV4_FWD_FLOW_ENTRY* pFlow)
 {
     TCPIP_MAC_ADDR   destMacAdd, *pMacDst;
     TCPIP_IPV4_DEST_TYPE destType;
@@ -1001,7 +1185,14 @@ static bool TCPIP_IPV4_ForwardPkt(TCPIP_MAC_PACKET* pFwdPkt, const IPV4_ROUTE_TA
     
     // the forward interface
     // do NOT set the packet interface, as this could be redirected internally too...
-    pFwdIf = (TCPIP_NET_IF*)TCPIP_STACK_IndexToNet(pEntry->outIfIx);
+    if(pFlow != 0 && pFlow->macValid != 0)
+    {
+        pFwdIf = (TCPIP_NET_IF*)TCPIP_STACK_IndexToNet(pFlow->outIfIx);
+    }
+    else
+    {
+        pFwdIf = (TCPIP_NET_IF*)TCPIP_STACK_IndexToNet(pEntry->outIfIx);
+    }
 
     // check for proper packet source address:
     const IPV4_ADDR* pSrcAdd = TCPIP_IPV4_PacketGetSourceAddress(pFwdPkt);
@@ -1011,15 +1202,33 @@ static bool TCPIP_IPV4_ForwardPkt(TCPIP_MAC_PACKET* pFwdPkt, const IPV4_ROUTE_TA
     }
 
     // select packet's destination MAC address
-    pMacDst = &destMacAdd;
-    // select packet's external destination MAC address
-    destType = TCPIP_IPV4_FwdPktMacDestination(pFwdPkt, pEntry, &pMacDst, &arpTarget);
-    if(destType == TCPIP_IPV4_DEST_FAIL) 
-    {   // discard, cannot send
+    if(pFlow != 0 && pFlow->macValid != 0)
+    {   // already resolved for this flow
+        pMacDst = &pFlow->destMacAdd;
+        destType = TCPIP_IPV4_DEST_NETWORK;
 #if (_TCPIP_IPV4_FORWARDING_STATS != 0)
-        pFwdDbg->failMacDest++;
+        pFwdDbg->flowPackets++;
 #endif  // (_TCPIP_IPV4_FORWARDING_STATS != 0)
-        return false;
+    }
+    else
+    {
+        pMacDst = &destMacAdd;
+        arpTarget.Val = 0;
+        // select packet's external destination MAC address
+        destType = TCPIP_IPV4_FwdPktMacDestination(pFwdPkt, pEntry, &pMacDst, &arpTarget);
+        if(destType == TCPIP_IPV4_DEST_FAIL) 
+        {   // discard, cannot send
+#if (_TCPIP_IPV4_FORWARDING_STATS != 0)
+            pFwdDbg->failMacDest++;
+#endif  // (_TCPIP_IPV4_FORWARDING_STATS != 0)
+            return false;
+        }
+
+        if(pFlow != 0 && pMacDst != 0 && arpTarget.Val != 0)
+        {   // ARP resolved destination; cache it
+            // broadcast, multicast and serial links are cheap to evaluate and are not cached
+            TCPIP_IPV4_FwdFlowSet(pFlow, pEntry, pMacDst, &arpTarget);
+        }
     }
 
     if(!TCPIP_STACK_NetworkIsUp(pFwdIf))
@@ -1044,6 +1253,16 @@ static bool TCPIP_IPV4_ForwardPkt(TCPIP_MAC_PACKET* pFwdPkt, const IPV4_ROUTE_TA
         }
     }
 
+#if (_TCPIP_IPV4_NAPT_ENABLE != 0)
+    if((procType & IPV4_PKT_DEST_HOST) == 0)
+    {   // only unicast is translated
+        if(!TCPIP_IPV4_NaptOutbound(pFwdPkt, pFwdIf))
+        {
+            return false;
+        }
+    }
+#endif  // (_TCPIP_IPV4_NAPT_ENABLE != 0)
+
     if((procType & IPV4_PKT_DEST_HOST) != 0)
     {   // after forwarding need to be processed locally  
         // save packet MAC address before changing anything
@@ -1244,10 +1463,11 @@ static TCPIP_IPV4_RES IPV4_BuildForwardTables(const TCPIP_IPV4_MODULE_CONFIG* pI
     size_t  usedEntries;
     IPV4_FORWARD_DESCRIPTOR* pFDcpt;
     IPV4_ROUTE_TABLE_ENTRY* pTblEntry;
+    IPV4_FWD_TRIE_NODE*     pTrieNode;
     IPV4_FORWARD_NODE*      pFwdNode;
 
     // allocate the descriptors
-    ipv4ForwardDcpt = (IPV4_FORWARD_DESCRIPTOR*)TCPIP_HEAP_Calloc(memH, nIfs, sizeof(*pFDcpt) + pIpInit->forwardTableMaxEntries * sizeof(*pTblEntry));
+    ipv4ForwardDcpt = (IPV4_FORWARD_DESCRIPTOR*)TCPIP_HEAP_Calloc(memH, nIfs, sizeof(*pFDcpt) + pIpInit->forwardTableMaxEntries * sizeof(*pTblEntry) + (2 * pIpInit->forwardTableMaxEntries + 1) * sizeof(*pTrieNode));
     if(ipv4ForwardDcpt == 0)
     {   // out of memory
         return TCPIP_IPV4_RES_MEM_ERR;
@@ -1267,11 +1487,14 @@ static TCPIP_IPV4_RES IPV4_BuildForwardTables(const TCPIP_IPV4_MODULE_CONFIG* pI
     pFDcpt = ipv4ForwardDcpt;
     // keep the forwarding tables at the end of allocated descriptor
     pTblEntry = (IPV4_ROUTE_TABLE_ENTRY*)(ipv4ForwardDcpt + nIfs);
+    // and the tries after the tables
+    pTrieNode = (IPV4_FWD_TRIE_NODE*)(pTblEntry + nIfs * pIpInit->forwardTableMaxEntries);
     for(netIx = 0; netIx < nIfs; netIx++, pFDcpt++)
     {
         pFDcpt->totEntries = pIpInit->forwardTableMaxEntries;
         pFDcpt->iniFlags = pIpInit->forwardFlags;
         pFDcpt->fwdTable = pTblEntry; 
+        pFDcpt->fwdTrie = pTrieNode; 
         if((pFDcpt->iniFlags & TCPIP_IPV4_FWD_FLAG_ENABLED) != 0)
         {
             pFDcpt->runFlags = IPV4_FWD_FLAG_FWD_ENABLE; 
@@ -1292,6 +1515,8 @@ static TCPIP_IPV4_RES IPV4_BuildForwardTables(const TCPIP_IPV4_MODULE_CONFIG* pI
         }
 
         pTblEntry = pTblEntry + pIpInit->forwardTableMaxEntries;  
+        pTrieNode = pTrieNode + 2 * pIpInit->forwardTableMaxEntries + 1;  
+        IPv4_UpdateFwdTable(pFDcpt);    // empty trie
     }
 
 
@@ -1332,13 +1557,13 @@ static TCPIP_IPV4_RES IPV4_BuildForwardTables(const TCPIP_IPV4_MODULE_CONFIG* pI
             break;
         }
 
-        // sort the tables for proper operation
+        // sort the tables and build the tries for proper operation
         pFDcpt = ipv4ForwardDcpt;
         for(netIx = 0; netIx < nIfs; netIx++, pFDcpt++)
         {
             if(pFDcpt->usedEntries)
             {
-                IPv4_SortFwdTable(pFDcpt->fwdTable, pFDcpt->totEntries);
+                IPv4_UpdateFwdTable(pFDcpt);
             }
         }
 
@@ -1672,8 +1897,8 @@ static TCPIP_IPV4_RES IPv4_DynFwdTblOper(const TCPIP_IPV4_FORWARD_ENTRY_BIN* pAr
         if(pCurrDcpt != 0)
         {
             if(setDcpt != 0)
-            {   // there's been changes: sort the table
-                IPv4_SortFwdTable(pCurrDcpt->fwdTable, pFDcpt->totEntries);
+            {   // there's been changes: sort the table and rebuild the trie
+                IPv4_UpdateFwdTable(pCurrDcpt);
             }
             pCurrDcpt->runFlags |= IPV4_FWD_FLAG_DYN_PROC;
         }
@@ -1772,6 +1997,7 @@ TCPIP_IPV4_RES TCPIP_IPV4_FwdTableRemoveAll(TCPIP_NET_HANDLE netH)
         pRtEntry->nOnes = -1;   // mark entry as invalid
     }
     pFDcpt->usedEntries = 0;
+    IPv4_UpdateFwdTable(pFDcpt);
 
     
     status = OSAL_CRIT_Enter(OSAL_CRIT_TYPE_LOW);
@@ -1823,6 +2049,127 @@ static void IPv4_SortFwdTable(IPV4_ROUTE_TABLE_ENTRY* pTable, size_t tableEntrie
     qsort(pTable, tableEntries, sizeof(*pTable), _RouteEntryCompare);
 }
 
+// updates the forwarding structures after a table change:
+// sorts the table, rebuilds the trie and flushes the flow cache
+// Note: forwarding should be disabled on the interface while updating!
+static void IPv4_UpdateFwdTable(IPV4_FORWARD_DESCRIPTOR* pFDcpt)
+{
+    int ix;
+    IPV4_ROUTE_TABLE_ENTRY* pEntry;
+    IPV4_FWD_TRIE_NODE* pRoot;
+    uint32_t netAdd, netMask;
+
+    if(pFDcpt->usedEntries != 0)
+    {
+        IPv4_SortFwdTable(pFDcpt->fwdTable, pFDcpt->totEntries);
+    }
+
+    // start with an empty root
+    pRoot = pFDcpt->fwdTrie;
+    memset(pRoot, 0, sizeof(*pRoot));
+    pRoot->routeIx = pRoot->child[0] = pRoot->child[1] = -1;
+    pFDcpt->trieNodes = 1;
+
+    // insert the routes in the table order:
+    // for the same prefix the 1st, best metric, route is kept
+    pEntry = pFDcpt->fwdTable;
+    for(ix = 0; ix < pFDcpt->usedEntries; ix++, pEntry++)
+    {
+        netAdd = TCPIP_Helper_ntohl(pEntry->netAddress);
+        netMask = TCPIP_Helper_ntohl(pEntry->netMask);
+        if((netAdd & netMask) != netAdd || pEntry->nOnes < 0)
+        {   // entry can never match
+            continue;
+        }
+        IPv4_FwdTrieInsert(pFDcpt, netAdd, (uint8_t)pEntry->nOnes, (int16_t)ix);
+    }
+
+    for(ix = 0; ix < sizeof(pFDcpt->flowCache) / sizeof(*pFDcpt->flowCache); ix++)
+    {
+        pFDcpt->flowCache[ix].routeIx = -1;
+        pFDcpt->flowCache[ix].macValid = 0;
+    }
+}
+
+// allocates a new trie node
+static int16_t IPv4_FwdTrieNewNode(IPV4_FORWARD_DESCRIPTOR* pFDcpt, uint32_t prefix, uint8_t prefixLen, int16_t routeIx)
+{
+    _IPv4AssertCond(pFDcpt->trieNodes < 2 * pFDcpt->totEntries + 1, __func__, __LINE__);
+    int16_t nodeIx = (int16_t)pFDcpt->trieNodes++;
+    IPV4_FWD_TRIE_NODE* pNode = pFDcpt->fwdTrie + nodeIx;
+
+    pNode->prefix = prefix;
+    pNode->prefixLen = prefixLen;
+    pNode->routeIx = routeIx;
+    pNode->child[0] = pNode->child[1] = -1;
+
+    return nodeIx;
+}
+
+// inserts a route prefix into the trie
+// host order prefix, already masked
+static void IPv4_FwdTrieInsert(IPV4_FORWARD_DESCRIPTOR* pFDcpt, uint32_t prefix, uint8_t prefixLen, int16_t routeIx)
+{
+    int16_t childIx, newIx;
+    uint8_t commonLen, maxLen;
+    IPV4_FWD_TRIE_NODE *pNode, *pChild, *pNew;
+    uint32_t prefixBit;
+
+    pNode = pFDcpt->fwdTrie;
+    while(true)
+    {   // pNode prefix is a prefix of the new one
+        if(pNode->prefixLen == prefixLen)
+        {   // same prefix
+            if(pNode->routeIx < 0)
+            {   // only a branch node so far
+                pNode->routeIx = routeIx;
+            }
+            // else keep the existing, better, route
+            return;
+        }
+
+        prefixBit = _IPv4FwdPrefixBit(prefix, pNode->prefixLen);
+        childIx = pNode->child[prefixBit];
+        if(childIx < 0)
+        {   // free spot
+            newIx = IPv4_FwdTrieNewNode(pFDcpt, prefix, prefixLen, routeIx);
+            pNode->child[prefixBit] = newIx;
+            return;
+        }
+
+        pChild = pFDcpt->fwdTrie + childIx;
+        // find the common part of the prefixes
+        maxLen = pChild->prefixLen < prefixLen ? pChild->prefixLen : prefixLen;
+        commonLen = pNode->prefixLen + 1;
+        while(commonLen < maxLen && _IPv4FwdPrefixBit(prefix ^ pChild->prefix, commonLen) == 0)
+        {
+            commonLen++;
+        }
+
+        if(commonLen == pChild->prefixLen)
+        {   // the child prefix covers the new one; go down
+            pNode = pChild;
+            continue;
+        }
+
+        if(commonLen == prefixLen)
+        {   // the new prefix covers the child: insert between
+            newIx = IPv4_FwdTrieNewNode(pFDcpt, prefix, prefixLen, routeIx);
+            pNew = pFDcpt->fwdTrie + newIx;
+            pNew->child[_IPv4FwdPrefixBit(pChild->prefix, prefixLen)] = childIx;
+        }
+        else
+        {   // prefixes diverge: add a branch node
+            newIx = IPv4_FwdTrieNewNode(pFDcpt, prefix & _IPv4FwdPrefixMask(commonLen), commonLen, -1);
+            pNew = pFDcpt->fwdTrie + newIx;
+            pNew->child[_IPv4FwdPrefixBit(pChild->prefix, commonLen)] = childIx;
+            pNew->child[_IPv4FwdPrefixBit(prefix, commonLen)] = IPv4_FwdTrieNewNode(pFDcpt, prefix, prefixLen, routeIx);
+        }
+        pNode->child[prefixBit] = newIx;
+        return;
+    }
+}
+
 size_t TCPIP_IPV4_ForwadTableSizeGet(TCPIP_NET_HANDLE netH, size_t* pValid)
 {
     if(ipv4ForwardDcpt != 0)
@@ -1953,105 +2300,529 @@ static void TCPIP_IPV4_ForwardAckFunc(TCPIP_MAC_PACKET* pkt,  const void* param)
         TCPIP_PKT_PacketAcknowledge(pkt, TCPIP_MAC_PKT_ACK_IP_REJECT_ERR);
     }
 }
-#endif  // (TCPIP_IPV4_FORWARDING_ENABLE != 0)
 
-// selects a source address and an interface based on the IPv4 destination address
-// updates the pSrcAddress and returns the needed interface, if successful
-// returns 0 if failed
-// if srcSet == 1 and netH != 0 the function won't change anything 
-// if srcSet == 1 and netH == 0 then the call will never fail 
-//      it will use whatever value in pSrcAddress (even 0)
-//      and will try to come up with an appropriate interface.
-// if srcSet == 0 and netH == 0 it will use the destination address
-// if srcSet == 0 and netH != 0 it will use the address of that interface
-// returns a valid interface if it succeeds, 0 otherwise
-// Condition: netH has to be valid (if non 0)
-// The interface is checked to be valid, up and linked
-TCPIP_NET_HANDLE TCPIP_IPV4_SelectSourceInterface(TCPIP_NET_HANDLE netH, const IPV4_ADDR* pDestAddress, IPV4_ADDR* pSrcAddress, bool srcSet)
+#if (_TCPIP_IPV4_NAPT_ENABLE != 0)
+// outbound hash of a connection
+// the values are in network order: the bytes that change the most between connections
+// (host part of the address, low byte of the port) can land on the same bits,
+// so they're mixed with a multiplication rather than just XOR-ed
+static __inline__ uint32_t __attribute__((always_inline)) _IPv4NaptHash(uint32_t inAdd, uint16_t inPort, uint32_t remAdd, uint16_t remPort)
 {
-    TCPIP_NET_IF  *pIf = _TCPIPStackHandleToNetUp(netH);
+    uint32_t hash = (inAdd + (((uint32_t)remPort << 16) | inPort)) * 0x9e3779b1;
+    hash = (hash ^ remAdd) * 0x9e3779b1;
+    return (hash >> 16) % _TCPIP_IPV4_NAPT_HASH_BUCKETS;
+}
 
-    if(srcSet)
-    {   // address in pSrcAddress is valid, no matter what
-        if(pIf == 0)
-        {   // try to see if it belongs to some interface
-            pIf = _TCPIPStackIpAddFromAnyNet(0, pSrcAddress);
-            if(pIf == 0)
-            {   // pSrcAddress is not the address of an interface!
-                // use the destination address
-                pIf = (TCPIP_NET_IF*)TCPIP_IPV4_SelectDestInterface(pDestAddress);
-            }
-        }
-        return pIf;
-    }
+// allocates the NAPT table
+// all entries are unused and the translation is disabled
+static TCPIP_IPV4_RES IPv4_NaptInitialize(const void* memH)
+{
+    int ix;
+    IPV4_NAPT_ENTRY* pEntry;
 
-    if(pIf == 0)
-    {   // use the destination address to decide which interface is this packet going out on
-        pIf = (TCPIP_NET_IF*)TCPIP_IPV4_SelectDestInterface(pDestAddress);
+    ipv4Napt = (IPV4_NAPT_DCPT*)TCPIP_HEAP_Calloc(memH, 1, sizeof(*ipv4Napt));
+    if(ipv4Napt == 0)
+    {
+        return TCPIP_IPV4_RES_MEM_ERR;
     }
-    // else interface is forced
 
-    if(pIf)
-    {
-        pSrcAddress->Val = TCPIP_STACK_NetAddressGet(pIf);
+    pEntry = ipv4Napt->entries;
+    for(ix = 0; ix < _TCPIP_IPV4_NAPT_ENTRIES; ix++, pEntry++)
+    {   // start with the last port generation, so that the 1st use is generation 0
+        pEntry->outsidePort = TCPIP_Helper_htons(_TCPIP_IPV4_NAPT_PORT_START + ix + (_TCPIP_IPV4_NAPT_PORT_GENERATIONS - 1) * _TCPIP_IPV4_NAPT_ENTRIES);
+        TCPIP_Helper_SingleListTailAdd(&ipv4Napt->freeList, (SGL_LIST_NODE*)pEntry);
     }
-    return pIf;
+
+    ipv4Napt->reqIfIx = ipv4Napt->outIfIx = -1;
+    return TCPIP_IPV4_RES_OK;
 }
 
-TCPIP_NET_HANDLE TCPIP_IPV4_SelectDestInterface(const IPV4_ADDR* pDestAddress)
+// rewrites an address and a port (or ICMP identifier) of a packet
+// the transport checksum is updated incrementally, RFC 1624: HC' = ~(~HC + ~m + m')
+// the one's complement sum does not depend on the byte order, so the raw 16 bit words are used
+// the IPv4 header checksum is calculated by the forwarding
+static void IPv4_NaptRewrite(IPV4_HEADER* pHeader, uint16_t* pL4, IPV4_ADDR* pAddress, uint32_t newAddress, uint16_t* pPort, uint16_t newPort)
 {
-    int netIx;
-    int avlblInterfaces;
-    uint32_t    ifAdd, ifMask;
-    TCPIP_NET_IF  *pIf;
-
-    // use the destination address to decide which interface is this packet going out on
+    uint16_t* pChksum;
+    uint32_t sum;
 
-    if(pDestAddress == 0 || pDestAddress->Val == 0)
-    {   // unroutable
-        return 0;
+    if(pHeader->Protocol == IP_PROT_TCP)
+    {
+        pChksum = pL4 + 8;
+    }
+    else if(pHeader->Protocol == IP_PROT_UDP)
+    {
+        pChksum = pL4 + 3;
+    }
+    else
+    {   // ICMP
+        pChksum = pL4 + 1;
     }
 
-    if((avlblInterfaces = TCPIP_STACK_NumberOfNetworksGet()) > 1)
-    {   // we have a choice
-        for(netIx = 0; netIx < avlblInterfaces; netIx++)
-        {
-            pIf = _TCPIPStackHandleToNetLinked(TCPIP_STACK_IndexToNet(netIx));
-            if(pIf)
-            {
-                ifAdd = _TCPIPStackNetAddress(pIf);
-                ifMask = _TCPIPStackNetMask(pIf);
-
-                if((ifAdd & ifMask) == (pDestAddress->Val & ifMask))
-                {   // destination address is on this interface
-                    return pIf;
-                }
-            }
+    if(pHeader->Protocol != IP_PROT_UDP || *pChksum != 0)
+    {   // UDP checksum 0 means no checksum
+        sum = (uint16_t)~*pChksum;
+        if(pHeader->Protocol != IP_PROT_ICMP)
+        {   // the address is part of the pseudo header
+            sum += (uint16_t)~pAddress->Val + (uint16_t)~(pAddress->Val >> 16) + (uint16_t)newAddress + (uint16_t)(newAddress >> 16);
+        }
+        sum += (uint16_t)~*pPort + newPort;
+        sum = (sum & 0xffff) + (sum >> 16);
+        sum = (sum & 0xffff) + (sum >> 16);
+        *pChksum = (uint16_t)~sum;
+        if(pHeader->Protocol == IP_PROT_UDP && *pChksum == 0)
+        {   // 0 is transmitted as all ones
+            *pChksum = 0xffff;
         }
     }
 
-    // use the default/any interface
-    return _TCPIPStackAnyNetLinked(true);
+    pAddress->Val = newAddress;
+    *pPort = newPort;
 }
 
-
-static TCPIP_NET_IF* TCPIP_IPV4_CheckPktTx(TCPIP_NET_HANDLE hNet, TCPIP_MAC_PACKET* pPkt)
+// restarts the timeout of a translation
+// TCP connections that are closed or reset get a short timeout
+static void IPv4_NaptEntryRefresh(IPV4_NAPT_ENTRY* pEntry, const uint8_t* pL4, bool isOutbound)
 {
-    TCPIP_NET_IF* pNetIf = 0;
+    uint32_t tmo;
+    uint8_t tcpFlags;
 
-    if(pPkt->next == 0)
-    {   // no support for chained packets!
-        // make sure the interface is valid
-        if((pNetIf = _TCPIPStackHandleToNetLinked(hNet)) != 0)
-        {   // cannot transmit over dead interface
-            if(_TCPIPStackIsConfig(pNetIf) && (pPkt->pktFlags & TCPIP_MAC_PKT_FLAG_CONFIG) == 0)
-            {   // no packets go out in stack configuration
-                pNetIf = 0;
-            } 
+    if(pEntry->protocol == IP_PROT_TCP)
+    {
+        tcpFlags = pL4[13];
+        if((tcpFlags & 0x12) == 0x02)
+        {   // SYN: new connection with the same ports
+            pEntry->tcpState = 0;
         }
-    }
-
-    return pNetIf;
+        if((tcpFlags & 0x04) != 0)
+        {
+            pEntry->tcpState |= IPV4_NAPT_TCP_RST;
+        }
+        if((tcpFlags & 0x01) != 0)
+        {
+            pEntry->tcpState |= isOutbound ? IPV4_NAPT_TCP_FIN_OUT : IPV4_NAPT_TCP_FIN_IN;
+        }
+
+        if((pEntry->tcpState & IPV4_NAPT_TCP_RST) != 0 || (pEntry->tcpState & (IPV4_NAPT_TCP_FIN_OUT | IPV4_NAPT_TCP_FIN_IN)) == (IPV4_NAPT_TCP_FIN_OUT | IPV4_NAPT_TCP_FIN_IN))
+        {
+            tmo = _TCPIP_IPV4_NAPT_TCP_CLOSE_TIMEOUT;
+        }
+        else
+        {
+            tmo = _TCPIP_IPV4_NAPT_TCP_TIMEOUT;
+        }
+    }
+    else if(pEntry->protocol == IP_PROT_UDP)
+    {
+        tmo = _TCPIP_IPV4_NAPT_UDP_TIMEOUT;
+    }
+    else
+    {
+        tmo = _TCPIP_IPV4_NAPT_ICMP_TIMEOUT;
+    }
+
+    pEntry->tExpire = SYS_TMR_TickCountGet() + tmo * SYS_TMR_TickCounterFrequencyGet();
+}
+
+// translates the source of a packet forwarded to the NAPT outside interface
+// the connection is searched in the hash and a new translation is created if needed
+// returns true if the packet can be forwarded: translated or not subject to translation
+// false if the packet needs to be discarded
+static bool TCPIP_IPV4_NaptOutbound(TCPIP_MAC_PACKET* pFwdPkt, TCPIP_NET_IF* pOutIf)
+{
+    IPV4_HEADER* pHeader;
+    IPV4_NAPT_ENTRY* pEntry;
+    SINGLE_LIST* pBucket;
+    IPV4_FRAGMENT_INFO fragInfo;
+    uint16_t *pL4, *pPort;
+    uint16_t remotePort, l4Len, gen;
+    uint8_t headerLen;
+
+    if(ipv4Napt == 0 || ipv4Napt->outIfIx != _TCPIPStackNetIxGet(pOutIf) || (TCPIP_NET_IF*)pFwdPkt->pktIf == pOutIf)
+    {   // not going from the inside to the outside
+        return true;
+    }
+
+    pHeader = (IPV4_HEADER*)pFwdPkt->pNetLayer;
+    fragInfo.val = TCPIP_Helper_ntohs(pHeader->FragmentInfo.val);
+    if(fragInfo.MF != 0 || fragInfo.fragOffset != 0)
+    {   // only the 1st fragment has the ports
+        ipv4Napt->stat.failFragment++;
+        return false;
+    }
+
+    if(pHeader->Protocol == IP_PROT_TCP)
+    {
+        l4Len = 20;
+    }
+    else if(pHeader->Protocol == IP_PROT_UDP || pHeader->Protocol == IP_PROT_ICMP)
+    {
+        l4Len = 8;
+    }
+    else
+    {
+        ipv4Napt->stat.failProtocol++;
+        return false;
+    }
+
+    headerLen = pHeader->IHL << 2;
+    if(pFwdPkt->pDSeg->segLen < headerLen + l4Len)
+    {
+        ipv4Napt->stat.failFormat++;
+        return false;
+    }
+
+    pL4 = (uint16_t*)(pFwdPkt->pNetLayer + headerLen);
+    if(pHeader->Protocol == IP_PROT_ICMP)
+    {   // the echo identifier plays the role of the port
+        if(*(uint8_t*)pL4 != 8)
+        {   // not an echo request
+            ipv4Napt->stat.failProtocol++;
+            return false;
+        }
+        pPort = pL4 + 2;
+        remotePort = 0;
+    }
+    else
+    {
+        pPort = pL4;
+        remotePort = pL4[1];
+    }
+
+    pBucket = ipv4Napt->hash + _IPv4NaptHash(pHeader->SourceAddress.Val, *pPort, pHeader->DestAddress.Val, remotePort);
+    for(pEntry = (IPV4_NAPT_ENTRY*)pBucket->head; pEntry != 0; pEntry = pEntry->next)
+    {
+        if(pEntry->insidePort == *pPort && pEntry->remotePort == remotePort && pEntry->insideAddress == pHeader->SourceAddress.Val &&
+                pEntry->remoteAddress == pHeader->DestAddress.Val && pEntry->protocol == pHeader->Protocol)
+        {   // existing connection
+            break;
+        }
+    }
+
+    if(pEntry == 0)
+    {   // new connection
+        if((pEntry = (IPV4_NAPT_ENTRY*)TCPIP_Helper_SingleListHeadRemove(&ipv4Napt->freeList)) == 0)
+        {
+            ipv4Napt->stat.failFull++;
+            return false;
+        }
+
+        // move to the next port owned by this entry
+        // so that a new connection does not reuse right away the port of the previous one
+        gen = (TCPIP_Helper_ntohs(pEntry->outsidePort) - _TCPIP_IPV4_NAPT_PORT_START) / _TCPIP_IPV4_NAPT_ENTRIES + 1;
+        if(gen == _TCPIP_IPV4_NAPT_PORT_GENERATIONS)
+        {
+            gen = 0;
+        }
+        pEntry->outsidePort = TCPIP_Helper_htons(_TCPIP_IPV4_NAPT_PORT_START + (pEntry - ipv4Napt->entries) + gen * _TCPIP_IPV4_NAPT_ENTRIES);
+        pEntry->insideAddress = pHeader->SourceAddress.Val;
+        pEntry->remoteAddress = pHeader->DestAddress.Val;
+        pEntry->insidePort = *pPort;
+        pEntry->remotePort = remotePort;
+        pEntry->protocol = pHeader->Protocol;
+        pEntry->tcpState = 0;
+        TCPIP_Helper_SingleListHeadAdd(pBucket, (SGL_LIST_NODE*)pEntry);
+        ipv4Napt->stat.entries++;
+        ipv4Napt->stat.newEntries++;
+    }
+
+    IPv4_NaptEntryRefresh(pEntry, (const uint8_t*)pL4, true);
+    IPv4_NaptRewrite(pHeader, pL4, &pHeader->SourceAddress, _TCPIPStackNetAddress(pOutIf), pPort, pEntry->outsidePort);
+    ipv4Napt->stat.outPackets++;
+
+    return true;
+}
+
+// translates the destination of a packet received on the NAPT outside interface
+// the outside port selects the entry directly
+// a packet that does not belong to a translated connection is not changed
+static void TCPIP_IPV4_NaptInbound(TCPIP_NET_IF* pNetIf, TCPIP_MAC_PACKET* pRxPkt, IPV4_HEADER* pCHeader, uint8_t headerLen)
+{
+    IPV4_HEADER* pHeader;
+    IPV4_NAPT_ENTRY* pEntry;
+    uint16_t *pL4, *pPort;
+    uint16_t remotePort, l4Len, hostPort;
+
+    if(ipv4Napt == 0 || ipv4Napt->outIfIx != _TCPIPStackNetIxGet(pNetIf) || pCHeader->DestAddress.Val != _TCPIPStackNetAddress(pNetIf))
+    {   // not for the outside address
+        return;
+    }
+
+    if(pCHeader->FragmentInfo.MF != 0 || pCHeader->FragmentInfo.fragOffset != 0)
+    {   // fragments are not translated
+        return;
+    }
+
+    if(pCHeader->Protocol == IP_PROT_TCP)
+    {
+        l4Len = 20;
+    }
+    else if(pCHeader->Protocol == IP_PROT_UDP || pCHeader->Protocol == IP_PROT_ICMP)
+    {
+        l4Len = 8;
+    }
+    else
+    {
+        return;
+    }
+
+    if(pRxPkt->pDSeg->segLen < headerLen + l4Len)
+    {
+        return;
+    }
+
+    pL4 = (uint16_t*)(pRxPkt->pNetLayer + headerLen);
+    if(pCHeader->Protocol == IP_PROT_ICMP)
+    {
+        if(*(uint8_t*)pL4 != 0)
+        {   // not an echo reply
+            return;
+        }
+        pPort = pL4 + 2;
+        remotePort = 0;
+    }
+    else
+    {
+        pPort = pL4 + 1;
+        remotePort = pL4[0];
+    }
+
+    hostPort = TCPIP_Helper_ntohs(*pPort);
+    if(hostPort < _TCPIP_IPV4_NAPT_PORT_START || hostPort >= _TCPIP_IPV4_NAPT_PORT_START + _TCPIP_IPV4_NAPT_PORT_GENERATIONS * _TCPIP_IPV4_NAPT_ENTRIES)
+    {   // not a translation port
+        return;
+    }
+
+    pEntry = ipv4Napt->entries + (hostPort - _TCPIP_IPV4_NAPT_PORT_START) % _TCPIP_IPV4_NAPT_ENTRIES;
+    if(pEntry->protocol != pCHeader->Protocol || pEntry->outsidePort != *pPort || pEntry->remotePort != remotePort || pEntry->remoteAddress != pCHeader->SourceAddress.Val)
+    {   // unused entry, old port or a different remote host
+        return;
+    }
+
+    IPv4_NaptEntryRefresh(pEntry, (const uint8_t*)pL4, false);
+    pHeader = (IPV4_HEADER*)pRxPkt->pNetLayer;
+    IPv4_NaptRewrite(pHeader, pL4, &pHeader->DestAddress, pEntry->insideAddress, pPort, pEntry->insidePort);
+    pCHeader->DestAddress.Val = pEntry->insideAddress;
+    ipv4Napt->stat.inPackets++;
+}
+
+// NAPT timeout processing
+// removes the expired translations, once per second
+// applies a change of the outside interface: all translations are removed
+static void TCPIP_IPV4_NaptTimeout(void)
+{
+    int ix;
+    bool purgeAll;
+    uint32_t currTick;
+    IPV4_NAPT_ENTRY *pEntry, *pPrev, *pNext;
+    SINGLE_LIST* pBucket;
+
+    if(ipv4Napt == 0)
+    {
+        return;
+    }
+
+    currTick = SYS_TMR_TickCountGet();
+    purgeAll = ipv4Napt->reqIfIx != ipv4Napt->outIfIx;
+    if(!purgeAll)
+    {
+        if(ipv4Napt->stat.entries == 0 || currTick - ipv4Napt->scanTick < SYS_TMR_TickCounterFrequencyGet())
+        {   // nothing to do yet
+            return;
+        }
+    }
+    ipv4Napt->scanTick = currTick;
+
+    pBucket = ipv4Napt->hash;
+    for(ix = 0; ix < sizeof(ipv4Napt->hash) / sizeof(*ipv4Napt->hash); ix++, pBucket++)
+    {
+        pPrev = 0;
+        for(pEntry = (IPV4_NAPT_ENTRY*)pBucket->head; pEntry != 0; pEntry = pNext)
+        {
+            pNext = pEntry->next;
+            if(purgeAll || (int32_t)(currTick - pEntry->tExpire) >= 0)
+            {   // expired entry; remove
+                TCPIP_Helper_SingleListNextRemove(pBucket, (SGL_LIST_NODE*)pPrev);
+                pEntry->protocol = 0;
+                TCPIP_Helper_SingleListTailAdd(&ipv4Napt->freeList, (SGL_LIST_NODE*)pEntry);
+                ipv4Napt->stat.entries--;
+                if(!purgeAll)
+                {
+                    ipv4Napt->stat.expiredEntries++;
+                }
+            }
+            else
+            {
+                pPrev = pEntry;
+            }
+        }
+    }
+
+    ipv4Napt->outIfIx = ipv4Napt->reqIfIx;
+}
+#endif  // (_TCPIP_IPV4_NAPT_ENABLE != 0)
+#endif  // (TCPIP_IPV4_FORWARDING_ENABLE != 0)
+
+#if (_TCPIP_IPV4_NAPT_ENABLE != 0)
+TCPIP_IPV4_RES TCPIP_IPV4_NaptSet(TCPIP_NET_HANDLE netH)
+{
+    TCPIP_NET_IF* pNetIf;
+
+    if(ipv4Napt == 0)
+    {   // no forwarding
+        return TCPIP_IPV4_RES_NAPT_ERR;
+    }
+
+    if(netH == 0)
+    {   // disable
+        ipv4Napt->reqIfIx = -1;
+        return TCPIP_IPV4_RES_OK;
+    }
+
+    if((pNetIf = _TCPIPStackHandleToNet(netH)) == 0)
+    {
+        return TCPIP_IPV4_RES_IF_ERR;
+    }
+
+    // the IPv4 task applies the change
+    ipv4Napt->reqIfIx = _TCPIPStackNetIxGet(pNetIf);
+    return TCPIP_IPV4_RES_OK;
+}
+
+bool TCPIP_IPV4_NaptStatGet(TCPIP_IPV4_NAPT_STAT* pStat, bool clear)
+{
+    unsigned int nEntries;
+
+    if(ipv4Napt == 0)
+    {
+        return false;
+    }
+
+    OSAL_CRITSECT_DATA_TYPE status = OSAL_CRIT_Enter(OSAL_CRIT_TYPE_LOW);
+    if(pStat)
+    {
+        *pStat = ipv4Napt->stat;
+    }
+    if(clear)
+    {
+        nEntries = ipv4Napt->stat.entries;
+        memset(&ipv4Napt->stat, 0, sizeof(ipv4Napt->stat));
+        ipv4Napt->stat.entries = nEntries;
+    }
+    OSAL_CRIT_Leave(OSAL_CRIT_TYPE_LOW, status);
+
+    return true;
+}
+#else
+TCPIP_IPV4_RES TCPIP_IPV4_NaptSet(TCPIP_NET_HANDLE netH)
+{
+    return TCPIP_IPV4_RES_NAPT_ERR;
+}
+
+bool TCPIP_IPV4_NaptStatGet(TCPIP_IPV4_NAPT_STAT* pStat, bool clear)
+{
+    return false;
+}
+#endif  // (_TCPIP_IPV4_NAPT_ENABLE != 0)
+
+// selects a source address and an interface based on the IPv4 destination address
+// updates the pSrcAddress and returns the needed interface, if successful
+// returns 0 if failed
+// if srcSet == 1 and netH != 0 the function won't change anything 
+// if srcSet == 1 and netH == 0 then the call will never fail 
+//      it will use whatever value in pSrcAddress (even 0)
+//      and will try to come up with an appropriate interface.
+// if srcSet == 0 and netH == 0 it will use the destination address
+// if srcSet == 0 and netH != 0 it will use the address of that interface
+// returns a valid interface if it succeeds, 0 otherwise
+// Condition: netH has to be valid (if non 0)
+// The interface is checked to be valid, up and linked
+TCPIP_NET_HANDLE TCPIP_IPV4_SelectSourceInterface(TCPIP_NET_HANDLE netH, const IPV4_ADDR* pDestAddress, IPV4_ADDR* pSrcAddress, bool srcSet)
+{
+    TCPIP_NET_IF  *pIf = _TCPIPStackHandleToNetUp(netH);
+
+    if(srcSet)
+    {   // address in pSrcAddress is valid, no matter what
+        if(pIf == 0)
+        {   // try to see if it belongs to some interface
+            pIf = _TCPIPStackIpAddFromAnyNet(0, pSrcAddress);
+            if(pIf == 0)
+            {   // pSrcAddress is not the address of an interface!
+                // use the destination address
+                pIf = (TCPIP_NET_IF*)TCPIP_IPV4_SelectDestInterface(pDestAddress);
+            }
+        }
+        return pIf;
+    }
+
+    if(pIf == 0)
+    {   // use the destination address to decide which interface is this packet going out on
+        pIf = (TCPIP_NET_IF*)TCPIP_IPV4_SelectDestInterface(pDestAddress);
+    }
+    // else interface is forced
+
+    if(pIf)
+    {
+        pSrcAddress->Val = TCPIP_STACK_NetAddressGet(pIf);
+    }
+    return pIf;
+}
+
+TCPIP_NET_HANDLE TCPIP_IPV4_SelectDestInterface(const IPV4_ADDR* pDestAddress)
+{
+    int netIx;
+    int avlblInterfaces;
+    uint32_t    ifAdd, ifMask;
+    TCPIP_NET_IF  *pIf;
+
+    // use the destination address to decide which interface is this packet going out on
+
+    if(pDestAddress == 0 || pDestAddress->Val == 0)
+    {   // unroutable
+        return 0;
+    }
+
+    if((avlblInterfaces = TCPIP_STACK_NumberOfNetworksGet()) > 1)
+    {   // we have a choice
+        for(netIx = 0; netIx < avlblInterfaces; netIx++)
+        {
+            pIf = _TCPIPStackHandleToNetLinked(TCPIP_STACK_IndexToNet(netIx));
+            if(pIf)
+            {
+                ifAdd = _TCPIPStackNetAddress(pIf);
+                ifMask = _TCPIPStackNetMask(pIf);
+
+                if((ifAdd & ifMask) == (pDestAddress->Val & ifMask))
+                {   // destination address is on this interface
+                    return pIf;
+                }
+            }
+        }
+    }
+
+    // use the default/any interface
+    return _TCPIPStackAnyNetLinked(true);
+}
+
+
+// burstOk: the packets chained with next are a transmit burst, handled by the caller
+static TCPIP_NET_IF* TCPIP_IPV4_CheckPktTx(TCPIP_NET_HANDLE hNet, TCPIP_MAC_PACKET* pPkt, bool burstOk)
+{
+    TCPIP_NET_IF* pNetIf = 0;
+
+    if(pPkt->next == 0 || burstOk)
+    {   // no support for chained packets, other than a burst!
+        // make sure the interface is valid
+        if((pNetIf = _TCPIPStackHandleToNetLinked(hNet)) != 0)
+        {   // cannot transmit over dead interface
+            if(_TCPIPStackIsConfig(pNetIf) && (pPkt->pktFlags & TCPIP_MAC_PKT_FLAG_CONFIG) == 0)
+            {   // no packets go out in stack configuration
+                pNetIf = 0;
+            } 
+        }
+    }
+
+    return pNetIf;
 }
 
 
@@ -2110,7 +2881,7 @@ bool TCPIP_IPV4_PktTx(IPV4_PACKET* pPkt, TCPIP_MAC_PACKET* pMacPkt, bool isPersi
     }
 
     // check valid interface
-    pNetIf = TCPIP_IPV4_CheckPktTx(pPkt->netIfH, pMacPkt);
+    pNetIf = TCPIP_IPV4_CheckPktTx(pPkt->netIfH, pMacPkt, true);
     if(pNetIf == 0)
     {   // cannot transmit over invalid interface
         return false;
@@ -2119,6 +2890,14 @@ bool TCPIP_IPV4_PktTx(IPV4_PACKET* pPkt, TCPIP_MAC_PACKET* pMacPkt, bool isPersi
 
     pMacPkt->pktIf = pNetIf;
 
+    if(pMacPkt->next != 0)
+    {   // burst of packets: sent in one go only to a resolved destination
+        if(destType == TCPIP_IPV4_DEST_SELF || pMacDst == 0 || !TCPIP_IPV4_BurstFormat(pMacPkt, pMacDst, pNetIf))
+        {
+            return false;
+        }
+    }
+
     // properly format the packet
     TCPIP_PKT_PacketMACFormat(pMacPkt, pMacDst, (const TCPIP_MAC_ADDR*)_TCPIPStack_NetMACAddressGet(pNetIf), TCPIP_ETHER_TYPE_IPV4);
 
@@ -2192,6 +2971,32 @@ bool TCPIP_IPV4_PktTx(IPV4_PACKET* pPkt, TCPIP_MAC_PACKET* pMacPkt, bool isPersi
 }
 
 
+// formats the packets chained to pMacPkt in a transmit burst
+// returns false, with no packet touched, if any of the chained packets needs fragmentation
+// the head of the burst is processed by the caller
+static bool TCPIP_IPV4_BurstFormat(TCPIP_MAC_PACKET* pMacPkt, const TCPIP_MAC_ADDR* pMacDst, TCPIP_NET_IF* pNetIf)
+{
+    TCPIP_MAC_PACKET* pBurstPkt;
+    uint16_t linkMtu = _TCPIPStackNetLinkMtu(pNetIf);
+
+    for(pBurstPkt = pMacPkt->next; pBurstPkt != 0; pBurstPkt = pBurstPkt->next)
+    {
+        if(TCPIP_PKT_PayloadLen(pBurstPkt) > linkMtu)
+        {   // no fragmentation for a burst
+            return false;
+        }
+    }
+
+    for(pBurstPkt = pMacPkt->next; pBurstPkt != 0; pBurstPkt = pBurstPkt->next)
+    {
+        pBurstPkt->pktIf = pNetIf;
+        TCPIP_PKT_PacketMACFormat(pBurstPkt, pMacDst, (const TCPIP_MAC_ADDR*)_TCPIPStack_NetMACAddressGet(pNetIf), TCPIP_ETHER_TYPE_IPV4);
+        TCPIP_PKT_FlightLogTx(pBurstPkt, TCPIP_THIS_MODULE_ID);
+    }
+
+    return true;
+}
+
 // IPv4 formats a IPV4_PACKET and calculates the header checksum
 // the source and destination addresses should be updated in the packet 
 void TCPIP_IPV4_PacketFormatTx(IPV4_PACKET* pPkt, uint8_t protocol, uint16_t ipLoadLen, TCPIP_IPV4_PACKET_PARAMS* pParams)
@@ -2268,23 +3073,70 @@ void TCPIP_IPV4_PacketFormatTx(IPV4_PACKET* pPkt, uint8_t protocol, uint16_t ipL
 }
 
 // queues a packet waiting for ARP resolution
+// each destination has its own queue, limited to _TCPIP_IPV4_ARP_QUEUE_DEST_PACKETS
+// when the destination queue is full the oldest packet is dropped
+// so that a burst to an unresolved host does not use all the ARP entries
 static bool TCPIP_IPV4_QueueArpPacket(void* pPkt, int arpIfIx, IPV4_ARP_PKT_TYPE type, IPV4_ADDR* arpTarget)
 {
+    IPV4_ARP_DEST   *pDest, *pMaxDest, *pSrchDest;
+    IPV4_ARP_ENTRY* pEntry;
     PROTECTED_SINGLE_LIST* pList = &ipv4ArpQueue;
+
     TCPIP_Helper_ProtectedSingleListLock(pList);
-    IPV4_ARP_ENTRY* pEntry = (IPV4_ARP_ENTRY*)TCPIP_Helper_SingleListHeadRemove(&ipv4ArpPool);
+    pDest = _IPv4ArpDestGet(arpTarget, arpIfIx);
+    if(pDest == 0)
+    {   // out of ARP destinations
+        SYS_ERROR(SYS_ERROR_WARNING, "IPv4: ARP destinations pool empty!\r\n");
+        TCPIP_Helper_ProtectedSingleListUnlock(pList);
+        return false;
+    }
+
+    if(TCPIP_Helper_SingleListCount(&pDest->pktList) >= _TCPIP_IPV4_ARP_QUEUE_DEST_PACKETS)
+    {   // destination queue full: drop the oldest packet
+        pEntry = (IPV4_ARP_ENTRY*)TCPIP_Helper_SingleListHeadRemove(&pDest->pktList);
+        _IPv4ArpEntryDiscard(pEntry, TCPIP_MAC_PKT_ACK_BUFFER_ERR);
+        pDest->nDropped++;
+    }
+    else if(TCPIP_Helper_SingleListIsEmpty(&ipv4ArpPool))
+    {   // out of ARP entries in the pool
+        // take the oldest packet of the longest queue, if longer than this one
+        pMaxDest = pDest;
+        for(pSrchDest = (IPV4_ARP_DEST*)pList->list.head; pSrchDest != 0; pSrchDest = pSrchDest->next)
+        {
+            if(TCPIP_Helper_SingleListCount(&pSrchDest->pktList) > TCPIP_Helper_SingleListCount(&pMaxDest->pktList))
+            {
+                pMaxDest = pSrchDest;
+            }
+        }
+
+        if(pMaxDest != pDest)
+        {
+            pEntry = (IPV4_ARP_ENTRY*)TCPIP_Helper_SingleListHeadRemove(&pMaxDest->pktList);
+            _IPv4ArpEntryDiscard(pEntry, TCPIP_MAC_PKT_ACK_BUFFER_ERR);
+            pMaxDest->nDropped++;
+        }
+    }
+
+    pEntry = (IPV4_ARP_ENTRY*)TCPIP_Helper_SingleListHeadRemove(&ipv4ArpPool);
     if(pEntry == 0)
     {   // out of ARP entries in the pool
         SYS_ERROR(SYS_ERROR_WARNING, "IPv4: ARP entries pool empty!\r\n");
+        pDest->nDropped++;
+        if(TCPIP_Helper_SingleListIsEmpty(&pDest->pktList))
+        {   // nothing queued for this destination; return it to the idle pool
+            TCPIP_Helper_SingleListNodeRemove(&pList->list, (SGL_LIST_NODE*)pDest);
+            TCPIP_Helper_SingleListTailAdd(&ipv4ArpDestPool, (SGL_LIST_NODE*)pDest);
+        }
         TCPIP_Helper_ProtectedSingleListUnlock(pList);
         return false;
     }
 
     pEntry->type = (uint8_t)type;
     pEntry->arpIfIx = (uint8_t)arpIfIx;
-    pEntry->pPkt = pPkt;     
+    pEntry->pPkt = pPkt;
     pEntry->arpTarget.Val = arpTarget->Val;
-    TCPIP_Helper_SingleListTailAdd(&pList->list, (SGL_LIST_NODE*)pEntry);
+    TCPIP_Helper_SingleListTailAdd(&pDest->pktList, (SGL_LIST_NODE*)pEntry);
+    pDest->nQueued++;
     TCPIP_Helper_ProtectedSingleListUnlock(pList);
 #if ((TCPIP_IPV4_DEBUG_LEVEL & TCPIP_IPV4_DEBUG_MASK_ARP_QUEUE) != 0)
     if(type == IPV4_ARP_PKT_TYPE_TX || type == IPV4_ARP_PKT_TYPE_MAC)
@@ -2303,24 +3155,89 @@ static bool TCPIP_IPV4_QueueArpPacket(void* pPkt, int arpIfIx, IPV4_ARP_PKT_TYPE
     return true;
 }
 
+// returns the MAC packet carried by an ARP queue entry
+static TCPIP_MAC_PACKET* _IPv4ArpEntryPacket(IPV4_ARP_ENTRY* pEntry)
+{
+    if(pEntry->type == IPV4_ARP_PKT_TYPE_TX)
+    {   // IPV4_PACKET*
+        return &pEntry->pTxPkt->macPkt;
+    }
+
+    // IPV4_ARP_PKT_TYPE_MAC/IPV4_ARP_PKT_TYPE_FWD: TCPIP_MAC_PACKET*
+    _IPv4AssertCond(pEntry->type == IPV4_ARP_PKT_TYPE_MAC || pEntry->type == IPV4_ARP_PKT_TYPE_FWD, __func__, __LINE__);
+    return pEntry->pMacPkt;
+}
+
+// discards the packet of an ARP queue entry and returns the entry to the pool
+// ipv4ArpQueue should be locked
+static void _IPv4ArpEntryDiscard(IPV4_ARP_ENTRY* pEntry, TCPIP_MAC_PKT_ACK_RES ackRes)
+{
+    TCPIP_IPV4_FragmentTxAcknowledge(_IPv4ArpEntryPacket(pEntry), ackRes, IPV4_FRAG_TX_ACK_HEAD | IPV4_FRAG_TX_ACK_FRAGS);
+    TCPIP_Helper_SingleListTailAdd(&ipv4ArpPool, (SGL_LIST_NODE*)pEntry);
+}
+
+// finds the destination queue for the (arpTarget, arpIfIx) pair
+// if not active, a new one is taken from the idle pool
+// an idle slot that served the same destination is preferred, to keep its counters
+// otherwise the least recently used one is reset and reused
+// returns 0 if no destination available
+// ipv4ArpQueue should be locked
+static IPV4_ARP_DEST* _IPv4ArpDestGet(const IPV4_ADDR* arpTarget, int arpIfIx)
+{
+    IPV4_ARP_DEST   *pDest, *pPrev;
+
+    for(pDest = (IPV4_ARP_DEST*)ipv4ArpQueue.list.head; pDest != 0; pDest = pDest->next)
+    {
+        if(pDest->arpTarget.Val == arpTarget->Val && pDest->arpIfIx == (uint8_t)arpIfIx)
+        {   // already queuing
+            return pDest;
+        }
+    }
+
+    pPrev = 0;
+    for(pDest = (IPV4_ARP_DEST*)ipv4ArpDestPool.head; pDest != 0; pDest = pDest->next)
+    {
+        if(pDest->arpTarget.Val == arpTarget->Val && pDest->arpIfIx == (uint8_t)arpIfIx)
+        {
+            break;
+        }
+        pPrev = pDest;
+    }
+
+    if(pDest != 0)
+    {
+        TCPIP_Helper_SingleListNextRemove(&ipv4ArpDestPool, (SGL_LIST_NODE*)pPrev);
+    }
+    else
+    {
+        pDest = (IPV4_ARP_DEST*)TCPIP_Helper_SingleListHeadRemove(&ipv4ArpDestPool);
+        if(pDest == 0)
+        {   // all destinations busy
+            return 0;
+        }
+        pDest->arpTarget.Val = arpTarget->Val;
+        pDest->arpIfIx = (uint8_t)arpIfIx;
+        pDest->nQueued = 0;
+        pDest->nFlushed = 0;
+        pDest->nDropped = 0;
+    }
 
+    TCPIP_Helper_SingleListTailAdd(&ipv4ArpQueue.list, (SGL_LIST_NODE*)pDest);
+    return pDest;
+}
 
 // ARP resolution done
 static void TCPIP_IPV4_ArpHandler(TCPIP_NET_HANDLE hNet, const IPV4_ADDR* ipAdd, const TCPIP_MAC_ADDR* MACAddr, TCPIP_ARP_EVENT_TYPE evType, const void* param)
 {
-    TCPIP_NET_IF* pPktIf;
-    SINGLE_LIST newList, *arpList;
-    IPV4_ARP_ENTRY *pEntry;
-    TCPIP_MAC_PACKET*   pMacPkt = 0;
-    TCPIP_MAC_PKT_ACK_RES   pktAckFail;
-    TCPIP_MAC_ETHERNET_HEADER* macHdr;
-    
+    IPV4_ARP_DEST   *pDest, *pNext, *pPrev;
+
+#if (TCPIP_IPV4_FORWARDING_ENABLE != 0)
+    TCPIP_IPV4_FwdFlowArpEvent(hNet, ipAdd, evType);
+#endif  // (TCPIP_IPV4_FORWARDING_ENABLE != 0)
 
-    TCPIP_Helper_SingleListInitialize (&newList);
-    
     TCPIP_Helper_ProtectedSingleListLock(&ipv4ArpQueue);
     // traverse the ipv4ArpQueue list
-    // and find all the packets waiting for the solved address
+    // and find all the destinations waiting for the solved address
 
 #if ((TCPIP_IPV4_DEBUG_LEVEL & TCPIP_IPV4_DEBUG_MASK_ARP_QUEUE) != 0)
     if(evType >= 0)
@@ -2332,86 +3249,172 @@ static void TCPIP_IPV4_ArpHandler(TCPIP_NET_HANDLE hNet, const IPV4_ADDR* ipAdd,
         _ipv4_arp_stat.totFailed++;
     }
 #endif  // ((TCPIP_IPV4_DEBUG_LEVEL & TCPIP_IPV4_DEBUG_MASK_ARP_QUEUE) != 0)
-    arpList = &ipv4ArpQueue.list;
 
-    while((pEntry = (IPV4_ARP_ENTRY*)TCPIP_Helper_SingleListHeadRemove(arpList)) != 0)
+    pPrev = 0;
+    for(pDest = (IPV4_ARP_DEST*)ipv4ArpQueue.list.head; pDest != 0; pDest = pNext)
+    {
+        pNext = pDest->next;
+        if(pDest->arpTarget.Val != ipAdd->Val)
+        {
+            pPrev = pDest;
+            continue;
+        }
+
+        // match; the target could be queued on multiple interfaces
+        TCPIP_Helper_SingleListNextRemove(&ipv4ArpQueue.list, (SGL_LIST_NODE*)pPrev);
+        _IPv4ArpDestFlush(pDest, evType >= 0 ? MACAddr : 0);
+        // most recently used, at the end of the idle pool
+        TCPIP_Helper_SingleListTailAdd(&ipv4ArpDestPool, (SGL_LIST_NODE*)pDest);
+    }
+
+    TCPIP_Helper_ProtectedSingleListUnlock(&ipv4ArpQueue);
+
+}
+
+// flushes all the packets queued for a destination, in the queuing order
+// if pMacDst != 0, the ARP was resolved and the packets are transmitted
+//  as bursts of packets chained with next, in one MAC call
+//  fragmented packets are transmitted on their own
+// if pMacDst == 0, the ARP failed and the packets are discarded
+// ipv4ArpQueue should be locked
+static void _IPv4ArpDestFlush(IPV4_ARP_DEST* pDest, const TCPIP_MAC_ADDR* pMacDst)
+{
+    IPV4_ARP_ENTRY* pEntry;
+    TCPIP_MAC_PACKET *pMacPkt, *pBurstHead, *pBurstTail;
+    TCPIP_MAC_ETHERNET_HEADER* macHdr;
+    TCPIP_NET_IF* pPktIf = (TCPIP_NET_IF*)TCPIP_STACK_IndexToNet(pDest->arpIfIx);
+
+    pBurstHead = pBurstTail = 0;
+    while((pEntry = (IPV4_ARP_ENTRY*)TCPIP_Helper_SingleListHeadRemove(&pDest->pktList)) != 0)
     {
-        if(pEntry->type == IPV4_ARP_PKT_TYPE_TX)
-        {   // IPV4_PACKET*
-            pMacPkt = &pEntry->pTxPkt->macPkt;
 #if ((TCPIP_IPV4_DEBUG_LEVEL & TCPIP_IPV4_DEBUG_MASK_ARP_QUEUE) != 0)
-            if(evType >= 0)
+        if(pMacDst != 0)
+        {
+            if(pEntry->type == IPV4_ARP_PKT_TYPE_FWD)
             {
-                _ipv4_arp_stat.txSolved++;
+                _ipv4_arp_stat.fwdSolved++;
             }
-#endif  // ((TCPIP_IPV4_DEBUG_LEVEL & TCPIP_IPV4_DEBUG_MASK_ARP_QUEUE) != 0)
-        }
-        else if(pEntry->type == IPV4_ARP_PKT_TYPE_MAC)
-        {   // TCPIP_MAC_PACKET*
-            pMacPkt = pEntry->pMacPkt;
-#if ((TCPIP_IPV4_DEBUG_LEVEL & TCPIP_IPV4_DEBUG_MASK_ARP_QUEUE) != 0)
-            if(evType >= 0)
+            else
             {
                 _ipv4_arp_stat.txSolved++;
             }
+        }
 #endif  // ((TCPIP_IPV4_DEBUG_LEVEL & TCPIP_IPV4_DEBUG_MASK_ARP_QUEUE) != 0)
+
+        if(pMacDst == 0 || pPktIf == 0)
+        {   // some error; discard the packet
+            _IPv4ArpEntryDiscard(pEntry, pMacDst == 0 ? TCPIP_MAC_PKT_ACK_ARP_TMO : TCPIP_MAC_PKT_ACK_ARP_NET_ERR);
+            pDest->nDropped++;
+            continue;
         }
-#if (TCPIP_IPV4_FORWARDING_ENABLE != 0)
-        else if(pEntry->type == IPV4_ARP_PKT_TYPE_FWD)
-        {   // TCPIP_MAC_PACKET*
-            pMacPkt = pEntry->pFwdPkt; 
-#if ((TCPIP_IPV4_DEBUG_LEVEL & TCPIP_IPV4_DEBUG_MASK_ARP_QUEUE) != 0)
-            if(evType >= 0)
+
+        // successfully resolved the ARP; update the packet destination
+        pMacPkt = _IPv4ArpEntryPacket(pEntry);
+        macHdr = (TCPIP_MAC_ETHERNET_HEADER*)pMacPkt->pMacLayer;
+        memcpy(&macHdr->DestMACAddr, pMacDst, sizeof(*pMacDst));
+        pMacPkt->next = 0;
+        // back to pool
+        TCPIP_Helper_SingleListTailAdd(&ipv4ArpPool, (SGL_LIST_NODE*)pEntry);
+
+        if(pMacPkt->pkt_next != 0)
+        {   // fragmented packet; send what's pending first, to keep the order
+            _IPv4ArpBurstTx(pDest, pPktIf, pBurstHead);
+            pBurstHead = 0;
+            if(TCPIP_IPV4_TxMacPkt(pPktIf, pMacPkt))
             {
-                _ipv4_arp_stat.fwdSolved++;
+                pDest->nFlushed++;
+            }
+            else
+            {
+                TCPIP_IPV4_FragmentTxAcknowledge(pMacPkt, TCPIP_MAC_PKT_ACK_ARP_NET_ERR, IPV4_FRAG_TX_ACK_HEAD | IPV4_FRAG_TX_ACK_FRAGS);
+                pDest->nDropped++;
             }
-#endif  // ((TCPIP_IPV4_DEBUG_LEVEL & TCPIP_IPV4_DEBUG_MASK_ARP_QUEUE) != 0)
         }
-#endif  // (TCPIP_IPV4_FORWARDING_ENABLE != 0)
         else
-        {   // should not happen!
-            _IPv4AssertCond(false, __func__, __LINE__);
-            return;
-        }
-
-        pPktIf = (TCPIP_NET_IF*)TCPIP_STACK_IndexToNet(pEntry->arpIfIx);
-            
-        pktAckFail = TCPIP_MAC_PKT_ACK_NONE; 
-        if(pEntry->arpTarget.Val == ipAdd->Val)
-        {   // match
-            if(evType >= 0)
-            {   // successfully resolved the ARP; update the packet destination
-                macHdr = (TCPIP_MAC_ETHERNET_HEADER*)pMacPkt->pMacLayer;
-                memcpy(&macHdr->DestMACAddr, MACAddr, sizeof(*MACAddr));
-                pMacPkt->next = 0;  // send single packet
-                if(pPktIf == 0 || !TCPIP_IPV4_TxMacPkt(pPktIf, pMacPkt))
-                {
-                    pktAckFail = TCPIP_MAC_PKT_ACK_ARP_NET_ERR; 
-                }
+        {   // add to the burst
+            if(pBurstHead == 0)
+            {
+                pBurstHead = pMacPkt;
             }
             else
-            {   // some error;
-                pktAckFail = TCPIP_MAC_PKT_ACK_ARP_TMO; 
+            {
+                pBurstTail->next = pMacPkt;
             }
+            pBurstTail = pMacPkt;
+        }
+    }
 
-            if(pktAckFail != TCPIP_MAC_PKT_ACK_NONE)
-            {   // some error; discard the packet
-                TCPIP_IPV4_FragmentTxAcknowledge(pMacPkt, pktAckFail, IPV4_FRAG_TX_ACK_HEAD | IPV4_FRAG_TX_ACK_FRAGS);
-            }
+    _IPv4ArpBurstTx(pDest, pPktIf, pBurstHead);
+}
 
-            // back to pool
-            TCPIP_Helper_SingleListTailAdd(&ipv4ArpPool, (SGL_LIST_NODE*)pEntry); 
-        }
-        else
-        {
-            TCPIP_Helper_SingleListTailAdd(&newList, (SGL_LIST_NODE*)pEntry);
-        }
+// transmits a burst of packets chained with next
+// if the MAC rejects the burst, all the packets are discarded
+static void _IPv4ArpBurstTx(IPV4_ARP_DEST* pDest, TCPIP_NET_IF* pPktIf, TCPIP_MAC_PACKET* pBurst)
+{
+    TCPIP_MAC_PACKET *pMacPkt, *pNext;
+    uint32_t nPkts;
+
+    if(pBurst == 0)
+    {
+        return;
     }
 
-    // update the arp queue
-    ipv4ArpQueue.list = newList;
+    nPkts = 0;
+    for(pMacPkt = pBurst; pMacPkt != 0; pMacPkt = pMacPkt->next)
+    {
+        nPkts++;
+    }
+
+    if(TCPIP_IPV4_TxMacPkt(pPktIf, pBurst))
+    {
+        pDest->nFlushed += nPkts;
+        return;
+    }
+
+    for(pMacPkt = pBurst; pMacPkt != 0; pMacPkt = pNext)
+    {
+        pNext = pMacPkt->next;
+        pMacPkt->next = 0;
+        TCPIP_PKT_PacketAcknowledge(pMacPkt, TCPIP_MAC_PKT_ACK_ARP_NET_ERR);
+    }
+    pDest->nDropped += nPkts;
+}
+
+bool TCPIP_IPV4_ArpQueueStatGet(size_t index, TCPIP_IPV4_ARP_DEST_STAT* pStat, bool clear)
+{
+    IPV4_ARP_DEST* pDest;
+
+    if(ipv4InitCount == 0 || index >= sizeof(ipv4ArpDests) / sizeof(*ipv4ArpDests))
+    {
+        return false;
+    }
+
+    pDest = ipv4ArpDests + index;
+    TCPIP_Helper_ProtectedSingleListLock(&ipv4ArpQueue);
+    if(pDest->arpTarget.Val == 0)
+    {   // never used
+        TCPIP_Helper_ProtectedSingleListUnlock(&ipv4ArpQueue);
+        return false;
+    }
+
+    if(pStat)
+    {
+        pStat->arpTarget.Val = pDest->arpTarget.Val;
+        pStat->netIx = pDest->arpIfIx;
+        pStat->pending = TCPIP_Helper_SingleListCount(&pDest->pktList);
+        pStat->queued = pDest->nQueued;
+        pStat->flushed = pDest->nFlushed;
+        pStat->dropped = pDest->nDropped;
+    }
+    if(clear)
+    {
+        pDest->nQueued = 0;
+        pDest->nFlushed = 0;
+        pDest->nDropped = 0;
+    }
     TCPIP_Helper_ProtectedSingleListUnlock(&ipv4ArpQueue);
 
+    return true;
 }
 
 void  TCPIP_IPV4_Task(void)
@@ -2425,25 +3428,24 @@ void  TCPIP_IPV4_Task(void)
         TCPIP_IPV4_Process();
     }
 
-#if (_TCPIP_IPV4_FRAGMENTATION != 0)
+#if (_TCPIP_IPV4_FRAGMENTATION != 0) || (_TCPIP_IPV4_NAPT_ENABLE != 0)
     if((sigPend & TCPIP_MODULE_SIGNAL_TMO) != 0)
     { // regular TMO occurred
+#if (_TCPIP_IPV4_FRAGMENTATION != 0)
         TCPIP_IPV4_Timeout();
-    }
 #endif  // (_TCPIP_IPV4_FRAGMENTATION != 0)
+#if (_TCPIP_IPV4_NAPT_ENABLE != 0)
+        TCPIP_IPV4_NaptTimeout();
+#endif  // (_TCPIP_IPV4_NAPT_ENABLE != 0)
+    }
+#endif  // (_TCPIP_IPV4_FRAGMENTATION != 0) || (_TCPIP_IPV4_NAPT_ENABLE != 0)
 
 }
 
-// processes an incoming IPV4 packet
+// processes the incoming IPV4 packets
 static void TCPIP_IPV4_Process(void)
 {
-    TCPIP_NET_IF* pNetIf;
     TCPIP_MAC_PACKET* pRxPkt;
-    uint8_t      headerLen, isFragment;
-    uint16_t     headerChecksum, totalLength, payloadLen;
-    IPV4_HEADER  *pHeader;
-    IPV4_HEADER  cIpv4Hdr, *pCHeader;
-    IPV4_PKT_PROC_TYPE procType;
     TCPIP_MAC_PKT_ACK_RES ackRes;
 
     // extract queued IPv4 packets
@@ -2453,7 +3455,7 @@ static void TCPIP_IPV4_Process(void)
         if(pRxPkt->ipv4PktData != 0)
         {   // re-visited packet; forwarded first; now processed
             pRxPkt->ipv4PktData = 0;
-            ackRes = TCPIP_IPV4_DispatchPacket(pRxPkt);
+            ackRes = TCPIP_IPV4_DispatchPacket(pRxPkt, false);
             _IPv4AssertCond(ackRes == TCPIP_MAC_PKT_ACK_NONE, __func__, __LINE__);
             continue;
         }
@@ -2473,144 +3475,210 @@ static void TCPIP_IPV4_Process(void)
         }
 #endif  // (TCPIP_IPV4_EXTERN_PACKET_PROCESS != 0)
 
-        while(true)
-        {
-            ackRes = TCPIP_MAC_PKT_ACK_NONE;
+        ackRes = TCPIP_IPV4_RxPacketProcess(pRxPkt, false);
 
-            pHeader = (IPV4_HEADER*)pRxPkt->pNetLayer;
-            // Make sure that this is an IPv4 packet.
-            if((pHeader->Version) != IPv4_VERSION)
-            {
-                ackRes = TCPIP_MAC_PKT_ACK_STRUCT_ERR;
-                break;
-            }
+        if(ackRes != TCPIP_MAC_PKT_ACK_NONE)
+        {   // something wrong; discard
+            TCPIP_PKT_PacketAcknowledge(pRxPkt, ackRes); 
+        }
+    }
 
-            // make sure the header length is within packet limits
-            headerLen = pHeader->IHL << 2;
-            if(headerLen < sizeof(IPV4_HEADER) || (uint16_t)headerLen > pRxPkt->pDSeg->segLen)
-            {
-                ackRes = TCPIP_MAC_PKT_ACK_STRUCT_ERR;
-                break;
-            }
-            totalLength = TCPIP_Helper_ntohs(pHeader->TotalLength);
-            if(totalLength < (uint16_t)headerLen)
-            {
-                ackRes = TCPIP_MAC_PKT_ACK_STRUCT_ERR;
-                break;
-            }
-            payloadLen = TCPIP_PKT_PayloadLen(pRxPkt);
-            if(totalLength > payloadLen)
-            {
-                ackRes = TCPIP_MAC_PKT_ACK_STRUCT_ERR;
-                break;
-            }
+}
 
-            // detect the proper alias interface
-            pNetIf = _TCPIPStackMapAliasInterface((TCPIP_NET_IF*)pRxPkt->pktIf, &pHeader->DestAddress);
-            pRxPkt->pktIf = pNetIf;
+// processes an incoming IPV4 packet
+// rxInline: the packet is processed to completion, from the stack manager
+// returns TCPIP_MAC_PKT_ACK_NONE if the packet was processed
+// an error code  (< 0) if the packet needs to be discarded
+static TCPIP_MAC_PKT_ACK_RES TCPIP_IPV4_RxPacketProcess(TCPIP_MAC_PACKET* pRxPkt, bool rxInline)
+{
+    TCPIP_NET_IF* pNetIf;
+    uint8_t      headerLen, isFragment;
+    uint16_t     headerChecksum, totalLength, payloadLen;
+    IPV4_HEADER  *pHeader;
+    IPV4_HEADER  cIpv4Hdr, *pCHeader;
+    IPV4_PKT_PROC_TYPE procType;
+    TCPIP_MAC_PKT_ACK_RES ackRes;
 
-            if(!TCPIP_STACK_NetworkIsUp(pNetIf))
-            {   // discard the packet
-                ackRes = TCPIP_MAC_PKT_ACK_IP_REJECT_ERR;
-                break;
-            }
+    while(true)
+    {
+        ackRes = TCPIP_MAC_PKT_ACK_NONE;
 
-            // discard wrong source address
-            if(_TCPIPStack_IsBcastAddress(pNetIf, &pHeader->SourceAddress))
-            {   // net or limited bcast
-                ackRes = TCPIP_MAC_PKT_ACK_SOURCE_ERR;
-                break;
-            }
+        pHeader = (IPV4_HEADER*)pRxPkt->pNetLayer;
+        // Make sure that this is an IPv4 packet.
+        if((pHeader->Version) != IPv4_VERSION)
+        {
+            ackRes = TCPIP_MAC_PKT_ACK_STRUCT_ERR;
+            break;
+        }
 
-            // discard wrong destination address
-            if(pHeader->DestAddress.Val == 0)
-            {   // invalid destination
-                ackRes = TCPIP_MAC_PKT_ACK_DEST_ERR;
-                break;
-            }
+        // make sure the header length is within packet limits
+        headerLen = pHeader->IHL << 2;
+        if(headerLen < sizeof(IPV4_HEADER) || (uint16_t)headerLen > pRxPkt->pDSeg->segLen)
+        {
+            ackRes = TCPIP_MAC_PKT_ACK_STRUCT_ERR;
+            break;
+        }
+        totalLength = TCPIP_Helper_ntohs(pHeader->TotalLength);
+        if(totalLength < (uint16_t)headerLen)
+        {
+            ackRes = TCPIP_MAC_PKT_ACK_STRUCT_ERR;
+            break;
+        }
+        payloadLen = TCPIP_PKT_PayloadLen(pRxPkt);
+        if(totalLength > payloadLen)
+        {
+            ackRes = TCPIP_MAC_PKT_ACK_STRUCT_ERR;
+            break;
+        }
+
+        // detect the proper alias interface
+        pNetIf = _TCPIPStackMapAliasInterface((TCPIP_NET_IF*)pRxPkt->pktIf, &pHeader->DestAddress);
+        pRxPkt->pktIf = pNetIf;
+
+        if(!TCPIP_STACK_NetworkIsUp(pNetIf))
+        {   // discard the packet
+            ackRes = TCPIP_MAC_PKT_ACK_IP_REJECT_ERR;
+            break;
+        }
+
+        // discard wrong source address
+        if(_TCPIPStack_IsBcastAddress(pNetIf, &pHeader->SourceAddress))
+        {   // net or limited bcast
+            ackRes = TCPIP_MAC_PKT_ACK_SOURCE_ERR;
+            break;
+        }
+
+        // discard wrong destination address
+        if(pHeader->DestAddress.Val == 0)
+        {   // invalid destination
+            ackRes = TCPIP_MAC_PKT_ACK_DEST_ERR;
+            break;
+        }
 
-            // Make a copy of the header for the network to host conversion
-            cIpv4Hdr = *pHeader;
-            pCHeader = &cIpv4Hdr;
-            pCHeader->TotalLength = totalLength;
-            pCHeader->FragmentInfo.val = TCPIP_Helper_ntohs(pCHeader->FragmentInfo.val);
+        // Make a copy of the header for the network to host conversion
+        cIpv4Hdr = *pHeader;
+        pCHeader = &cIpv4Hdr;
+        pCHeader->TotalLength = totalLength;
+        pCHeader->FragmentInfo.val = TCPIP_Helper_ntohs(pCHeader->FragmentInfo.val);
 
-            isFragment =  (pCHeader->FragmentInfo.MF != 0 || pCHeader->FragmentInfo.fragOffset != 0);
+        isFragment =  (pCHeader->FragmentInfo.MF != 0 || pCHeader->FragmentInfo.fragOffset != 0);
 #if (_TCPIP_IPV4_FRAGMENTATION == 0)
-            // Throw this packet away if it is a fragment.  
-            // We don't support IPv4 fragment reconstruction.
-            if(isFragment)
-            {   // discard the fragment
-                ackRes = TCPIP_MAC_PKT_ACK_STRUCT_ERR;
-                break;
-            }
+        // Throw this packet away if it is a fragment.  
+        // We don't support IPv4 fragment reconstruction.
+        if(isFragment)
+        {   // discard the fragment
+            ackRes = TCPIP_MAC_PKT_ACK_STRUCT_ERR;
+            break;
+        }
 #endif  // (_TCPIP_IPV4_FRAGMENTATION == 0)
 
-            // Validate the IP header.  If it is correct, the checksum 
-            // will come out to 0x0000 (because the header contains a 
-            // precomputed checksum).  A corrupt header will have a 
-            // nonzero checksum.
-            if((pRxPkt->pktFlags & TCPIP_MAC_PKT_FLAG_RX_CHKSUM_IP) == 0)
-            {   // cannot skip checksum calculation if not handled by MAC!
-                headerChecksum = TCPIP_Helper_CalcIPChecksum((uint8_t*)pHeader, headerLen, 0);
+        // Validate the IP header.  If it is correct, the checksum 
+        // will come out to 0x0000 (because the header contains a 
+        // precomputed checksum).  A corrupt header will have a 
+        // nonzero checksum.
+        if((pRxPkt->pktFlags & TCPIP_MAC_PKT_FLAG_RX_CHKSUM_IP) == 0)
+        {   // cannot skip checksum calculation if not handled by MAC!
+            headerChecksum = TCPIP_Helper_CalcIPChecksum((uint8_t*)pHeader, headerLen, 0);
 
-                if(headerChecksum)
-                {
-                    // Bad packet. The function caller will be notified by means of the false 
-                    // return value and it should discard the packet.
-                    ackRes = TCPIP_MAC_PKT_ACK_CHKSUM_ERR;
-                    break;
-                }
+            if(headerChecksum)
+            {
+                // Bad packet. The function caller will be notified by means of the false 
+                // return value and it should discard the packet.
+                ackRes = TCPIP_MAC_PKT_ACK_CHKSUM_ERR;
+                break;
             }
+        }
 
 
-            TCPIP_IPV4_CheckRxPkt(pRxPkt);
+        TCPIP_IPV4_CheckRxPkt(pRxPkt);
 
-            // Check the packet arrived on the proper interface and passes the filters
-            procType = TCPIP_IPV4_VerifyPkt(pNetIf, pCHeader, pRxPkt);
+#if (_TCPIP_IPV4_ACL_ENABLE != 0)
+        if(!TCPIP_IPV4_AclVerify(pRxPkt, pCHeader, headerLen))
+        {   // denied by the ACL
+            ackRes = TCPIP_MAC_PKT_ACK_IP_REJECT_ERR;
+            break;
+        }
+#endif  // (_TCPIP_IPV4_ACL_ENABLE != 0)
 
-            if((procType & IPV4_PKT_DEST_HOST) == 0)
-            {   // not processed internally; but some oter module may still need it; check the filters
-                if(TCPIP_IPV4_VerifyPktFilters(pRxPkt, headerLen))
-                {
-                    procType = IPV4_PKT_DEST_HOST;
-                }
-            }
+#if (_TCPIP_IPV4_NAPT_ENABLE != 0)
+        // replies for the NAPT connections are translated before the local delivery decision
+        TCPIP_IPV4_NaptInbound(pNetIf, pRxPkt, pCHeader, headerLen);
+#endif  // (_TCPIP_IPV4_NAPT_ENABLE != 0)
 
-#if (TCPIP_IPV4_FORWARDING_ENABLE != 0)
-            if((procType & IPV4_PKT_DEST_FWD) != 0)
-            {   // packet to be forwarded
-                if(TCPIP_IPV4_ProcessExtPkt(pNetIf, pRxPkt, procType))
-                {   // we're done
-                    break;
-                }
+        // Check the packet arrived on the proper interface and passes the filters
+        procType = TCPIP_IPV4_VerifyPkt(pNetIf, pCHeader, pRxPkt);
+
+        if((procType & IPV4_PKT_DEST_HOST) == 0)
+        {   // not processed internally; but some oter module may still need it; check the filters
+            if(TCPIP_IPV4_VerifyPktFilters(pRxPkt, headerLen))
+            {
+                procType = IPV4_PKT_DEST_HOST;
             }
-#endif  // (TCPIP_IPV4_FORWARDING_ENABLE != 0)
+        }
 
-            if((procType & (IPV4_PKT_DEST_HOST)) == 0)
-            {   // discard
-                ackRes = TCPIP_MAC_PKT_ACK_IP_REJECT_ERR;
+#if (TCPIP_IPV4_FORWARDING_ENABLE != 0)
+        if((procType & IPV4_PKT_DEST_FWD) != 0)
+        {   // packet to be forwarded
+            if(TCPIP_IPV4_ProcessExtPkt(pNetIf, pRxPkt, procType))
+            {   // we're done
                 break;
             }
+        }
+#endif  // (TCPIP_IPV4_FORWARDING_ENABLE != 0)
 
-            // valid IPv4 packet
-            ackRes = TCPIP_IPV4_DispatchPacket(pRxPkt);
+        if((procType & (IPV4_PKT_DEST_HOST)) == 0)
+        {   // discard
+            ackRes = TCPIP_MAC_PKT_ACK_IP_REJECT_ERR;
             break;
         }
 
-        if(ackRes != TCPIP_MAC_PKT_ACK_NONE)
-        {   // something wrong; discard
-            TCPIP_PKT_PacketAcknowledge(pRxPkt, ackRes); 
-        }
+        // valid IPv4 packet
+        ackRes = TCPIP_IPV4_DispatchPacket(pRxPkt, rxInline);
+        break;
+    }
+
+    return ackRes;
+}
+
+#if (_TCPIP_STACK_RX_RUN_TO_COMPLETION != 0)
+// run-to-completion processing of an IPv4 packet, called by the stack manager
+// returns false if the packet needs the regular, queued, processing; the packet is not touched
+// returns true if the packet was processed or discarded
+bool TCPIP_IPV4_RxInline(TCPIP_MAC_PACKET* pRxPkt)
+{
+    IPV4_FRAGMENT_INFO fragInfo;
+    TCPIP_MAC_PKT_ACK_RES ackRes;
+
+#if (TCPIP_IPV4_EXTERN_PACKET_PROCESS != 0)
+    if(ipv4PktHandler != 0)
+    {   // the external handler gets the packets in the IPv4 context
+        return false;
+    }
+#endif  // (TCPIP_IPV4_EXTERN_PACKET_PROCESS != 0)
+
+    fragInfo.val = TCPIP_Helper_ntohs(((IPV4_HEADER*)pRxPkt->pNetLayer)->FragmentInfo.val);
+    if(fragInfo.MF != 0 || fragInfo.fragOffset != 0)
+    {   // fragments go through the reassembly queue
+        return false;
+    }
+
+    TCPIP_PKT_FlightLogRx(pRxPkt, TCPIP_THIS_MODULE_ID);
+    ackRes = TCPIP_IPV4_RxPacketProcess(pRxPkt, true);
+    if(ackRes != TCPIP_MAC_PKT_ACK_NONE)
+    {   // something wrong; discard
+        TCPIP_PKT_PacketAcknowledge(pRxPkt, ackRes); 
     }
 
+    return true;
 }
+#endif  // (_TCPIP_STACK_RX_RUN_TO_COMPLETION != 0)
 
 // dispatch an IPv4 packet to its module
 // packet is assumed to be valid!
+// rxInline: TCP and UDP packets are delivered directly to the transport, if possible
 // returns TCPIP_MAC_PKT_ACK_NONE if packet dispatched OK
 // an error code  (< 0) otherwise 
-static TCPIP_MAC_PKT_ACK_RES TCPIP_IPV4_DispatchPacket(TCPIP_MAC_PACKET* pRxPkt)
+static TCPIP_MAC_PKT_ACK_RES TCPIP_IPV4_DispatchPacket(TCPIP_MAC_PACKET* pRxPkt, bool rxInline)
 {
     IPV4_HEADER  *pHeader;
     bool        isFragment;
@@ -2659,7 +3727,30 @@ static TCPIP_MAC_PKT_ACK_RES TCPIP_IPV4_DispatchPacket(TCPIP_MAC_PACKET* pRxPkt)
 #endif  // (_TCPIP_IPV4_FRAGMENTATION != 0)
 
     if(!isFragment)
-    {   // forward this packet and signal
+    {
+#if (_TCPIP_STACK_RX_RUN_TO_COMPLETION != 0)
+        if(rxInline && _TCPIPStackModuleRxInline(destId))
+        {   // deliver straight to the transport
+#if defined(TCPIP_STACK_USE_TCP)
+            if(destId == TCPIP_MODULE_TCP)
+            {
+                TCPIP_TCP_RxInline(pRxPkt);
+                return TCPIP_MAC_PKT_ACK_NONE;
+            }
+#endif  // defined(TCPIP_STACK_USE_TCP)
+#if defined(TCPIP_STACK_USE_UDP)
+            if(destId == TCPIP_MODULE_UDP)
+            {
+                TCPIP_UDP_RxInline(pRxPkt);
+                return TCPIP_MAC_PKT_ACK_NONE;
+            }
+#endif  // defined(TCPIP_STACK_USE_UDP)
+        }
+#else
+        (void)rxInline;
+#endif  // (_TCPIP_STACK_RX_RUN_TO_COMPLETION != 0)
+
+        // forward this packet and signal
         if(!_TCPIPStackModuleRxInsert(destId, pRxPkt, true))
         {
             return TCPIP_MAC_PKT_ACK_PROTO_DEST_ERR;
@@ -3011,6 +4102,454 @@ static bool TCPIP_IPV4_VerifyPktFilters(TCPIP_MAC_PACKET* pRxPkt, uint8_t hdrlen
     return pktOk;
 }
 
+#if (_TCPIP_IPV4_ACL_ENABLE != 0)
+// returns the index of the 1st rule that matches the packet values
+// or pAcl->nRules if none
+static int IPv4_AclMatchLinear(const IPV4_ACL_TABLE* pAcl, const uint32_t* dimVal)
+{
+    int ruleIx, dimIx;
+    const IPV4_ACL_RANGE* pRange = pAcl->pRanges;
+
+    for(ruleIx = 0; ruleIx < pAcl->nRules; ruleIx++)
+    {
+        for(dimIx = 0; dimIx < IPV4_ACL_DIMENSIONS; dimIx++, pRange++)
+        {
+            if(dimVal[dimIx] < pRange->low || dimVal[dimIx] > pRange->high)
+            {   // no match; skip the rest of the rule
+                pRange += IPV4_ACL_DIMENSIONS - dimIx;
+                break;
+            }
+        }
+
+        if(dimIx == IPV4_ACL_DIMENSIONS)
+        {   // all fields matched
+            break;
+        }
+    }
+
+    return ruleIx;
+}
+
+// same as IPv4_AclMatchLinear, using the compiled intervals
+static int IPv4_AclMatchCompiled(const IPV4_ACL_TABLE* pAcl, const uint32_t* dimVal)
+{
+    int ix, wIx, ruleIx;
+    uint32_t val, ruleMap;
+    uint16_t nLeft, half;
+    const uint32_t* pBound;
+    const uint32_t* pDimMaps[IPV4_ACL_DIMENSIONS];
+    const IPV4_ACL_DIMENSION* pDim;
+
+    // find the interval of each value
+    // the dimensions with a single interval, where all the rules match, are skipped
+    for(ix = 0; ix < pAcl->nDims; ix++)
+    {
+        pDim = pAcl->dims + pAcl->dimList[ix];
+        // binary search for the last bound <= val
+        // written so that it compiles to conditional moves rather than branches
+        val = dimVal[pAcl->dimList[ix]];
+        pBound = pDim->pBounds;
+        nLeft = pDim->nIntervals;
+        while(nLeft > 1)
+        {
+            half = nLeft / 2;
+            pBound = (pBound[half] <= val) ? pBound + half : pBound;
+            nLeft -= half;
+        }
+        pDimMaps[ix] = pDim->pMaps + (pBound - pDim->pBounds) * pAcl->nWords;
+    }
+
+    // the 1st rule present in all the intervals is the match
+    ruleIx = pAcl->nRules;
+    for(wIx = 0; wIx < pAcl->nWords; wIx++)
+    {
+        ruleMap = pDimMaps[0][wIx];
+        for(ix = 1; ix < pAcl->nDims && ruleMap != 0; ix++)
+        {
+            ruleMap &= pDimMaps[ix][wIx];
+        }
+
+        if(ruleMap != 0)
+        {
+            ruleIx = wIx * 32;
+            while((ruleMap & 1) == 0)
+            {
+                ruleMap >>= 1;
+                ruleIx++;
+            }
+            break;
+        }
+    }
+
+    return ruleIx;
+}
+
+// checks a RX packet against the ACL
+// returns true if the packet is permitted
+static bool TCPIP_IPV4_AclVerify(TCPIP_MAC_PACKET* pRxPkt, IPV4_HEADER* pCHeader, uint8_t hdrlen)
+{
+    int ruleIx;
+    uint32_t dimVal[IPV4_ACL_DIMENSIONS];
+    IPV4_ACL_TABLE* pAcl;
+    uint8_t action;
+    bool freeAcl;
+
+    if(ipv4AclTable == 0)
+    {   // no ACL
+        return true;
+    }
+
+    OSAL_CRITSECT_DATA_TYPE status = OSAL_CRIT_Enter(OSAL_CRIT_TYPE_LOW);
+    pAcl = ipv4AclTable;
+    if(pAcl != 0)
+    {
+        pAcl->nUsers++;
+    }
+    OSAL_CRIT_Leave(OSAL_CRIT_TYPE_LOW, status);
+
+    if(pAcl == 0)
+    {   // removed in the meantime
+        return true;
+    }
+
+    // get the packet values
+    dimVal[IPV4_ACL_DIM_SRC_ADDRESS] = TCPIP_Helper_ntohl(pCHeader->SourceAddress.Val);
+    dimVal[IPV4_ACL_DIM_DEST_ADDRESS] = TCPIP_Helper_ntohl(pCHeader->DestAddress.Val);
+    dimVal[IPV4_ACL_DIM_PROTOCOL] = pCHeader->Protocol;
+    dimVal[IPV4_ACL_DIM_SRC_PORT] = 0;
+    dimVal[IPV4_ACL_DIM_DEST_PORT] = 0;
+    dimVal[IPV4_ACL_DIM_IF] = _TCPIPStackNetIxGet((TCPIP_NET_IF*)pRxPkt->pktIf);
+
+    if((pCHeader->Protocol == IP_PROT_TCP || pCHeader->Protocol == IP_PROT_UDP) && pCHeader->FragmentInfo.fragOffset == 0)
+    {   // TCP and UDP headers start with the source and destination ports
+        if(pRxPkt->pDSeg->segLen >= hdrlen + 4)
+        {
+            uint8_t* pPorts = pRxPkt->pNetLayer + hdrlen;
+            dimVal[IPV4_ACL_DIM_SRC_PORT] = ((uint32_t)pPorts[0] << 8) | pPorts[1];
+            dimVal[IPV4_ACL_DIM_DEST_PORT] = ((uint32_t)pPorts[2] << 8) | pPorts[3];
+        }
+    }
+
+    ruleIx = (pAcl->pRanges != 0) ? IPv4_AclMatchLinear(pAcl, dimVal) : IPv4_AclMatchCompiled(pAcl, dimVal);
+
+    pAcl->ruleHits[ruleIx]++;
+    action = (ruleIx == pAcl->nRules) ? pAcl->defAction : pAcl->actions[ruleIx];
+
+    status = OSAL_CRIT_Enter(OSAL_CRIT_TYPE_LOW);
+    freeAcl = --pAcl->nUsers == 0 && pAcl != ipv4AclTable;
+    OSAL_CRIT_Leave(OSAL_CRIT_TYPE_LOW, status);
+
+    if(freeAcl)
+    {   // replaced while in use
+        TCPIP_HEAP_Free(ipv4MemH, pAcl);
+    }
+
+    return action == TCPIP_IPV4_ACL_ACTION_PERMIT;
+}
+
+TCPIP_IPV4_RES TCPIP_IPV4_AclSet(const TCPIP_IPV4_ACL_RULE* pRules, size_t nRules, TCPIP_IPV4_ACL_ACTION defAction)
+{
+    IPV4_ACL_TABLE *pNewAcl, *pOldAcl;
+    TCPIP_IPV4_RES aclRes;
+    bool freeAcl;
+
+    if(ipv4MemH == 0)
+    {   // not initialized
+        return TCPIP_IPV4_RES_INIT_VAL_ERR;
+    }
+
+    if(nRules != 0)
+    {
+        if(pRules == 0 || nRules > _TCPIP_IPV4_ACL_MAX_RULES || (defAction != TCPIP_IPV4_ACL_ACTION_PERMIT && defAction != TCPIP_IPV4_ACL_ACTION_DENY))
+        {
+            return TCPIP_IPV4_RES_ACL_RULE_ERR;
+        }
+
+        pNewAcl = IPv4_AclCompile(pRules, nRules, defAction, &aclRes);
+        if(pNewAcl == 0)
+        {
+            return aclRes;
+        }
+    }
+    else
+    {
+        pNewAcl = 0;
+    }
+
+    OSAL_CRITSECT_DATA_TYPE status = OSAL_CRIT_Enter(OSAL_CRIT_TYPE_LOW);
+    pOldAcl = ipv4AclTable;
+    ipv4AclTable = pNewAcl;
+    // if in use, the last RX user will free it
+    freeAcl = pOldAcl != 0 && pOldAcl->nUsers == 0;
+    OSAL_CRIT_Leave(OSAL_CRIT_TYPE_LOW, status);
+
+    if(freeAcl)
+    {
+        TCPIP_HEAP_Free(ipv4MemH, pOldAcl);
+    }
+
+    return TCPIP_IPV4_RES_OK;
+}
+
+bool TCPIP_IPV4_AclRuleHitsGet(size_t ruleIx, uint32_t* pHits, bool clear)
+{
+    bool hitsRes = false;
+
+    OSAL_CRITSECT_DATA_TYPE status = OSAL_CRIT_Enter(OSAL_CRIT_TYPE_LOW);
+    IPV4_ACL_TABLE* pAcl = ipv4AclTable;
+    if(pAcl != 0 && ruleIx <= pAcl->nRules)
+    {
+        if(pHits)
+        {
+            *pHits = pAcl->ruleHits[ruleIx];
+        }
+        if(clear)
+        {
+            pAcl->ruleHits[ruleIx] = 0;
+        }
+        hitsRes = true;
+    }
+    OSAL_CRIT_Leave(OSAL_CRIT_TYPE_LOW, status);
+
+    return hitsRes;
+}
+
+// converts an ACL rule to the matching value range for each dimension
+static TCPIP_IPV4_RES IPv4_AclRuleRanges(const TCPIP_IPV4_ACL_RULE* pRule, IPV4_ACL_RANGE* pRanges)
+{
+    uint32_t netMask, invMask;
+    TCPIP_NET_IF* pNetIf;
+
+    if(pRule->action != TCPIP_IPV4_ACL_ACTION_PERMIT && pRule->action != TCPIP_IPV4_ACL_ACTION_DENY)
+    {
+        return TCPIP_IPV4_RES_ACL_RULE_ERR;
+    }
+
+    // addresses
+    netMask = TCPIP_Helper_ntohl(pRule->srcMask);
+    invMask = ~netMask;
+    if((invMask & (invMask + 1)) != 0)
+    {   // not contiguous
+        return TCPIP_IPV4_RES_MASK_ERR;
+    }
+    pRanges[IPV4_ACL_DIM_SRC_ADDRESS].low = TCPIP_Helper_ntohl(pRule->srcAddress) & netMask;
+    pRanges[IPV4_ACL_DIM_SRC_ADDRESS].high = pRanges[IPV4_ACL_DIM_SRC_ADDRESS].low | invMask;
+
+    netMask = TCPIP_Helper_ntohl(pRule->destMask);
+    invMask = ~netMask;
+    if((invMask & (invMask + 1)) != 0)
+    {   // not contiguous
+        return TCPIP_IPV4_RES_MASK_ERR;
+    }
+    pRanges[IPV4_ACL_DIM_DEST_ADDRESS].low = TCPIP_Helper_ntohl(pRule->destAddress) & netMask;
+    pRanges[IPV4_ACL_DIM_DEST_ADDRESS].high = pRanges[IPV4_ACL_DIM_DEST_ADDRESS].low | invMask;
+
+    // protocol
+    // a field that matches any value takes the whole range, so that it adds no interval bounds
+    pRanges[IPV4_ACL_DIM_PROTOCOL].low = pRule->protocol;
+    pRanges[IPV4_ACL_DIM_PROTOCOL].high = pRule->protocol == 0 ? 0xffffffff : pRule->protocol;
+
+    // ports
+    if(pRule->srcPortMin > pRule->srcPortMax || pRule->destPortMin > pRule->destPortMax)
+    {
+        return TCPIP_IPV4_RES_ACL_RULE_ERR;
+    }
+    pRanges[IPV4_ACL_DIM_SRC_PORT].low = pRule->srcPortMin;
+    pRanges[IPV4_ACL_DIM_SRC_PORT].high = pRule->srcPortMax == 0 ? 0xffffffff : pRule->srcPortMax;
+    pRanges[IPV4_ACL_DIM_DEST_PORT].low = pRule->destPortMin;
+    pRanges[IPV4_ACL_DIM_DEST_PORT].high = pRule->destPortMax == 0 ? 0xffffffff : pRule->destPortMax;
+
+    // interface
+    if(pRule->netH == 0)
+    {
+        pRanges[IPV4_ACL_DIM_IF].low = 0;
+        pRanges[IPV4_ACL_DIM_IF].high = 0xffffffff;
+    }
+    else
+    {
+        pNetIf = _TCPIPStackHandleToNet(pRule->netH);
+        if(pNetIf == 0)
+        {
+            return TCPIP_IPV4_RES_IF_ERR;
+        }
+        pRanges[IPV4_ACL_DIM_IF].low = pRanges[IPV4_ACL_DIM_IF].high = _TCPIPStackNetIxGet(pNetIf);
+    }
+
+    return TCPIP_IPV4_RES_OK;
+}
+
+// sorting function for the interval bounds
+static int _AclBoundCompare(const void* p1, const void* p2)
+{
+    uint32_t b1 = *(const uint32_t*)p1;
+    uint32_t b2 = *(const uint32_t*)p2;
+
+    return b1 < b2 ? -1 : (b1 > b2 ? 1 : 0);
+}
+
+// compiles the ACL rules into a IPV4_ACL_TABLE
+// returns 0 and the error in pRes if failed
+static IPV4_ACL_TABLE* IPv4_AclCompile(const TCPIP_IPV4_ACL_RULE* pRules, size_t nRules, TCPIP_IPV4_ACL_ACTION defAction, TCPIP_IPV4_RES* pRes)
+{
+    int ruleIx;
+    size_t aclSize;
+    IPV4_ACL_RANGE *pRanges, *pRange;
+    uint32_t *pTmpBounds, *pAclData;
+    uint8_t* pActions;
+    IPV4_ACL_TABLE* pAcl;
+
+    // scratch memory: the rule ranges and the interval bounds for all dimensions
+    pRanges = (IPV4_ACL_RANGE*)TCPIP_HEAP_Malloc(ipv4MemH, nRules * IPV4_ACL_DIMENSIONS * sizeof(*pRanges) + IPV4_ACL_DIMENSIONS * (2 * nRules + 1) * sizeof(*pTmpBounds));
+    if(pRanges == 0)
+    {
+        *pRes = TCPIP_IPV4_RES_MEM_ERR;
+        return 0;
+    }
+    pTmpBounds = (uint32_t*)(pRanges + nRules * IPV4_ACL_DIMENSIONS);
+
+    pRange = pRanges;
+    for(ruleIx = 0; ruleIx < nRules; ruleIx++, pRange += IPV4_ACL_DIMENSIONS)
+    {
+        if((*pRes = IPv4_AclRuleRanges(pRules + ruleIx, pRange)) != TCPIP_IPV4_RES_OK)
+        {
+            TCPIP_HEAP_Free(ipv4MemH, pRanges);
+            return 0;
+        }
+    }
+
+    aclSize = sizeof(*pAcl) + (nRules + 1) * sizeof(*pAcl->ruleHits) + nRules;
+    if(nRules <= _TCPIP_IPV4_ACL_LINEAR_RULES)
+    {   // small ACL; the rule ranges are scanned in order
+        aclSize += nRules * IPV4_ACL_DIMENSIONS * sizeof(*pRanges);
+        pAcl = (IPV4_ACL_TABLE*)TCPIP_HEAP_Calloc(ipv4MemH, 1, aclSize);
+        if(pAcl != 0)
+        {
+            pAcl->ruleHits = (uint32_t*)(pAcl + 1);
+            pAcl->pRanges = (IPV4_ACL_RANGE*)(pAcl->ruleHits + nRules + 1);
+            memcpy((IPV4_ACL_RANGE*)pAcl->pRanges, pRanges, nRules * IPV4_ACL_DIMENSIONS * sizeof(*pRanges));
+            pAclData = (uint32_t*)(pAcl->pRanges + nRules * IPV4_ACL_DIMENSIONS);
+        }
+    }
+    else
+    {
+        pAcl = IPv4_AclCompileIntervals(pRanges, pTmpBounds, nRules, aclSize, &pAclData);
+    }
+
+    TCPIP_HEAP_Free(ipv4MemH, pRanges);
+    if(pAcl == 0)
+    {
+        *pRes = TCPIP_IPV4_RES_MEM_ERR;
+        return 0;
+    }
+
+    pAcl->nRules = nRules;
+    pAcl->defAction = (uint8_t)defAction;
+    pActions = (uint8_t*)pAclData;
+    for(ruleIx = 0; ruleIx < nRules; ruleIx++)
+    {
+        pActions[ruleIx] = pRules[ruleIx].action;
+    }
+    pAcl->actions = pActions;
+
+    *pRes = TCPIP_IPV4_RES_OK;
+    return pAcl;
+}
+
+// builds a compiled ACL from the rule ranges
+// pTmpBounds is scratch memory for the interval bounds of all dimensions
+// aclSize is the size of the table without the intervals
+// returns 0 if out of memory
+// pAclData is updated with the data following the intervals
+static IPV4_ACL_TABLE* IPv4_AclCompileIntervals(const IPV4_ACL_RANGE* pRanges, uint32_t* pTmpBounds, size_t nRules, size_t aclSize, uint32_t** pAclData)
+{
+    int ruleIx, dimIx, bIx, nBounds;
+    uint16_t nWords, nIntervals[IPV4_ACL_DIMENSIONS];
+    const IPV4_ACL_RANGE* pRange;
+    uint32_t *pBounds, *pMap, *pData;
+    IPV4_ACL_TABLE* pAcl;
+    IPV4_ACL_DIMENSION* pDim;
+
+    // build the sorted, unique, interval bounds for each dimension
+    nWords = (nRules + 31) / 32;
+    for(dimIx = 0; dimIx < IPV4_ACL_DIMENSIONS; dimIx++)
+    {
+        pBounds = pTmpBounds + dimIx * (2 * nRules + 1);
+        nBounds = 0;
+        pBounds[nBounds++] = 0;
+        for(ruleIx = 0; ruleIx < nRules; ruleIx++)
+        {
+            pRange = pRanges + ruleIx * IPV4_ACL_DIMENSIONS + dimIx;
+            pBounds[nBounds++] = pRange->low;
+            if(pRange->high != 0xffffffff)
+            {
+                pBounds[nBounds++] = pRange->high + 1;
+            }
+        }
+        qsort(pBounds, nBounds, sizeof(*pBounds), _AclBoundCompare);
+
+        nIntervals[dimIx] = 1;
+        for(bIx = 1; bIx < nBounds; bIx++)
+        {
+            if(pBounds[bIx] != pBounds[nIntervals[dimIx] - 1])
+            {
+                pBounds[nIntervals[dimIx]++] = pBounds[bIx];
+            }
+        }
+
+        aclSize += nIntervals[dimIx] * (1 + nWords) * sizeof(uint32_t);
+    }
+
+    pAcl = (IPV4_ACL_TABLE*)TCPIP_HEAP_Calloc(ipv4MemH, 1, aclSize);
+    if(pAcl == 0)
+    {
+        return 0;
+    }
+
+    pAcl->nWords = nWords;
+    pAcl->ruleHits = (uint32_t*)(pAcl + 1);
+    pData = pAcl->ruleHits + nRules + 1;
+
+    // set the dimension intervals and rule bitmaps
+    pDim = pAcl->dims;
+    for(dimIx = 0; dimIx < IPV4_ACL_DIMENSIONS; dimIx++, pDim++)
+    {
+        pBounds = pData;
+        memcpy(pBounds, pTmpBounds + dimIx * (2 * nRules + 1), nIntervals[dimIx] * sizeof(*pBounds));
+        pData += nIntervals[dimIx];
+        pMap = pData;
+        pData += nIntervals[dimIx] * nWords;
+
+        pDim->pBounds = pBounds;
+        pDim->pMaps = pMap;
+        pDim->nIntervals = nIntervals[dimIx];
+        if(nIntervals[dimIx] > 1)
+        {   // needs a lookup
+            pAcl->dimList[pAcl->nDims++] = dimIx;
+        }
+
+        for(bIx = 0; bIx < nIntervals[dimIx]; bIx++, pMap += nWords)
+        {   // an interval is either fully inside or outside a rule range
+            for(ruleIx = 0; ruleIx < nRules; ruleIx++)
+            {
+                pRange = pRanges + ruleIx * IPV4_ACL_DIMENSIONS + dimIx;
+                if(pRange->low <= pBounds[bIx] && pBounds[bIx] <= pRange->high)
+                {
+                    pMap[ruleIx / 32] |= 1UL << (ruleIx % 32);
+                }
+            }
+        }
+    }
+
+    if(pAcl->nDims == 0)
+    {   // all the rules match any packet; keep one dimension for the bitmaps
+        pAcl->dimList[pAcl->nDims++] = 0;
+    }
+
+    *pAclData = pData;
+    return pAcl;
+}
+#endif  // (_TCPIP_IPV4_ACL_ENABLE != 0)
+
 IPV4_FILTER_HANDLE IPv4RegisterFilter(IPV4_FILTER_FUNC handler, bool active)
 {
     IPV4_FILTER_LIST_NODE* newNode = 0;
@@ -3253,7 +4792,7 @@ bool  TCPIP_IPV4_MacPacketTransmit(TCPIP_MAC_PACKET* pPkt, TCPIP_NET_HANDLE hNet
     }
 
     // check valid interface
-    pNetIf = TCPIP_IPV4_CheckPktTx(pNetIf, pPkt);
+    pNetIf = TCPIP_IPV4_CheckPktTx(pNetIf, pPkt, false);
     if(pNetIf == 0)
     {   // cannot transmit over invalid interface
         return false;
@@ -3469,33 +5008,42 @@ bool TCPIP_IPV4_IsFragmentationEnabled(void)
 // checks fragments timeouts
 static void TCPIP_IPV4_Timeout(void)
 {
+    int ix;
     uint32_t tickFreq, currTick;
-    IPV4_FRAGMENT_NODE *pF;
-    SINGLE_LIST     newList;
+    IPV4_FRAGMENT_NODE *pF, *pPrev, *pNext;
+    SINGLE_LIST*    pBucket;
     
-    TCPIP_Helper_SingleListInitialize(&newList);
+    if(ipv4FragmentStreams == 0)
+    {   // nothing to purge
+        return;
+    }
+
     tickFreq = SYS_TMR_TickCounterFrequencyGet();
     currTick = SYS_TMR_TickCountGet();
 
-    while((pF = (IPV4_FRAGMENT_NODE*)TCPIP_Helper_SingleListHeadRemove(&ipv4FragmentQueue)) != 0)
+    pBucket = ipv4FragmentHash;
+    for(ix = 0; ix < sizeof(ipv4FragmentHash) / sizeof(*ipv4FragmentHash); ix++, pBucket++)
     {
-        if(currTick - pF->fragTStart > pF->fragTmo * tickFreq)
-        {   // expired node; remove
-            _IPv4FragmentDbg(pF, 0, TCPIP_IPV4_FRAG_DISCARD_TMO);
-            TCPIP_IPV4_RxFragmentDiscard(pF, TCPIP_MAC_PKT_ACK_FRAGMENT_ERR);
-        }
-        else
+        pPrev = 0;
+        for(pF = (IPV4_FRAGMENT_NODE*)pBucket->head; pF != 0; pF = pNext)
         {
-            TCPIP_Helper_SingleListHeadAdd(&newList, (SGL_LIST_NODE*)pF);
+            pNext = pF->next;
+            if(currTick - pF->fragTStart > pF->fragTmo * tickFreq)
+            {   // expired node; remove
+                TCPIP_Helper_SingleListNextRemove(pBucket, (SGL_LIST_NODE*)pPrev);
+                _IPv4FragmentDbg(pF, 0, TCPIP_IPV4_FRAG_DISCARD_TMO);
+                TCPIP_IPV4_RxFragmentDiscard(pF, TCPIP_MAC_PKT_ACK_FRAGMENT_ERR);
+            }
+            else
+            {
+                pPrev = pF;
+            }
         }
     }
-
-    // replace lists
-    ipv4FragmentQueue = newList;
 }
 
 
-// inserts a new fragment to the ipv4FragmentQueue 
+// inserts a new fragment to the ipv4FragmentHash 
 // returns TCPIP_MAC_PKT_ACK_NONE if successful insertion/processing
 //      ppFrag points to 0 if nothing else is required (intermediary fragment)
 //      ppFrag points to a valid complete fragment that needs to be reassembled and passed to the user
@@ -3506,7 +5054,9 @@ static TCPIP_MAC_PKT_ACK_RES TCPIP_IPV4_RxFragmentInsert(TCPIP_MAC_PACKET* pRxPk
 {
     IPV4_FRAGMENT_NODE *pF, *pParent, *pPrevParent;
     IPV4_HEADER *pFHdr, *pRxHdr;
-    uint16_t rxMin, rxMax, nextMin;   
+    uint16_t rxMin, rxMax;   
+    SINGLE_LIST* pBucket;
+    IPV4_FRAGMENT_SOURCE* pSource;
 
     // minimal check 
     pRxHdr = (IPV4_HEADER*)pRxPkt->pNetLayer;
@@ -3519,7 +5069,8 @@ static TCPIP_MAC_PKT_ACK_RES TCPIP_IPV4_RxFragmentInsert(TCPIP_MAC_PACKET* pRxPk
 
     *ppFrag = 0;
     pParent = pPrevParent = 0;
-    for(pF = (IPV4_FRAGMENT_NODE*)ipv4FragmentQueue.head; pF != 0; pF = pF->next)
+    pBucket = ipv4FragmentHash + _IPv4FragmentHash(pRxHdr);
+    for(pF = (IPV4_FRAGMENT_NODE*)pBucket->head; pF != 0; pF = pF->next)
     {
         pFHdr = (IPV4_HEADER*)pF->fragHead->pNetLayer;
         if(pFHdr->Identification == pRxHdr->Identification && pFHdr->SourceAddress.Val == pRxHdr->SourceAddress.Val &&
@@ -3533,11 +5084,17 @@ static TCPIP_MAC_PKT_ACK_RES TCPIP_IPV4_RxFragmentInsert(TCPIP_MAC_PACKET* pRxPk
 
     if(pParent == 0)
     {   // brand new fragment packet
-        if(TCPIP_Helper_SingleListCount(&ipv4FragmentQueue) >= TCPIP_IPV4_FRAGMENT_MAX_STREAMS)
+        if(ipv4FragmentStreams >= TCPIP_IPV4_FRAGMENT_MAX_STREAMS)
         {   // don't start another fragmented stream
             return TCPIP_MAC_PKT_ACK_FRAGMENT_ERR;
         }
 
+        pSource = TCPIP_IPV4_RxFragmentSource(&pRxHdr->SourceAddress);
+        if(pSource == 0 || pSource->nFrags >= _TCPIP_IPV4_FRAGMENT_SOURCE_QUOTA)
+        {   // this source is over its quota
+            return TCPIP_MAC_PKT_ACK_FRAGMENT_ERR;
+        }
+
         IPV4_FRAGMENT_NODE*  newNode = (IPV4_FRAGMENT_NODE*)TCPIP_HEAP_Calloc(ipv4MemH, 1, sizeof(*newNode));
 
         if(newNode == 0)
@@ -3549,25 +5106,34 @@ static TCPIP_MAC_PKT_ACK_RES TCPIP_IPV4_RxFragmentInsert(TCPIP_MAC_PACKET* pRxPk
         newNode->fragTStart = SYS_TMR_TickCountGet();  
         newNode->fragTmo =  TCPIP_IPV4_FRAGMENT_TIMEOUT;
         newNode->nFrags =  1;
+        newNode->rcvLen = pRxPkt->totTransportLen;
+        newNode->totLen = pRxHdr->FragmentInfo.MF == 0 ? rxMax : 0;
+        newNode->pSource = pSource;
+        if(pSource->nStreams++ == 0)
+        {   // new source entry
+            pSource->srcAddress.Val = pRxHdr->SourceAddress.Val;
+        }
+        pSource->nFrags++;
+        ipv4FragmentStreams++;
 
         _IPv4FragmentDbg(newNode, pRxPkt, TCPIP_IPV4_FRAG_CREATED);
-        TCPIP_Helper_SingleListTailAdd(&ipv4FragmentQueue, (SGL_LIST_NODE*)newNode);  
+        TCPIP_Helper_SingleListTailAdd(pBucket, (SGL_LIST_NODE*)newNode);  
         return TCPIP_MAC_PKT_ACK_NONE;
     }
 
     // this is just a new fragment;
     if(pParent->nFrags >= TCPIP_IPV4_FRAGMENT_MAX_NUMBER)
     {   // more fragments than allowed
-        TCPIP_Helper_SingleListNextRemove(&ipv4FragmentQueue, (SGL_LIST_NODE*)pPrevParent);
+        TCPIP_Helper_SingleListNextRemove(pBucket, (SGL_LIST_NODE*)pPrevParent);
         _IPv4FragmentDbg(pParent, pRxPkt, TCPIP_IPV4_FRAG_DISCARD_EXCEEDED);
         TCPIP_IPV4_RxFragmentDiscard(pParent, TCPIP_MAC_PKT_ACK_FRAGMENT_ERR);
         return TCPIP_MAC_PKT_ACK_FRAGMENT_ERR;
     }
 
-    // adjust the time
-    if(pRxHdr->TimeToLive > pParent->fragTmo)
-    {
-        pParent->fragTmo = pRxHdr->TimeToLive;
+    pSource = pParent->pSource;
+    if(pSource->nFrags >= _TCPIP_IPV4_FRAGMENT_SOURCE_QUOTA)
+    {   // this source is over its quota; drop the fragment, the stream will time out if not completed
+        return TCPIP_MAC_PKT_ACK_FRAGMENT_ERR;
     }
 
     // a new fragment needs to be inserted in the proper place
@@ -3577,6 +5143,31 @@ static TCPIP_MAC_PKT_ACK_RES TCPIP_IPV4_RxFragmentInsert(TCPIP_MAC_PACKET* pRxPk
     uint16_t currMin, currMax;   
     bool fragOverlap = false;
 
+    if(pParent->totLen != 0)
+    {   // the last fragment was received; nothing goes past it
+        if(rxMax > pParent->totLen || (pRxHdr->FragmentInfo.MF == 0 && rxMax != pParent->totLen))
+        {   // inconsistent fragment; drop it
+            return TCPIP_MAC_PKT_ACK_FRAGMENT_ERR;
+        }
+    }
+    else if(pRxHdr->FragmentInfo.MF == 0)
+    {   // the last fragment sets the total length
+        // the fragments are ordered; the last one in the list has the highest end
+        for(pCurrPkt = pParent->fragHead; pCurrPkt->pkt_next != 0; pCurrPkt = pCurrPkt->pkt_next);
+        pCurrHdr = (IPV4_HEADER*)pCurrPkt->pNetLayer;
+        if(pCurrHdr->FragmentInfo.fragOffset * 8 + pCurrPkt->totTransportLen > rxMax)
+        {   // data past the end of the datagram; drop it
+            return TCPIP_MAC_PKT_ACK_FRAGMENT_ERR;
+        }
+        pParent->totLen = rxMax;
+    }
+
+    // adjust the time
+    if(pRxHdr->TimeToLive > pParent->fragTmo)
+    {
+        pParent->fragTmo = pRxHdr->TimeToLive;
+    }
+
     // insert in proper place
     pPrevPkt = 0;
     for(pCurrPkt = pParent->fragHead; pCurrPkt != 0; pCurrPkt = pNextPkt)
@@ -3623,6 +5214,8 @@ static TCPIP_MAC_PKT_ACK_RES TCPIP_IPV4_RxFragmentInsert(TCPIP_MAC_PACKET* pRxPk
                 }
                 _IPv4FragmentDbg(pParent, pCurrPkt, TCPIP_IPV4_FRAG_DISCARD_OVERLAP);
                 pParent->nFrags--;
+                pSource->nFrags--;
+                pParent->rcvLen -= pCurrPkt->totTransportLen;
                 TCPIP_PKT_PacketAcknowledge(pCurrPkt, TCPIP_MAC_PKT_ACK_FRAGMENT_ERR); 
                 continue;
             }
@@ -3631,14 +5224,18 @@ static TCPIP_MAC_PKT_ACK_RES TCPIP_IPV4_RxFragmentInsert(TCPIP_MAC_PACKET* pRxPk
                 pCurrHdr->FragmentInfo.fragOffset += ld / 8;
                 pCurrPkt->totTransportLen -= ld;
                 pCurrPkt->pTransportLayer += ld;
+                pParent->rcvLen -= ld;
             }
             else if(le == 0)
             {   // partial overlap; discard at the end of current
                 pCurrPkt->totTransportLen -= ld;
+                pParent->rcvLen -= ld;
             }
             else
             {   // lb!= 0 && le != 0; total overlap; rx < current; keep begin + discard + keep end
+                // the end part moves to rx and it's accounted for when rx is inserted
                 pCurrPkt->totTransportLen -= ld + le;
+                pParent->rcvLen -= ld + le;
                 // copy the end part to rx; consider packets spanning multiple segments!
                 TCPIP_MAC_DATA_SEGMENT* pDestSeg = TCPIP_PKT_DataSegmentGet(pRxPkt, pRxPkt->pTransportLayer +  pRxPkt->totTransportLen, true);
                 _IPv4AssertCond(pDestSeg != 0, __func__, __LINE__);
@@ -3683,44 +5280,35 @@ static TCPIP_MAC_PKT_ACK_RES TCPIP_IPV4_RxFragmentInsert(TCPIP_MAC_PACKET* pRxPk
     _IPv4FragmentDbg(pParent, pRxPkt, fragOverlap ? TCPIP_IPV4_FRAG_INSERT_OVERLAP:  TCPIP_IPV4_FRAG_INSERTED);
     pRxPkt->next = 0; 
     pParent->nFrags++;
+    pSource->nFrags++;
+    pParent->rcvLen += pRxPkt->totTransportLen;
 
     // check for packet completion
-    bool pktDone = false;
-    pCurrPkt = pParent->fragHead;
-    pCurrHdr = (IPV4_HEADER*)pCurrPkt->pNetLayer;
-    if(pCurrHdr->FragmentInfo.MF != 0 && pCurrHdr->FragmentInfo.fragOffset == 0)
-    {   // at least 2 frags and 1st fragment is in place
-        for( ; pCurrPkt != 0; pCurrPkt = pNextPkt)
-        {
-            pNextPkt = pCurrPkt->pkt_next;
-            pCurrHdr = (IPV4_HEADER*)pCurrPkt->pNetLayer;
-            // check if gap
-
-            if(pNextPkt)
-            {
-                currMax = pCurrHdr->FragmentInfo.fragOffset * 8 + pCurrPkt->totTransportLen;
-                nextMin = ((IPV4_HEADER*)pNextPkt->pNetLayer)->FragmentInfo.fragOffset * 8;
-                if(currMax != nextMin)
-                {   // gap
-                    break;
-                }
-            }
+    // the fragments in the list are disjoint and within the total length,
+    // so the whole payload could be present only when the covered length matches the total length
+    // the counters only rule out an incomplete datagram; matching counters still need the chain walk below,
+    // so the completion check is not O(1): it costs a walk over nFrags fragments once the counters match
+    if(pParent->totLen == 0 || pParent->rcvLen != pParent->totLen)
+    {   // not yet
+        return TCPIP_MAC_PKT_ACK_NONE;
+    }
 
-            // no gap
-            if(pCurrHdr->FragmentInfo.MF == 0)
-            {   // last packet is here; we're done; 
-                _IPv4AssertCond(pNextPkt == 0, __func__, __LINE__);
-                pktDone = true;
-                break;
-            }
+    // make sure the chain is complete: the 1st fragment in place, no gaps, up to the total length
+    currMax = 0;
+    for(pCurrPkt = pParent->fragHead; pCurrPkt != 0; pCurrPkt = pCurrPkt->pkt_next)
+    {
+        pCurrHdr = (IPV4_HEADER*)pCurrPkt->pNetLayer;
+        if(pCurrHdr->FragmentInfo.fragOffset * 8 != currMax)
+        {   // gap or missing the 1st fragment
+            break;
         }
+        currMax += pCurrPkt->totTransportLen;
     }
-    // else no way, missing the 1st fragment
 
-    if(pktDone)
+    if(pCurrPkt == 0 && currMax == pParent->totLen)
     {   // completed; remove the packet from the list
         *ppFrag = pParent;
-        TCPIP_Helper_SingleListNextRemove(&ipv4FragmentQueue, (SGL_LIST_NODE*)pPrevParent);
+        TCPIP_Helper_SingleListNextRemove(pBucket, (SGL_LIST_NODE*)pPrevParent);
         TCPIP_IPV4_RxFragmentDiscard(pParent, TCPIP_MAC_PKT_ACK_NONE);    // segments are still valid but the node itself is deleted
         _IPv4FragmentDbg(pParent, 0, TCPIP_IPV4_FRAG_COMPLETE);
     }
@@ -3730,10 +5318,16 @@ static TCPIP_MAC_PKT_ACK_RES TCPIP_IPV4_RxFragmentInsert(TCPIP_MAC_PACKET* pRxPk
 
 // if ackRes != TCPIP_MAC_PKT_ACK_NONE, it acknowledges all the packets in the fragment node
 // then deallocates the node itself
-// node should have been removed from the ipv4FragmentQueue!
+// node should have been removed from the ipv4FragmentHash!
 static void TCPIP_IPV4_RxFragmentDiscard(IPV4_FRAGMENT_NODE* pFrag, TCPIP_MAC_PKT_ACK_RES ackRes)
 {
     TCPIP_MAC_PACKET *pPkt, *pPktNext;
+    IPV4_FRAGMENT_SOURCE* pSource = pFrag->pSource;
+
+    // the fragments are no longer held by the reassembly
+    pSource->nFrags -= pFrag->nFrags;
+    pSource->nStreams--;
+    ipv4FragmentStreams--;
 
     if(ackRes != TCPIP_MAC_PKT_ACK_NONE)
     {   // acknowledge the segments too
@@ -3747,9 +5341,7 @@ static void TCPIP_IPV4_RxFragmentDiscard(IPV4_FRAGMENT_NODE* pFrag, TCPIP_MAC_PK
     TCPIP_HEAP_Free(ipv4MemH, pFrag);
 }
 
-// purges the ipv4FragmentQueue 
-// if pRxPkt == 0, then it purges everything
-// otherwise it looks for a specific packet 
+// purges a ipv4FragmentHash bucket
 static void TCPIP_IPV4_RxFragmentListPurge(SINGLE_LIST* pL)
 {
     IPV4_FRAGMENT_NODE* pF;
@@ -3760,6 +5352,34 @@ static void TCPIP_IPV4_RxFragmentListPurge(SINGLE_LIST* pL)
     }
 }
 
+// returns the accounting entry for a fragments source address
+// a new entry is returned if the source is not in use
+// 0 if no entry available
+static IPV4_FRAGMENT_SOURCE* TCPIP_IPV4_RxFragmentSource(const IPV4_ADDR* pSrcAdd)
+{
+    int ix;
+    IPV4_FRAGMENT_SOURCE *pSource, *pFree;
+
+    pFree = 0;
+    pSource = ipv4FragmentSources;
+    for(ix = 0; ix < sizeof(ipv4FragmentSources) / sizeof(*ipv4FragmentSources); ix++, pSource++)
+    {
+        if(pSource->nStreams == 0)
+        {
+            if(pFree == 0)
+            {
+                pFree = pSource;
+            }
+        }
+        else if(pSource->srcAddress.Val == pSrcAdd->Val)
+        {
+            return pSource;
+        }
+    }
+
+    return pFree;
+}
+
 
 // fragment transmit functionality
 
@@ -125,6 +125,13 @@ void                    TCPIP_IPV4_MacPacketSwitchTxToRx(TCPIP_MAC_PACKET* pRxPk
 // Otherwise, the pMacPkt will be used if ARP queuing needed
 bool TCPIP_IPV4_PktTx(IPV4_PACKET* pPkt, TCPIP_MAC_PACKET* pMacPkt, bool isPersistent);
 
+#if (_TCPIP_STACK_RX_RUN_TO_COMPLETION != 0)
+// run-to-completion processing of a RX packet, called by the stack manager
+// returns false if the packet needs the regular, queued, processing
+// fragments and packets for an external handler are not processed inline
+bool TCPIP_IPV4_RxInline(TCPIP_MAC_PACKET* pRxPkt);
+#endif  // (_TCPIP_STACK_RX_RUN_TO_COMPLETION != 0)
+
 #endif // _IPV4_MANAGER_H_
 
 
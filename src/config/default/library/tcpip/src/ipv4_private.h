@@ -79,18 +79,122 @@ typedef struct  _TAG_IPV4_FILTER_LIST_NODE
     uint8_t                             reserved[3];// not used
 }IPV4_FILTER_LIST_NODE;
 
+// IPv4 ACL
+#if defined(TCPIP_IPV4_ACL_ENABLE) && (TCPIP_IPV4_ACL_ENABLE != 0)
+#define _TCPIP_IPV4_ACL_ENABLE      1
+#else
+#define _TCPIP_IPV4_ACL_ENABLE      0
+#endif
+
+// max number of rules in the ACL
+#if defined(TCPIP_IPV4_ACL_MAX_RULES) && (TCPIP_IPV4_ACL_MAX_RULES != 0)
+#define _TCPIP_IPV4_ACL_MAX_RULES   TCPIP_IPV4_ACL_MAX_RULES
+#else
+#define _TCPIP_IPV4_ACL_MAX_RULES   32      // default value
+#endif
+
+// ACLs with up to this number of rules are scanned linearly
+// larger ACLs are compiled into intervals and bitmaps
+#if defined(TCPIP_IPV4_ACL_LINEAR_RULES)
+#define _TCPIP_IPV4_ACL_LINEAR_RULES    TCPIP_IPV4_ACL_LINEAR_RULES
+#else
+#define _TCPIP_IPV4_ACL_LINEAR_RULES    8       // default value
+#endif
+
+// packet fields an ACL rule matches
+typedef enum
+{
+    IPV4_ACL_DIM_SRC_ADDRESS,       // source address, host order
+    IPV4_ACL_DIM_DEST_ADDRESS,      // destination address, host order
+    IPV4_ACL_DIM_PROTOCOL,          // IPv4 protocol
+    IPV4_ACL_DIM_SRC_PORT,          // TCP/UDP source port
+    IPV4_ACL_DIM_DEST_PORT,         // TCP/UDP destination port
+    IPV4_ACL_DIM_IF,                // interface index
+
+    IPV4_ACL_DIMENSIONS             // number of fields
+}IPV4_ACL_DIM;
+
+// a rule matches an interval of values in each dimension
+typedef struct
+{
+    uint32_t    low;
+    uint32_t    high;
+}IPV4_ACL_RANGE;
+
+// compiled ACL dimension
+// the dimension values are split into elementary intervals: no rule starts or ends inside an interval
+// each interval has a bitmap of the rules that match it
+typedef struct
+{
+    const uint32_t* pBounds;        // start value of each interval, ascending; pBounds[0] == 0
+    const uint32_t* pMaps;          // nIntervals bitmaps, nWords each; bit n set if rule n matches
+    uint16_t        nIntervals;     // number of intervals
+    uint16_t        reserved;       // not used
+}IPV4_ACL_DIMENSION;
+
+// ACL table
+// a linear ACL stores the rule ranges, checked in order
+// a compiled ACL: a packet matches the rules that are set in all the dimension bitmaps
+// the lowest such rule is the one that applies
+// allocated as one block:
+//      IPV4_ACL_TABLE
+//      uint32_t ruleHits[nRules + 1]
+//      linear:     IPV4_ACL_RANGE ranges[nRules * IPV4_ACL_DIMENSIONS]
+//      compiled:   uint32_t bounds[] and maps[] for each dimension
+//      uint8_t actions[nRules]
+typedef struct
+{
+    IPV4_ACL_DIMENSION  dims[IPV4_ACL_DIMENSIONS];
+    const IPV4_ACL_RANGE* pRanges;      // rule ranges for a linear ACL; 0 for a compiled one
+    uint32_t*           ruleHits;       // hits per rule; ruleHits[nRules] for the default action
+    const uint8_t*      actions;        // TCPIP_IPV4_ACL_ACTION per rule
+    uint16_t            nRules;         // number of rules
+    uint16_t            nWords;         // number of 32 bit words in a rule bitmap
+    uint16_t            nUsers;         // RX evaluations in progress; protected by critical section
+    uint8_t             defAction;      // TCPIP_IPV4_ACL_ACTION when no rule matches
+    uint8_t             nDims;          // compiled dimensions that need a lookup: more than 1 interval
+    uint8_t             dimList[IPV4_ACL_DIMENSIONS];   // indexes of these dimensions
+}IPV4_ACL_TABLE;
+
 
 
 // IPv4 fragment reassembly
 
+// number of buckets in the reassembly hash
+#if defined(TCPIP_IPV4_FRAGMENT_HASH_BUCKETS) && (TCPIP_IPV4_FRAGMENT_HASH_BUCKETS != 0)
+#define _TCPIP_IPV4_FRAGMENT_HASH_BUCKETS       TCPIP_IPV4_FRAGMENT_HASH_BUCKETS
+#else
+#define _TCPIP_IPV4_FRAGMENT_HASH_BUCKETS       8       // default value
+#endif
+
+// max number of fragments held in reassembly for the same source address
+// across all of its streams
+#if defined(TCPIP_IPV4_FRAGMENT_SOURCE_QUOTA) && (TCPIP_IPV4_FRAGMENT_SOURCE_QUOTA != 0)
+#define _TCPIP_IPV4_FRAGMENT_SOURCE_QUOTA       TCPIP_IPV4_FRAGMENT_SOURCE_QUOTA
+#else
+#define _TCPIP_IPV4_FRAGMENT_SOURCE_QUOTA       (2 * TCPIP_IPV4_FRAGMENT_MAX_NUMBER)    // default value
+#endif
+
+// per source accounting of the fragments held in reassembly
+typedef struct
+{
+    IPV4_ADDR   srcAddress;     // source address
+    uint16_t    nStreams;       // number of reassembly streams from this source; 0 means free entry
+    uint16_t    nFrags;         // number of fragments held for this source
+}IPV4_FRAGMENT_SOURCE;
+
 typedef struct _TAG_IPV4_FRAGMENT_NODE
 {
-    struct _TAG_IPV4_FRAGMENT_NODE* next;       // next fragment node: ipv4FragmentQueue 
+    struct _TAG_IPV4_FRAGMENT_NODE* next;       // next fragment node: ipv4FragmentHash bucket
     TCPIP_MAC_PACKET*               fragHead;   // head fragments list; connected with pkt_next;
     uint32_t                        fragTStart; // fragment occurring tick 
     uint16_t                        nFrags;     // number of fragments in this node
     uint16_t                        fragTmo;    // fragment expiration timeout, seconds
-    
+    IPV4_FRAGMENT_SOURCE*           pSource;    // source accounting entry
+    uint16_t                        rcvLen;     // number of payload bytes covered by the fragments
+                                                // fragments in the list never overlap
+    uint16_t                        totLen;     // total payload length; known when the last fragment arrives
+                                                // 0 otherwise
 }IPV4_FRAGMENT_NODE;
 
 
@@ -177,6 +281,35 @@ typedef struct _tag_IPV4_ARP_ENTRY
     IPV4_ADDR               arpTarget;  // ARP resolution target
 }IPV4_ARP_ENTRY;
 
+// max number of destinations that can have packets waiting for ARP resolution at the same time
+#if defined(TCPIP_IPV4_ARP_QUEUE_DESTINATIONS) && (TCPIP_IPV4_ARP_QUEUE_DESTINATIONS != 0)
+#define _TCPIP_IPV4_ARP_QUEUE_DESTINATIONS      TCPIP_IPV4_ARP_QUEUE_DESTINATIONS
+#else
+#define _TCPIP_IPV4_ARP_QUEUE_DESTINATIONS      8       // default value
+#endif
+
+// max number of packets queued for the same destination
+// when the limit is reached the oldest packet is dropped
+#if defined(TCPIP_IPV4_ARP_QUEUE_DEST_PACKETS) && (TCPIP_IPV4_ARP_QUEUE_DEST_PACKETS != 0)
+#define _TCPIP_IPV4_ARP_QUEUE_DEST_PACKETS      TCPIP_IPV4_ARP_QUEUE_DEST_PACKETS
+#else
+#define _TCPIP_IPV4_ARP_QUEUE_DEST_PACKETS      4       // default value
+#endif
+
+// destination with packets waiting for ARP resolution
+// the IPV4_ARP_ENTRY packets are kept in the queuing order
+typedef struct _tag_IPV4_ARP_DEST
+{
+    struct _tag_IPV4_ARP_DEST* next;    // SGL_LIST_NODE safe cast
+    SINGLE_LIST             pktList;    // list of IPV4_ARP_ENTRY waiting for this destination, oldest first
+    IPV4_ADDR               arpTarget;  // ARP resolution target; 0 if the slot was never used
+    uint8_t                 arpIfIx;    // index of the interface for which ARP is queued
+    uint8_t                 reserved[3];// not used
+    uint32_t                nQueued;    // packets queued for this destination
+    uint32_t                nFlushed;   // packets transmitted when the ARP was resolved
+    uint32_t                nDropped;   // packets dropped: queue full, ARP failure, TX error
+}IPV4_ARP_DEST;
+
 
 // routing
 
@@ -213,15 +346,52 @@ typedef enum
 
 }IPV4_FORWARD_RUN_FLAGS;
 
+// node of the forwarding table longest prefix match trie
+// path compressed binary trie: a node exists only for a route prefix
+// or where 2 prefixes branch; prefixes are in host order
+// nodes are referenced by their index in the trie array; the root is at index 0
+typedef struct
+{
+    uint32_t                prefix;         // node prefix, masked to prefixLen bits
+    int16_t                 routeIx;        // index of the route in fwdTable; < 0 if no route for this prefix
+    int16_t                 child[2];       // next node for a 0/1 bit following the prefix; < 0 if none
+    uint8_t                 prefixLen;      // number of significant bits in prefix: 0 - 32
+    uint8_t                 reserved[3];    // not used
+}IPV4_FWD_TRIE_NODE;
+
+// number of entries in the per interface flow cache
+#if defined(TCPIP_IPV4_FORWARDING_FLOW_CACHE_SIZE) && (TCPIP_IPV4_FORWARDING_FLOW_CACHE_SIZE != 0)
+#define _TCPIP_IPV4_FWD_FLOW_CACHE_SIZE         TCPIP_IPV4_FORWARDING_FLOW_CACHE_SIZE
+#else
+#define _TCPIP_IPV4_FWD_FLOW_CACHE_SIZE         8       // default value
+#endif
+
+// flow cache entry
+// the cache is per input interface, so the key is (destination, input interface)
+// the route is valid as long as the forwarding table doesn't change
+// the MAC address is valid until an ARP event for the next hop
+typedef struct
+{
+    uint32_t                destAddress;    // destination address, network order
+    uint32_t                nextHop;        // ARP target the destMacAdd belongs to: destination or gateway
+    int16_t                 routeIx;        // index of the route in fwdTable; < 0 if invalid entry
+    uint8_t                 outIfIx;        // output interface
+    uint8_t                 macValid;       // the destMacAdd is resolved and can be used
+    TCPIP_MAC_ADDR          destMacAdd;     // next hop MAC address
+}IPV4_FWD_FLOW_ENTRY;
+
 // IP forwarding descriptor per interface
 typedef struct
 {
     IPV4_ROUTE_TABLE_ENTRY* fwdTable;       // forwarding table itself
+    IPV4_FWD_TRIE_NODE*     fwdTrie;        // longest prefix match trie built over the fwdTable
     uint16_t                usedEntries;    // number of entries that are used 
     uint16_t                totEntries;     // total number of entries
+    uint16_t                trieNodes;      // number of trie nodes in use
     uint16_t                iniFlags;       // TCPIP_IPV4_FORWARD_FLAGS: initialization flags
     uint8_t                 runFlags;       // IPV4_FORWARD_RUN_FLAGS: initialization flags
     uint8_t                 saveFlags;      // IPV4_FORWARD_RUN_FLAGS: save flags when messing with the FIB
+    IPV4_FWD_FLOW_ENTRY     flowCache[_TCPIP_IPV4_FWD_FLOW_CACHE_SIZE];  // destination flow cache
 }IPV4_FORWARD_DESCRIPTOR;
 
 // overall structure of the forward descriptor:
@@ -233,6 +403,11 @@ typedef struct
 //      IPV4_ROUTE_TABLE_ENTRY[forwardTableMaxEntries] for if1
 //      ...
 //      IPV4_ROUTE_TABLE_ENTRY[forwardTableMaxEntries] for ifn
+//      IPV4_FWD_TRIE_NODE[2 * forwardTableMaxEntries + 1] for if0
+//      ...
+//      IPV4_FWD_TRIE_NODE[2 * forwardTableMaxEntries + 1] for ifn
+//
+// each route adds at most 2 nodes to the trie: its own and a branch node
 
 // forwarded packets that need to also be processed locally
 // these are bcast/mcast packets
@@ -249,6 +424,118 @@ typedef struct _tag_IPV4_FORWARD_NODE
 }IPV4_FORWARD_NODE;
 
 
+// NAPT: the hosts behind the private interfaces share the address of an outside interface
+// needs forwarding
+#if defined(TCPIP_IPV4_NAPT_ENABLE) && (TCPIP_IPV4_NAPT_ENABLE != 0) && (TCPIP_IPV4_FORWARDING_ENABLE != 0)
+#define _TCPIP_IPV4_NAPT_ENABLE     1
+#else
+#define _TCPIP_IPV4_NAPT_ENABLE     0
+#endif
+
+#if (_TCPIP_IPV4_NAPT_ENABLE != 0)
+// number of translations; the table is allocated at initialization and never grows
+#if defined(TCPIP_IPV4_NAPT_ENTRIES) && (TCPIP_IPV4_NAPT_ENTRIES != 0)
+#define _TCPIP_IPV4_NAPT_ENTRIES            TCPIP_IPV4_NAPT_ENTRIES
+#else
+#define _TCPIP_IPV4_NAPT_ENTRIES            32      // default value
+#endif
+
+// number of buckets in the outbound lookup hash
+#if defined(TCPIP_IPV4_NAPT_HASH_BUCKETS) && (TCPIP_IPV4_NAPT_HASH_BUCKETS != 0)
+#define _TCPIP_IPV4_NAPT_HASH_BUCKETS       TCPIP_IPV4_NAPT_HASH_BUCKETS
+#else
+#define _TCPIP_IPV4_NAPT_HASH_BUCKETS       16      // default value
+#endif
+
+// outside ports used for the translations: [start, start + range)
+// should not overlap the TCP/UDP local ports of the stack itself
+#if defined(TCPIP_IPV4_NAPT_PORT_START) && (TCPIP_IPV4_NAPT_PORT_START != 0)
+#define _TCPIP_IPV4_NAPT_PORT_START         TCPIP_IPV4_NAPT_PORT_START
+#else
+#define _TCPIP_IPV4_NAPT_PORT_START         40000   // default value
+#endif
+
+#if defined(TCPIP_IPV4_NAPT_PORT_RANGE) && (TCPIP_IPV4_NAPT_PORT_RANGE != 0)
+#define _TCPIP_IPV4_NAPT_PORT_RANGE         TCPIP_IPV4_NAPT_PORT_RANGE
+#else
+#define _TCPIP_IPV4_NAPT_PORT_RANGE         8192    // default value
+#endif
+
+#if (_TCPIP_IPV4_NAPT_PORT_RANGE < _TCPIP_IPV4_NAPT_ENTRIES) || (_TCPIP_IPV4_NAPT_PORT_START + _TCPIP_IPV4_NAPT_PORT_RANGE > 65536)
+#error "IPv4 NAPT: the port range should cover at least one port per entry and fit within 65535"
+#endif
+
+// translation timeouts, seconds
+#if defined(TCPIP_IPV4_NAPT_TCP_TIMEOUT) && (TCPIP_IPV4_NAPT_TCP_TIMEOUT != 0)
+#define _TCPIP_IPV4_NAPT_TCP_TIMEOUT        TCPIP_IPV4_NAPT_TCP_TIMEOUT
+#else
+#define _TCPIP_IPV4_NAPT_TCP_TIMEOUT        600     // default value
+#endif
+
+// TCP connection that was reset or closed in both directions
+#if defined(TCPIP_IPV4_NAPT_TCP_CLOSE_TIMEOUT) && (TCPIP_IPV4_NAPT_TCP_CLOSE_TIMEOUT != 0)
+#define _TCPIP_IPV4_NAPT_TCP_CLOSE_TIMEOUT  TCPIP_IPV4_NAPT_TCP_CLOSE_TIMEOUT
+#else
+#define _TCPIP_IPV4_NAPT_TCP_CLOSE_TIMEOUT  10      // default value
+#endif
+
+#if defined(TCPIP_IPV4_NAPT_UDP_TIMEOUT) && (TCPIP_IPV4_NAPT_UDP_TIMEOUT != 0)
+#define _TCPIP_IPV4_NAPT_UDP_TIMEOUT        TCPIP_IPV4_NAPT_UDP_TIMEOUT
+#else
+#define _TCPIP_IPV4_NAPT_UDP_TIMEOUT        60      // default value
+#endif
+
+#if defined(TCPIP_IPV4_NAPT_ICMP_TIMEOUT) && (TCPIP_IPV4_NAPT_ICMP_TIMEOUT != 0)
+#define _TCPIP_IPV4_NAPT_ICMP_TIMEOUT       TCPIP_IPV4_NAPT_ICMP_TIMEOUT
+#else
+#define _TCPIP_IPV4_NAPT_ICMP_TIMEOUT       30      // default value
+#endif
+
+// number of outside ports owned by each entry
+#define _TCPIP_IPV4_NAPT_PORT_GENERATIONS   (_TCPIP_IPV4_NAPT_PORT_RANGE / _TCPIP_IPV4_NAPT_ENTRIES)
+
+// TCP connection state of a translation
+typedef enum
+{
+    IPV4_NAPT_TCP_FIN_OUT   = 0x01,     // FIN seen from the inside host
+    IPV4_NAPT_TCP_FIN_IN    = 0x02,     // FIN seen from the remote host
+    IPV4_NAPT_TCP_RST       = 0x04,     // RST seen in any direction
+}IPV4_NAPT_TCP_STATE;
+
+// NAPT translation entry
+// a connection is identified by (protocol, inside address, inside port, remote address, remote port)
+// for ICMP echo the ports are (identifier, 0)
+// the entry index selects the outside port: each entry owns the outside ports
+//      start + index + k * _TCPIP_IPV4_NAPT_ENTRIES
+// so the inbound lookup is direct, with no search
+typedef struct _tag_IPV4_NAPT_ENTRY
+{
+    struct _tag_IPV4_NAPT_ENTRY*    next;           // SGL_LIST_NODE safe cast: hash bucket or free list
+    uint32_t                        insideAddress;  // inside host address, network order
+    uint32_t                        remoteAddress;  // remote host address, network order
+    uint32_t                        tExpire;        // tick when the entry expires
+    uint16_t                        insidePort;     // inside host port or ICMP identifier, network order
+    uint16_t                        remotePort;     // remote host port, network order; 0 for ICMP
+    uint16_t                        outsidePort;    // translated port or ICMP identifier, network order
+    uint8_t                         protocol;       // IP_PROT_TCP, IP_PROT_UDP, IP_PROT_ICMP; 0 if unused
+    uint8_t                         tcpState;       // IPV4_NAPT_TCP_STATE value
+}IPV4_NAPT_ENTRY;
+
+// NAPT descriptor
+// allocated at initialization, in one block
+typedef struct
+{
+    SINGLE_LIST             hash[_TCPIP_IPV4_NAPT_HASH_BUCKETS];   // outbound lookup of the used entries
+    SINGLE_LIST             freeList;       // unused entries
+    uint32_t                scanTick;       // tick of the last timeout scan
+    volatile int16_t        reqIfIx;        // outside interface set by the user; < 0 if disabled
+    int16_t                 outIfIx;        // outside interface in use by the translations; < 0 if disabled
+    TCPIP_IPV4_NAPT_STAT    stat;           // run time statistics
+    IPV4_NAPT_ENTRY         entries[_TCPIP_IPV4_NAPT_ENTRIES];
+}IPV4_NAPT_DCPT;
+#endif  // (_TCPIP_IPV4_NAPT_ENABLE != 0)
+
+
 
 #endif // _IPV4_PRIVATE_H_
 
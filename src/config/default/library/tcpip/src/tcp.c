@@ -65,6 +65,13 @@ Microchip or any third party.
 #define TCP_OPTIONS_END_OF_LIST     (0x00u)     // End of List TCP Option Flag
 #define TCP_OPTIONS_NO_OP           (0x01u)     // No Op TCP Option
 #define TCP_OPTIONS_MAX_SEG_SIZE    (0x02u)     // Maximum segment size TCP flag
+#define TCP_OPTIONS_SACK_PERMITTED  (0x04u)     // SACK permitted TCP option
+#define TCP_OPTIONS_SACK            (0x05u)     // SACK TCP option
+#define TCP_OPTIONS_WINDOW_SCALE    (0x03u)     // Window scale TCP option
+#define TCP_OPTIONS_TIMESTAMP       (0x08u)     // Timestamps TCP option
+#define TCP_MAX_WINDOW_SHIFT        (14u)       // maximum window scale shift, RFC 7323
+#define TCP_RCV_WINDOW_SHIFT        (0u)        // our window scale shift: the RX FIFO size is limited to TCP_MAX_RX_BUFF_SIZE
+#define TCP_OPTIONS_MAX_SIZE        (40u)       // maximum size of the TCP header options
 typedef struct
 {
     uint8_t        Kind;                            // Type of option
@@ -107,6 +114,20 @@ typedef enum
 
 static TCB_STUB** TCBStubs = 0;
 
+// socket demultiplexing hash tables
+// sockets are chained by their remoteHash value
+static TCB_STUB*  tcpListenHash[_TCP_SOCKET_HASH_BUCKETS];     // listening sockets; remoteHash == localPort
+static TCB_STUB*  tcpConnHash[_TCP_SOCKET_HASH_BUCKETS];       // connected/connecting sockets
+
+// socket timer wheel
+// a socket is linked in the slot where its earliest timeout falls
+// so that the periodic tick processes only the sockets that have something to do
+static TCB_STUB*    tcpTmrWheel[_TCP_TIMER_WHEEL_SLOTS];
+static int          tcpTmrSlot;                     // next slot to be processed
+static uint32_t     tcpTmrTime;                     // tick when tcpTmrSlot needs to be processed
+static uint32_t     tcpTmrSlotTicks;                // number of system ticks covered by a slot
+static TCP_SOCKET*  tcpTmrDue = 0;                  // expired sockets collected by the tick; TcpSockets entries
+
 static int        tcpLockCount = 0;                 // lock protection counter
 static int        tcpInitCount = 0;                 // initialization counter
 
@@ -131,6 +152,30 @@ static const void* tcpPktHandlerParam;
 #endif  // (TCPIP_TCP_EXTERN_PACKET_PROCESS != 0)
 
 static uint32_t             sysTickFreq;            // the system tick counter frequency; frequently used 
+static uint32_t             tcpTsTickDiv;           // system ticks per timestamp clock tick (1 ms)
+
+#if (_TCP_SYN_BACKLOG_ENABLE)
+// SYN backlog
+// the half-open connections to the listening sockets
+// accessed only from the stack thread: RX processing and tick
+static TCP_SYN_ENTRY        tcpSynBacklog[_TCP_SYN_BACKLOG_SIZE];
+static uint32_t             tcpSynSecret[16 / 4];   // 128 bits key for the ISN and SYN cookies
+static TCP_SYN_BACKLOG_STAT tcpSynStat;
+static uint32_t             tcpSynStatTime;         // tick when the statistics were cleared
+#endif  // (_TCP_SYN_BACKLOG_ENABLE)
+
+#if (_TCP_TIME_WAIT_ENABLE)
+// compact TIME_WAIT table
+// the closing connections that released their sockets
+// accessed only from the stack thread: RX processing and tick
+static TCP_TW_ENTRY         tcpTwTable[_TCP_TIME_WAIT_SIZE];
+static uint32_t             tcpTwReleased;          // sockets released to the table
+static uint32_t             tcpTwEvicted;           // entries discarded to make room
+#endif  // (_TCP_TIME_WAIT_ENABLE)
+
+#if (_TCP_AUTO_TUNE)
+static uint32_t             tcpAutoTuneTime;        // tick of the last buffers auto-tune pass
+#endif  // (_TCP_AUTO_TUNE)
 
 /****************************************************************************
   Section:
@@ -144,6 +189,31 @@ static void _TcpSwapHeader(TCP_HEADER* header);
 static void _TcpCloseSocket(TCB_STUB* pSkt, TCPIP_TCP_SIGNAL_TYPE tcpEvent);
 static void _TcpSocketInitialize(TCB_STUB* pSkt, TCP_SOCKET hTCP, uint8_t* txBuff, uint16_t txBuffSize, uint8_t* rxBuff, uint16_t rxBuffSize);
 static void _TcpSocketSetIdleState(TCB_STUB* pSkt);
+static void _TcpSocketHashUpdate(TCB_STUB* pSkt);
+static void _TcpTimerUpdate(TCB_STUB* pSkt);
+#if (_TCP_SACK_ENABLE)
+static uint16_t _TcpSackOptionSet(TCB_STUB* pSkt, uint8_t* pOpt, int maxBlocks);
+#endif  // (_TCP_SACK_ENABLE)
+static uint16_t _TcpTimestampOptionSet(TCB_STUB* pSkt, uint8_t* pOpt);
+#if (_TCP_SYN_BACKLOG_ENABLE)
+static void _TcpSynBacklogInit(void);
+static bool _TcpSynBacklogRx(TCPIP_MAC_PACKET* pRxPkt, TCB_STUB* pListenSkt, const IPV4_ADDR* remoteIP, const IPV4_ADDR* localIP, TCP_SYN_ENTRY* pSyn);
+static void _TcpSynBacklogPromote(TCB_STUB* pSkt, const TCP_SYN_ENTRY* pSyn);
+static void _TcpSynBacklogTick(uint32_t tickNow);
+#endif  // (_TCP_SYN_BACKLOG_ENABLE)
+
+#if (_TCP_TIME_WAIT_ENABLE)
+static bool _TcpTimeWaitEnter(TCB_STUB* pSkt);
+static bool _TcpTimeWaitRx(TCPIP_MAC_PACKET* pRxPkt, const IPV4_ADDR* remoteIP);
+static void _TcpTimeWaitTick(uint32_t tickNow);
+#endif  // (_TCP_TIME_WAIT_ENABLE)
+
+#if (TCPIP_TCP_DYNAMIC_OPTIONS != 0)
+static bool _TcpFifoSizeAdjust(TCB_STUB* pSkt, uint16_t wMinRXSize, uint16_t wMinTXSize, TCP_ADJUST_FLAGS vFlags);
+#endif  // (TCPIP_TCP_DYNAMIC_OPTIONS != 0)
+#if (_TCP_AUTO_TUNE)
+static void _TcpAutoTune(uint32_t tickNow);
+#endif  // (_TCP_AUTO_TUNE)
 
 #if (TCPIP_STACK_DOWN_OPERATION != 0)
 static void _TcpCleanup(void);
@@ -174,6 +244,8 @@ static void         TCPIP_TCP_Tick(void);
 
 static void         TCPIP_TCP_Process(void);
 
+static void         TCPIP_TCP_RxPacketProcess(TCPIP_MAC_PACKET* pRxPkt);
+
 static TCP_PORT     _TCP_EphemeralPortAllocate(void);
 static bool         _TCP_PortIsAvailable(TCP_PORT port);
 
@@ -199,7 +271,11 @@ static TCP_V4_PACKET*   _Tcpv4AllocateTxPacketIfQueued(TCB_STUB * pSkt, bool res
 static void             _Tcpv4TxAckFnc (TCPIP_MAC_PACKET * pPkt, const void * param);
 static void             _Tcpv4UnlinkDataSeg(TCP_V4_PACKET* pPkt);
 static void             _Tcpv4LinkDataSeg(TCP_V4_PACKET* pPkt, uint8_t* pBuff1, uint16_t bSize1, uint8_t* pBuff2, uint16_t bSize2);
-static bool             _TCPv4Flush(TCB_STUB * pSkt, IPV4_PACKET* pv4Pkt, uint16_t hdrLen, uint16_t loadLen);
+static bool             _TCPv4Flush(TCB_STUB * pSkt, IPV4_PACKET* pv4Pkt, uint16_t hdrLen, uint16_t loadLen, uint16_t loadSum, TCPIP_MAC_PACKET* pBurst);
+#if (_TCP_TX_BURST > 1)
+static TCPIP_MAC_PACKET* _Tcpv4BurstBuild(TCB_STUB* pSkt, const TCP_HEADER* pHdr, uint16_t hdrLen, uint16_t segLen);
+static void             _Tcpv4BurstAckFnc (TCPIP_MAC_PACKET * pPkt, const void * param);
+#endif  // (_TCP_TX_BURST > 1)
 static TCP_V4_PACKET*   _TxSktGetLockedV4Pkt(TCB_STUB* pSkt);
 static TCPIP_MAC_PACKET *_TxSktFreeLockedV4Pkt(TCB_STUB* pSkt);
 static TCPIP_MAC_PKT_ACK_RES TCPIP_TCP_ProcessIPv4(TCPIP_MAC_PACKET* pRxPkt);
@@ -227,12 +303,24 @@ static bool         _TCP_RxPktValidate(TCPIP_MAC_PACKET* pRxPkt);
 static bool         _TCP_TxPktValid(TCB_STUB * pSkt);
 
 static void         _TCP_PayloadSet(TCB_STUB * stub, void* pPkt, uint8_t* payload1, uint16_t len1, uint8_t* payload2, uint16_t len2);
-static bool         _TCP_Flush(TCB_STUB * pSkt, void* pPkt, uint16_t hdrLen, uint16_t loadLen);
+static bool         _TCP_Flush(TCB_STUB * pSkt, void* pPkt, uint16_t hdrLen, uint16_t loadLen, uint16_t loadSum, TCPIP_MAC_PACKET* pBurst);
 
 static bool         _TcpFlush(TCB_STUB* pSkt);
 
 static void         _TcpDiscardTx(TCB_STUB* pSkt);
 
+static void         _TcpPutFlush(TCB_STUB* pSkt, uint16_t freeSpace);
+
+#if (_TCP_TX_CHKSUM_CACHE)
+static void         _TcpTxChkCopy(TCB_STUB* pSkt, uint8_t* pDst, const uint8_t* pSrc, uint16_t len);
+#endif  // (_TCP_TX_CHKSUM_CACHE)
+
+#if (_TCP_TX_REF_ENABLE)
+static uint8_t*     _TcpTxRefSource(TCB_STUB* pSkt, uint32_t* pLen);
+static void         _TcpTxRefAck(TCB_STUB* pSkt, const uint8_t* oldTail, uint32_t ackBytes);
+static void         _TcpTxRefRelease(TCB_STUB* pSkt, bool acked);
+#endif  // (_TCP_TX_REF_ENABLE)
+
 static uint16_t     _TCPIsPutReady(TCB_STUB* pSkt);
 
 static uint16_t     _TCPIsGetReady(TCB_STUB* pSkt);
@@ -334,6 +422,166 @@ static void _TcpSocketBind(TCB_STUB* pSkt, TCPIP_NET_IF* pNet, IP_MULTI_ADDRESS*
 }
 
 
+// (re)links a socket in the proper demultiplexing hash bucket
+// based on its current state and remoteHash
+// should be called whenever any of these changes
+static void _TcpSocketHashUpdate(TCB_STUB* pSkt)
+{
+    TCB_STUB    **pHead, **pPrev;
+    TCB_STUB    *pNode;
+
+    switch(pSkt->smState)
+    {
+        case TCPIP_TCP_STATE_LISTEN:
+            pHead = tcpListenHash + (pSkt->remoteHash % _TCP_SOCKET_HASH_BUCKETS);
+            break;
+
+        case TCPIP_TCP_STATE_CLIENT_WAIT_CONNECT:
+        case TCPIP_TCP_STATE_KILLED:
+            // not available for incoming traffic
+            pHead = 0;
+            break;
+
+        default:
+            pHead = tcpConnHash + (pSkt->remoteHash % _TCP_SOCKET_HASH_BUCKETS);
+            break;
+    }
+
+    OSAL_CRITSECT_DATA_TYPE status = OSAL_CRIT_Enter(OSAL_CRIT_TYPE_LOW);
+    if(pHead != pSkt->hashHead)
+    {
+        if(pSkt->hashHead != 0)
+        {   // unlink from the old bucket
+            for(pPrev = pSkt->hashHead; (pNode = *pPrev) != 0; pPrev = &pNode->hashNext)
+            {
+                if(pNode == pSkt)
+                {
+                    *pPrev = pSkt->hashNext;
+                    break;
+                }
+            }
+        }
+
+        if(pHead != 0)
+        {   // link into the new one
+            pSkt->hashNext = *pHead;
+            *pHead = pSkt;
+        }
+        pSkt->hashHead = pHead;
+    }
+    OSAL_CRIT_Leave(OSAL_CRIT_TYPE_LOW, status);
+}
+
+// sets the socket remote hash and updates the demultiplexing tables
+static void _TcpSocketRemoteHashSet(TCB_STUB* pSkt, uint16_t remoteHash)
+{
+    pSkt->remoteHash = remoteHash;
+    _TcpSocketHashUpdate(pSkt);
+}
+
+// (re)links a socket in the timer wheel slot
+// corresponding to its earliest enabled timeout
+// should be called whenever any of the socket timers or its state changes
+static void _TcpTimerUpdate(TCB_STUB* pSkt)
+{
+    TCB_STUB    **pHead, **pPrev;
+    TCB_STUB    *pNode;
+    uint32_t    tmrTime, slotOffs;
+    bool        tmrSet;
+
+    tmrTime = 0;
+    tmrSet = false;
+
+    if(pSkt->smState != TCPIP_TCP_STATE_KILLED && pSkt->smState != TCPIP_TCP_STATE_CLIENT_WAIT_CONNECT)
+    {
+        if(pSkt->Flags.bTXASAP || pSkt->Flags.bTXASAPWithoutTimerReset)
+        {   // needs processing right away
+            tmrTime = SYS_TMR_TickCountGet();
+            tmrSet = true;
+        }
+        else
+        {
+            if(pSkt->Flags.bTimer2Enabled)
+            {
+                tmrTime = pSkt->eventTime2;
+                tmrSet = true;
+            }
+
+            if(pSkt->Flags.bDelayedACKTimerEnabled)
+            {
+                if(!tmrSet || (int32_t)(pSkt->delayedACKTime - tmrTime) < 0)
+                {
+                    tmrTime = pSkt->delayedACKTime;
+                }
+                tmrSet = true;
+            }
+
+            switch(pSkt->smState)
+            {
+#if  (TCPIP_TCP_CLOSE_WAIT_TIMEOUT != 0)
+                case TCPIP_TCP_STATE_CLOSE_WAIT:
+#endif  // (TCPIP_TCP_CLOSE_WAIT_TIMEOUT != 0)
+#if (TCPIP_TCP_MSL_TIMEOUT != 0)
+                case TCPIP_TCP_STATE_TIME_WAIT:
+#endif  // (TCPIP_TCP_MSL_TIMEOUT != 0)
+                case TCPIP_TCP_STATE_FIN_WAIT_2:
+                    if(!tmrSet || (int32_t)(pSkt->closeWaitTime - tmrTime) < 0)
+                    {
+                        tmrTime = pSkt->closeWaitTime;
+                    }
+                    tmrSet = true;
+                    break;
+
+                default:
+                    break;
+            }
+
+            // the retransmission timer or the keep-alive one
+            if(pSkt->Flags.bTimerEnabled || (pSkt->Flags.keepAlive && pSkt->smState == TCPIP_TCP_STATE_ESTABLISHED))
+            {
+                if(!tmrSet || (int32_t)(pSkt->eventTime - tmrTime) < 0)
+                {
+                    tmrTime = pSkt->eventTime;
+                }
+                tmrSet = true;
+            }
+        }
+    }
+
+    OSAL_CRITSECT_DATA_TYPE status = OSAL_CRIT_Enter(OSAL_CRIT_TYPE_LOW);
+    if(tmrSet)
+    {   // a timeout beyond the wheel span will be checked again at the next revolutions
+        slotOffs = ((int32_t)(tmrTime - tcpTmrTime) <= 0) ? 0 : (tmrTime - tcpTmrTime + tcpTmrSlotTicks - 1) / tcpTmrSlotTicks;
+        pHead = tcpTmrWheel + (tcpTmrSlot + slotOffs) % _TCP_TIMER_WHEEL_SLOTS;
+    }
+    else
+    {
+        pHead = 0;
+    }
+
+    if(pSkt->tmrHead != 0 && pSkt->tmrHead != pHead)
+    {   // unlink from the old slot
+        for(pPrev = pSkt->tmrHead; (pNode = *pPrev) != 0; pPrev = &pNode->tmrNext)
+        {
+            if(pNode == pSkt)
+            {
+                *pPrev = pSkt->tmrNext;
+                break;
+            }
+        }
+        pSkt->tmrHead = 0;
+    }
+
+    if(pHead != 0 && pSkt->tmrHead == 0)
+    {   // link into the new one
+        pSkt->tmrNext = *pHead;
+        *pHead = pSkt;
+        pSkt->tmrHead = pHead;
+    }
+    pSkt->tmrTime = tmrTime;
+    OSAL_CRIT_Leave(OSAL_CRIT_TYPE_LOW, status);
+}
+
 static __inline__ bool __attribute__((always_inline)) _TCP_IsConnected(TCB_STUB* pSkt)
 {
     return (pSkt->smState == TCPIP_TCP_STATE_ESTABLISHED || pSkt->smState == TCPIP_TCP_STATE_FIN_WAIT_1 || pSkt->smState == TCPIP_TCP_STATE_FIN_WAIT_2 || pSkt->smState == TCPIP_TCP_STATE_CLOSE_WAIT);
@@ -368,6 +616,8 @@ static void _TcpSocketSetState(TCB_STUB* pSkt, TCPIP_TCP_STATE newState)
         } 
     }
     pSkt->smState = newState;
+    _TcpSocketHashUpdate(pSkt);
+    _TcpTimerUpdate(pSkt);
 }
 
 static uint32_t    _tcpTraceMask = 0;      // currently only first 32 sockets could be traced from the creation moment
@@ -400,6 +650,8 @@ bool TCPIP_TCP_SocketTraceSet(TCP_SOCKET sktNo, bool enable)
 static __inline__ void __attribute__((always_inline)) _TcpSocketSetState(TCB_STUB* pSkt, TCPIP_TCP_STATE newState)
 {
     pSkt->smState = newState;
+    _TcpSocketHashUpdate(pSkt);
+    _TcpTimerUpdate(pSkt);
 }
 bool TCPIP_TCP_SocketTraceSet(TCP_SOCKET sktNo, bool enable)
 {
@@ -456,6 +708,9 @@ static bool TCPIP_TCP_CheckRxPkt(TCP_HEADER* pHdr)
     TCBStubs[pSkt->sktIx] = 0;
     OSAL_CRIT_Leave(OSAL_CRIT_TYPE_LOW, status);
 
+#if (_TCP_TX_REF_ENABLE)
+    _TcpTxRefRelease(pSkt, false);
+#endif  // (_TCP_TX_REF_ENABLE)
     TCPIP_HEAP_Free(tcpHeapH, (void*)pSkt->rxStart);
     TCPIP_HEAP_Free(tcpHeapH, (void*)pSkt->txStart);
     TCPIP_HEAP_Free(tcpHeapH, pSkt);
@@ -477,7 +732,7 @@ static int _TcpClientSocketConnect(TCB_STUB* pSkt)
                 return -1;
             }
             // destination known
-            pSkt->remoteHash = _TCP_ClientIPV4RemoteHash(&pSkt->destAddress, pSkt);
+            _TcpSocketRemoteHashSet(pSkt, _TCP_ClientIPV4RemoteHash(&pSkt->destAddress, pSkt));
             break;
 #endif  // defined (TCPIP_STACK_USE_IPV4)
 
@@ -488,7 +743,7 @@ static int _TcpClientSocketConnect(TCB_STUB* pSkt)
                 return -1;
             }
             // destination known
-            pSkt->remoteHash = TCPIP_IPV6_GetHash( TCPIP_IPV6_DestAddressGet(pSkt->pV6Pkt), pSkt->remotePort, pSkt->localPort);
+            _TcpSocketRemoteHashSet(pSkt, TCPIP_IPV6_GetHash( TCPIP_IPV6_DestAddressGet(pSkt->pV6Pkt), pSkt->remotePort, pSkt->localPort));
             break;
 #endif  // defined (TCPIP_STACK_USE_IPV6)
 
@@ -581,7 +836,7 @@ static void _TCP_LoadRetxTmo(TCB_STUB* pSkt, bool reload)
     uint32_t retxTmo;
     if(reload)
     {
-        retxTmo = _TCP_SOCKET_RETX_TMO;
+        retxTmo = pSkt->rto != 0 ? pSkt->rto : _TCP_SOCKET_RETX_TMO;
     }
     else
     {
@@ -596,6 +851,225 @@ static void _TCP_LoadRetxTmo(TCB_STUB* pSkt, bool reload)
     pSkt->retxTime = SYS_TMR_TickCountGet() + (pSkt->retxTmo * sysTickFreq)/1000;
 }
 
+// updates the socket smoothed RTT and RTT variation
+// and calculates the retransmission timeout (RFC 6298)
+// rtt is the new measurement, ms
+static void _TcpRttUpdate(TCB_STUB* pSkt, uint32_t rtt)
+{
+    int32_t delta;
+    uint32_t rto, granularity;
+
+    if(pSkt->nRttSamples == 0)
+    {   // first measurement: SRTT = R; RTTVAR = R / 2
+        pSkt->srtt = rtt << 3;
+        pSkt->rttVar = rtt << 1;
+    }
+    else
+    {   // SRTT = 7/8 * SRTT + 1/8 * R; RTTVAR = 3/4 * RTTVAR + 1/4 * |SRTT - R|
+        delta = (int32_t)rtt - (int32_t)(pSkt->srtt >> 3);
+        pSkt->srtt += delta;
+        if(delta < 0)
+        {
+            delta = -delta;
+        }
+        pSkt->rttVar += delta - (int32_t)(pSkt->rttVar >> 2);
+    }
+
+    if(pSkt->nRttSamples != 0xffff)
+    {
+        pSkt->nRttSamples++;
+    }
+
+    // RTO = SRTT + max(G, 4 * RTTVAR)
+    granularity = 1000 / sysTickFreq;
+    rto = (pSkt->srtt >> 3) + (pSkt->rttVar > granularity ? pSkt->rttVar : granularity);
+    if(rto < _TCP_SOCKET_MIN_RTO)
+    {
+        rto = _TCP_SOCKET_MIN_RTO;
+    }
+    else if(rto > _TCP_SOCKET_MAX_RTO)
+    {
+        rto = _TCP_SOCKET_MAX_RTO;
+    }
+    pSkt->rto = rto;
+}
+
+// returns the initial retransmission interval, ticks
+static uint32_t _TcpRetryIntervalGet(TCB_STUB* pSkt)
+{
+    uint32_t tmo = pSkt->rto != 0 ? pSkt->rto : TCPIP_TCP_START_TIMEOUT_VAL;
+
+    return (tmo * sysTickFreq) / 1000;
+}
+
+// Congestion control: RFC 5681 + RFC 6582 (NewReno)
+// Note: the TX FIFO maintains just the unacknowledged tail pointer
+// so any retransmission restarts from the first unacknowledged byte
+// and is paced by the congestion window.
+
+// returns the number of bytes sent but not acknowledged yet
+static uint16_t _TcpFlightSize(TCB_STUB* pSkt)
+{
+    int32_t flight = pSkt->txUnackedTail - pSkt->txTail;
+    if(flight < 0)
+    {
+        flight += pSkt->txEnd - pSkt->txStart;
+    }
+
+    return (uint16_t)flight;
+}
+
+// sets the congestion window to the initial window
+// called whenever the remote MSS changes
+static void _TcpCongInit(TCB_STUB* pSkt)
+{
+    uint32_t iw;
+
+    if(pSkt->wRemoteMSS > 2190)
+    {
+        iw = 2 * pSkt->wRemoteMSS;
+    }
+    else if(pSkt->wRemoteMSS > 1095)
+    {
+        iw = 3 * pSkt->wRemoteMSS;
+    }
+    else
+    {
+        iw = 4 * pSkt->wRemoteMSS;
+    }
+
+    pSkt->cwnd = iw > 0xffff ? 0xffff : (uint16_t)iw;
+    pSkt->ssthresh = 0xffff;
+    pSkt->cwndAckBytes = 0;
+    pSkt->flags.fastRecovery = 0;
+}
+
+// returns the number of bytes that can be sent right now:
+// the remote window limited by the congestion window
+static uint16_t _TcpSendWindow(TCB_STUB* pSkt)
+{
+    uint16_t flight, congWindow;
+
+    if(pSkt->flags.congCtrl != 0)
+    {
+        flight = _TcpFlightSize(pSkt);
+        congWindow = flight < pSkt->cwnd ? pSkt->cwnd - flight : 0;
+        if(congWindow < pSkt->remoteWindow)
+        {
+            return congWindow;
+        }
+    }
+
+    return pSkt->remoteWindow;
+}
+
+// sets the slow start threshold after a loss was detected
+static void _TcpCongSetThreshold(TCB_STUB* pSkt)
+{
+    uint16_t ssthresh = _TcpFlightSize(pSkt) >> 1;
+    if(ssthresh < 2 * pSkt->wRemoteMSS)
+    {
+        ssthresh = 2 * pSkt->wRemoteMSS;
+    }
+    pSkt->ssthresh = ssthresh;
+}
+
+// updates the congestion window for new acknowledged data
+// returns true if a partial acknowledge in fast recovery requires a retransmission
+static bool _TcpCongAck(TCB_STUB* pSkt, uint32_t ackBytes, uint32_t ackNumber)
+{
+    uint32_t cwnd = pSkt->cwnd;
+    bool retransmit = false;
+
+    if(pSkt->flags.fastRecovery != 0)
+    {
+        if((int32_t)(ackNumber - pSkt->recoverSEQ) >= 0)
+        {   // full acknowledge: deflate the window and exit fast recovery
+            cwnd = pSkt->ssthresh;
+            pSkt->flags.fastRecovery = 0;
+        }
+        else
+        {   // partial acknowledge: deflate by the acknowledged amount
+            // and retransmit the first unacknowledged segment
+            cwnd = (cwnd > ackBytes ? cwnd - ackBytes : 0) + pSkt->wRemoteMSS;
+            retransmit = true;
+        }
+    }
+    else if(cwnd < pSkt->ssthresh)
+    {   // slow start
+        cwnd += ackBytes < pSkt->wRemoteMSS ? ackBytes : pSkt->wRemoteMSS;
+    }
+    else
+    {   // congestion avoidance: one MSS per window acknowledged
+        ackBytes += pSkt->cwndAckBytes;
+        if(ackBytes >= cwnd)
+        {
+            ackBytes -= cwnd;
+            cwnd += pSkt->wRemoteMSS;
+        }
+        pSkt->cwndAckBytes = ackBytes > 0xffff ? 0xffff : (uint16_t)ackBytes;
+    }
+
+    pSkt->cwnd = cwnd > 0xffff ? 0xffff : (uint16_t)cwnd;
+    return retransmit;
+}
+
+// updates the congestion state for a duplicate acknowledge
+// returns true if a fast retransmission needs to be done
+static bool _TcpCongDupAck(TCB_STUB* pSkt)
+{
+    uint32_t cwnd;
+
+    if(pSkt->flags.fastRecovery != 0)
+    {   // inflate the window for the segment that left the network
+        cwnd = pSkt->cwnd + pSkt->wRemoteMSS;
+        pSkt->cwnd = cwnd > 0xffff ? 0xffff : (uint16_t)cwnd;
+        pSkt->Flags.bTXASAPWithoutTimerReset = 1;
+        return false;
+    }
+
+    if(++pSkt->dupAckCnt != 3)
+    {
+        return false;
+    }
+
+    // enter fast recovery
+    _TcpCongSetThreshold(pSkt);
+    pSkt->recoverSEQ = pSkt->MySEQ;
+    cwnd = pSkt->ssthresh + 3 * pSkt->wRemoteMSS;
+    pSkt->cwnd = cwnd > 0xffff ? 0xffff : (uint16_t)cwnd;
+    pSkt->cwndAckBytes = 0;
+    pSkt->flags.fastRecovery = 1;
+    return true;
+}
+
+// updates the congestion state when the retransmission timer expired
+static void _TcpCongTimeout(TCB_STUB* pSkt)
+{
+    if(pSkt->flags.congCtrl != 0)
+    {
+        _TcpCongSetThreshold(pSkt);
+        pSkt->cwnd = pSkt->wRemoteMSS;
+        pSkt->cwndAckBytes = 0;
+        pSkt->flags.fastRecovery = 0;
+    }
+}
+
+// rolls back the unacknowledged TX tail pointer
+// to cause the retransmission of all unacknowledged data
+static void _TcpTxRollback(TCB_STUB* pSkt)
+{
+    pSkt->MySEQ -= (pSkt->txUnackedTail - pSkt->txTail);
+
+    if(pSkt->txUnackedTail < pSkt->txTail)
+    {
+        pSkt->MySEQ -= (pSkt->txEnd - pSkt->txStart);
+    }
+    pSkt->txUnackedTail = pSkt->txTail;
+    pSkt->Flags.bTXASAPWithoutTimerReset = 1;
+    pSkt->optFlags.rttTiming = 0;   // Karn: retransmitted data is not timed
+}
+
 
 /*****************************************************************************
   Function:
@@ -690,13 +1164,18 @@ bool TCPIP_TCP_Initialize(const TCPIP_STACK_MODULE_CTRL* const stackInit, const
     }
 
     sysTickFreq = SYS_TMR_TickCounterFrequencyGet(); 
+    if((tcpTsTickDiv = sysTickFreq / 1000) == 0)
+    {
+        tcpTsTickDiv = 1;
+    }
     tcpHeapH = stackInit->memH;
     nSockets = pTcpInit->nSockets;
     // default initialization
     tcpDefTxSize = pTcpInit->sktTxBuffSize;
     tcpDefRxSize = pTcpInit->sktRxBuffSize;
 
-    TCBStubs = (TCB_STUB**)TCPIP_HEAP_Calloc(tcpHeapH, nSockets, sizeof(*TCBStubs));
+    // the timer wheel expired sockets array is allocated together with the TCBStubs
+    TCBStubs = (TCB_STUB**)TCPIP_HEAP_Calloc(tcpHeapH, nSockets, sizeof(*TCBStubs) + sizeof(*tcpTmrDue));
     if(TCBStubs == 0)
     {
         SYS_ERROR(SYS_ERROR_ERROR, " TCP Dynamic allocation failed");
@@ -706,6 +1185,26 @@ bool TCPIP_TCP_Initialize(const TCPIP_STACK_MODULE_CTRL* const stackInit, const
 
 
     TcpSockets = nSockets;
+    memset(tcpListenHash, 0, sizeof(tcpListenHash));
+    memset(tcpConnHash, 0, sizeof(tcpConnHash));
+    tcpTmrDue = (TCP_SOCKET*)(TCBStubs + nSockets);
+    memset(tcpTmrWheel, 0, sizeof(tcpTmrWheel));
+    tcpTmrSlot = 0;
+    if((tcpTmrSlotTicks = (TCPIP_TCP_TASK_TICK_RATE * sysTickFreq + 999) / 1000) == 0)
+    {
+        tcpTmrSlotTicks = 1;
+    }
+    tcpTmrTime = SYS_TMR_TickCountGet() + tcpTmrSlotTicks;
+#if (_TCP_SYN_BACKLOG_ENABLE)
+    _TcpSynBacklogInit();
+#endif  // (_TCP_SYN_BACKLOG_ENABLE)
+#if (_TCP_TIME_WAIT_ENABLE)
+    memset(tcpTwTable, 0, sizeof(tcpTwTable));
+    tcpTwReleased = tcpTwEvicted = 0;
+#endif  // (_TCP_TIME_WAIT_ENABLE)
+#if (_TCP_AUTO_TUNE)
+    tcpAutoTuneTime = SYS_TMR_TickCountGet();
+#endif  // (_TCP_AUTO_TUNE)
 #if (TCPIP_TCP_QUIET_TIME != 0)
     tcpQuietDone = false;
     tcpStartTime = 0;
@@ -837,6 +1336,7 @@ static void _TcpCleanup(void)
 
     TCPIP_HEAP_Free(tcpHeapH, TCBStubs);
     TCBStubs = 0;
+    tcpTmrDue = 0;
 
     TcpSockets = 0;
 
@@ -876,6 +1376,38 @@ static void _TCPAbortSockets(uint32_t netMask, TCPIP_TCP_SIGNAL_TYPE sigType)
             }
         }
     }
+
+#if (_TCP_SYN_BACKLOG_ENABLE)
+    // drop the half-open connections on these interfaces
+    TCP_SYN_ENTRY* pSyn = tcpSynBacklog;
+    for(ix = 0; ix < _TCP_SYN_BACKLOG_SIZE; ix++, pSyn++)
+    {
+        if(pSyn->conn.remoteAddress.Val != 0)
+        {
+            int netIx = TCPIP_STACK_NetIxGet(pSyn->conn.pNet);
+            if(netIx >= 0 && ((1 << netIx) & netMask) != 0)
+            {
+                pSyn->conn.remoteAddress.Val = 0;
+            }
+        }
+    }
+#endif  // (_TCP_SYN_BACKLOG_ENABLE)
+
+#if (_TCP_TIME_WAIT_ENABLE)
+    // and the closing ones
+    TCP_TW_ENTRY* pTw = tcpTwTable;
+    for(ix = 0; ix < _TCP_TIME_WAIT_SIZE; ix++, pTw++)
+    {
+        if(pTw->conn.remoteAddress.Val != 0)
+        {
+            int netIx = TCPIP_STACK_NetIxGet(pTw->conn.pNet);
+            if(netIx >= 0 && ((1 << netIx) & netMask) != 0)
+            {
+                pTw->conn.remoteAddress.Val = 0;
+            }
+        }
+    }
+#endif  // (_TCP_TIME_WAIT_ENABLE)
 } 
 #endif  // (TCPIP_STACK_DOWN_OPERATION != 0) || (_TCPIP_STACK_INTERFACE_CHANGE_SIGNALING != 0)
 
@@ -1207,7 +1739,7 @@ static TCP_SOCKET _TCP_Open(IP_ADDRESS_TYPE addType, TCP_OPEN_TYPE opType, TCP_P
         pSkt->localPort = localPort;
         pSkt->Flags.bServer = true;
         _TcpSocketSetState(pSkt, TCPIP_TCP_STATE_LISTEN);
-        pSkt->remoteHash = localPort;
+        _TcpSocketRemoteHashSet(pSkt, localPort);
     }
     // Handle all the client mode socket types
     else
@@ -1302,52 +1834,66 @@ void  TCPIP_TCP_Task(void)
 static void TCPIP_TCP_Process(void)
 {
     TCPIP_MAC_PACKET*   pRxPkt;
-    TCPIP_MAC_PKT_ACK_RES ackRes;
 
     // extract queued TCP packets
     while((pRxPkt = _TCPIPStackModuleRxExtract(TCPIP_THIS_MODULE_ID)) != 0)
     {
-        TCPIP_PKT_FlightLogRx(pRxPkt, TCPIP_THIS_MODULE_ID);
+        TCPIP_TCP_RxPacketProcess(pRxPkt);
+    }
+}
+
+#if (_TCPIP_STACK_RX_RUN_TO_COMPLETION != 0)
+void TCPIP_TCP_RxInline(TCPIP_MAC_PACKET* pRxPkt)
+{
+    TCPIP_TCP_RxPacketProcess(pRxPkt);
+}
+#endif  // (_TCPIP_STACK_RX_RUN_TO_COMPLETION != 0)
+
+// processes a RX TCP packet
+static void TCPIP_TCP_RxPacketProcess(TCPIP_MAC_PACKET* pRxPkt)
+{
+    TCPIP_MAC_PKT_ACK_RES ackRes;
+
+    TCPIP_PKT_FlightLogRx(pRxPkt, TCPIP_THIS_MODULE_ID);
 #if (TCPIP_TCP_EXTERN_PACKET_PROCESS != 0)
-        if(tcpPktHandler != 0)
+    if(tcpPktHandler != 0)
+    {
+        bool was_processed = (*tcpPktHandler)(pRxPkt->pktIf, pRxPkt, tcpPktHandlerParam);
+        if(was_processed)
         {
-            bool was_processed = (*tcpPktHandler)(pRxPkt->pktIf, pRxPkt, tcpPktHandlerParam);
-            if(was_processed)
-            {
-                TCPIP_PKT_FlightLogAcknowledge(pRxPkt, TCPIP_THIS_MODULE_ID, TCPIP_MAC_PKT_ACK_EXTERN);
-                continue;
-            }
+            TCPIP_PKT_FlightLogAcknowledge(pRxPkt, TCPIP_THIS_MODULE_ID, TCPIP_MAC_PKT_ACK_EXTERN);
+            return;
         }
+    }
 #endif  // (TCPIP_TCP_EXTERN_PACKET_PROCESS != 0)
 
-        ackRes = TCPIP_MAC_PKT_ACK_PROTO_DEST_ERR;
+    ackRes = TCPIP_MAC_PKT_ACK_PROTO_DEST_ERR;
 #if (TCPIP_TCP_QUIET_TIME != 0)
-        if(tcpQuietDone)
+    if(tcpQuietDone)
 #endif  // (TCPIP_TCP_QUIET_TIME != 0)
-        {
-            if(!_TCP_RxPktValidate(pRxPkt))
-            {   // discard packet
-                ackRes = TCPIP_MAC_PKT_ACK_STRUCT_ERR;
-            }
+    {
+        if(!_TCP_RxPktValidate(pRxPkt))
+        {   // discard packet
+            ackRes = TCPIP_MAC_PKT_ACK_STRUCT_ERR;
+        }
 #if defined (TCPIP_STACK_USE_IPV4)
-            else if((pRxPkt->pktFlags & TCPIP_MAC_PKT_FLAG_NET_TYPE) == TCPIP_MAC_PKT_FLAG_IPV4) 
-            {
-                ackRes = TCPIP_TCP_ProcessIPv4(pRxPkt);
-            }
+        else if((pRxPkt->pktFlags & TCPIP_MAC_PKT_FLAG_NET_TYPE) == TCPIP_MAC_PKT_FLAG_IPV4) 
+        {
+            ackRes = TCPIP_TCP_ProcessIPv4(pRxPkt);
+        }
 #endif  // defined (TCPIP_STACK_USE_IPV4)
 
 #if defined (TCPIP_STACK_USE_IPV6)
-            else if((pRxPkt->pktFlags & TCPIP_MAC_PKT_FLAG_NET_TYPE) == TCPIP_MAC_PKT_FLAG_IPV6) 
-            {
-                ackRes = TCPIP_TCP_ProcessIPv6(pRxPkt);
-            }
-#endif  // defined (TCPIP_STACK_USE_IPV6)
+        else if((pRxPkt->pktFlags & TCPIP_MAC_PKT_FLAG_NET_TYPE) == TCPIP_MAC_PKT_FLAG_IPV6) 
+        {
+            ackRes = TCPIP_TCP_ProcessIPv6(pRxPkt);
         }
+#endif  // defined (TCPIP_STACK_USE_IPV6)
+    }
 
-        if(ackRes != TCPIP_MAC_PKT_ACK_NONE)
-        {   // unknown/error; discard it.
-            TCPIP_PKT_PacketAcknowledge(pRxPkt, ackRes);
-        }
+    if(ackRes != TCPIP_MAC_PKT_ACK_NONE)
+    {   // unknown/error; discard it.
+        TCPIP_PKT_PacketAcknowledge(pRxPkt, ackRes);
     }
 }
 
@@ -1447,8 +1993,8 @@ static TCP_V4_PACKET* _TcpAllocateTxPacket(TCB_STUB* pSkt, IP_ADDRESS_TYPE addTy
     // allocate IPv4 packet
     allocFlags = TCPIP_MAC_PKT_FLAG_IPV4 | TCPIP_MAC_PKT_FLAG_SPLIT | TCPIP_MAC_PKT_FLAG_TX | TCPIP_MAC_PKT_FLAG_TCP;
     // allocate from main packet pool
-    // make sure there's enough room for TCP_OPTIONS
-    pv4Pkt = (TCP_V4_PACKET*)TCPIP_PKT_SocketAlloc(sizeof(TCP_V4_PACKET), sizeof(TCP_HEADER), sizeof(TCP_OPTIONS), allocFlags);
+    // make sure there's enough room for the TCP options
+    pv4Pkt = (TCP_V4_PACKET*)TCPIP_PKT_SocketAlloc(sizeof(TCP_V4_PACKET), sizeof(TCP_HEADER), TCP_OPTIONS_MAX_SIZE, allocFlags);
 
     if(pv4Pkt)
     {   // lazy linking of the data segments, when needed
@@ -1580,7 +2126,8 @@ static void _Tcpv4LinkDataSeg(TCP_V4_PACKET* pTcpPkt, uint8_t* pBuff1, uint16_t
 
 }
 
-static bool _TCPv4Flush(TCB_STUB * pSkt, IPV4_PACKET* pv4Pkt, uint16_t hdrLen, uint16_t loadLen)
+// loadSum: raw checksum of the payload, if known; 0 otherwise
+static bool _TCPv4Flush(TCB_STUB * pSkt, IPV4_PACKET* pv4Pkt, uint16_t hdrLen, uint16_t loadLen, uint16_t loadSum, TCPIP_MAC_PACKET* pBurst)
 {
     TCP_HEADER*         pTCPHdr;
     IPV4_PSEUDO_HEADER  pseudoHdr;
@@ -1622,7 +2169,14 @@ static bool _TCPv4Flush(TCB_STUB * pSkt, IPV4_PACKET* pv4Pkt, uint16_t hdrLen, u
         if(loadLen)
         {   // add the data segments
             pv4Pkt->macPkt.pDSeg->segFlags |= TCPIP_MAC_SEG_FLAG_USER_PAYLOAD;
-            checksum = ~TCPIP_Helper_PacketChecksum(&pv4Pkt->macPkt, ((TCP_V4_PACKET*)pv4Pkt)->tcpSeg[0].segLoad, loadLen, checksum);
+            if(loadSum != 0)
+            {   // already calculated
+                checksum = TCPIP_Helper_ChecksumFold((uint32_t)checksum + loadSum);
+            }
+            else
+            {
+                checksum = ~TCPIP_Helper_PacketChecksum(&pv4Pkt->macPkt, ((TCP_V4_PACKET*)pv4Pkt)->tcpSeg[0].segLoad, loadLen, checksum);
+            }
         }
         else
         {   // packet not carying user payload
@@ -1639,28 +2193,236 @@ static bool _TCPv4Flush(TCB_STUB * pSkt, IPV4_PACKET* pv4Pkt, uint16_t hdrLen, u
 
     // and we're done
     TCPIP_IPV4_PacketFormatTx(pv4Pkt, IP_PROT_TCP, hdrLen + loadLen, &pktParams);
-    pv4Pkt->macPkt.next = 0;    // single packet
+    pv4Pkt->macPkt.next = pBurst;    // single packet or burst
     TCPIP_PKT_FlightLogTxSkt(&pv4Pkt->macPkt, TCPIP_THIS_MODULE_ID, ((uint32_t)pSkt->localPort << 16) | pSkt->remotePort, pSkt->sktIx);
     if(TCPIP_IPV4_PacketTransmit(pv4Pkt))
     {
         return true; 
     }
+
+#if (_TCP_TX_BURST > 1)
+    if(pBurst != 0)
+    {   // burst not accepted, destination not resolved, etc.
+        // transmit the packets one by one
+        TCPIP_MAC_PACKET* pNext;
+        bool txRes;
+
+        pv4Pkt->macPkt.next = 0;
+        if((txRes = TCPIP_IPV4_PacketTransmit(pv4Pkt)) == false)
+        {
+            TCPIP_PKT_PacketAcknowledge(&pv4Pkt->macPkt, TCPIP_MAC_PKT_ACK_IP_REJECT_ERR);
+        }
+
+        for( ; pBurst != 0; pBurst = pNext)
+        {
+            pNext = pBurst->next;
+            pBurst->next = 0;
+            if(!TCPIP_IPV4_PacketTransmit((IPV4_PACKET*)pBurst))
+            {
+                TCPIP_PKT_PacketAcknowledge(pBurst, TCPIP_MAC_PKT_ACK_IP_REJECT_ERR);
+            }
+        }
+
+        return txRes;
+    }
+#endif  // (_TCP_TX_BURST > 1)
+
     // failed
     TCPIP_PKT_PacketAcknowledge(&pv4Pkt->macPkt, TCPIP_MAC_PKT_ACK_IP_REJECT_ERR);
 
     return false;
 }
 
-static TCPIP_MAC_PKT_ACK_RES TCPIP_TCP_ProcessIPv4(TCPIP_MAC_PACKET* pRxPkt)
+#if (_TCP_TX_BURST > 1)
+// builds a burst of full size segments with the data pending in the TX FIFO
+// following the segment in pHdr, which is built but not transmitted yet.
+// The segments reuse the header of the 1st segment as a template
+// and a partial checksum of the pseudo header + template;
+// only the sequence number and the payload are added per segment.
+// Returns the list of packets to be chained to the 1st segment or 0.
+static TCPIP_MAC_PACKET* _Tcpv4BurstBuild(TCB_STUB* pSkt, const TCP_HEADER* pHdr, uint16_t hdrLen, uint16_t segLen)
 {
+    TCP_V4_PACKET*      pTcpPkt;
     TCP_HEADER*         pTCPHdr;
-    uint16_t            tcpTotLength;
-    uint16_t            optionsSize;
-    const IPV4_ADDR*    pPktSrcAdd;
-    const IPV4_ADDR*    pPktDstAdd;
+    TCPIP_MAC_PACKET    *pBurst, *pLast;
     IPV4_PSEUDO_HEADER  pseudoHdr;
-    uint16_t            calcChkSum;
+    TCPIP_IPV4_PACKET_PARAMS pktParams;
+    uint8_t             hdrTemplate[sizeof(TCP_HEADER) + TCP_OPTIONS_MAX_SIZE];
+    uint32_t            seqNo, dataLen;
+    int32_t             pendLen;
+    uint8_t*            pRefData = 0;
+    uint16_t            partialSum, checksum, lenEnd;
+    int                 nSegs;
+    bool                swChecksum;
+
+    if(pSkt->destAddress.Val == 0 || hdrLen > sizeof(hdrTemplate) || !_TcpSocketSetSourceInterface(pSkt))
+    {
+        return 0;
+    }
+
+    if(sizeof(IPV4_HEADER) + hdrLen + segLen > _TCPIPStackNetLinkMtu(pSkt->pSktNet))
+    {   // no fragmentation for a burst
+        return 0;
+    }
+
+    if(hdrLen - sizeof(TCP_HEADER) + segLen > pSkt->wRemoteMSS)
+    {   // the options in the template take room from the MSS
+        return 0;
+    }
+
+    // the header template: same for all the segments in the burst
+    memcpy(hdrTemplate, pHdr, hdrLen);
+    pTCPHdr = (TCP_HEADER*)hdrTemplate;
+    pTCPHdr->SeqNumber = 0;
+    pTCPHdr->Checksum = 0;
+
+    partialSum = 0;
+    swChecksum = (pSkt->pSktNet->txOffload & TCPIP_MAC_CHECKSUM_TCP) == 0;
+    if(swChecksum)
+    {   // not handled by hardware
+        pseudoHdr.SourceAddress.Val = pSkt->srcAddress.Val;
+        pseudoHdr.DestAddress.Val = pSkt->destAddress.Val;
+        pseudoHdr.Zero = 0;
+        pseudoHdr.Protocol = IP_PROT_TCP;
+        pseudoHdr.Length = TCPIP_Helper_htons(hdrLen + segLen);
+        partialSum = ~TCPIP_Helper_CalcIPChecksum((uint8_t*)&pseudoHdr, sizeof(pseudoHdr), 0);
+        partialSum = ~TCPIP_Helper_CalcIPChecksum(hdrTemplate, hdrLen, partialSum);
+    }
+
+    pktParams.ttl = pSkt->ttl;
+    pktParams.tosFlags = pSkt->tos;
+    pktParams.df = 0;
+
+    pBurst = pLast = 0;
+    for(nSegs = 1; nSegs < _TCP_TX_BURST; nSegs++)
+    {
+        pendLen = pSkt->txHead - pSkt->txUnackedTail;
+        if(pendLen < 0)
+        {
+            pendLen += pSkt->txEnd - pSkt->txStart;
+        }
+
+        if(pendLen < segLen || _TcpSendWindow(pSkt) < segLen)
+        {   // only full size segments in a burst
+            break;
+        }
+
+        dataLen = segLen;
+#if (_TCP_TX_REF_ENABLE)
+        pRefData = _TcpTxRefSource(pSkt, &dataLen);
+#endif  // (_TCP_TX_REF_ENABLE)
+        if(dataLen != segLen)
+        {   // FIFO data and user buffer boundary
+            break;
+        }
+
+        if((pTcpPkt = _TcpAllocateTxPacket(pSkt, IP_ADDRESS_TYPE_IPV4)) == 0)
+        {   // out of memory; the rest will go in the next pass
+            break;
+        }
+        TCPIP_PKT_PacketAcknowledgeSet(&pTcpPkt->v4Pkt.macPkt, _Tcpv4BurstAckFnc, pSkt);
+
+        // link application data into the TX packet
+        lenEnd = pSkt->txEnd - pSkt->txUnackedTail;
+        if(pRefData != 0)
+        {   // user buffer; contiguous
+            _Tcpv4LinkDataSeg(pTcpPkt, pRefData, segLen, 0, 0);
+        }
+        else if(lenEnd >= segLen)
+        {
+            _Tcpv4LinkDataSeg(pTcpPkt, pSkt->txUnackedTail, segLen, 0, 0);
+        }
+        else
+        {
+            _Tcpv4LinkDataSeg(pTcpPkt, pSkt->txUnackedTail, lenEnd, pSkt->txStart, segLen - lenEnd);
+        }
+
+        pSkt->txUnackedTail += segLen;
+        if(pSkt->txUnackedTail >= pSkt->txEnd)
+        {
+            pSkt->txUnackedTail -= pSkt->txEnd - pSkt->txStart;
+        }
+
+        pTcpPkt->v4Pkt.srcAddress.Val = pSkt->srcAddress.Val;
+        pTcpPkt->v4Pkt.destAddress.Val = pSkt->destAddress.Val;
+        pTcpPkt->v4Pkt.netIfH = pSkt->pSktNet;
+        pTcpPkt->v4Pkt.macPkt.pDSeg->segLen += hdrLen;
+        pTcpPkt->v4Pkt.macPkt.pDSeg->segFlags |= TCPIP_MAC_SEG_FLAG_USER_PAYLOAD;
+
+        pTCPHdr = (TCP_HEADER*)pTcpPkt->v4Pkt.macPkt.pTransportLayer;
+        memcpy(pTCPHdr, hdrTemplate, hdrLen);
+        seqNo = TCPIP_Helper_htonl(pSkt->MySEQ);
+        pTCPHdr->SeqNumber = seqNo;
+        if(swChecksum)
+        {
+            checksum = ~TCPIP_Helper_CalcIPChecksum((uint8_t*)&seqNo, sizeof(seqNo), partialSum);
+            checksum = ~TCPIP_Helper_PacketChecksum(&pTcpPkt->v4Pkt.macPkt, pTcpPkt->tcpSeg[0].segLoad, segLen, checksum);
+            pTCPHdr->Checksum = ~checksum;
+        }
+
+        TCPIP_IPV4_PacketFormatTx(&pTcpPkt->v4Pkt, IP_PROT_TCP, hdrLen + segLen, &pktParams);
+        TCPIP_PKT_FlightLogTxSkt(&pTcpPkt->v4Pkt.macPkt, TCPIP_THIS_MODULE_ID, ((uint32_t)pSkt->localPort << 16) | pSkt->remotePort, pSkt->sktIx);
+
+        pTcpPkt->v4Pkt.macPkt.next = 0;
+        if(pLast == 0)
+        {
+            pBurst = &pTcpPkt->v4Pkt.macPkt;
+        }
+        else
+        {
+            pLast->next = &pTcpPkt->v4Pkt.macPkt;
+        }
+        pLast = &pTcpPkt->v4Pkt.macPkt;
+
+        pSkt->MySEQ += segLen;
+        pSkt->remoteWindow -= segLen;
+        pSkt->txBurstPkts++;
+    }
+
+    if(pBurst != 0)
+    {
+        if((int32_t)(pSkt->MySEQ - pSkt->sndMaxSEQ) > 0)
+        {
+            pSkt->sndMaxSEQ = pSkt->MySEQ;
+        }
+        // come back as soon as possible if there's more to send
+        pSkt->Flags.bTXASAPWithoutTimerReset = pSkt->txHead != pSkt->txUnackedTail;
+    }
+
+    return pBurst;
+}
+
+// acknowledge function for the burst packets:
+// they are always discarded by _Tcpv4TxAckFnc
+static void _Tcpv4BurstAckFnc (TCPIP_MAC_PACKET * pPkt, const void * param)
+{
+    TCB_STUB* pSkt = (TCB_STUB*)param;
+
+    OSAL_CRITSECT_DATA_TYPE status =  OSAL_CRIT_Enter(OSAL_CRIT_TYPE_LOW);
+    if(TCBStubs != 0 && pSkt->sktIx >= 0 && pSkt->sktIx < TcpSockets && pSkt == TCBStubs[pSkt->sktIx])
+    {
+        if(pSkt->txBurstPkts != 0)
+        {
+            pSkt->txBurstPkts--;
+        }
+    }
+    OSAL_CRIT_Leave(OSAL_CRIT_TYPE_LOW, status);
+
+    _Tcpv4TxAckFnc(pPkt, param);
+}
+#endif  // (_TCP_TX_BURST > 1)
+
+static TCPIP_MAC_PKT_ACK_RES TCPIP_TCP_ProcessIPv4(TCPIP_MAC_PACKET* pRxPkt)
+{
+    TCP_HEADER*         pTCPHdr;
+    uint16_t            tcpTotLength;
+    uint16_t            optionsSize;
+    const IPV4_ADDR*    pPktSrcAdd;
+    const IPV4_ADDR*    pPktDstAdd;
+    IPV4_PSEUDO_HEADER  pseudoHdr;
+    uint16_t            calcChkSum;
     TCB_STUB*           pSkt; 
+    TCP_SOCKET          sktIx;
     TCPIP_TCP_SIGNAL_FUNCTION sigHandler;
     const void*         sigParam;
     uint16_t            sigMask;
@@ -1721,7 +2483,15 @@ static TCPIP_MAC_PKT_ACK_RES TCPIP_TCP_ProcessIPv4(TCPIP_MAC_PACKET* pRxPkt)
 
         // extract header
         pRxPkt->pDSeg->segLen -=  optionsSize + sizeof(*pTCPHdr);    
+        sktIx = pSkt->sktIx;
         _TcpHandleSeg(pSkt, pTCPHdr, tcpTotLength - optionsSize - sizeof(*pTCPHdr), pRxPkt, &sktEvent);
+        if(TCBStubs[sktIx] != pSkt)
+        {   // the socket was closed and killed; don't touch it anymore
+            pSkt = 0;
+            ackRes = TCPIP_MAC_PKT_ACK_RX_OK;
+            break;
+        }
+        _TcpTimerUpdate(pSkt);
 
         sigMask = _TcpSktGetSignalLocked(pSkt, &sigHandler, &sigParam);
         if((sktEvent &= sigMask) != 0)
@@ -2137,7 +2907,7 @@ static _TCP_SEND_RES _TcpDisconnect(TCB_STUB* pSkt, bool signalFIN)
                 do
                 {   
                     sendRes = _TcpSend(pSkt, tcpFlags, SENDTCP_RESET_TIMERS);
-                    if(sendRes < 0 || pSkt->remoteWindow == 0u)
+                    if(sendRes < 0 || _TcpSendWindow(pSkt) == 0u)
                         break;
                 } while(pSkt->txHead != pSkt->txUnackedTail);
             }
@@ -2354,6 +3124,10 @@ bool TCPIP_TCP_SocketInfoGet(TCP_SOCKET hTCP, TCP_SOCKET_INFO* remoteInfo)
     remoteInfo->rxPending = _TCPIsGetReady(pSkt);
     remoteInfo->txPending = TCPIP_TCP_FifoTxFullGet(hTCP);
     remoteInfo->flags = _TCP_SktFlagsGet(pSkt);
+    remoteInfo->srtt = pSkt->srtt >> 3;
+    remoteInfo->rttVar = pSkt->rttVar >> 2;
+    remoteInfo->rto = pSkt->rto != 0 ? pSkt->rto : TCPIP_TCP_START_TIMEOUT_VAL;
+    remoteInfo->rttSamples = pSkt->nRttSamples;
 
     return true;
 }
@@ -2400,6 +3174,72 @@ int TCPIP_TCP_SocketsNumberGet(void)
     return TcpSockets;
 }
 
+bool TCPIP_TCP_SynBacklogStatGet(TCP_SYN_BACKLOG_STAT* pStat, bool clear)
+{
+#if (_TCP_SYN_BACKLOG_ENABLE)
+    int ix;
+    uint32_t tickNow = SYS_TMR_TickCountGet();
+
+    if(pStat)
+    {
+        *pStat = tcpSynStat;
+        pStat->backlogSize = _TCP_SYN_BACKLOG_SIZE;
+        pStat->backlogUsed = 0;
+        for(ix = 0; ix < _TCP_SYN_BACKLOG_SIZE; ix++)
+        {
+            if(tcpSynBacklog[ix].conn.remoteAddress.Val != 0)
+            {
+                pStat->backlogUsed++;
+            }
+        }
+        pStat->statTime = ((uint64_t)(tickNow - tcpSynStatTime) * 1000) / sysTickFreq;
+    }
+
+    if(clear)
+    {
+        memset(&tcpSynStat, 0, sizeof(tcpSynStat));
+        tcpSynStatTime = tickNow;
+    }
+
+    return true;
+#else
+    return false;
+#endif  // (_TCP_SYN_BACKLOG_ENABLE)
+}
+
+bool TCPIP_TCP_TimeWaitStatGet(TCP_TIME_WAIT_STAT* pStat)
+{
+#if (_TCP_TIME_WAIT_ENABLE)
+    int ix;
+
+    if(pStat)
+    {
+        pStat->tableSize = _TCP_TIME_WAIT_SIZE;
+        pStat->timeWait = pStat->lastAck = 0;
+        for(ix = 0; ix < _TCP_TIME_WAIT_SIZE; ix++)
+        {
+            if(tcpTwTable[ix].conn.remoteAddress.Val != 0)
+            {
+                if(tcpTwTable[ix].smState == TCPIP_TCP_STATE_LAST_ACK)
+                {
+                    pStat->lastAck++;
+                }
+                else
+                {
+                    pStat->timeWait++;
+                }
+            }
+        }
+        pStat->released = tcpTwReleased;
+        pStat->evicted = tcpTwEvicted;
+    }
+
+    return true;
+#else
+    return false;
+#endif  // (_TCP_TIME_WAIT_ENABLE)
+}
+
 #if defined(TCPIP_TCP_DISABLE_CRYPTO_USAGE) && (TCPIP_TCP_DISABLE_CRYPTO_USAGE != false)
 // sets the TCP sequence number using a pseudo random number
 static uint32_t _TCP_SktSetSequenceNo(const TCB_STUB* pSkt)
@@ -2541,7 +3381,7 @@ bool TCPIP_TCP_Flush(TCP_SOCKET hTCP)
 
 static bool _TcpFlush(TCB_STUB* pSkt)
 {
-    if(pSkt->txHead != pSkt->txUnackedTail && pSkt->remoteWindow != 0)
+    if(pSkt->txHead != pSkt->txUnackedTail && _TcpSendWindow(pSkt) != 0)
     {   // The check remoteWindow != 0 stops us sending lots of
         // ACKs with len == 0, when the other host is slow
         // Send the TCP segment with all unacked bytes
@@ -2556,6 +3396,10 @@ static void _TcpDiscardTx(TCB_STUB* pSkt)
 {
     // Empty the TX buffer
     pSkt->txHead = pSkt->txTail = pSkt->txUnackedTail = pSkt->txStart;
+    pSkt->txChkStart = 0;
+#if (_TCP_TX_REF_ENABLE)
+    _TcpTxRefRelease(pSkt, false);
+#endif  // (_TCP_TX_REF_ENABLE)
 }
 
 /*****************************************************************************
@@ -2666,6 +3510,30 @@ uint16_t TCPIP_TCP_ArrayPut(TCP_SOCKET hTCP, const uint8_t* data, uint16_t len)
     wActualLen = len >= wFreeTxSpace ? wFreeTxSpace : len;
     wFreeTxSpace -= wActualLen; // new free space
 
+#if (_TCP_TX_CHKSUM_CACHE)
+    if(pSkt->txChkStart != pSkt->txUnackedTail)
+    {   // the sum no longer describes the pending data
+        pSkt->txChkStart = 0;
+        if(pSkt->txUnackedTail == pSkt->txHead)
+        {   // nothing pending; start a new sum
+            pSkt->txChkStart = pSkt->txHead;
+            pSkt->txChkSum = 0;
+            pSkt->txChkLen = 0;
+        }
+    }
+
+    // See if we need a two part put
+    if(pSkt->txHead + wActualLen >= pSkt->txEnd)
+    {
+        wRightLen = pSkt->txEnd-pSkt->txHead;
+        _TcpTxChkCopy(pSkt, (uint8_t*)pSkt->txHead, data, wRightLen);
+        data += wRightLen;
+        wActualLen -= wRightLen;
+        pSkt->txHead = pSkt->txStart;
+    }
+
+    _TcpTxChkCopy(pSkt, (uint8_t*)pSkt->txHead, data, wActualLen);
+#else
     // See if we need a two part put
     if(pSkt->txHead + wActualLen >= pSkt->txEnd)
     {
@@ -2677,8 +3545,97 @@ uint16_t TCPIP_TCP_ArrayPut(TCP_SOCKET hTCP, const uint8_t* data, uint16_t len)
     }
 
     TCPIP_Helper_Memcpy((uint8_t*)pSkt->txHead, data, (uint32_t)wActualLen);
+#endif  // (_TCP_TX_CHKSUM_CACHE)
     pSkt->txHead += wActualLen;
 
+    _TcpPutFlush(pSkt, wFreeTxSpace);
+
+    return wActualLen + wRightLen;
+}
+
+bool TCPIP_TCP_ArrayPutRef(TCP_SOCKET hTCP, const uint8_t* pBuff, uint16_t len, TCPIP_TCP_TX_REF_FUNCTION ackFnc, const void* param)
+{
+#if (_TCP_TX_REF_ENABLE)
+    uint16_t wFreeTxSpace;
+    TCP_TX_REF_BUFF* pRef;
+    TCB_STUB* pSkt; 
+    
+    if(len == 0 || pBuff == 0 || (pSkt = _TcpSocketChk(hTCP)) == 0)
+    {
+        return false;
+    }
+
+    wFreeTxSpace = _TCPIsPutReady(pSkt);
+    if(wFreeTxSpace < len)
+    {   // not enough room in the socket buffer
+        if(_TCP_TxPktValid(pSkt))
+        {
+            _TcpFlush(pSkt);
+        }
+        return false;
+    }
+
+    pRef = (TCP_TX_REF_BUFF*)TCPIP_HEAP_Malloc(tcpHeapH, sizeof(*pRef));
+    if(pRef == 0)
+    {   // out of memory
+        return false;
+    }
+
+    pRef->pBuff = pBuff;
+    pRef->fifoStart = pSkt->txHead;
+    pRef->buffLen = len;
+    pRef->ackLen = 0;
+    pRef->ackFnc = ackFnc;
+    pRef->ackParam = param;
+
+    // queue the buffer before making its data visible to the TX thread
+    OSAL_CRITSECT_DATA_TYPE status = OSAL_CRIT_Enter(OSAL_CRIT_TYPE_LOW);
+    TCPIP_Helper_SingleListTailAdd(&pSkt->txRefList, (SGL_LIST_NODE*)pRef);
+    OSAL_CRIT_Leave(OSAL_CRIT_TYPE_LOW, status);
+
+    // reserve the buffer size in the TX FIFO; no data copy
+    pSkt->txChkStart = 0;
+    pSkt->txHead += len;
+    if(pSkt->txHead >= pSkt->txEnd)
+    {
+        pSkt->txHead -= pSkt->txEnd - pSkt->txStart;
+    }
+
+    _TcpPutFlush(pSkt, wFreeTxSpace - len);
+
+    return true;
+#else
+    return false;
+#endif  // (_TCP_TX_REF_ENABLE)
+}
+
+#if (_TCP_TX_CHKSUM_CACHE)
+// copies user data to the TX FIFO
+// adds it to the pending data checksum, if this is valid
+static void _TcpTxChkCopy(TCB_STUB* pSkt, uint8_t* pDst, const uint8_t* pSrc, uint16_t len)
+{
+    uint16_t segChkSum;
+
+    if(pSkt->txChkStart == 0)
+    {
+        TCPIP_Helper_Memcpy(pDst, pSrc, (uint32_t)len);
+        return;
+    }
+
+    segChkSum = ~TCPIP_Helper_MemcpyChecksum(pDst, pSrc, len, 0);
+    if((pSkt->txChkLen & 0x1) != 0)
+    {
+        segChkSum = TCPIP_Helper_htons(segChkSum);
+    }
+    pSkt->txChkSum += segChkSum;
+    pSkt->txChkLen += len;
+}
+#endif  // (_TCP_TX_CHKSUM_CACHE)
+
+// transmits the data just added to the TX FIFO or arms the auto transmit timer
+// freeSpace is the TX FIFO free space after the data was added
+static void _TcpPutFlush(TCB_STUB* pSkt, uint16_t freeSpace)
+{
     bool    toFlush = false;
     bool    toSetFlag = false;
     if(pSkt->txHead != pSkt->txUnackedTail)
@@ -2686,7 +3643,7 @@ uint16_t TCPIP_TCP_ArrayPut(TCP_SOCKET hTCP, const uint8_t* data, uint16_t len)
 
         if(pSkt->flags.halfThresFlush != 0)
         {
-            if(pSkt->Flags.bHalfFullFlush == 0 && wFreeTxSpace <=  ((pSkt->txEnd - pSkt->txStart) >> 1) )
+            if(pSkt->Flags.bHalfFullFlush == 0 && freeSpace <=  ((pSkt->txEnd - pSkt->txStart) >> 1) )
             {   // Send current payload if crossing the half buffer threshold
                 // This improves performance with the delayed acknowledgement algorithm
                 toFlush = true;
@@ -2715,17 +3672,137 @@ uint16_t TCPIP_TCP_ArrayPut(TCP_SOCKET hTCP, const uint8_t* data, uint16_t len)
     {
         pSkt->Flags.bTimer2Enabled = true;
         pSkt->eventTime2 = SYS_TMR_TickCountGet() + (TCPIP_TCP_AUTO_TRANSMIT_TIMEOUT_VAL * sysTickFreq)/1000;
+        _TcpTimerUpdate(pSkt);
     }
+}
 
-    return wActualLen + wRightLen;
+#if (_TCP_TX_REF_ENABLE)
+// returns the user buffer data of a segment starting at txUnackedTail
+// or 0 if the segment data is in the TX FIFO.
+// *pLen is limited so that the segment does not cross
+// the boundary between the FIFO data and a user buffer.
+static uint8_t* _TcpTxRefSource(TCB_STUB* pSkt, uint32_t* pLen)
+{
+    TCP_TX_REF_BUFF* pRef;
+    int32_t     segOffs, refOffs, refLen;
+    int32_t     fifoSize = pSkt->txEnd - pSkt->txStart;
+    uint32_t    maxLen = 0;
+    uint8_t*    pData = 0;
+
+    // offsets from the TX FIFO tail
+    if((segOffs = pSkt->txUnackedTail - pSkt->txTail) < 0)
+    {
+        segOffs += fifoSize;
+    }
+
+    for(pRef = (TCP_TX_REF_BUFF*)pSkt->txRefList.head; pRef != 0; pRef = pRef->next)
+    {
+        if((refOffs = pRef->fifoStart - pSkt->txTail) < 0)
+        {
+            refOffs += fifoSize;
+        }
+
+        if(segOffs < refOffs)
+        {   // FIFO data up to this buffer
+            maxLen = refOffs - segOffs;
+            break;
+        }
+
+        refLen = pRef->buffLen - pRef->ackLen;
+        if(segOffs < refOffs + refLen)
+        {   // inside this buffer
+            segOffs -= refOffs;
+            maxLen = refLen - segOffs;
+            pData = (uint8_t*)pRef->pBuff + pRef->ackLen + segOffs;
+            break;
+        }
+    }
+
+    if(maxLen != 0 && *pLen > maxLen)
+    {
+        *pLen = maxLen;
+        pSkt->Flags.bTXASAPWithoutTimerReset = 1;
+    }
+
+    return pData;
+}
+
+// updates the user buffers when ackBytes starting at oldTail were acknowledged
+static void _TcpTxRefAck(TCB_STUB* pSkt, const uint8_t* oldTail, uint32_t ackBytes)
+{
+    TCP_TX_REF_BUFF* pRef;
+    int32_t     refOffs;
+    uint32_t    refAck;
+    int32_t     fifoSize = pSkt->txEnd - pSkt->txStart;
+
+    while((pRef = (TCP_TX_REF_BUFF*)pSkt->txRefList.head) != 0)
+    {
+        if((refOffs = pRef->fifoStart - oldTail) < 0)
+        {
+            refOffs += fifoSize;
+        }
+
+        if(refOffs >= ackBytes)
+        {   // not reached
+            break;
+        }
+
+        refAck = ackBytes - refOffs;
+        if(refAck < pRef->buffLen - pRef->ackLen)
+        {   // partially acknowledged
+            pRef->ackLen += refAck;
+            pRef->fifoStart += refAck;
+            if(pRef->fifoStart >= pSkt->txEnd)
+            {
+                pRef->fifoStart -= fifoSize;
+            }
+            break;
+        }
+
+        // done with this buffer
+        OSAL_CRITSECT_DATA_TYPE status = OSAL_CRIT_Enter(OSAL_CRIT_TYPE_LOW);
+        TCPIP_Helper_SingleListHeadRemove(&pSkt->txRefList);
+        OSAL_CRIT_Leave(OSAL_CRIT_TYPE_LOW, status);
+
+        if(pRef->ackFnc != 0)
+        {
+            (*pRef->ackFnc)(pSkt->sktIx, pRef->pBuff, true, pRef->ackParam);
+        }
+        TCPIP_HEAP_Free(tcpHeapH, pRef);
+    }
+}
+
+// releases all the user buffers queued on the socket
+static void _TcpTxRefRelease(TCB_STUB* pSkt, bool acked)
+{
+    TCP_TX_REF_BUFF* pRef;
+
+    while(true)
+    {
+        OSAL_CRITSECT_DATA_TYPE status = OSAL_CRIT_Enter(OSAL_CRIT_TYPE_LOW);
+        pRef = (TCP_TX_REF_BUFF*)TCPIP_Helper_SingleListHeadRemove(&pSkt->txRefList);
+        OSAL_CRIT_Leave(OSAL_CRIT_TYPE_LOW, status);
+
+        if(pRef == 0)
+        {
+            break;
+        }
+
+        if(pRef->ackFnc != 0)
+        {
+            (*pRef->ackFnc)(pSkt->sktIx, pRef->pBuff, acked, pRef->ackParam);
+        }
+        TCPIP_HEAP_Free(tcpHeapH, pRef);
+    }
 }
+#endif  // (_TCP_TX_REF_ENABLE)
 
 static bool _TCPNeedSend(TCB_STUB* pSkt)
 {
 
     if(pSkt->txHead != pSkt->txUnackedTail)
     {   // something to send
-        uint16_t toSendData, canSend;
+        uint16_t toSendData, canSend, sendWindow;
 
         // check how much we can send
         if(pSkt->txHead > pSkt->txUnackedTail)
@@ -2737,9 +3814,10 @@ static bool _TCPNeedSend(TCB_STUB* pSkt)
             toSendData = (pSkt->txEnd - pSkt->txUnackedTail) + (pSkt->txHead - pSkt->txStart);
         }
 
-        if(toSendData > pSkt->remoteWindow)
+        sendWindow = _TcpSendWindow(pSkt);
+        if(toSendData > sendWindow)
         {
-            canSend = pSkt->remoteWindow;
+            canSend = sendWindow;
         }
         else
         {
@@ -2887,21 +3965,70 @@ uint16_t TCPIP_TCP_Discard(TCP_SOCKET hTCP)
             pSkt->rxTail = pSkt->rxHead;
             _TCPSendWinIncUpdate(pSkt);
         }
+        pSkt->rxLent = 0;
     }
 
     return nBytes;
 }
 
-// checks if a Window increased update is needed
-// returns true if it was issued, false otherwise
-// tries to avoid the Silly Window Syndrome (SWS) on the RX side
-// it will send the Win update if all RX buffer is available
-static bool _TCPSendWinIncUpdate(TCB_STUB* pSkt)
+int TCPIP_TCP_RxSegmentsGet(TCP_SOCKET hTCP, TCP_RX_SEGMENT* pSegs, int nSegs)
 {
-    uint16_t    oldWin, newWin, minWinInc, rxBuffSz;
-    bool    toAdvertise = false;
+    uint16_t wGetReadyCount;
+    uint16_t RightLen;
+    TCB_STUB* pSkt; 
 
-    // previously advertised window
+    if(pSegs == 0 || nSegs <= 0 || (pSkt = _TcpSocketChk(hTCP)) == 0 || (wGetReadyCount = _TCPIsGetReady(pSkt)) == 0)
+    {
+        return 0;
+    }
+
+    // See if the data wraps around
+    RightLen = wGetReadyCount;
+    if(pSkt->rxTail + wGetReadyCount > pSkt->rxEnd)
+    {
+        RightLen = pSkt->rxEnd - pSkt->rxTail + 1;
+    }
+
+    pSegs->pData = pSkt->rxTail;
+    pSegs->dataLen = RightLen;
+    pSkt->rxLent = RightLen;
+
+    if(RightLen == wGetReadyCount || nSegs == 1)
+    {
+        return 1;
+    }
+
+    pSegs++;
+    pSegs->pData = pSkt->rxStart;
+    pSegs->dataLen = wGetReadyCount - RightLen;
+    pSkt->rxLent = wGetReadyCount;
+
+    return 2;
+}
+
+uint16_t TCPIP_TCP_RxRelease(TCP_SOCKET hTCP, uint16_t nBytes)
+{
+    TCB_STUB* pSkt = _TcpSocketChk(hTCP); 
+
+    if(pSkt == 0)
+    {
+        return 0;
+    }
+
+    pSkt->rxLent = 0;   // done with the loan
+    return TCPIP_TCP_ArrayGet(hTCP, 0, nBytes);
+}
+
+// checks if a Window increased update is needed
+// returns true if it was issued, false otherwise
+// tries to avoid the Silly Window Syndrome (SWS) on the RX side
+// it will send the Win update if all RX buffer is available
+static bool _TCPSendWinIncUpdate(TCB_STUB* pSkt)
+{
+    uint16_t    oldWin, newWin, minWinInc, rxBuffSz;
+    bool    toAdvertise = false;
+
+    // previously advertised window
     oldWin = pSkt->localWindow;
 
     // new window is all the available RX buffer
@@ -3003,6 +4130,8 @@ uint16_t TCPIP_TCP_ArrayGet(TCP_SOCKET hTCP, uint8_t* buffer, uint16_t len)
         len = wGetReadyCount;
     }
 
+    pSkt->rxLent = 0;   // the FIFO data is moving
+
     // See if we need a two part get
     if(pSkt->rxTail + len > pSkt->rxEnd)
     {
@@ -3036,6 +4165,7 @@ uint16_t TCPIP_TCP_ArrayGet(TCP_SOCKET hTCP, uint8_t* buffer, uint16_t len)
             pSkt->Flags.bTimer2Enabled = true;
             pSkt->eventTime2 = SYS_TMR_TickCountGet() + (TCPIP_TCP_WINDOW_UPDATE_TIMEOUT_VAL * sysTickFreq)/1000;
         }
+        _TcpTimerUpdate(pSkt);
     }
 
     return len;
@@ -3458,334 +4588,416 @@ uint16_t TCPIP_TCP_Find(TCP_SOCKET hTCP, uint8_t cFind, uint16_t wStart, uint16_
     Data Processing Functions
   ***************************************************************************/
 
-// Performs periodic TCP tasks.
-static void TCPIP_TCP_Tick(void)
+// Performs the timed operations of a socket
+// All the socket timers are checked against the current time
+// so calling it before a timeout expires is harmless
+static void _TcpSocketTick(TCB_STUB* pSkt)
 {
-    TCP_SOCKET hTCP;
     bool bRetransmit;
     bool bCloseSocket;
     uint8_t vFlags;
     uint16_t w;
-    TCB_STUB* pSkt; 
 
-    // Periodically all "not closed" sockets must perform timed operations
-    for(hTCP = 0; hTCP < TcpSockets; hTCP++)
+    if(pSkt->smState == TCPIP_TCP_STATE_CLIENT_WAIT_CONNECT)
     {
-        pSkt = TCBStubs[hTCP];
-        if(pSkt != 0 && pSkt->smState != TCPIP_TCP_STATE_CLIENT_WAIT_CONNECT)
-        {   // existing socket
-            vFlags = 0x00;
-            bRetransmit = false;
-            bCloseSocket = false;
-
-            // Transmit ASAP data 
-            if(pSkt->Flags.bTXASAP || pSkt->Flags.bTXASAPWithoutTimerReset)
-            {
-                vFlags = ACK;
-                bRetransmit = pSkt->Flags.bTXASAPWithoutTimerReset;
-            }
+        return;
+    }
 
-            // Perform any needed window updates and data transmissions
-            if(pSkt->Flags.bTimer2Enabled)
-            {
-                // See if the timeout has occured, and we need to send a new window update and pending data
-                if((int32_t)(SYS_TMR_TickCountGet() - pSkt->eventTime2) >= 0)
-                {
-                    vFlags = ACK;
-                }
-            }
+    vFlags = 0x00;
+    bRetransmit = false;
+    bCloseSocket = false;
 
-            // Process Delayed ACKnowledgement timer
-            if(pSkt->Flags.bDelayedACKTimerEnabled)
-            {
-                // See if the timeout has occured and delayed ACK needs to be sent
-                if((int32_t)(SYS_TMR_TickCountGet() - pSkt->delayedACKTime) >= 0)
-                {
-                    vFlags = ACK;
-                }
-            }
+    // Transmit ASAP data 
+    if(pSkt->Flags.bTXASAP || pSkt->Flags.bTXASAPWithoutTimerReset)
+    {
+        vFlags = ACK;
+        bRetransmit = pSkt->Flags.bTXASAPWithoutTimerReset;
+    }
+
+    // Perform any needed window updates and data transmissions
+    if(pSkt->Flags.bTimer2Enabled)
+    {
+        // See if the timeout has occured, and we need to send a new window update and pending data
+        if((int32_t)(SYS_TMR_TickCountGet() - pSkt->eventTime2) >= 0)
+        {
+            vFlags = ACK;
+        }
+    }
+
+    // Process Delayed ACKnowledgement timer
+    if(pSkt->Flags.bDelayedACKTimerEnabled)
+    {
+        // See if the timeout has occured and delayed ACK needs to be sent
+        if((int32_t)(SYS_TMR_TickCountGet() - pSkt->delayedACKTime) >= 0)
+        {
+            vFlags = ACK;
+        }
+    }
 
 #if  (TCPIP_TCP_CLOSE_WAIT_TIMEOUT != 0)
-            // Process TCPIP_TCP_STATE_CLOSE_WAIT timer
-            if(pSkt->smState == TCPIP_TCP_STATE_CLOSE_WAIT)
-            {
-                // Automatically close the socket on our end if the application 
-                // fails to call TCPIP_TCP_Disconnect() is a reasonable amount of time.
-                if((int32_t)(SYS_TMR_TickCountGet() - pSkt->closeWaitTime) >= 0)
-                {
-                    vFlags = FIN | ACK;
-                    _TcpSocketSetState(pSkt, TCPIP_TCP_STATE_LAST_ACK);
-                }
-            }
+    // Process TCPIP_TCP_STATE_CLOSE_WAIT timer
+    if(pSkt->smState == TCPIP_TCP_STATE_CLOSE_WAIT)
+    {
+        // Automatically close the socket on our end if the application 
+        // fails to call TCPIP_TCP_Disconnect() is a reasonable amount of time.
+        if((int32_t)(SYS_TMR_TickCountGet() - pSkt->closeWaitTime) >= 0)
+        {
+            vFlags = FIN | ACK;
+            _TcpSocketSetState(pSkt, TCPIP_TCP_STATE_LAST_ACK);
+        }
+    }
 #endif  // (TCPIP_TCP_CLOSE_WAIT_TIMEOUT != 0)
 
-            // Process FIN_WAIT2 timer
-            if(pSkt->smState == TCPIP_TCP_STATE_FIN_WAIT_2)
-            {
-                if((int32_t)(SYS_TMR_TickCountGet() - pSkt->closeWaitTime) >= 0)
-                {   // the other side failed to close its connection within the TCPIP_TCP_FIN_WAIT_2_TIMEOUT
-                    _TcpSend(pSkt, RST | ACK, SENDTCP_RESET_TIMERS);
+    // Process FIN_WAIT2 timer
+    if(pSkt->smState == TCPIP_TCP_STATE_FIN_WAIT_2)
+    {
+        if((int32_t)(SYS_TMR_TickCountGet() - pSkt->closeWaitTime) >= 0)
+        {   // the other side failed to close its connection within the TCPIP_TCP_FIN_WAIT_2_TIMEOUT
+            _TcpSend(pSkt, RST | ACK, SENDTCP_RESET_TIMERS);
 #if (TCPIP_TCP_MSL_TIMEOUT != 0)
-                    _TcpSocketSetState(pSkt, TCPIP_TCP_STATE_TIME_WAIT);
-                    pSkt->closeWaitTime = SYS_TMR_TickCountGet() + ((TCPIP_TCP_MSL_TIMEOUT * 2) * sysTickFreq);
+            _TcpSocketSetState(pSkt, TCPIP_TCP_STATE_TIME_WAIT);
+            pSkt->closeWaitTime = SYS_TMR_TickCountGet() + ((TCPIP_TCP_MSL_TIMEOUT * 2) * sysTickFreq);
 #else
-                    _TcpCloseSocket(pSkt, 0);
+            _TcpCloseSocket(pSkt, 0);
 #endif  // (TCPIP_TCP_MSL_TIMEOUT != 0)
-                    continue;
-                }
-            }
+            return;
+        }
+    }
 
 #if (TCPIP_TCP_MSL_TIMEOUT != 0)
-            // Process 2MSL timer
-            if(pSkt->smState == TCPIP_TCP_STATE_TIME_WAIT)
-            {
-                if((int32_t)(SYS_TMR_TickCountGet() - pSkt->closeWaitTime) >= 0)
-                {   // timeout expired, close the socket
-                    _TcpCloseSocket(pSkt, 0);
-                    continue;
-                }
-            }
+    // Process 2MSL timer
+    if(pSkt->smState == TCPIP_TCP_STATE_TIME_WAIT)
+    {
+        if((int32_t)(SYS_TMR_TickCountGet() - pSkt->closeWaitTime) >= 0)
+        {   // timeout expired, close the socket
+            _TcpCloseSocket(pSkt, 0);
+            return;
+        }
+    }
 #endif  // (TCPIP_TCP_MSL_TIMEOUT != 0)
 
-            if(vFlags)
-            {
-                _TcpSend(pSkt, vFlags, bRetransmit ? 0 : SENDTCP_RESET_TIMERS);
-            }
+    if(vFlags)
+    {
+        _TcpSend(pSkt, vFlags, bRetransmit ? 0 : SENDTCP_RESET_TIMERS);
+    }
 
-            // The TCPIP_TCP_STATE_LISTEN, and sometimes the TCPIP_TCP_STATE_ESTABLISHED 
-            // state don't need any timeout events, so see if the timer is enabled
-            if(!pSkt->Flags.bTimerEnabled)
+    // The TCPIP_TCP_STATE_LISTEN, and sometimes the TCPIP_TCP_STATE_ESTABLISHED 
+    // state don't need any timeout events, so see if the timer is enabled
+    if(!pSkt->Flags.bTimerEnabled)
+    {
+        if(pSkt->Flags.keepAlive)
+        {
+            // Only the established state has any use for keep-alives
+            if(pSkt->smState == TCPIP_TCP_STATE_ESTABLISHED)
             {
-                if(pSkt->Flags.keepAlive)
+                // If timeout has not occured, do not do anything.
+                if((int32_t)(SYS_TMR_TickCountGet() - pSkt->eventTime) < 0)
                 {
-                    // Only the established state has any use for keep-alives
-                    if(pSkt->smState == TCPIP_TCP_STATE_ESTABLISHED)
-                    {
-                        // If timeout has not occured, do not do anything.
-                        if((int32_t)(SYS_TMR_TickCountGet() - pSkt->eventTime) < 0)
-                        {
-                            continue;
-                        }
-
-                        // If timeout has occured and the connection appears to be dead (no 
-                        // responses from remote node at all), close the connection so the 
-                        // application doesn't sit around indefinitely with a useless socket 
-                        // that it thinks is still open
-                        if(pSkt->keepAliveCount == pSkt->keepAliveLim)
-                        {
-                            vFlags = pSkt->Flags.bServer;
-
-                            // Force an immediate FIN and RST transmission
-                            // Also back in the listening state immediately if a server socket.
-                            _TcpDisconnect(pSkt, true);
-                            pSkt->Flags.bServer = 1;    // force client socket non-closing
-                            _TcpAbort(pSkt, _TCP_ABORT_FLAG_REGULAR, TCPIP_TCP_SIGNAL_KEEP_ALIVE_TMO);
-
-                            // Prevent client mode sockets from getting reused by other applications.  
-                            // The application must call TCPIP_TCP_Disconnect()/TCPIP_TCP_Abort() with the handle to free this 
-                            // socket (and the handle associated with it)
-                            if(!vFlags)
-                            {
-                                pSkt->Flags.bServer = 0;    // restore the client socket
-                                _TcpSocketSetState(pSkt, TCPIP_TCP_STATE_CLIENT_WAIT_DISCONNECT);
-                            }
-
-                            continue;
-                        }
+                    return;
+                }
 
-                        // Otherwise, if a timeout occured, simply send a keep-alive packet
-                        _TcpSend(pSkt, ACK, SENDTCP_KEEP_ALIVE);
-                        pSkt->eventTime = SYS_TMR_TickCountGet() + (pSkt->keepAliveTmo * sysTickFreq)/1000;
+                // If timeout has occured and the connection appears to be dead (no 
+                // responses from remote node at all), close the connection so the 
+                // application doesn't sit around indefinitely with a useless socket 
+                // that it thinks is still open
+                if(pSkt->keepAliveCount == pSkt->keepAliveLim)
+                {
+                    vFlags = pSkt->Flags.bServer;
+
+                    // Force an immediate FIN and RST transmission
+                    // Also back in the listening state immediately if a server socket.
+                    _TcpDisconnect(pSkt, true);
+                    pSkt->Flags.bServer = 1;    // force client socket non-closing
+                    _TcpAbort(pSkt, _TCP_ABORT_FLAG_REGULAR, TCPIP_TCP_SIGNAL_KEEP_ALIVE_TMO);
+
+                    // Prevent client mode sockets from getting reused by other applications.  
+                    // The application must call TCPIP_TCP_Disconnect()/TCPIP_TCP_Abort() with the handle to free this 
+                    // socket (and the handle associated with it)
+                    if(!vFlags)
+                    {
+                        pSkt->Flags.bServer = 0;    // restore the client socket
+                        _TcpSocketSetState(pSkt, TCPIP_TCP_STATE_CLIENT_WAIT_DISCONNECT);
                     }
+
+                    return;
                 }
-                continue;
+
+                // Otherwise, if a timeout occured, simply send a keep-alive packet
+                _TcpSend(pSkt, ACK, SENDTCP_KEEP_ALIVE);
+                pSkt->eventTime = SYS_TMR_TickCountGet() + (pSkt->keepAliveTmo * sysTickFreq)/1000;
+            }
+        }
+        return;
+    }
+
+    // If timeout has not occured, do not do anything.
+    if((int32_t)(SYS_TMR_TickCountGet() - pSkt->eventTime) < 0 )
+    {
+        return;
+    }
+    
+    // A timeout has occured.  Respond to this timeout condition
+    // depending on what state this socket is in.
+    switch(pSkt->smState)
+    {
+        case TCPIP_TCP_STATE_SYN_SENT:
+            // Keep sending SYN until we hear from remote node.
+            // This may be for infinite time, in that case
+            // caller must detect it and do something.
+            vFlags = SYN;
+            bRetransmit = true;
+
+            // Exponentially increase timeout until we reach TCPIP_TCP_MAX_RETRIES attempts then stay constant
+            if(pSkt->retryCount >= (TCPIP_TCP_MAX_RETRIES - 1))
+            {
+                pSkt->retryCount = TCPIP_TCP_MAX_RETRIES - 1;
+                pSkt->retryInterval = ((TCPIP_TCP_START_TIMEOUT_VAL * sysTickFreq)/1000) << (TCPIP_TCP_MAX_RETRIES-1);
             }
+            break;
 
-            // If timeout has not occured, do not do anything.
-            if((int32_t)(SYS_TMR_TickCountGet() - pSkt->eventTime) < 0 )
+        case TCPIP_TCP_STATE_SYN_RECEIVED:
+            // We must receive ACK before timeout expires.
+            // If not, resend SYN+ACK.
+            // Abort, if maximum attempts counts are reached.
+            if(pSkt->retryCount < TCPIP_TCP_MAX_SYN_RETRIES)
             {
-                continue;
+                vFlags = SYN | ACK;
+                bRetransmit = true;
             }
-            
-            // A timeout has occured.  Respond to this timeout condition
-            // depending on what state this socket is in.
-            switch(pSkt->smState)
+            else
             {
-                case TCPIP_TCP_STATE_SYN_SENT:
-                    // Keep sending SYN until we hear from remote node.
-                    // This may be for infinite time, in that case
-                    // caller must detect it and do something.
+                if(pSkt->Flags.bServer)
+                {
+                    vFlags = RST | ACK;
+                    bCloseSocket = true;
+                }
+                else
+                {
                     vFlags = SYN;
-                    bRetransmit = true;
-
-                    // Exponentially increase timeout until we reach TCPIP_TCP_MAX_RETRIES attempts then stay constant
-                    if(pSkt->retryCount >= (TCPIP_TCP_MAX_RETRIES - 1))
-                    {
-                        pSkt->retryCount = TCPIP_TCP_MAX_RETRIES - 1;
-                        pSkt->retryInterval = ((TCPIP_TCP_START_TIMEOUT_VAL * sysTickFreq)/1000) << (TCPIP_TCP_MAX_RETRIES-1);
-                    }
-                    break;
-
-                case TCPIP_TCP_STATE_SYN_RECEIVED:
-                    // We must receive ACK before timeout expires.
-                    // If not, resend SYN+ACK.
-                    // Abort, if maximum attempts counts are reached.
-                    if(pSkt->retryCount < TCPIP_TCP_MAX_SYN_RETRIES)
-                    {
-                        vFlags = SYN | ACK;
-                        bRetransmit = true;
-                    }
-                    else
-                    {
-                        if(pSkt->Flags.bServer)
-                        {
-                            vFlags = RST | ACK;
-                            bCloseSocket = true;
-                        }
-                        else
-                        {
-                            vFlags = SYN;
-                        }
-                    }
-                    break;
+                }
+            }
+            break;
 
-                case TCPIP_TCP_STATE_ESTABLISHED:
-                    // Retransmit any unacknowledged data
-                    if(pSkt->retryCount < TCPIP_TCP_MAX_RETRIES)
-                    {
-                        vFlags = ACK;
-                        bRetransmit = true;
-                    }
-                    else
-                    {   // No response back for too long, close connection
-                        // This could happen, for instance, if the communication 
-                        // medium was lost
-                        _TcpSocketSetState(pSkt, TCPIP_TCP_STATE_FIN_WAIT_1);
-                        vFlags = FIN | ACK;
-                    }
-                    break;
+        case TCPIP_TCP_STATE_ESTABLISHED:
+            // Retransmit any unacknowledged data
+            if(pSkt->retryCount < TCPIP_TCP_MAX_RETRIES)
+            {
+                vFlags = ACK;
+                bRetransmit = true;
+            }
+            else
+            {   // No response back for too long, close connection
+                // This could happen, for instance, if the communication 
+                // medium was lost
+                _TcpSocketSetState(pSkt, TCPIP_TCP_STATE_FIN_WAIT_1);
+                vFlags = FIN | ACK;
+            }
+            break;
 
-                case TCPIP_TCP_STATE_FIN_WAIT_1:
-                    if(pSkt->retryCount < TCPIP_TCP_MAX_RETRIES)
-                    {
-                        // Send another FIN
-                        vFlags = FIN | ACK;
-                        bRetransmit = true;
-                    }
-                    else
-                    {   // Close on our own, we can't seem to communicate 
-                        // with the remote node anymore
-                        vFlags = RST | ACK;
+        case TCPIP_TCP_STATE_FIN_WAIT_1:
+            if(pSkt->retryCount < TCPIP_TCP_MAX_RETRIES)
+            {
+                // Send another FIN
+                vFlags = FIN | ACK;
+                bRetransmit = true;
+            }
+            else
+            {   // Close on our own, we can't seem to communicate 
+                // with the remote node anymore
+                vFlags = RST | ACK;
 #if (TCPIP_TCP_MSL_TIMEOUT != 0)
-                        _TcpSocketSetState(pSkt, TCPIP_TCP_STATE_TIME_WAIT);
+                _TcpSocketSetState(pSkt, TCPIP_TCP_STATE_TIME_WAIT);
 #else
-                        bCloseSocket = true;
+                bCloseSocket = true;
 #endif  // (TCPIP_TCP_MSL_TIMEOUT != 0)
-                    }
-                    break;
+            }
+            break;
 
-                case TCPIP_TCP_STATE_CLOSING:
-                    if(pSkt->retryCount < TCPIP_TCP_MAX_RETRIES)
-                    {
-                        // Send another ACK+FIN (the FIN is retransmitted 
-                        // automatically since it hasn't been acknowledged by 
-                        // the remote node yet)
-                        vFlags = ACK;
-                        bRetransmit = true;
-                    }
-                    else
-                    {   // Close on our own, we can't seem to communicate 
-                        // with the remote node anymore
-                        vFlags = RST | ACK;
+        case TCPIP_TCP_STATE_CLOSING:
+            if(pSkt->retryCount < TCPIP_TCP_MAX_RETRIES)
+            {
+                // Send another ACK+FIN (the FIN is retransmitted 
+                // automatically since it hasn't been acknowledged by 
+                // the remote node yet)
+                vFlags = ACK;
+                bRetransmit = true;
+            }
+            else
+            {   // Close on our own, we can't seem to communicate 
+                // with the remote node anymore
+                vFlags = RST | ACK;
 #if (TCPIP_TCP_MSL_TIMEOUT != 0)
-                        _TcpSocketSetState(pSkt, TCPIP_TCP_STATE_TIME_WAIT);
+                _TcpSocketSetState(pSkt, TCPIP_TCP_STATE_TIME_WAIT);
 #else
-                        bCloseSocket = true;
+                bCloseSocket = true;
 #endif  // (TCPIP_TCP_MSL_TIMEOUT != 0)
-                    }
-                    break;
-
-
-                case TCPIP_TCP_STATE_LAST_ACK:
-                    // Send some more FINs or close anyway
-                    if(pSkt->retryCount < TCPIP_TCP_MAX_RETRIES)
-                    {
-                        vFlags = FIN | ACK;
-                        bRetransmit = true;
-                    }
-                    else
-                    {
-                        vFlags = RST | ACK;
-                        bCloseSocket = true;
-                    }
-                    break;
-
-                default:    // case TCPIP_TCP_STATE_TIME_WAIT:
-                    break;
             }
+            break;
 
-            if(vFlags)
-            {
-                // Transmit all unacknowledged data over again
-                if(bRetransmit)
-                {
-                    // Set the appropriate retry time
-                    pSkt->retryCount++;
-                    pSkt->retryInterval <<= 1;
-
-                    // Calculate how many bytes we have to roll back and retransmit
-                    w = pSkt->txUnackedTail - pSkt->txTail;
-                    if(pSkt->txUnackedTail < pSkt->txTail)
-                        w += pSkt->txEnd - pSkt->txStart;
-
-                    // Perform roll back of local SEQuence counter, remote window 
-                    // adjustment, and cause all unacknowledged data to be 
-                    // retransmitted by moving the unacked tail pointer.
-                    pSkt->MySEQ -= w;
-                    pSkt->remoteWindow += w;
-                    pSkt->txUnackedTail = pSkt->txTail;     
-                    _TcpSend(pSkt, vFlags, 0);
-                }
-                else
-                {
-                    _TcpSend(pSkt, vFlags, SENDTCP_RESET_TIMERS);
-                }
 
+        case TCPIP_TCP_STATE_LAST_ACK:
+            // Send some more FINs or close anyway
+            if(pSkt->retryCount < TCPIP_TCP_MAX_RETRIES)
+            {
+                vFlags = FIN | ACK;
+                bRetransmit = true;
             }
-
-            if(bCloseSocket)
+            else
             {
-                _TcpCloseSocket(pSkt, 0);
+                vFlags = RST | ACK;
+                bCloseSocket = true;
             }
-        }
+            break;
+
+        default:    // case TCPIP_TCP_STATE_TIME_WAIT:
+            break;
     }
 
-}
+    if(vFlags)
+    {
+        // Transmit all unacknowledged data over again
+        if(bRetransmit)
+        {
+            // Set the appropriate retry time
+            pSkt->retryCount++;
+            pSkt->retryInterval <<= 1;
+            _TcpCongTimeout(pSkt);
 
+            // Calculate how many bytes we have to roll back and retransmit
+            w = pSkt->txUnackedTail - pSkt->txTail;
+            if(pSkt->txUnackedTail < pSkt->txTail)
+                w += pSkt->txEnd - pSkt->txStart;
 
-#if defined (TCPIP_STACK_USE_IPV6)
-static TCPIP_MAC_PKT_ACK_RES TCPIP_TCP_ProcessIPv6(TCPIP_MAC_PACKET* pRxPkt)
-{
-    TCP_HEADER      *pTCPHdr;
-    uint16_t        dataLen;
-    uint8_t         optionsSize;
-    const IPV6_ADDR*    localIP;
-    const IPV6_ADDR*    remoteIP;
-    TCB_STUB*       pSkt; 
-    TCPIP_NET_IF*       pPktIf;
-    TCPIP_TCP_SIGNAL_FUNCTION sigHandler;
-    const void*         sigParam;
-    uint16_t            sigMask;
-    TCPIP_MAC_PKT_ACK_RES ackRes;
-    TCPIP_TCP_SIGNAL_TYPE sktEvent = 0;
+            // Perform roll back of local SEQuence counter, remote window 
+            // adjustment, and cause all unacknowledged data to be 
+            // retransmitted by moving the unacked tail pointer.
+            pSkt->MySEQ -= w;
+            pSkt->remoteWindow += w;
+            pSkt->txUnackedTail = pSkt->txTail;     
+            pSkt->optFlags.rttTiming = 0;
+            _TcpSend(pSkt, vFlags, 0);
+        }
+        else
+        {
+            _TcpSend(pSkt, vFlags, SENDTCP_RESET_TIMERS);
+        }
 
-    if(!TCPIP_IPV6_AddressesGet(pRxPkt, &localIP, &remoteIP))
-    {
-        return TCPIP_MAC_PKT_ACK_STRUCT_ERR;
     }
 
-    dataLen = pRxPkt->totTransportLen;
-
+    if(bCloseSocket)
+    {
+        _TcpCloseSocket(pSkt, 0);
+    }
+}
+
+// Performs periodic TCP tasks.
+// Only the sockets linked in the timer wheel slots that have passed are processed
+static void TCPIP_TCP_Tick(void)
+{
+    int ix, nDue, nSlots;
+    TCB_STUB* pSkt; 
+    TCB_STUB **pPrev;
+    uint32_t tickNow = SYS_TMR_TickCountGet();
+
+    // collect the expired sockets
+    nDue = 0;
+    OSAL_CRITSECT_DATA_TYPE status = OSAL_CRIT_Enter(OSAL_CRIT_TYPE_LOW);
+    for(nSlots = 0; nSlots < _TCP_TIMER_WHEEL_SLOTS && (int32_t)(tickNow - tcpTmrTime) >= 0; nSlots++)
+    {
+        pPrev = tcpTmrWheel + tcpTmrSlot;
+        while((pSkt = *pPrev) != 0)
+        {
+            if((int32_t)(tickNow - pSkt->tmrTime) >= 0)
+            {   // expired; remove it from the wheel
+                *pPrev = pSkt->tmrNext;
+                pSkt->tmrHead = 0;
+                tcpTmrDue[nDue++] = pSkt->sktIx;
+            }
+            else
+            {   // due at a next revolution
+                pPrev = &pSkt->tmrNext;
+            }
+        }
+
+        tcpTmrSlot = (tcpTmrSlot + 1) % _TCP_TIMER_WHEEL_SLOTS;
+        tcpTmrTime += tcpTmrSlotTicks;
+    }
+
+    if((int32_t)(tickNow - tcpTmrTime) >= 0)
+    {   // the wheel fell behind more than a revolution
+        // collect all the sockets, they'll be rescheduled relative to the new wheel time
+        for(ix = 0; ix < _TCP_TIMER_WHEEL_SLOTS; ix++)
+        {
+            while((pSkt = tcpTmrWheel[ix]) != 0)
+            {
+                tcpTmrWheel[ix] = pSkt->tmrNext;
+                pSkt->tmrHead = 0;
+                tcpTmrDue[nDue++] = pSkt->sktIx;
+            }
+        }
+        tcpTmrTime = tickNow + tcpTmrSlotTicks;
+    }
+    OSAL_CRIT_Leave(OSAL_CRIT_TYPE_LOW, status);
+
+    // process the collected sockets
+    for(ix = 0; ix < nDue; ix++)
+    {
+        if((pSkt = TCBStubs[tcpTmrDue[ix]]) != 0)
+        {
+            if((int32_t)(tickNow - pSkt->tmrTime) >= 0)
+            {
+                _TcpSocketTick(pSkt);
+            }
+
+            if(TCBStubs[tcpTmrDue[ix]] == pSkt)
+            {   // still alive
+#if (_TCP_TIME_WAIT_ENABLE)
+                if((pSkt->smState == TCPIP_TCP_STATE_TIME_WAIT || pSkt->smState == TCPIP_TCP_STATE_LAST_ACK) && _TcpTimeWaitEnter(pSkt))
+                {   // released to the TIME_WAIT table
+                    continue;
+                }
+#endif  // (_TCP_TIME_WAIT_ENABLE)
+                // schedule the next timeout
+                _TcpTimerUpdate(pSkt);
+            }
+        }
+    }
+
+#if (_TCP_SYN_BACKLOG_ENABLE)
+    _TcpSynBacklogTick(tickNow);
+#endif  // (_TCP_SYN_BACKLOG_ENABLE)
+#if (_TCP_TIME_WAIT_ENABLE)
+    _TcpTimeWaitTick(tickNow);
+#endif  // (_TCP_TIME_WAIT_ENABLE)
+#if (_TCP_AUTO_TUNE)
+    _TcpAutoTune(tickNow);
+#endif  // (_TCP_AUTO_TUNE)
+}
+
+#if defined (TCPIP_STACK_USE_IPV6)
+static TCPIP_MAC_PKT_ACK_RES TCPIP_TCP_ProcessIPv6(TCPIP_MAC_PACKET* pRxPkt)
+{
+    TCP_HEADER      *pTCPHdr;
+    uint16_t        dataLen;
+    uint8_t         optionsSize;
+    const IPV6_ADDR*    localIP;
+    const IPV6_ADDR*    remoteIP;
+    TCB_STUB*       pSkt; 
+    TCP_SOCKET      sktIx;
+    TCPIP_NET_IF*       pPktIf;
+    TCPIP_TCP_SIGNAL_FUNCTION sigHandler;
+    const void*         sigParam;
+    uint16_t            sigMask;
+    TCPIP_MAC_PKT_ACK_RES ackRes;
+    TCPIP_TCP_SIGNAL_TYPE sktEvent = 0;
+
+    if(!TCPIP_IPV6_AddressesGet(pRxPkt, &localIP, &remoteIP))
+    {
+        return TCPIP_MAC_PKT_ACK_STRUCT_ERR;
+    }
+
+    dataLen = pRxPkt->totTransportLen;
+
     pTCPHdr = (TCP_HEADER*)pRxPkt->pTransportLayer;
 
     pPktIf = (TCPIP_NET_IF*)pRxPkt->pktIf;
@@ -3834,7 +5046,15 @@ static TCPIP_MAC_PKT_ACK_RES TCPIP_TCP_ProcessIPv6(TCPIP_MAC_PACKET* pRxPkt)
 
         // extract header
         pRxPkt->pDSeg->segLen -=  optionsSize + sizeof(*pTCPHdr);    
+        sktIx = pSkt->sktIx;
         _TcpHandleSeg(pSkt, pTCPHdr, dataLen - optionsSize - sizeof(*pTCPHdr), pRxPkt, &sktEvent);
+        if(TCBStubs[sktIx] != pSkt)
+        {   // the socket was closed and killed; don't touch it anymore
+            pSkt = 0;
+            ackRes = TCPIP_MAC_PKT_ACK_RX_OK;
+            break;
+        }
+        _TcpTimerUpdate(pSkt);
 
         sigMask = _TcpSktGetSignalLocked(pSkt, &sigHandler, &sigParam);
         if((sktEvent &= sigMask) != 0)
@@ -3860,6 +5080,33 @@ static TCPIP_MAC_PKT_ACK_RES TCPIP_TCP_ProcessIPv6(TCPIP_MAC_PACKET* pRxPkt)
 }
 #endif  // defined (TCPIP_STACK_USE_IPV6)
 
+// writes the TCP options following the TCP header of the packet to be transmitted
+// optLen has to be a multiple of 4
+// returns false if there's no room in the packet
+static bool _TcpOptionsPut(TCB_STUB* pSkt, void* pSendPkt, TCP_HEADER* header, const uint8_t* pOpt, uint16_t optLen)
+{
+#if defined (TCPIP_STACK_USE_IPV6)
+    if(pSkt->addType == IP_ADDRESS_TYPE_IPV6)
+    {
+        if (TCPIP_IPV6_TxIsPutReady((IPV6_PACKET*)pSendPkt, optLen) < optLen)
+        {
+            return false;
+        }
+        TCPIP_IPV6_PutArray((IPV6_PACKET*)pSendPkt, pOpt, optLen);
+    }
+#endif  // defined (TCPIP_STACK_USE_IPV6)
+
+#if defined (TCPIP_STACK_USE_IPV4)
+    if(pSkt->addType == IP_ADDRESS_TYPE_IPV4)
+    {
+        memcpy(header + 1, pOpt, optLen);
+    }
+#endif  // defined (TCPIP_STACK_USE_IPV4)
+
+    header->DataOffset.Val += optLen >> 2;
+    return true;
+}
+
 /*****************************************************************************
   Function:
     static bool _TcpSend(pSkt, uint8_t vTCPFlags, uint8_t vSendFlags)
@@ -3886,9 +5133,14 @@ static TCPIP_MAC_PKT_ACK_RES TCPIP_TCP_ProcessIPv6(TCPIP_MAC_PACKET* pRxPkt)
 static _TCP_SEND_RES _TcpSend(TCB_STUB* pSkt, uint8_t vTCPFlags, uint8_t vSendFlags)
 {
     TCP_OPTIONS     options;
+    uint8_t         optBuff[TCP_OPTIONS_MAX_SIZE];
+    uint16_t        optLen;
     uint32_t        len, lenStart, lenEnd;
-    uint16_t        loadLen, hdrLen, maxPayload;
+    uint16_t        loadLen, hdrLen, maxPayload, sendWindow;
+    uint16_t        loadSum = 0;
     void*           pSendPkt;
+    TCPIP_MAC_PACKET* pBurst = 0;
+    uint8_t*        pRefData = 0;
     uint16_t        mss = 0;
     TCP_HEADER *    header = 0;
     TCPIP_TCP_SIGNAL_FUNCTION sigHandler;
@@ -3967,6 +5219,7 @@ static _TCP_SEND_RES _TcpSend(TCB_STUB* pSkt, uint8_t vTCPFlags, uint8_t vSendFl
 #endif  // defined (TCPIP_STACK_USE_IPV4)
 
         header->DataOffset.Val = 0;
+        optLen = 0;
 
         // Put all socket application data in the TX space
         if(vTCPFlags & (SYN | RST))
@@ -4007,38 +5260,72 @@ static _TCP_SEND_RES _TcpSend(TCB_STUB* pSkt, uint8_t vTCPFlags, uint8_t vSendFl
                 options.MaxSegSize.Val = (((mss)&0x00FF)<<8) | (((mss)&0xFF00)>>8);
                 pSkt->localMSS = mss;
 
-                header->DataOffset.Val   += sizeof(options) >> 2;
+                memcpy(optBuff, &options, sizeof(options));
+                optLen = sizeof(options);
 
-#if defined (TCPIP_STACK_USE_IPV6)
-                if(pSkt->addType == IP_ADDRESS_TYPE_IPV6)
+                // request the options in our SYN; reply with them only if the remote node requested them
+#if (_TCP_SACK_ENABLE)
+                if((vTCPFlags & ACK) == 0 || pSkt->optFlags.sackPermit != 0)
                 {
-                    if (TCPIP_IPV6_TxIsPutReady((IPV6_PACKET*)pSendPkt, sizeof (options)) < sizeof (options))
-                    {
-                        sendRes = _TCP_SEND_NO_MEMORY;
-                        break;
-                    }
-                    TCPIP_IPV6_PutArray((IPV6_PACKET*)pSendPkt, (uint8_t*)&options, sizeof(options));
+                    optBuff[optLen++] = TCP_OPTIONS_NO_OP;
+                    optBuff[optLen++] = TCP_OPTIONS_NO_OP;
+                    optBuff[optLen++] = TCP_OPTIONS_SACK_PERMITTED;
+                    optBuff[optLen++] = 2;
                 }
-#endif  // defined (TCPIP_STACK_USE_IPV6)
+#endif  // (_TCP_SACK_ENABLE)
 
-#if defined (TCPIP_STACK_USE_IPV4)
-                if(pSkt->addType == IP_ADDRESS_TYPE_IPV4)
+                if((vTCPFlags & ACK) == 0 ? pSkt->optFlags.wsEnable != 0 : pSkt->optFlags.wsPermit != 0)
                 {
-                    memcpy(header + 1, &options, sizeof(options));
+                    optBuff[optLen++] = TCP_OPTIONS_NO_OP;
+                    optBuff[optLen++] = TCP_OPTIONS_WINDOW_SCALE;
+                    optBuff[optLen++] = 3;
+                    optBuff[optLen++] = TCP_RCV_WINDOW_SHIFT;
+                }
+
+                if((vTCPFlags & ACK) == 0 ? pSkt->optFlags.tsEnable != 0 : pSkt->optFlags.tsPermit != 0)
+                {
+                    optLen += _TcpTimestampOptionSet(pSkt, optBuff + optLen);
+                }
+
+                if(!_TcpOptionsPut(pSkt, pSendPkt, header, optBuff, optLen))
+                {
+                    sendRes = _TCP_SEND_NO_MEMORY;
+                    break;
                 }
-#endif  // defined (TCPIP_STACK_USE_IPV4)
 
                 if(pSkt->MySEQ == 0)
                 {   // Set Initial Sequence Number (ISN)
                     pSkt->MySEQ = _TCP_SktSetSequenceNo(pSkt);
+                    pSkt->sndMaxSEQ = pSkt->MySEQ;
                 }
             }
         }
         else
         {
+            // timestamps are carried by all segments once negotiated
+            if(pSkt->optFlags.tsPermit != 0)
+            {
+                optLen = _TcpTimestampOptionSet(pSkt, optBuff);
+            }
+
+#if (_TCP_SACK_ENABLE)
+            // report the out-of-order data we have
+            if((vTCPFlags & ACK) != 0 && pSkt->optFlags.sackPermit != 0 && pSkt->nOooBlocks != 0)
+            {
+                optLen += _TcpSackOptionSet(pSkt, optBuff + optLen, (TCP_OPTIONS_MAX_SIZE - 4 - optLen) / 8);
+            }
+#endif  // (_TCP_SACK_ENABLE)
+
+            if(optLen != 0 && !_TcpOptionsPut(pSkt, pSendPkt, header, optBuff, optLen))
+            {
+                sendRes = _TCP_SEND_NO_MEMORY;
+                break;
+            }
+
             // Begin copying any application data over to the TX space
             maxPayload = pSkt->wRemoteMSS;
-            if(pSkt->txHead == pSkt->txUnackedTail || pSkt->remoteWindow == 0)
+            sendWindow = _TcpSendWindow(pSkt);
+            if(pSkt->txHead == pSkt->txUnackedTail || sendWindow == 0)
             {   // either all caught up on data TX or cannot send anything
                 len = 0;
             }
@@ -4067,12 +5354,15 @@ static _TCP_SEND_RES _TcpSend(TCB_STUB* pSkt, uint8_t vTCPFlags, uint8_t vSendFl
                     }
                 }
 
+                // the MSS does not include the TCP options: timestamps and SACK blocks
+                maxPayload -= optLen;
+
                 if(pSkt->txHead > pSkt->txUnackedTail)
                 {
                     len = pSkt->txHead - pSkt->txUnackedTail;
-                    if(len > pSkt->remoteWindow)
+                    if(len > sendWindow)
                     {
-                        len = pSkt->remoteWindow;
+                        len = sendWindow;
                     }
 
                     if(len > maxPayload)
@@ -4081,8 +5371,12 @@ static _TCP_SEND_RES _TcpSend(TCB_STUB* pSkt, uint8_t vTCPFlags, uint8_t vSendFl
                         pSkt->Flags.bTXASAPWithoutTimerReset = 1;
                     }
 
+#if (_TCP_TX_REF_ENABLE)
+                    pRefData = _TcpTxRefSource(pSkt, &len);
+#endif  // (_TCP_TX_REF_ENABLE)
+
                     // link application data into the TX packet
-                    _TCP_PayloadSet(pSkt, pSendPkt, pSkt->txUnackedTail, len, 0, 0);
+                    _TCP_PayloadSet(pSkt, pSendPkt, pRefData != 0 ? pRefData : pSkt->txUnackedTail, len, 0, 0);
                     pSkt->txUnackedTail += len;
                 }
                 else
@@ -4090,8 +5384,8 @@ static _TCP_SEND_RES _TcpSend(TCB_STUB* pSkt, uint8_t vTCPFlags, uint8_t vSendFl
                     lenEnd = pSkt->txEnd - pSkt->txUnackedTail;
                     len = lenEnd + pSkt->txHead - pSkt->txStart;
 
-                    if(len > pSkt->remoteWindow)
-                        len = pSkt->remoteWindow;
+                    if(len > sendWindow)
+                        len = sendWindow;
 
                     if(len > maxPayload)
                     {
@@ -4099,6 +5393,10 @@ static _TCP_SEND_RES _TcpSend(TCB_STUB* pSkt, uint8_t vTCPFlags, uint8_t vSendFl
                         pSkt->Flags.bTXASAPWithoutTimerReset = 1;
                     }
 
+#if (_TCP_TX_REF_ENABLE)
+                    pRefData = _TcpTxRefSource(pSkt, &len);
+#endif  // (_TCP_TX_REF_ENABLE)
+
                     if (lenEnd > len)
                     {
                         lenEnd = len;
@@ -4106,7 +5404,11 @@ static _TCP_SEND_RES _TcpSend(TCB_STUB* pSkt, uint8_t vTCPFlags, uint8_t vSendFl
                     lenStart = len - lenEnd;
 
                     // link application data into the TX packet
-                    if(lenStart)
+                    if(pRefData != 0)
+                    {   // user buffer; contiguous
+                        _TCP_PayloadSet(pSkt, pSendPkt, pRefData, len, 0, 0);
+                    }
+                    else if(lenStart)
                     {
                         _TCP_PayloadSet(pSkt, pSendPkt, pSkt->txUnackedTail, lenEnd, pSkt->txStart, lenStart);
                     }
@@ -4121,12 +5423,23 @@ static _TCP_SEND_RES _TcpSend(TCB_STUB* pSkt, uint8_t vTCPFlags, uint8_t vSendFl
                         pSkt->txUnackedTail -= pSkt->txEnd-pSkt->txStart;
                     }
                 }
+
+#if (_TCP_TX_CHKSUM_CACHE)
+                if(pSkt->txChkStart != 0)
+                {
+                    if(len == pSkt->txChkLen && pSkt->txUnackedTail == pSkt->txHead && pRefData == 0)
+                    {   // the segment carries exactly the data summed by TCPIP_TCP_ArrayPut
+                        loadSum = TCPIP_Helper_ChecksumFold(pSkt->txChkSum);
+                    }
+                    pSkt->txChkStart = 0;
+                }
+#endif  // (_TCP_TX_CHKSUM_CACHE)
             }
 
             // If we are to transmit a FIN, make sure we can put one in this packet
             if(pSkt->Flags.bTXFIN)
             {
-                if((len != pSkt->remoteWindow) && (len != maxPayload))
+                if((len != sendWindow) && (len != maxPayload) && (pSkt->txUnackedTail == pSkt->txHead))
                 {
                     vTCPFlags |= FIN;
                 }
@@ -4154,9 +5467,17 @@ static _TCP_SEND_RES _TcpSend(TCB_STUB* pSkt, uint8_t vTCPFlags, uint8_t vSendFl
             if(vSendFlags & SENDTCP_RESET_TIMERS)
             {
                 pSkt->retryCount = 0;
-                pSkt->retryInterval = (TCPIP_TCP_START_TIMEOUT_VAL * sysTickFreq)/1000;
+                pSkt->retryInterval = _TcpRetryIntervalGet(pSkt);
             }   
 
+            // time this segment if it's new data; retransmissions are not timed (Karn)
+            if(len != 0 && pSkt->optFlags.rttTiming == 0 && (int32_t)(pSkt->MySEQ - pSkt->sndMaxSEQ) >= 0)
+            {
+                pSkt->rttSEQ = pSkt->MySEQ + len;
+                pSkt->rttTime = SYS_TMR_TickCountGet();
+                pSkt->optFlags.rttTiming = 1;
+            }
+
             pSkt->eventTime = SYS_TMR_TickCountGet() + pSkt->retryInterval;
             pSkt->Flags.bTimerEnabled = 1;
         }
@@ -4193,6 +5514,7 @@ static _TCP_SEND_RES _TcpSend(TCB_STUB* pSkt, uint8_t vTCPFlags, uint8_t vSendFl
         header->DestPort            = pSkt->remotePort;
         header->SeqNumber           = pSkt->MySEQ;
         header->AckNumber           = pSkt->RemoteSEQ;
+        pSkt->tsLastAckSent         = pSkt->RemoteSEQ;
         header->Flags.bits.Reserved2    = 0;
         header->DataOffset.Reserved3    = 0;
         header->Flags.byte          = vTCPFlags;
@@ -4202,9 +5524,13 @@ static _TCP_SEND_RES _TcpSend(TCB_STUB* pSkt, uint8_t vTCPFlags, uint8_t vSendFl
         // Update our send sequence number and ensure retransmissions 
         // of SYNs and FINs use the right sequence number
         pSkt->MySEQ += (uint32_t)len;
+        if((int32_t)(pSkt->MySEQ - pSkt->sndMaxSEQ) > 0)
+        {
+            pSkt->sndMaxSEQ = pSkt->MySEQ;
+        }
+        hdrLen = optLen;
         if(vTCPFlags & SYN)
         {
-            hdrLen = sizeof(options);
 
             // SEG.ACK needs to be zero for the first SYN packet for compatibility 
             // with certain paranoid TCP/IP stacks, even though the ACK flag isn't 
@@ -4224,10 +5550,6 @@ static _TCP_SEND_RES _TcpSend(TCB_STUB* pSkt, uint8_t vTCPFlags, uint8_t vSendFl
                 pSkt->flags.bSYNSent = 1;
             }
         }
-        else
-        {
-            hdrLen = 0;
-        }
 
         if(vTCPFlags & FIN)
         {
@@ -4263,8 +5585,15 @@ static _TCP_SEND_RES _TcpSend(TCB_STUB* pSkt, uint8_t vTCPFlags, uint8_t vSendFl
         }
 #endif  // defined (TCPIP_STACK_USE_IPV6)
 
+#if (_TCP_TX_BURST > 1) && defined (TCPIP_STACK_USE_IPV4)
+        if(pSkt->addType == IP_ADDRESS_TYPE_IPV4 && loadLen != 0 && loadLen == maxPayload && (vTCPFlags & (SYN | FIN | RST)) == 0)
+        {   // full size segment; send more of the pending data in the same pass
+            pBurst = _Tcpv4BurstBuild(pSkt, header, hdrLen, loadLen);
+        }
+#endif  // (_TCP_TX_BURST > 1) && defined (TCPIP_STACK_USE_IPV4)
+
         // transmit the packet over the network
-        sendRes = _TCP_Flush (pSkt, pSendPkt, hdrLen, loadLen) ? _TCP_SEND_OK : _TCP_SEND_IP_FAIL;
+        sendRes = _TCP_Flush (pSkt, pSendPkt, hdrLen, loadLen, loadSum, pBurst) ? _TCP_SEND_OK : _TCP_SEND_IP_FAIL;
         if(loadLen && pSkt->retxTime == 0)
         {   // sending some payload
             _TCP_LoadRetxTmo(pSkt, true);
@@ -4288,6 +5617,7 @@ static _TCP_SEND_RES _TcpSend(TCB_STUB* pSkt, uint8_t vTCPFlags, uint8_t vSendFl
         } 
     }
 
+    _TcpTimerUpdate(pSkt);
     return sendRes;
 }
 
@@ -4299,8 +5629,12 @@ static _TCP_SEND_RES _TcpSend(TCB_STUB* pSkt, uint8_t vTCPFlags, uint8_t vSendFl
     Finds a suitable socket for a TCP segment.
 
   Description:
-    This function searches through the sockets and attempts to match one with
+    This function searches the socket hash tables and attempts to match one with
     a given TCP header.
+    The connected sockets are searched first, using the remote hash of the packet.
+    The listening sockets are searched by the destination port.
+    The IPv4 handshakes with the listening sockets are performed in the SYN backlog;
+    a listening socket is returned only when the handshake is completed.
     If a socket is found, a valid socket pointer it is returned. 
     Otherwise, a 0 pointer is returned.
     
@@ -4319,7 +5653,6 @@ static _TCP_SEND_RES _TcpSend(TCB_STUB* pSkt, uint8_t vTCPFlags, uint8_t vSendFl
   ***************************************************************************/
 static TCB_STUB* _TcpFindMatchingSocket(TCPIP_MAC_PACKET* pRxPkt, const void * remoteIP, const void * localIP, IP_ADDRESS_TYPE addressType)
 {
-    TCP_SOCKET hTCP;
     uint16_t hash;
     TCB_STUB* pSkt, *partialSkt;
     TCPIP_NET_IF* pPktIf;
@@ -4353,13 +5686,12 @@ static TCB_STUB* _TcpFindMatchingSocket(TCPIP_MAC_PACKET* pRxPkt, const void * r
             return 0;  // shouldn't happen
     }
 
-    // Loop through all sockets looking for a socket that is expecting this 
-    // packet or can handle it.
-    for(hTCP = 0; hTCP < TcpSockets; hTCP++)
+    // Search the bucket of the connected sockets for a socket that is expecting this packet.
+    // The hash is just a filter: the full tuple is checked
+    OSAL_CRITSECT_DATA_TYPE status = OSAL_CRIT_Enter(OSAL_CRIT_TYPE_LOW);
+    for(pSkt = tcpConnHash[hash % _TCP_SOCKET_HASH_BUCKETS]; pSkt != 0; pSkt = pSkt->hashNext)
     {
-        pSkt = TCBStubs[hTCP];
-
-        if(pSkt == 0 || pSkt->smState == TCPIP_TCP_STATE_CLIENT_WAIT_CONNECT)
+        if(pSkt->remoteHash != hash || h->DestPort != pSkt->localPort || h->SourcePort != pSkt->remotePort)
         {
             continue;
         }
@@ -4367,59 +5699,78 @@ static TCB_STUB* _TcpFindMatchingSocket(TCPIP_MAC_PACKET* pRxPkt, const void * r
         if( (pSkt->addType == IP_ADDRESS_TYPE_ANY || pSkt->addType == addressType) &&
                 (pSkt->pSktNet == 0 || pSkt->pSktNet == pPktIf) )
         {   // both network interface and address type match
-
             bool found = false;
 
-            if(pSkt->smState == TCPIP_TCP_STATE_LISTEN)
+#if defined (TCPIP_STACK_USE_IPV6)
+            if (addressType == IP_ADDRESS_TYPE_IPV6)
             {
-                // For listening ports, check if this is the correct port
-                if(pSkt->remoteHash == h->DestPort && partialSkt == 0)
+                if (!memcmp (TCPIP_IPV6_DestAddressGet(pSkt->pV6Pkt), remoteIP, sizeof (IPV6_ADDR)))
                 {
-                    partialSkt = pSkt;
+                    found = true;
                 }
-                continue;
             }
-            else if(pSkt->remoteHash != hash)
-            {// Ignore if the hash doesn't match
-                continue;
-            }
-
-            while(  h->DestPort == pSkt->localPort && h->SourcePort == pSkt->remotePort )  
-            {
-
-#if defined (TCPIP_STACK_USE_IPV6)
-                if (addressType == IP_ADDRESS_TYPE_IPV6)
-                {
-                    if (!memcmp (TCPIP_IPV6_DestAddressGet(pSkt->pV6Pkt), remoteIP, sizeof (IPV6_ADDR)))
-                    {
-                        found = true;
-                    }
-                    break;
-                }
 #endif  // defined (TCPIP_STACK_USE_IPV6)
 
 #if defined (TCPIP_STACK_USE_IPV4)
-                if (addressType == IP_ADDRESS_TYPE_IPV4)
+            if (addressType == IP_ADDRESS_TYPE_IPV4)
+            {
+                if (pSkt->destAddress.Val == ((IPV4_ADDR *)remoteIP)->Val)
                 {
-                    if (pSkt->destAddress.Val == ((IPV4_ADDR *)remoteIP)->Val)
-                    {
-                        found = true;
-                    }
-                    break;
+                    found = true;
                 }
+            }
 #endif  // defined (TCPIP_STACK_USE_IPV4)
 
+            if(found)
+            { 
                 break;
             }
+        }
+    }
 
-            if(found)
-            { 
-                pSkt->addType = addressType;
-                _TcpSocketBind(pSkt, pPktIf, (IP_MULTI_ADDRESS*)localIP);
-                return pSkt;    // bind to the correct interface
+    if(pSkt == 0)
+    {   // no connected socket; check for a listening one
+        // if multiple sockets listen on this port, the lowest socket index is selected
+        for(pSkt = tcpListenHash[h->DestPort % _TCP_SOCKET_HASH_BUCKETS]; pSkt != 0; pSkt = pSkt->hashNext)
+        {
+            if(pSkt->remoteHash == h->DestPort && (partialSkt == 0 || pSkt->sktIx < partialSkt->sktIx))
+            {
+                if( (pSkt->addType == IP_ADDRESS_TYPE_ANY || pSkt->addType == addressType) &&
+                        (pSkt->pSktNet == 0 || pSkt->pSktNet == pPktIf) )
+                {
+                    partialSkt = pSkt;
+                }
             }
         }
     }
+    OSAL_CRIT_Leave(OSAL_CRIT_TYPE_LOW, status);
+
+    if(pSkt != 0)
+    { 
+        pSkt->addType = addressType;
+        _TcpSocketBind(pSkt, pPktIf, (IP_MULTI_ADDRESS*)localIP);
+        return pSkt;    // bind to the correct interface
+    }
+
+#if (_TCP_TIME_WAIT_ENABLE)
+    if(addressType == IP_ADDRESS_TYPE_IPV4 && _TcpTimeWaitRx(pRxPkt, (const IPV4_ADDR*)remoteIP))
+    {   // segment for a connection in the TIME_WAIT table
+        return 0;
+    }
+#endif  // (_TCP_TIME_WAIT_ENABLE)
+
+#if (_TCP_SYN_BACKLOG_ENABLE)
+    TCP_SYN_ENTRY synEntry;     // connection completed in the backlog
+
+    synEntry.conn.remoteAddress.Val = 0;
+    if(addressType == IP_ADDRESS_TYPE_IPV4)
+    {   // the half-open connections are kept in the SYN backlog
+        if(!_TcpSynBacklogRx(pRxPkt, partialSkt, (const IPV4_ADDR*)remoteIP, (const IPV4_ADDR*)localIP, &synEntry))
+        {   // segment consumed by the backlog
+            return 0;
+        }
+    }
+#endif  // (_TCP_SYN_BACKLOG_ENABLE)
 
 
     // If there is a partial match, then a listening socket is currently 
@@ -4465,10 +5816,16 @@ static TCB_STUB* _TcpFindMatchingSocket(TCPIP_MAC_PACKET* pRxPkt, const void * r
         // success; bind it
         pSkt->addType = addressType;
         _TcpSocketBind(pSkt, pPktIf, (IP_MULTI_ADDRESS*)localIP);
-        pSkt->remoteHash = hash;
         pSkt->remotePort = h->SourcePort;
         pSkt->localPort = h->DestPort;
+        _TcpSocketRemoteHashSet(pSkt, hash);
         pSkt->txUnackedTail = pSkt->txStart;
+#if (_TCP_SYN_BACKLOG_ENABLE)
+        if(synEntry.conn.remoteAddress.Val != 0)
+        {   // the handshake was completed in the backlog
+            _TcpSynBacklogPromote(pSkt, &synEntry);
+        }
+#endif  // (_TCP_SYN_BACKLOG_ENABLE)
 
         // All done, and we have a match
         return pSkt;
@@ -4526,6 +5883,10 @@ static void _TcpSocketInitialize(TCB_STUB* pSkt, TCP_SOCKET hTCP, uint8_t* txBuf
     // Start out assuming worst case Maximum Segment Size (changes when MSS 
     // option is received from remote node)
     pSkt->wRemoteMSS = TCP_MIN_DEFAULT_MTU;
+    pSkt->flags.congCtrl = _TCP_CONGESTION_CONTROL;
+    pSkt->optFlags.wsEnable = _TCP_WINDOW_SCALE_ENABLE;
+    pSkt->optFlags.tsEnable = _TCP_TIMESTAMPS_ENABLE;
+    pSkt->optFlags.autoTune = _TCP_AUTO_TUNE;
 
     TCBStubs[hTCP] = pSkt;  // store it
     
@@ -4536,12 +5897,17 @@ static void _TcpSocketInitialize(TCB_STUB* pSkt, TCP_SOCKET hTCP, uint8_t* txBuf
 static void _TcpSocketSetIdleState(TCB_STUB* pSkt)
 {
 
-    pSkt->remoteHash = pSkt->localPort;
+    _TcpSocketRemoteHashSet(pSkt, pSkt->localPort);
     pSkt->txHead = pSkt->txStart;
     pSkt->txTail = pSkt->txStart;
     pSkt->txUnackedTail = pSkt->txStart;
+    pSkt->txChkStart = 0;
+#if (_TCP_TX_REF_ENABLE)
+    _TcpTxRefRelease(pSkt, false);
+#endif  // (_TCP_TX_REF_ENABLE)
     pSkt->rxHead = pSkt->rxStart;
     pSkt->rxTail = pSkt->rxStart;
+    pSkt->rxLent = 0;
     pSkt->Flags.bTimerEnabled = 0;
     pSkt->Flags.bTimer2Enabled = 0;
     pSkt->Flags.bDelayedACKTimerEnabled = 0;
@@ -4558,11 +5924,19 @@ static void _TcpSocketSetIdleState(TCB_STUB* pSkt)
     pSkt->flags.seqInc = 0;
     pSkt->flags.bSYNSent = 0;
     pSkt->retxTmo = pSkt->retxTime = 0;
+    pSkt->srtt = pSkt->rttVar = pSkt->rto = 0;
+    pSkt->nRttSamples = 0;
+    pSkt->optFlags.rttTiming = 0;
     pSkt->dupAckCnt = 0;    
     pSkt->MySEQ = 0;
-    pSkt->sHoleSize = -1;
+    pSkt->nOooBlocks = 0;
+    pSkt->optFlags.sackPermit = 0;
+    pSkt->optFlags.wsPermit = 0;
+    pSkt->optFlags.tsPermit = 0;
+    pSkt->sndWndShift = 0;
     pSkt->remoteWindow = 1;
     pSkt->maxRemoteWindow = 1;
+    _TcpCongInit(pSkt);
 
 
     // Note : no result of the explicit binding is maintained!
@@ -4758,50 +6132,1037 @@ static uint16_t _GetMaxSegSizeOption(TCP_HEADER* h)
     {
         vOption = *pOption++;
 
-        if(vOption == 0u)   // End of Options list
-            break;
+        if(vOption == 0u)   // End of Options list
+            break;
+
+        if(vOption == 1u)   // NOP option
+            continue;
+
+        if(vOption == 2u)   // Maximum Segment Size option
+        {
+            if(vOptionsBytes < 3u)
+                break;
+
+            wMSS = 0;
+
+            // Get option length
+            vOption = *pOption++;
+            if(vOption == 4u)
+            {// Retrieve MSS and swap value to little endian
+                ((uint8_t*)&wMSS)[1] = *pOption++;
+                ((uint8_t*)&wMSS)[0] = *pOption++;
+            }
+
+            if(wMSS < TCP_MIN_DEFAULT_MTU)
+                break;
+            if(wMSS > TCPIP_TCP_MAX_SEG_SIZE_TX)
+                return TCPIP_TCP_MAX_SEG_SIZE_TX;
+            else 
+                return wMSS;
+        }
+        else
+        { // Assume this is a multi byte option and throw it way
+            if(vOptionsBytes < 2u)
+                break;
+            vOption = *pOption++;
+            if(vOptionsBytes < vOption)
+                break;
+            pOption += vOption;
+            vOptionsBytes -= vOption;
+        }
+
+    }
+
+    // Did not find MSS option, return worst case default
+    return TCP_MIN_DEFAULT_MTU;
+}
+
+// searches the TCP header options for the optKind option having optLen length
+// returns a pointer to the option or 0 if not found
+static uint8_t* _TcpOptionFind(TCP_HEADER* h, uint8_t optKind, uint8_t optLen)
+{
+    uint8_t *pOption, *pEnd;
+
+    pOption = (uint8_t*)(h + 1);
+    pEnd = (uint8_t*)h + (h->DataOffset.Val << 2);
+
+    while(pOption < pEnd)
+    {
+        if(*pOption == TCP_OPTIONS_END_OF_LIST)
+        {
+            break;
+        }
+
+        if(*pOption == TCP_OPTIONS_NO_OP)
+        {
+            pOption++;
+            continue;
+        }
+
+        if(pOption + 1 >= pEnd || pOption[1] < 2 || pOption + pOption[1] > pEnd)
+        {   // malformed
+            break;
+        }
+
+        if(pOption[0] == optKind)
+        {
+            return pOption[1] == optLen ? pOption : 0;
+        }
+
+        pOption += pOption[1];
+    }
+
+    return 0;
+}
+
+// adds the [startSEQ, endSEQ) out-of-order block to the socket list
+// merges it with the existing overlapping/adjacent blocks
+static void _TcpRxOooAdd(TCB_STUB* pSkt, uint32_t startSEQ, uint32_t endSEQ)
+{
+    int ix, jx;
+    int nBlocks = pSkt->nOooBlocks;
+    TCP_RX_OOO_BLOCK* pBlk = pSkt->oooBlocks;
+
+    pSkt->oooLastSEQ = startSEQ;
+
+    // find the first block that doesn't end before the new one
+    for(ix = 0; ix < nBlocks; ix++)
+    {
+        if((int32_t)(pBlk[ix].endSEQ - startSEQ) >= 0)
+        {
+            break;
+        }
+    }
+
+    // extend over all the blocks that overlap or are adjacent
+    for(jx = ix; jx < nBlocks && (int32_t)(pBlk[jx].startSEQ - endSEQ) <= 0; jx++)
+    {
+        if((int32_t)(pBlk[jx].startSEQ - startSEQ) < 0)
+        {
+            startSEQ = pBlk[jx].startSEQ;
+        }
+        if((int32_t)(pBlk[jx].endSEQ - endSEQ) > 0)
+        {
+            endSEQ = pBlk[jx].endSEQ;
+        }
+    }
+
+    if(jx == ix)
+    {   // new hole; insert a new block
+        if(nBlocks == _TCP_RX_OOO_BLOCKS)
+        {   // full; drop the highest block, if it's above the new one
+            if(ix == nBlocks)
+            {
+                return;
+            }
+            nBlocks--;
+        }
+        memmove(pBlk + ix + 1, pBlk + ix, (nBlocks - ix) * sizeof(*pBlk));
+        nBlocks++;
+    }
+    else if(jx > ix + 1)
+    {   // multiple blocks coalesced into one
+        memmove(pBlk + ix + 1, pBlk + jx, (nBlocks - jx) * sizeof(*pBlk));
+        nBlocks -= jx - ix - 1;
+    }
+
+    pBlk[ix].startSEQ = startSEQ;
+    pBlk[ix].endSEQ = endSEQ;
+    pSkt->nOooBlocks = nBlocks;
+}
+
+// advances the socket RX head over the out-of-order blocks
+// that are now in sequence
+static void _TcpRxOooAdvance(TCB_STUB* pSkt)
+{
+    int ix;
+    uint32_t advance;
+    int nBlocks = pSkt->nOooBlocks;
+    TCP_RX_OOO_BLOCK* pBlk = pSkt->oooBlocks;
+
+    for(ix = 0; ix < nBlocks; ix++)
+    {
+        if((int32_t)(pBlk[ix].startSEQ - pSkt->RemoteSEQ) > 0)
+        {   // still a hole here
+            break;
+        }
+
+        advance = pBlk[ix].endSEQ - pSkt->RemoteSEQ;
+        if((int32_t)advance > 0)
+        {
+            pSkt->RemoteSEQ += advance;
+            pSkt->rxHead += advance;
+            if(pSkt->rxHead > pSkt->rxEnd)
+            {
+                pSkt->rxHead -= pSkt->rxEnd - pSkt->rxStart + 1;                            
+            }
+        }
+    }
+
+    if(ix != 0)
+    {
+        memmove(pBlk, pBlk + ix, (nBlocks - ix) * sizeof(*pBlk));
+        pSkt->nOooBlocks = nBlocks - ix;
+    }
+}
+
+// stores a 32 bit value in network order
+static __inline__ uint8_t* __attribute__((always_inline)) _TcpOptionPut32(uint8_t* pOpt, uint32_t val)
+{
+    *pOpt++ = (uint8_t)(val >> 24);
+    *pOpt++ = (uint8_t)(val >> 16);
+    *pOpt++ = (uint8_t)(val >> 8);
+    *pOpt++ = (uint8_t)val;
+    return pOpt;
+}
+
+// retrieves a 32 bit value stored in network order
+static __inline__ uint32_t __attribute__((always_inline)) _TcpOptionGet32(const uint8_t* pOpt)
+{
+    return ((uint32_t)pOpt[0] << 24) | ((uint32_t)pOpt[1] << 16) | ((uint32_t)pOpt[2] << 8) | pOpt[3];
+}
+
+// current value of the timestamp clock, 1 ms resolution
+static __inline__ uint32_t __attribute__((always_inline)) _TcpTimestampGet(void)
+{
+    return SYS_TMR_TickCountGet() / tcpTsTickDiv;
+}
+
+// builds the timestamps option
+// returns the option size
+static uint16_t _TcpTimestampOptionSet(TCB_STUB* pSkt, uint8_t* pOpt)
+{
+    pOpt[0] = TCP_OPTIONS_NO_OP;
+    pOpt[1] = TCP_OPTIONS_NO_OP;
+    pOpt[2] = TCP_OPTIONS_TIMESTAMP;
+    pOpt[3] = 10;
+    _TcpOptionPut32(pOpt + 4, _TcpTimestampGet());
+    // the echo reply is valid only when the ACK bit is set; 0 otherwise
+    _TcpOptionPut32(pOpt + 8, pSkt->optFlags.tsPermit != 0 ? pSkt->tsRecent : 0);
+
+    return 12;
+}
+
+// processes the options of a received SYN segment
+// and sets the socket negotiated options
+static void _TcpSynOptionsProcess(TCB_STUB* pSkt, TCP_HEADER* h)
+{
+    uint8_t* pOpt;
+
+    pSkt->optFlags.sackPermit = _TCP_SACK_ENABLE && _TcpOptionFind(h, TCP_OPTIONS_SACK_PERMITTED, 2) != 0;
+
+    pSkt->sndWndShift = 0;
+    pSkt->optFlags.wsPermit = 0;
+    if(pSkt->optFlags.wsEnable != 0 && (pOpt = _TcpOptionFind(h, TCP_OPTIONS_WINDOW_SCALE, 3)) != 0)
+    {
+        pSkt->sndWndShift = pOpt[2] > TCP_MAX_WINDOW_SHIFT ? TCP_MAX_WINDOW_SHIFT : pOpt[2];
+        pSkt->optFlags.wsPermit = 1;
+    }
+
+    pSkt->optFlags.tsPermit = 0;
+    if(pSkt->optFlags.tsEnable != 0 && (pOpt = _TcpOptionFind(h, TCP_OPTIONS_TIMESTAMP, 10)) != 0)
+    {
+        pSkt->tsRecent = _TcpOptionGet32(pOpt + 2);
+        pSkt->optFlags.tsPermit = 1;
+    }
+}
+
+#if (_TCP_SACK_ENABLE)
+
+// builds the SACK option for the out-of-order blocks
+// the block containing the most recent segment is reported first
+// returns the option size
+static uint16_t _TcpSackOptionSet(TCB_STUB* pSkt, uint8_t* pOpt, int maxBlocks)
+{
+    int ix, firstIx, nBlocks;
+    uint8_t* pBlkOpt;
+    TCP_RX_OOO_BLOCK* pBlk = pSkt->oooBlocks;
+
+    nBlocks = pSkt->nOooBlocks;
+    if(maxBlocks > _TCP_SACK_BLOCKS_MAX)
+    {
+        maxBlocks = _TCP_SACK_BLOCKS_MAX;
+    }
+    if(nBlocks > maxBlocks)
+    {
+        nBlocks = maxBlocks;
+    }
+
+    firstIx = 0;
+    for(ix = 0; ix < pSkt->nOooBlocks; ix++)
+    {
+        if((int32_t)(pSkt->oooLastSEQ - pBlk[ix].startSEQ) >= 0 && (int32_t)(pSkt->oooLastSEQ - pBlk[ix].endSEQ) < 0)
+        {
+            firstIx = ix;
+            break;
+        }
+    }
+
+    pOpt[0] = TCP_OPTIONS_NO_OP;
+    pOpt[1] = TCP_OPTIONS_NO_OP;
+    pOpt[2] = TCP_OPTIONS_SACK;
+    pOpt[3] = 2 + nBlocks * 8;
+
+    pBlkOpt = _TcpOptionPut32(pOpt + 4, pBlk[firstIx].startSEQ);
+    pBlkOpt = _TcpOptionPut32(pBlkOpt, pBlk[firstIx].endSEQ);
+    for(ix = 0; ix < pSkt->nOooBlocks && nBlocks > 1; ix++)
+    {
+        if(ix != firstIx)
+        {
+            pBlkOpt = _TcpOptionPut32(pBlkOpt, pBlk[ix].startSEQ);
+            pBlkOpt = _TcpOptionPut32(pBlkOpt, pBlk[ix].endSEQ);
+            nBlocks--;
+        }
+    }
+
+    return pBlkOpt - pOpt;
+}
+#endif  // (_TCP_SACK_ENABLE)
+
+#if (_TCP_SYN_BACKLOG_ENABLE) || (_TCP_TIME_WAIT_ENABLE)
+// control segments for the IPv4 connections that are not using a socket:
+// the SYN backlog and the compact TIME_WAIT table
+
+static void _Tcpv4CtrlTxAckFnc(TCPIP_MAC_PACKET* pPkt, const void* param)
+{
+    TCPIP_PKT_PacketFree(pPkt);
+}
+
+// sends a segment with no data for a connection without a socket
+// pOpt/optLen are the already formatted options, 4 bytes aligned 
+static bool _Tcpv4CtrlSend(const TCP_V4_CONN_ID* pConn, uint32_t seq, uint32_t ack, uint8_t flags, uint16_t window, const uint8_t* pOpt, uint16_t optLen)
+{
+    IPV4_PACKET*        pv4Pkt;
+    TCP_HEADER*         pTCPHdr;
+    uint16_t            hdrLen, checksum;
+    IPV4_PSEUDO_HEADER  pseudoHdr;
+    TCPIP_IPV4_PACKET_PARAMS pktParams;
+
+    pv4Pkt = (IPV4_PACKET*)TCPIP_PKT_SocketAlloc(sizeof(IPV4_PACKET), sizeof(TCP_HEADER), TCP_OPTIONS_MAX_SIZE, TCPIP_MAC_PKT_FLAG_IPV4 | TCPIP_MAC_PKT_FLAG_TX | TCPIP_MAC_PKT_FLAG_TCP);
+    if(pv4Pkt == 0)
+    {
+        return false;
+    }
+    TCPIP_PKT_PacketAcknowledgeSet(&pv4Pkt->macPkt, _Tcpv4CtrlTxAckFnc, 0);
+
+    pTCPHdr = (TCP_HEADER*)pv4Pkt->macPkt.pTransportLayer;
+    if(optLen != 0)
+    {
+        memcpy(pTCPHdr + 1, pOpt, optLen);
+    }
+    hdrLen = sizeof(TCP_HEADER) + optLen;
+
+    pTCPHdr->SourcePort         = pConn->localPort;
+    pTCPHdr->DestPort           = pConn->remotePort;
+    pTCPHdr->SeqNumber          = seq;
+    pTCPHdr->AckNumber          = ack;
+    pTCPHdr->DataOffset.Val     = hdrLen >> 2;
+    pTCPHdr->DataOffset.Reserved3   = 0;
+    pTCPHdr->Flags.bits.Reserved2   = 0;
+    pTCPHdr->Flags.byte         = flags;
+    pTCPHdr->Window             = window;
+    pTCPHdr->UrgentPointer      = 0;
+    pTCPHdr->Checksum           = 0;
+    _TcpSwapHeader(pTCPHdr);
+
+    pv4Pkt->srcAddress.Val = pConn->localAddress.Val;
+    pv4Pkt->destAddress.Val = pConn->remoteAddress.Val;
+    pv4Pkt->netIfH = pConn->pNet;
+    pv4Pkt->macPkt.pDSeg->segLen += hdrLen;
+
+    if((pConn->pNet->txOffload & TCPIP_MAC_CHECKSUM_TCP) == 0)
+    {   // not handled by hardware
+        pseudoHdr.SourceAddress.Val = pv4Pkt->srcAddress.Val;
+        pseudoHdr.DestAddress.Val = pv4Pkt->destAddress.Val;
+        pseudoHdr.Zero = 0;
+        pseudoHdr.Protocol = IP_PROT_TCP;
+        pseudoHdr.Length = TCPIP_Helper_htons(hdrLen);
+        checksum = ~TCPIP_Helper_CalcIPChecksum((uint8_t*)&pseudoHdr, sizeof(pseudoHdr), 0);
+        checksum = ~TCPIP_Helper_CalcIPChecksum((uint8_t*)pTCPHdr, hdrLen, checksum);
+        pTCPHdr->Checksum = ~checksum;
+    }
+
+    pktParams.ttl = pConn->ttl;
+    pktParams.tosFlags = pConn->tos;
+    pktParams.df = 0;
+
+    TCPIP_IPV4_PacketFormatTx(pv4Pkt, IP_PROT_TCP, hdrLen, &pktParams);
+    pv4Pkt->macPkt.next = 0;    // single packet
+    TCPIP_PKT_FlightLogTxSkt(&pv4Pkt->macPkt, TCPIP_THIS_MODULE_ID, ((uint32_t)pConn->localPort << 16) | pConn->remotePort, 0xffff);
+    if(TCPIP_IPV4_PacketTransmit(pv4Pkt))
+    {
+        return true; 
+    }
+
+    TCPIP_PKT_PacketAcknowledge(&pv4Pkt->macPkt, TCPIP_MAC_PKT_ACK_IP_REJECT_ERR);
+    return false;
+}
+#endif  // (_TCP_SYN_BACKLOG_ENABLE) || (_TCP_TIME_WAIT_ENABLE)
+
+#if (_TCP_SYN_BACKLOG_ENABLE)
+// SYN backlog implementation
+//
+// A SYN received for a listening port is answered by the backlog:
+// a compact entry stores the connection identity and the negotiated options
+// and the SYN + ACK is sent without involving a socket.
+// When the ACK completing the handshake arrives, a listening socket is bound
+// to the connection and moved to SYN_RECEIVED; processing that ACK
+// will move it to ESTABLISHED, as for a regular handshake.
+// When the backlog is full, the SYN + ACK carries a SYN cookie
+// and the connection is recreated from the cookie in the returned ACK.
+
+#define TCP_SYN_COOKIE_PERIOD       64      // seconds covered by the SYN cookie counter
+#define TCP_SYN_COOKIE_HASH_MASK    0x00ffffffu
+
+// the MSS values that can be encoded in a SYN cookie
+static const uint16_t tcpSynCookieMss[] = { 216, 536, 1024, 1220, 1360, 1440, 1452, 1460 };
+
+static void _TcpSynBacklogInit(void)
+{
+    memset(tcpSynBacklog, 0, sizeof(tcpSynBacklog));
+    memset(&tcpSynStat, 0, sizeof(tcpSynStat));
+    tcpSynStatTime = SYS_TMR_TickCountGet();
+#if defined(TCPIP_TCP_DISABLE_CRYPTO_USAGE) && (TCPIP_TCP_DISABLE_CRYPTO_USAGE != false)
+    int ix;
+    for(ix = 0; ix < sizeof(tcpSynSecret) / sizeof(*tcpSynSecret); ix++)
+    {
+        tcpSynSecret[ix] = (SYS_RANDOM_PseudoGet() << 16) | (uint16_t)SYS_RANDOM_PseudoGet();
+    }
+#else
+    SYS_RANDOM_CryptoBlockGet(tcpSynSecret, sizeof(tcpSynSecret));
+#endif  // defined(TCPIP_TCP_DISABLE_CRYPTO_USAGE) && (TCPIP_TCP_DISABLE_CRYPTO_USAGE != false)
+}
+
+// keyed hash of the connection identity
+static uint32_t _TcpSynHash(const TCP_SYN_ENTRY* pSyn, uint32_t count)
+{
+    uint32_t hashData[4 + 16 / 4];
+
+    hashData[0] = pSyn->conn.remoteAddress.Val;
+    hashData[1] = pSyn->conn.localAddress.Val;
+    hashData[2] = ((uint32_t)pSyn->conn.localPort << 16) + (uint32_t)pSyn->conn.remotePort;
+    hashData[3] = count;
+    memcpy(hashData + 4, tcpSynSecret, sizeof(tcpSynSecret));
+
+    return fnv_32a_hash(hashData, sizeof(hashData));
+}
+
+// initial sequence number for a backlog entry, RFC 6528
+static uint32_t _TcpSynIsnGet(const TCP_SYN_ENTRY* pSyn)
+{
+    // 64 us clock, wrapping at 32 bits: 274 seconds period > MSL = 120 seconds
+    // divide first so that the 64 bit counter product cannot overflow
+    uint64_t cnt = SYS_TIME_Counter64Get();
+    uint32_t freq = SYS_TIME_FrequencyGet();
+    uint32_t m = (uint32_t)((cnt / freq) * (1000000 / 64) + ((cnt % freq) * (1000000 / 64)) / freq);
+    return _TcpSynHash(pSyn, 0) + m;
+}
+
+static __inline__ uint32_t __attribute__((always_inline)) _TcpSynCookieCount(void)
+{
+    // the 64 bit counter avoids a discontinuity when the 32 bit tick count wraps around
+    return (uint32_t)(SYS_TIME_Counter64Get() / SYS_TIME_FrequencyGet() / TCP_SYN_COOKIE_PERIOD);
+}
+
+// SYN cookie: 5 bits counter, 3 bits MSS index, 24 bits hash of the connection
+static uint32_t _TcpSynCookieGet(const TCP_SYN_ENTRY* pSyn)
+{
+    uint32_t count = _TcpSynCookieCount();
+    uint32_t mssIx = sizeof(tcpSynCookieMss) / sizeof(*tcpSynCookieMss) - 1;
+
+    while(mssIx != 0 && tcpSynCookieMss[mssIx] > pSyn->remoteMSS)
+    {
+        mssIx--;
+    }
+
+    return ((count & 0x1f) << 27) | (mssIx << 24) | ((_TcpSynHash(pSyn, (count << 3) | mssIx) + pSyn->irs) & TCP_SYN_COOKIE_HASH_MASK);
+}
+
+// checks the SYN cookie returned by the remote node
+// cookies from the current and previous counter periods are valid
+// returns the encoded MSS or 0 if the cookie is not valid
+static uint16_t _TcpSynCookieCheck(const TCP_SYN_ENTRY* pSyn, uint32_t cookie)
+{
+    uint32_t count = _TcpSynCookieCount();
+    uint32_t mssIx = (cookie >> 24) & 0x07;
+    uint32_t age = (count - (cookie >> 27)) & 0x1f;
+
+    if(age > 1)
+    {
+        return 0;
+    }
+
+    count -= age;
+    if(((_TcpSynHash(pSyn, (count << 3) | mssIx) + pSyn->irs) & TCP_SYN_COOKIE_HASH_MASK) != (cookie & TCP_SYN_COOKIE_HASH_MASK))
+    {
+        return 0;
+    }
+
+    return tcpSynCookieMss[mssIx];
+}
+
+// returns a server socket, busy or not, opened on the port
+static TCB_STUB* _TcpSynListenSocketFind(TCP_PORT port, TCPIP_NET_IF* pPktIf)
+{
+    int ix;
+    TCB_STUB* pSkt;
+
+    for(ix = 0; ix < TcpSockets; ix++)
+    {
+        pSkt = TCBStubs[ix];
+        if(pSkt != 0 && pSkt->Flags.bServer != 0 && pSkt->localPort == port)
+        {
+            if((pSkt->flags.openAddType == IP_ADDRESS_TYPE_ANY || pSkt->flags.openAddType == IP_ADDRESS_TYPE_IPV4) &&
+                    (pSkt->flags.openBindIf == 0 || pSkt->pSktNet == pPktIf))
+            {
+                return pSkt;
+            }
+        }
+    }
+
+    return 0;
+}
+
+// sends the SYN + ACK for a backlog entry
+// a SYN cookie carries only the MSS option, the other options cannot be recovered
+static bool _TcpSynAckSend(const TCP_SYN_ENTRY* pSyn, bool isCookie)
+{
+    uint8_t     optBuff[TCP_OPTIONS_MAX_SIZE];
+    uint8_t*    pOpt;
+    uint16_t    mss;
+
+#if (TCPIP_TCP_QUIET_TIME != 0)
+    if(!tcpQuietDone)
+    {
+        return false;
+    }
+#endif  // (TCPIP_TCP_QUIET_TIME != 0)
+
+    pOpt = optBuff;
+    mss = TCPIP_IPV4_MaxDatagramDataSizeGet(pSyn->conn.pNet) - sizeof(TCP_HEADER);
+    *pOpt++ = TCP_OPTIONS_MAX_SEG_SIZE;
+    *pOpt++ = 4;
+    *pOpt++ = (uint8_t)(mss >> 8);
+    *pOpt++ = (uint8_t)mss;
+
+    if(!isCookie)
+    {
+        if(pSyn->optFlags.sackPermit != 0)
+        {
+            *pOpt++ = TCP_OPTIONS_NO_OP;
+            *pOpt++ = TCP_OPTIONS_NO_OP;
+            *pOpt++ = TCP_OPTIONS_SACK_PERMITTED;
+            *pOpt++ = 2;
+        }
+
+        if(pSyn->optFlags.wsPermit != 0)
+        {
+            *pOpt++ = TCP_OPTIONS_NO_OP;
+            *pOpt++ = TCP_OPTIONS_WINDOW_SCALE;
+            *pOpt++ = 3;
+            *pOpt++ = TCP_RCV_WINDOW_SHIFT;
+        }
+
+        if(pSyn->optFlags.tsPermit != 0)
+        {
+            *pOpt++ = TCP_OPTIONS_NO_OP;
+            *pOpt++ = TCP_OPTIONS_NO_OP;
+            *pOpt++ = TCP_OPTIONS_TIMESTAMP;
+            *pOpt++ = 10;
+            pOpt = _TcpOptionPut32(pOpt, _TcpTimestampGet());
+            pOpt = _TcpOptionPut32(pOpt, pSyn->tsRecent);
+        }
+    }
+
+    return _Tcpv4CtrlSend(&pSyn->conn, pSyn->iss, pSyn->irs + 1, SYN | ACK, pSyn->rxWindow, optBuff, pOpt - optBuff);
+}
+
+// processes an IPv4 segment for which no connected socket was found
+// pListenSkt is the available listening socket, if any
+// SYNs for the listening ports are stored in the backlog, or answered with a cookie,
+// and RSTs remove the corresponding entries
+// an ACK completing a handshake is returned in pSyn
+// returns true if the segment needs to be processed by pListenSkt (handshake completed
+// or a segment not handled by the backlog) and false if the segment was consumed
+static bool _TcpSynBacklogRx(TCPIP_MAC_PACKET* pRxPkt, TCB_STUB* pListenSkt, const IPV4_ADDR* remoteIP, const IPV4_ADDR* localIP, TCP_SYN_ENTRY* pSyn)
+{
+    int ix;
+    TCP_SYN_ENTRY *pEntry, *pFree;
+    TCB_STUB* pTmplSkt;
+    uint8_t* pOpt;
+    uint16_t cookieMss;
+    bool isCookie;
+    TCP_SYN_ENTRY cookieEntry;
+
+    TCP_HEADER* h = (TCP_HEADER*)pRxPkt->pTransportLayer;
+    TCPIP_NET_IF* pPktIf = (TCPIP_NET_IF*)pRxPkt->pktIf;
+    uint8_t hdrFlags = h->Flags.byte & (SYN | ACK | RST);
+
+    pSyn->conn.remoteAddress.Val = 0;
+
+    // search for the connection
+    pEntry = 0;
+    pFree = 0;
+    for(ix = 0; ix < _TCP_SYN_BACKLOG_SIZE; ix++)
+    {
+        TCP_SYN_ENTRY* pSrch = tcpSynBacklog + ix;
+        if(pSrch->conn.remoteAddress.Val == 0)
+        {
+            if(pFree == 0)
+            {
+                pFree = pSrch;
+            }
+        }
+        else if(pSrch->conn.remoteAddress.Val == remoteIP->Val && pSrch->conn.remotePort == h->SourcePort &&
+                pSrch->conn.localPort == h->DestPort && pSrch->conn.pNet == pPktIf)
+        {
+            pEntry = pSrch;
+        }
+    }
+
+    if((hdrFlags & RST) != 0)
+    {
+        if(pEntry != 0)
+        {   // remote node gave up
+            // the RST must carry the expected sequence number: a blind RST is dropped
+            if(h->SeqNumber == pEntry->irs + 1)
+            {
+                pEntry->conn.remoteAddress.Val = 0;
+                tcpSynStat.dropped++;
+            }
+            return false;
+        }
+        return pListenSkt != 0;
+    }
+
+    if(hdrFlags == SYN)
+    {
+        pTmplSkt = pListenSkt != 0 ? pListenSkt : _TcpSynListenSocketFind(h->DestPort, pPktIf);
+        if(pTmplSkt == 0)
+        {   // not a listening port
+            return false;
+        }
+
+        tcpSynStat.synRcvd++;
+        if(pEntry != 0 && pEntry->irs == h->SeqNumber)
+        {   // retransmitted SYN
+            _TcpSynAckSend(pEntry, false);
+            return false;
+        }
+
+        isCookie = false;
+        if(pEntry == 0)
+        {
+            if((pEntry = pFree) == 0)
+            {   // backlog full
+                if(!_TCP_SYN_COOKIES)
+                {
+                    tcpSynStat.dropped++;
+                    return false;
+                }
+                pEntry = &cookieEntry;
+                isCookie = true;
+            }
+        }
+        // else a new connection replacing an old one
+
+        memset(pEntry, 0, sizeof(*pEntry));
+        pEntry->conn.remoteAddress.Val = remoteIP->Val;
+        pEntry->conn.localAddress.Val = localIP->Val;
+        pEntry->conn.pNet = pPktIf;
+        pEntry->conn.remotePort = h->SourcePort;
+        pEntry->conn.localPort = h->DestPort;
+        pEntry->irs = h->SeqNumber;
+        pEntry->remoteMSS = _GetMaxSegSizeOption(h);
+        pEntry->rxWindow = pTmplSkt->rxEnd - pTmplSkt->rxStart;
+        pEntry->conn.ttl = pTmplSkt->ttl;
+        pEntry->conn.tos = pTmplSkt->tos;
+
+        pEntry->optFlags.sackPermit = _TCP_SACK_ENABLE && _TcpOptionFind(h, TCP_OPTIONS_SACK_PERMITTED, 2) != 0;
+        if(pTmplSkt->optFlags.wsEnable != 0 && (pOpt = _TcpOptionFind(h, TCP_OPTIONS_WINDOW_SCALE, 3)) != 0)
+        {
+            pEntry->sndWndShift = pOpt[2] > TCP_MAX_WINDOW_SHIFT ? TCP_MAX_WINDOW_SHIFT : pOpt[2];
+            pEntry->optFlags.wsPermit = 1;
+        }
+        if(pTmplSkt->optFlags.tsEnable != 0 && (pOpt = _TcpOptionFind(h, TCP_OPTIONS_TIMESTAMP, 10)) != 0)
+        {
+            pEntry->tsRecent = _TcpOptionGet32(pOpt + 2);
+            pEntry->optFlags.tsPermit = 1;
+        }
+
+        if(isCookie)
+        {
+            pEntry->iss = _TcpSynCookieGet(pEntry);
+            tcpSynStat.cookiesSent++;
+        }
+        else
+        {
+            pEntry->iss = _TcpSynIsnGet(pEntry);
+            pEntry->retxTime = SYS_TMR_TickCountGet() + (TCPIP_TCP_START_TIMEOUT_VAL * sysTickFreq) / 1000;
+        }
+
+        _TcpSynAckSend(pEntry, isCookie);
+        return false;
+    }
+
+    if(hdrFlags != ACK)
+    {   // not part of a handshake
+        return pListenSkt != 0;
+    }
+
+    isCookie = false;
+    if(pEntry != 0)
+    {
+        if(h->AckNumber != pEntry->iss + 1 || h->SeqNumber != pEntry->irs + 1)
+        {   // not for this connection; drop it
+            return false;
+        }
+    }
+    else if(_TCP_SYN_COOKIES)
+    {   // could be an ACK for a SYN cookie
+        memset(&cookieEntry, 0, sizeof(cookieEntry));
+        cookieEntry.conn.remoteAddress.Val = remoteIP->Val;
+        cookieEntry.conn.localAddress.Val = localIP->Val;
+        cookieEntry.conn.pNet = pPktIf;
+        cookieEntry.conn.remotePort = h->SourcePort;
+        cookieEntry.conn.localPort = h->DestPort;
+        cookieEntry.irs = h->SeqNumber - 1;
+        cookieEntry.iss = h->AckNumber - 1;
+        if((cookieMss = _TcpSynCookieCheck(&cookieEntry, cookieEntry.iss)) == 0)
+        {   // not a valid cookie; let the listening socket reset it
+            return pListenSkt != 0;
+        }
+        cookieEntry.remoteMSS = cookieMss;
+        pEntry = &cookieEntry;
+        isCookie = true;
+    }
+    else
+    {
+        return pListenSkt != 0;
+    }
+
+    // handshake completed
+    if(pListenSkt == 0)
+    {   // no available socket
+        if(isCookie)
+        {   // no state is kept for a cookie: reset the connection
+            _Tcpv4CtrlSend(&pEntry->conn, h->AckNumber, 0, RST, 0, 0, 0);
+            tcpSynStat.dropped++;
+        }
+        // else the connection stays in the backlog
+        // the retransmitted SYN + ACKs or the remote node data
+        // will be ACK-ed again and a socket may be available then
+        return false;
+    }
+
+    *pSyn = *pEntry;
+    pEntry->conn.remoteAddress.Val = 0;
+    if(isCookie)
+    {
+        tcpSynStat.cookiesValid++;
+    }
+    return true;
+}
+
+// sets up a listening socket for a connection that completed the handshake in the backlog
+// the socket is placed in SYN_RECEIVED, as after a regular SYN processing;
+// the ACK that completed the handshake will move it to ESTABLISHED
+static void _TcpSynBacklogPromote(TCB_STUB* pSkt, const TCP_SYN_ENTRY* pSyn)
+{
+    pSkt->RemoteSEQ = pSyn->irs + 1;
+    pSkt->MySEQ = pSyn->iss + 1;
+    pSkt->sndMaxSEQ = pSkt->MySEQ;
+    pSkt->flags.bSYNSent = 1;
+
+    pSkt->wRemoteMSS = pSyn->remoteMSS;
+    pSkt->localMSS = TCPIP_IPV4_MaxDatagramDataSizeGet(pSkt->pSktNet) - sizeof(TCP_HEADER);
+    _TCPSetHalfFlushFlag(pSkt);
+    _TcpCongInit(pSkt);
+
+    pSkt->optFlags.sackPermit = pSyn->optFlags.sackPermit;
+    pSkt->optFlags.wsPermit = pSyn->optFlags.wsPermit;
+    pSkt->sndWndShift = pSyn->sndWndShift;
+    pSkt->optFlags.tsPermit = pSyn->optFlags.tsPermit;
+    pSkt->tsRecent = pSyn->tsRecent;
+    pSkt->tsLastAckSent = pSkt->RemoteSEQ;
+
+    _TcpSocketSetState(pSkt, TCPIP_TCP_STATE_SYN_RECEIVED);
+    tcpSynStat.accepted++;
+}
+
+// retransmits the SYN + ACKs and expires the half-open connections
+static void _TcpSynBacklogTick(uint32_t tickNow)
+{
+    int ix;
+    TCP_SYN_ENTRY* pEntry = tcpSynBacklog;
+
+    for(ix = 0; ix < _TCP_SYN_BACKLOG_SIZE; ix++, pEntry++)
+    {
+        if(pEntry->conn.remoteAddress.Val == 0 || (int32_t)(tickNow - pEntry->retxTime) < 0)
+        {
+            continue;
+        }
+
+        if(pEntry->retryCount >= TCPIP_TCP_MAX_SYN_RETRIES)
+        {   // give up
+            pEntry->conn.remoteAddress.Val = 0;
+            tcpSynStat.dropped++;
+            continue;
+        }
+
+        pEntry->retryCount++;
+        pEntry->retxTime = tickNow + (((TCPIP_TCP_START_TIMEOUT_VAL * sysTickFreq) / 1000) << pEntry->retryCount);
+        _TcpSynAckSend(pEntry, false);
+    }
+}
+#endif  // (_TCP_SYN_BACKLOG_ENABLE)
+
+#if (_TCP_TIME_WAIT_ENABLE)
+// compact TIME_WAIT table implementation
+//
+// A closing IPv4 connection that needs no more data transfer:
+// TIME_WAIT or LAST_ACK with only the FIN outstanding,
+// is moved to a table entry holding just the connection identity and sequence numbers
+// and its socket is released: a server socket returns to listening,
+// a socket already closed by the user is killed and its buffers freed.
+// The stray segments for the connection are answered from the table entry
+// and the LAST_ACK FIN retransmissions are done by the table tick.
+
+// moves a closing connection to the TIME_WAIT table and releases its socket
+// only the server sockets and the sockets already closed by the user are released,
+// so that a handle still owned by the application stays valid
+// returns true if the socket was released
+static bool _TcpTimeWaitEnter(TCB_STUB* pSkt)
+{
+    int ix;
+    TCP_TW_ENTRY *pTw, *pFree, *pOld;
+
+    if(pSkt->addType != IP_ADDRESS_TYPE_IPV4 || pSkt->pSktNet == 0)
+    {
+        return false;
+    }
+
+    if(pSkt->Flags.bServer == 0 && pSkt->flags.forceKill == 0)
+    {   // the user still owns the socket
+        return false;
+    }
+
+    if(pSkt->rxHead != pSkt->rxTail)
+    {   // unread data
+        return false;
+    }
+
+    if(pSkt->smState == TCPIP_TCP_STATE_LAST_ACK)
+    {
+        if(pSkt->flags.bFINSent == 0 || pSkt->txTail != pSkt->txHead)
+        {   // data still to be acknowledged
+            return false;
+        }
+    }
+    else if(pSkt->smState != TCPIP_TCP_STATE_TIME_WAIT)
+    {
+        return false;
+    }
+
+    // find a free entry or the oldest TIME_WAIT one
+    pFree = pOld = 0;
+    pTw = tcpTwTable;
+    for(ix = 0; ix < _TCP_TIME_WAIT_SIZE; ix++, pTw++)
+    {
+        if(pTw->conn.remoteAddress.Val == 0)
+        {
+            pFree = pTw;
+            break;
+        }
+
+        if(pTw->smState == TCPIP_TCP_STATE_TIME_WAIT && (pOld == 0 || (int32_t)(pTw->eventTime - pOld->eventTime) < 0))
+        {
+            pOld = pTw;
+        }
+    }
+
+    if(pFree == 0)
+    {
+        if(pOld == 0)
+        {   // all entries waiting for the LAST_ACK; keep the socket
+            return false;
+        }
+        pFree = pOld;
+        tcpTwEvicted++;
+    }
+
+    pFree->conn.remoteAddress.Val = pSkt->destAddress.Val;
+    pFree->conn.localAddress.Val = pSkt->srcAddress.Val;
+    pFree->conn.pNet = pSkt->pSktNet;
+    pFree->conn.remotePort = pSkt->remotePort;
+    pFree->conn.localPort = pSkt->localPort;
+    pFree->conn.ttl = pSkt->ttl;
+    pFree->conn.tos = pSkt->tos;
+    pFree->rcvNxt = pSkt->RemoteSEQ;
+    pFree->tsRecent = pSkt->tsRecent;
+    pFree->rxWindow = pSkt->localWindow;
+    pFree->tsPermit = pSkt->optFlags.tsPermit;
+    pFree->smState = pSkt->smState;
+    if(pSkt->smState == TCPIP_TCP_STATE_LAST_ACK)
+    {   // the FIN sequence number; the FIN retransmission continues from the table
+        pFree->sndNxt = pSkt->MySEQ;
+        pFree->retryCount = pSkt->retryCount;
+        pFree->retryInterval = pSkt->retryInterval;
+        pFree->eventTime = SYS_TMR_TickCountGet() + pSkt->retryInterval;
+    }
+    else
+    {   // the FIN was acknowledged
+        pFree->sndNxt = pSkt->MySEQ + ((pSkt->flags.bFINSent != 0 && pSkt->flags.seqInc == 0) ? 1 : 0);
+        pFree->retryCount = 0;
+        pFree->retryInterval = 0;
+        pFree->eventTime = pSkt->closeWaitTime;
+    }
+
+    tcpTwReleased++;
+    _TcpCloseSocket(pSkt, 0);
+    return true;
+}
+
+// sends a segment for a TIME_WAIT table entry
+static void _TcpTimeWaitSend(TCP_TW_ENTRY* pTw, uint8_t flags)
+{
+    uint8_t     optBuff[12];
+    uint16_t    optLen;
+
+    optLen = 0;
+    if(pTw->tsPermit != 0)
+    {
+        optBuff[0] = TCP_OPTIONS_NO_OP;
+        optBuff[1] = TCP_OPTIONS_NO_OP;
+        optBuff[2] = TCP_OPTIONS_TIMESTAMP;
+        optBuff[3] = 10;
+        _TcpOptionPut32(optBuff + 4, _TcpTimestampGet());
+        _TcpOptionPut32(optBuff + 8, pTw->tsRecent);
+        optLen = 12;
+    }
+
+    _Tcpv4CtrlSend(&pTw->conn, pTw->sndNxt, pTw->rcvNxt, flags, pTw->rxWindow, optBuff, optLen);
+}
+
+// processes an IPv4 segment for which no connected socket was found
+// returns true if the segment belongs to a connection in the TIME_WAIT table
+// and was consumed, false otherwise
+static bool _TcpTimeWaitRx(TCPIP_MAC_PACKET* pRxPkt, const IPV4_ADDR* remoteIP)
+{
+    int ix;
+    TCP_TW_ENTRY* pTw;
+    uint16_t dataLen;
+    int32_t seqOffset;
+
+    TCP_HEADER* h = (TCP_HEADER*)pRxPkt->pTransportLayer;
+    TCPIP_NET_IF* pPktIf = (TCPIP_NET_IF*)pRxPkt->pktIf;
+
+    pTw = tcpTwTable;
+    for(ix = 0; ix < _TCP_TIME_WAIT_SIZE; ix++, pTw++)
+    {
+        if(pTw->conn.remoteAddress.Val == remoteIP->Val && pTw->conn.remotePort == h->SourcePort &&
+                pTw->conn.localPort == h->DestPort && pTw->conn.pNet == pPktIf)
+        {
+            break;
+        }
+    }
+
+    if(ix == _TCP_TIME_WAIT_SIZE)
+    {   // not ours
+        return false;
+    }
+
+    if((h->Flags.byte & RST) != 0)
+    {   // RCV.NXT =< SEG.SEQ < RCV.NXT+RCV.WND, as for the connected sockets
+        // a RST outside the receive window is dropped
+        seqOffset = h->SeqNumber - pTw->rcvNxt;
+        if(seqOffset == 0 || (seqOffset > 0 && seqOffset < (int32_t)pTw->rxWindow))
+        {
+            pTw->conn.remoteAddress.Val = 0;
+        }
+        return true;
+    }
+
+    if((h->Flags.byte & SYN) != 0)
+    {   // a new connection is attempted; RFC 1122 4.2.2.13:
+        // a TIME_WAIT entry is released only if the SYN sequence number is past the old connection
+        // the SYN is dropped, the remote node will retry and reach a listening socket
+        if(pTw->smState == TCPIP_TCP_STATE_TIME_WAIT && (int32_t)(h->SeqNumber - pTw->rcvNxt) > 0)
+        {
+            pTw->conn.remoteAddress.Val = 0;
+        }
+        else
+        {   // old duplicate or the old connection is not done yet
+            _TcpTimeWaitSend(pTw, ACK);
+        }
+        return true;
+    }
+
+    if((h->Flags.byte & ACK) == 0)
+    {
+        return true;
+    }
+
+    if(pTw->smState == TCPIP_TCP_STATE_LAST_ACK)
+    {
+        if(h->AckNumber == pTw->sndNxt + 1)
+        {   // our FIN was acknowledged
+            pTw->conn.remoteAddress.Val = 0;
+        }
+        else if((h->Flags.byte & FIN) != 0)
+        {   // the remote node didn't get our FIN
+            _TcpTimeWaitSend(pTw, FIN | ACK);
+        }
+        return true;
+    }
+
+    // TIME_WAIT: reacknowledge a retransmitted FIN or any unexpected segment
+    dataLen = pRxPkt->totTransportLen - (h->DataOffset.Val << 2);
+    if((h->Flags.byte & FIN) != 0 || dataLen != 0 || h->SeqNumber != pTw->rcvNxt)
+    {
+        _TcpTimeWaitSend(pTw, ACK);
+    }
+
+    return true;
+}
+
+// TIME_WAIT table timeouts
+// the TIME_WAIT entries expire after 2 MSL
+// the LAST_ACK entries retransmit the FIN and are reset after TCPIP_TCP_MAX_RETRIES
+static void _TcpTimeWaitTick(uint32_t tickNow)
+{
+    int ix;
+    TCP_TW_ENTRY* pTw;
 
-        if(vOption == 1u)   // NOP option
+    pTw = tcpTwTable;
+    for(ix = 0; ix < _TCP_TIME_WAIT_SIZE; ix++, pTw++)
+    {
+        if(pTw->conn.remoteAddress.Val == 0 || (int32_t)(tickNow - pTw->eventTime) < 0)
+        {
             continue;
+        }
 
-        if(vOption == 2u)   // Maximum Segment Size option
+        if(pTw->smState == TCPIP_TCP_STATE_TIME_WAIT)
         {
-            if(vOptionsBytes < 3u)
-                break;
-
-            wMSS = 0;
-
-            // Get option length
-            vOption = *pOption++;
-            if(vOption == 4u)
-            {// Retrieve MSS and swap value to little endian
-                ((uint8_t*)&wMSS)[1] = *pOption++;
-                ((uint8_t*)&wMSS)[0] = *pOption++;
-            }
-
-            if(wMSS < TCP_MIN_DEFAULT_MTU)
-                break;
-            if(wMSS > TCPIP_TCP_MAX_SEG_SIZE_TX)
-                return TCPIP_TCP_MAX_SEG_SIZE_TX;
-            else 
-                return wMSS;
+            pTw->conn.remoteAddress.Val = 0;
+            continue;
         }
-        else
-        { // Assume this is a multi byte option and throw it way
-            if(vOptionsBytes < 2u)
-                break;
-            vOption = *pOption++;
-            if(vOptionsBytes < vOption)
-                break;
-            pOption += vOption;
-            vOptionsBytes -= vOption;
+
+        // LAST_ACK
+        if(pTw->retryCount >= TCPIP_TCP_MAX_RETRIES)
+        {   // close anyway
+            _TcpTimeWaitSend(pTw, RST | ACK);
+            pTw->conn.remoteAddress.Val = 0;
+            continue;
         }
 
+        pTw->retryCount++;
+        pTw->retryInterval <<= 1;
+        pTw->eventTime = tickNow + pTw->retryInterval;
+        _TcpTimeWaitSend(pTw, FIN | ACK);
     }
-
-    // Did not find MSS option, return worst case default
-    return TCP_MIN_DEFAULT_MTU;
 }
+#endif  // (_TCP_TIME_WAIT_ENABLE)
 
 static void _TCPSetHalfFlushFlag(TCB_STUB* pSkt)
 {
@@ -4874,6 +7235,10 @@ static void _TcpHandleSeg(TCB_STUB* pSkt, TCP_HEADER* h, uint16_t tcpLen, TCPIP_
     uint8_t* pSegSrc;
     uint16_t nCopiedBytes;
     uint8_t* newRxHead;
+    bool ackNow = false;
+    uint8_t* pTsOpt;
+    uint32_t segTsVal = 0;
+    uint32_t remoteWnd;
 
 
      
@@ -4926,6 +7291,8 @@ static void _TcpHandleSeg(TCB_STUB* pSkt, TCP_HEADER* h, uint16_t tcpLen, TCPIP_
                 // Set MSS option
                 pSkt->wRemoteMSS = _GetMaxSegSizeOption(h);
                 _TCPSetHalfFlushFlag(pSkt);
+                _TcpCongInit(pSkt);
+                _TcpSynOptionsProcess(pSkt, h);
 
                 // Respond with SYN + ACK
                 _TcpSend(pSkt, SYN | ACK, SENDTCP_RESET_TIMERS);
@@ -4986,6 +7353,8 @@ static void _TcpHandleSeg(TCB_STUB* pSkt, TCP_HEADER* h, uint16_t tcpLen, TCPIP_
                 // Set MSS option
                 pSkt->wRemoteMSS = _GetMaxSegSizeOption(h);
                 _TCPSetHalfFlushFlag(pSkt);
+                _TcpCongInit(pSkt);
+                _TcpSynOptionsProcess(pSkt, h);
 
                 if(localHeaderFlags & ACK)
                 {
@@ -5013,6 +7382,18 @@ static void _TcpHandleSeg(TCB_STUB* pSkt, TCP_HEADER* h, uint16_t tcpLen, TCPIP_
             break;
     }
 
+    // PAWS: discard the old duplicates carrying an obsolete timestamp
+    pTsOpt = 0;
+    if(pSkt->optFlags.tsPermit != 0 && (pTsOpt = _TcpOptionFind(h, TCP_OPTIONS_TIMESTAMP, 10)) != 0)
+    {
+        segTsVal = _TcpOptionGet32(pTsOpt + 2);
+        if((localHeaderFlags & RST) == 0 && (int32_t)(segTsVal - pSkt->tsRecent) < 0)
+        {
+            _TcpSend(pSkt, ACK, SENDTCP_RESET_TIMERS);
+            return;
+        }
+    }
+
     //
     // First: check the sequence number
     //
@@ -5096,6 +7477,12 @@ static void _TcpHandleSeg(TCB_STUB* pSkt, TCP_HEADER* h, uint16_t tcpLen, TCPIP_
         return;
     }
 
+    // record the timestamp to be echoed
+    if(pTsOpt != 0 && (int32_t)(localSeqNumber - pSkt->tsLastAckSent) <= 0)
+    {
+        pSkt->tsRecent = segTsVal;
+    }
+
 
     //
     // Second: check the RST bit
@@ -5195,11 +7582,27 @@ static void _TcpHandleSeg(TCB_STUB* pSkt, TCP_HEADER* h, uint16_t tcpLen, TCPIP_
             dwTemp = localAckNumber - dwTemp;
             if(((int32_t)(dwTemp) > 0) && (dwTemp <= pSkt->txEnd - pSkt->txStart))
             {   // ACK-ed some data
+                // take a RTT sample: the echoed timestamp, if available, or the timed segment
+                if(pTsOpt != 0 && (wTemp = _TcpOptionGet32(pTsOpt + 6)) != 0)
+                {
+                    _TcpRttUpdate(pSkt, _TcpTimestampGet() - wTemp);
+                }
+                else if(pSkt->optFlags.rttTiming != 0 && (int32_t)(localAckNumber - pSkt->rttSEQ) >= 0)
+                {
+                    _TcpRttUpdate(pSkt, ((SYS_TMR_TickCountGet() - pSkt->rttTime) * 1000) / sysTickFreq);
+                }
+                if((int32_t)(localAckNumber - pSkt->rttSEQ) >= 0)
+                {
+                    pSkt->optFlags.rttTiming = 0;
+                }
                 _TCP_LoadRetxTmo(pSkt, true);
                 pSkt->dupAckCnt = 0;    
                 pSkt->Flags.bHalfFullFlush = false;
 
                 // Bytes ACKed, free up the TX FIFO space
+#if (_TCP_TX_REF_ENABLE)
+                _TcpTxRefAck(pSkt, pSkt->txTail, dwTemp);
+#endif  // (_TCP_TX_REF_ENABLE)
                 ptrTemp = pSkt->txTail;
                 pSkt->txTail += dwTemp;
                 if(pSkt->txUnackedTail >= ptrTemp)
@@ -5232,6 +7635,18 @@ static void _TcpHandleSeg(TCB_STUB* pSkt, TCP_HEADER* h, uint16_t tcpLen, TCPIP_
                 {
                     *pSktEvent |= TCPIP_TCP_SIGNAL_TX_SPACE; 
                 }
+
+                if(pSkt->flags.congCtrl != 0)
+                {
+                    if(_TcpCongAck(pSkt, dwTemp, localAckNumber))
+                    {   // partial acknowledge
+                        _TcpTxRollback(pSkt);
+                    }
+                    else if(pSkt->txHead != pSkt->txUnackedTail)
+                    {   // the congestion window opened; send pending data
+                        pSkt->Flags.bTXASAP = 1;
+                    }
+                }
             }
             else
             {   // no acknowledge
@@ -5239,13 +7654,19 @@ static void _TcpHandleSeg(TCB_STUB* pSkt, TCP_HEADER* h, uint16_t tcpLen, TCPIP_
                 if(pSkt->txTail != pSkt->txUnackedTail)
                 {
                     bool fastRetransmit = false;
-                    if(++pSkt->dupAckCnt >= 3)
+                    if(pSkt->flags.congCtrl != 0)
+                    {   // only segments carrying no data count as duplicate acknowledges
+                        fastRetransmit = tcpLen == 0 && _TcpCongDupAck(pSkt);
+                    }
+                    else if(++pSkt->dupAckCnt >= 3)
                     {
                         fastRetransmit = true; 
                     }
-                    else if (pSkt->retxTime != 0 && (int32_t)(SYS_TMR_TickCountGet() - pSkt->retxTime) >= 0)
+
+                    if (!fastRetransmit && pSkt->retxTime != 0 && (int32_t)(SYS_TMR_TickCountGet() - pSkt->retxTime) >= 0)
                     {   // ack timeout
                         _TCP_LoadRetxTmo(pSkt, false);
+                        _TcpCongTimeout(pSkt);
                         fastRetransmit = true;
                     }
 
@@ -5253,14 +7674,7 @@ static void _TcpHandleSeg(TCB_STUB* pSkt, TCP_HEADER* h, uint16_t tcpLen, TCPIP_
                     {
                         // Set up to perform a fast retransmission
                         // Roll back unacknowledged TX tail pointer to cause retransmit to occur
-                        pSkt->MySEQ -= (pSkt->txUnackedTail - pSkt->txTail);
-
-                        if(pSkt->txUnackedTail < pSkt->txTail)
-                        {
-                            pSkt->MySEQ -= (pSkt->txEnd - pSkt->txStart);
-                        }
-                        pSkt->txUnackedTail = pSkt->txTail;
-                        pSkt->Flags.bTXASAPWithoutTimerReset = 1;
+                        _TcpTxRollback(pSkt);
                     }
                 }
             }
@@ -5289,15 +7703,23 @@ static void _TcpHandleSeg(TCB_STUB* pSkt, TCP_HEADER* h, uint16_t tcpLen, TCPIP_
                 }
             }
 
+            // scale the advertised window
+            // our TX FIFO cannot take advantage of more than 64 KB
+            remoteWnd = (uint32_t)h->Window << pSkt->sndWndShift;
+            if(remoteWnd > 0xffff)
+            {
+                remoteWnd = 0xffff;
+            }
+
             // update the max window
-            if(h->Window > pSkt->maxRemoteWindow)
+            if(remoteWnd > pSkt->maxRemoteWindow)
             {
-                pSkt->maxRemoteWindow = h->Window;
+                pSkt->maxRemoteWindow = remoteWnd;
             }
             // The window size advertised in this packet is adjusted to account 
             // for any bytes that we have transmitted but haven't been ACKed yet 
             // by this segment.
-            wNewWindow = h->Window - ((uint16_t)(pSkt->MySEQ - localAckNumber));
+            wNewWindow = remoteWnd - ((uint16_t)(pSkt->MySEQ - localAckNumber));
 
             // Update the local stored copy of the RemoteWindow.
             // If previously we had a zero window, and now we don't, then 
@@ -5328,6 +7750,9 @@ static void _TcpHandleSeg(TCB_STUB* pSkt, TCP_HEADER* h, uint16_t tcpLen, TCPIP_
 #if (TCPIP_TCP_MSL_TIMEOUT != 0)
                     _TcpSocketSetState(pSkt, TCPIP_TCP_STATE_TIME_WAIT);
                     pSkt->closeWaitTime = SYS_TMR_TickCountGet() + ((TCPIP_TCP_MSL_TIMEOUT * 2) * sysTickFreq);
+#if (_TCP_TIME_WAIT_ENABLE)
+                    _TcpTimeWaitEnter(pSkt);
+#endif  // (_TCP_TIME_WAIT_ENABLE)
 #else
                     _TcpCloseSocket(pSkt, 0);
 #endif  // (TCPIP_TCP_MSL_TIMEOUT != 0)
@@ -5341,8 +7766,21 @@ static void _TcpHandleSeg(TCB_STUB* pSkt, TCP_HEADER* h, uint16_t tcpLen, TCPIP_
             // Check to see if our FIN has been ACKnowledged
             if(pSkt->MySEQ + 1 == localAckNumber)
             {
+#if (_TCP_TX_REF_ENABLE)
+                _TcpTxRefRelease(pSkt, true);
+#endif  // (_TCP_TX_REF_ENABLE)
                 _TcpCloseSocket(pSkt, 0);
             }
+#if (_TCP_TIME_WAIT_ENABLE)
+            else if(pSkt->MySEQ == localAckNumber && pSkt->flags.bFINSent != 0 && pSkt->txUnackedTail == pSkt->txHead)
+            {   // all data acknowledged, only the FIN is outstanding
+#if (_TCP_TX_REF_ENABLE)
+                _TcpTxRefRelease(pSkt, true);
+#endif  // (_TCP_TX_REF_ENABLE)
+                pSkt->txTail = pSkt->txHead;
+                _TcpTimeWaitEnter(pSkt);
+            }
+#endif  // (_TCP_TIME_WAIT_ENABLE)
             return;
 
         default:    // case TCPIP_TCP_STATE_TIME_WAIT:
@@ -5414,27 +7852,11 @@ static void _TcpHandleSeg(TCB_STUB* pSkt, TCP_HEADER* h, uint16_t tcpLen, TCPIP_
                     *pSktEvent |= TCPIP_TCP_SIGNAL_RX_DATA;
                 }
 
-                // See if we have a hole and other data waiting already in the RX FIFO
-                if(pSkt->sHoleSize != -1)
+                // See if we have holes and other data waiting already in the RX FIFO
+                if(pSkt->nOooBlocks != 0)
                 {
-                    pSkt->sHoleSize -= len;
-                    wTemp = pSkt->wFutureDataSize + pSkt->sHoleSize;
-
-                    // See if we just closed up a hole, and if so, advance head pointer
-                    if((int32_t)wTemp < 0)
-                    {
-                        pSkt->sHoleSize = -1;
-                    }
-                    else if(pSkt->sHoleSize <= 0)
-                    {
-                        pSkt->RemoteSEQ += wTemp;
-                        pSkt->rxHead += wTemp;
-                        if(pSkt->rxHead > pSkt->rxEnd)
-                        {
-                            pSkt->rxHead -= pSkt->rxEnd - pSkt->rxStart + 1;                            
-                        }
-                        pSkt->sHoleSize = -1;
-                    }
+                    _TcpRxOooAdvance(pSkt);
+                    ackNow = true;
                 }
             }
         } 
@@ -5471,40 +7893,9 @@ static void _TcpHandleSeg(TCB_STUB* pSkt, TCP_HEADER* h, uint16_t tcpLen, TCPIP_
             }
 
             if(nCopiedBytes == len)
-            {
-                // Record the hole is here
-                if(pSkt->sHoleSize == -1)
-                {
-                    pSkt->sHoleSize = wMissingBytes;
-                    pSkt->wFutureDataSize = len;
-                }
-                else
-                {
-                    // We already have a hole, see if we can shrink the hole 
-                    // or extend the future data size
-                    if(wMissingBytes < (uint32_t)pSkt->sHoleSize)
-                    {
-                        if((wMissingBytes + len > (uint32_t)pSkt->sHoleSize + pSkt->wFutureDataSize) || (wMissingBytes + len < (uint32_t)pSkt->sHoleSize))
-                        {
-                            pSkt->wFutureDataSize = len;
-                        }
-                        else
-                        {
-                            pSkt->wFutureDataSize = (uint32_t)pSkt->sHoleSize + pSkt->wFutureDataSize - wMissingBytes;
-                        }
-                        pSkt->sHoleSize = wMissingBytes;
-                    }
-                    else if(wMissingBytes + len > (uint32_t)pSkt->sHoleSize + pSkt->wFutureDataSize)
-                    {
-                        // Make sure that there isn't a second hole between 
-                        // our future data and this TCP segment's future data
-                        if(wMissingBytes <= (uint32_t)pSkt->sHoleSize + pSkt->wFutureDataSize)
-                        {
-                            pSkt->wFutureDataSize += wMissingBytes + len - (uint32_t)pSkt->sHoleSize - pSkt->wFutureDataSize;
-                        }
-                    }
-
-                }
+            {   // record the out-of-order block and signal the hole to the remote node
+                _TcpRxOooAdd(pSkt, pSkt->RemoteSEQ + wMissingBytes, pSkt->RemoteSEQ + wMissingBytes + len);
+                ackNow = true;
             }
         }
     }
@@ -5526,8 +7917,8 @@ static void _TcpHandleSeg(TCB_STUB* pSkt, TCP_HEADER* h, uint16_t tcpLen, TCPIP_
             pSkt->rxTail = pSkt->rxHead;
         }
 
-        if(pSkt->Flags.bOneSegmentReceived)
-        {
+        if(pSkt->Flags.bOneSegmentReceived || ackNow)
+        {   // out-of-order data or a filled hole is acknowledged immediately
             _TcpSend(pSkt, ACK, SENDTCP_RESET_TIMERS);
             // bOneSegmentReceived is cleared in _TcpSend(pSkt, ), so no need here
         }
@@ -5629,6 +8020,12 @@ static void _TcpHandleSeg(TCB_STUB* pSkt, TCP_HEADER* h, uint16_t tcpLen, TCPIP_
 
             // Acknowledge receipt of FIN
             _TcpSend(pSkt, ACK, SENDTCP_RESET_TIMERS);
+#if (_TCP_TIME_WAIT_ENABLE)
+            if(pSkt->smState == TCPIP_TCP_STATE_TIME_WAIT)
+            {
+                _TcpTimeWaitEnter(pSkt);
+            }
+#endif  // (_TCP_TIME_WAIT_ENABLE)
         }
     }
 }
@@ -5726,12 +8123,6 @@ static void _TcpHandleSeg(TCB_STUB* pSkt, TCP_HEADER* h, uint16_t tcpLen, TCPIP_
 #if (TCPIP_TCP_DYNAMIC_OPTIONS != 0)
 bool TCPIP_TCP_FifoSizeAdjust(TCP_SOCKET hTCP, uint16_t wMinRXSize, uint16_t wMinTXSize, TCP_ADJUST_FLAGS vFlags)
 {
-    uint16_t    oldTxSize, pendTxEnd, pendTxBeg, txUnackOffs;
-    uint16_t    oldRxSize, avlblRxEnd, avlblRxBeg;
-    uint16_t    diffChange;
-    uint8_t     *newTxBuff, *newRxBuff;
-    bool        adjustFail;
-    
     if((vFlags & (TCP_ADJUST_TX_ONLY | TCP_ADJUST_RX_ONLY)) == (TCP_ADJUST_TX_ONLY | TCP_ADJUST_RX_ONLY))
     {   // invalid option
         return false;
@@ -5744,6 +8135,31 @@ bool TCPIP_TCP_FifoSizeAdjust(TCP_SOCKET hTCP, uint16_t wMinRXSize, uint16_t wMi
         return false;
     }
 
+    // the user takes control of the buffers
+    pSkt->optFlags.autoTune = 0;
+    return _TcpFifoSizeAdjust(pSkt, wMinRXSize, wMinTXSize, vFlags);
+}
+
+static bool _TcpFifoSizeAdjust(TCB_STUB* pSkt, uint16_t wMinRXSize, uint16_t wMinTXSize, TCP_ADJUST_FLAGS vFlags)
+{
+    uint16_t    oldTxSize, pendTxEnd, pendTxBeg, txUnackOffs;
+    uint16_t    oldRxSize, avlblRxEnd, avlblRxBeg;
+    uint16_t    diffChange;
+    uint8_t     *newTxBuff, *newRxBuff;
+    bool        adjustFail;
+
+#if (_TCP_TX_REF_ENABLE)
+    if((vFlags & TCP_ADJUST_RX_ONLY) == 0 && !TCPIP_Helper_SingleListIsEmpty(&pSkt->txRefList))
+    {   // the TX FIFO positions are in use by the queued user buffers
+        return false;
+    }
+#endif  // (_TCP_TX_REF_ENABLE)
+
+    if((vFlags & TCP_ADJUST_TX_ONLY) == 0 && pSkt->rxLent != 0)
+    {   // the RX FIFO data is lent to the user
+        return false;
+    }
+    
     // minimum size check
     if(wMinRXSize < TCP_MIN_RX_BUFF_SIZE)
     {
@@ -5906,9 +8322,9 @@ bool TCPIP_TCP_FifoSizeAdjust(TCP_SOCKET hTCP, uint16_t wMinRXSize, uint16_t wMi
             rxHead = pSkt->rxHead;
 
             // preserve out-of-order pending data
-            if(pSkt->sHoleSize != -1)
+            if(pSkt->nOooBlocks != 0)
             {
-                rxHead += pSkt->sHoleSize + pSkt->wFutureDataSize;
+                rxHead += pSkt->oooBlocks[pSkt->nOooBlocks - 1].endSEQ - pSkt->RemoteSEQ;
                 if(rxHead > pSkt->rxEnd)
                 {
                     rxHead -= pSkt->rxEnd - pSkt->rxStart + 1;
@@ -5969,6 +8385,7 @@ bool TCPIP_TCP_FifoSizeAdjust(TCP_SOCKET hTCP, uint16_t wMinRXSize, uint16_t wMi
         pSkt->txTail = pSkt->txStart;
         pSkt->txHead = pSkt->txStart + (pendTxEnd + pendTxBeg);
         pSkt->txUnackedTail = pSkt->txTail + txUnackOffs;
+        pSkt->txChkStart = 0;
         _TCPSetHalfFlushFlag(pSkt);
     }
 
@@ -5994,6 +8411,217 @@ bool TCPIP_TCP_FifoSizeAdjust(TCP_SOCKET hTCP, uint16_t wMinRXSize, uint16_t wMi
 
     return true;
 }
+
+#if (_TCP_AUTO_TUNE)
+// socket buffers auto-tuning
+//
+// Every TCP_AUTO_TUNE_PERIOD the data moved by each auto-tuned connection is measured:
+// the RX data consumed by the application and the TX data acknowledged by the remote node.
+// A FIFO is grown to twice the bandwidth-delay product of that rate,
+// at most doubling in a period, up to _TCP_AUTO_TUNE_MAX_BUFF:
+// a FIFO that limits the transfer keeps growing, one that doesn't stays unchanged.
+// All the auto-tuned sockets share _TCP_AUTO_TUNE_MEM_LIMIT bytes above the default sizes.
+// A socket with empty FIFOs and no data transfer for _TCP_AUTO_TUNE_IDLE_TIME
+// returns to the default sizes.
+
+#define TCP_AUTO_TUNE_PERIOD        250     // measurement period, ms
+#define TCP_AUTO_TUNE_DEF_RTT       100     // RTT used when no sample is available, ms
+#define TCP_AUTO_TUNE_ROUND         512     // FIFO sizes granularity
+
+// returns the sequence number acknowledged by the remote node
+static uint32_t _TcpAutoTuneSndUna(TCB_STUB* pSkt)
+{
+    int32_t unackLen = pSkt->txUnackedTail - pSkt->txTail;
+    if(unackLen < 0)
+    {
+        unackLen += pSkt->txEnd - pSkt->txStart;
+    }
+
+    return pSkt->MySEQ - unackLen;
+}
+
+// returns true if the socket TX buffer is not referenced by a queued packet
+static bool _TcpAutoTuneTxIdle(TCB_STUB* pSkt)
+{
+    if(pSkt->txBurstPkts != 0)
+    {   // burst packets referencing the TX FIFO
+        return false;
+    }
+
+    if(pSkt->pTxPkt == 0)
+    {
+        return true;
+    }
+
+#if defined (TCPIP_STACK_USE_IPV4)
+    if(pSkt->addType == IP_ADDRESS_TYPE_IPV4)
+    {
+        return (pSkt->pV4Pkt->macPkt.pktFlags & TCPIP_MAC_PKT_FLAG_QUEUED) == 0;
+    }
+#endif  // defined (TCPIP_STACK_USE_IPV4)
+
+    // the IPv6 packets are not tracked
+    return false;
+}
+
+// returns the memory used by the auto-tuned sockets above the default FIFO sizes
+static uint32_t _TcpAutoTuneMemGet(void)
+{
+    int ix;
+    TCB_STUB* pSkt;
+    uint16_t rxSize, txSize;
+    uint32_t memUsed = 0;
+
+    for(ix = 0; ix < TcpSockets; ix++)
+    {
+        if((pSkt = TCBStubs[ix]) != 0 && pSkt->optFlags.autoTune != 0)
+        {
+            rxSize = pSkt->rxEnd - pSkt->rxStart;
+            txSize = pSkt->txEnd - pSkt->txStart - 1;
+            if(rxSize > tcpDefRxSize)
+            {
+                memUsed += rxSize - tcpDefRxSize;
+            }
+            if(txSize > tcpDefTxSize)
+            {
+                memUsed += txSize - tcpDefTxSize;
+            }
+        }
+    }
+
+    return memUsed;
+}
+
+// calculates the new size of a FIFO that moved nBytes in the period
+// the memory taken above the default size is subtracted from *pMemAvlbl
+// returns 0 if the FIFO doesn't need to grow
+static uint16_t _TcpAutoTuneSizeGet(uint16_t currSize, uint16_t defSize, uint32_t nBytes, uint32_t rtt, uint32_t period, uint32_t* pMemAvlbl)
+{
+    uint32_t newSize, baseSize;
+
+    newSize = (uint32_t)(((uint64_t)nBytes * rtt * 2) / period);
+    if(newSize <= currSize)
+    {   // large enough
+        return 0;
+    }
+
+    if(newSize > (uint32_t)currSize * 2)
+    {
+        newSize = (uint32_t)currSize * 2;
+    }
+    newSize = ((newSize + TCP_AUTO_TUNE_ROUND - 1) / TCP_AUTO_TUNE_ROUND) * TCP_AUTO_TUNE_ROUND;
+    if(newSize > _TCP_AUTO_TUNE_MAX_BUFF)
+    {
+        newSize = _TCP_AUTO_TUNE_MAX_BUFF;
+    }
+
+    baseSize = currSize > defSize ? currSize : defSize;
+    if(newSize > baseSize + *pMemAvlbl)
+    {   // global limit
+        newSize = baseSize + *pMemAvlbl;
+    }
+
+    if(newSize < (uint32_t)currSize + TCP_MIN_BUFF_CHANGE)
+    {
+        return 0;
+    }
+
+    if(newSize > baseSize)
+    {
+        *pMemAvlbl -= newSize - baseSize;
+    }
+
+    return (uint16_t)newSize;
+}
+
+// auto-tunes the socket FIFOs
+// called from the stack thread, as part of the TCP tick processing
+static void _TcpAutoTune(uint32_t tickNow)
+{
+    int ix;
+    TCB_STUB* pSkt;
+    uint32_t period, memUsed, memAvlbl, rtt, rxBytes, txBytes;
+    uint16_t rxSize, txSize, newSize;
+
+    if((tickNow - tcpAutoTuneTime) < (TCP_AUTO_TUNE_PERIOD * sysTickFreq) / 1000)
+    {
+        return;
+    }
+
+    period = ((tickNow - tcpAutoTuneTime) * 1000) / sysTickFreq;
+    tcpAutoTuneTime = tickNow;
+
+    memUsed = _TcpAutoTuneMemGet();
+    memAvlbl = memUsed < _TCP_AUTO_TUNE_MEM_LIMIT ? _TCP_AUTO_TUNE_MEM_LIMIT - memUsed : 0;
+
+    for(ix = 0; ix < TcpSockets; ix++)
+    {
+        if((pSkt = TCBStubs[ix]) == 0 || pSkt->optFlags.autoTune == 0)
+        {
+            continue;
+        }
+
+        rxSize = pSkt->rxEnd - pSkt->rxStart;
+        txSize = pSkt->txEnd - pSkt->txStart - 1;
+
+        if(pSkt->smState == TCPIP_TCP_STATE_ESTABLISHED && pSkt->optFlags.atSample != 0)
+        {   // data consumed by the user and acknowledged by the remote node in this period
+            rxBytes = (pSkt->RemoteSEQ - pSkt->atRxSEQ) + pSkt->atRxPending - _TCPIsGetReady(pSkt);
+            txBytes = _TcpAutoTuneSndUna(pSkt) - pSkt->atTxSEQ;
+            if(rxBytes != 0 || txBytes != 0)
+            {
+                pSkt->atActiveTime = tickNow;
+            }
+
+            rtt = pSkt->nRttSamples != 0 ? (pSkt->srtt >> 3) : TCP_AUTO_TUNE_DEF_RTT;
+            if(rtt == 0)
+            {
+                rtt = 1;
+            }
+
+            if((newSize = _TcpAutoTuneSizeGet(rxSize, tcpDefRxSize, rxBytes, rtt, period, &memAvlbl)) != 0)
+            {
+                if(!_TcpFifoSizeAdjust(pSkt, newSize, 0, TCP_ADJUST_RX_ONLY | TCP_ADJUST_PRESERVE_RX))
+                {   // out of memory; the limit is not reached
+                    memAvlbl += newSize - (rxSize > tcpDefRxSize ? rxSize : tcpDefRxSize);
+                }
+            }
+
+            // the TX FIFO needs to grow only if the user has more data to send
+            if(pSkt->txHead != pSkt->txUnackedTail && _TcpAutoTuneTxIdle(pSkt))
+            {
+                if((newSize = _TcpAutoTuneSizeGet(txSize, tcpDefTxSize, txBytes, rtt, period, &memAvlbl)) != 0)
+                {
+                    if(!_TcpFifoSizeAdjust(pSkt, 0, newSize, TCP_ADJUST_TX_ONLY | TCP_ADJUST_PRESERVE_TX))
+                    {
+                        memAvlbl += newSize - (txSize > tcpDefTxSize ? txSize : tcpDefTxSize);
+                    }
+                }
+            }
+        }
+        else if((rxSize > tcpDefRxSize || txSize > tcpDefTxSize) && (tickNow - pSkt->atActiveTime) >= (_TCP_AUTO_TUNE_IDLE_TIME * sysTickFreq) / 1000)
+        {   // idle, not connected: back to the default sizes
+            if(pSkt->rxHead == pSkt->rxTail && pSkt->nOooBlocks == 0 && pSkt->txHead == pSkt->txTail && _TcpAutoTuneTxIdle(pSkt))
+            {
+                if(rxSize > tcpDefRxSize)
+                {
+                    _TcpFifoSizeAdjust(pSkt, tcpDefRxSize, 0, TCP_ADJUST_RX_ONLY);
+                }
+                if(txSize > tcpDefTxSize)
+                {
+                    _TcpFifoSizeAdjust(pSkt, 0, tcpDefTxSize, TCP_ADJUST_TX_ONLY);
+                }
+            }
+        }
+
+        // new sample
+        pSkt->atRxSEQ = pSkt->RemoteSEQ;
+        pSkt->atRxPending = _TCPIsGetReady(pSkt);
+        pSkt->atTxSEQ = _TcpAutoTuneSndUna(pSkt);
+        pSkt->optFlags.atSample = pSkt->smState == TCPIP_TCP_STATE_ESTABLISHED;
+    }
+}
+#endif  // (_TCP_AUTO_TUNE)
 #endif  // (TCPIP_TCP_DYNAMIC_OPTIONS != 0)
 
 
@@ -6163,6 +8791,17 @@ static bool _TCP_PortIsAvailable(TCP_PORT port)
         }
     }
 
+#if (_TCP_TIME_WAIT_ENABLE)
+    // the closing connections still own their local port
+    for(sktIx = 0; sktIx < _TCP_TIME_WAIT_SIZE; sktIx++)
+    {
+        if(tcpTwTable[sktIx].conn.remoteAddress.Val != 0 && tcpTwTable[sktIx].conn.localPort == port)
+        {
+            return false;
+        }
+    }
+#endif  // (_TCP_TIME_WAIT_ENABLE)
+
     return true;
 }
 
@@ -6246,11 +8885,11 @@ bool TCPIP_TCP_Bind(TCP_SOCKET hTCP, IP_ADDRESS_TYPE addType, TCP_PORT localPort
     // recalculate the MYTCBStub remote hash value
     if(pSkt->Flags.bServer)
     {   // server socket
-        pSkt->remoteHash = localPort;
+        _TcpSocketRemoteHashSet(pSkt, localPort);
     }
     else
     {   // client socket
-        pSkt->remoteHash = _TCP_ClientIPV4RemoteHash(&pSkt->destAddress, pSkt);
+        _TcpSocketRemoteHashSet(pSkt, _TCP_ClientIPV4RemoteHash(&pSkt->destAddress, pSkt));
     }
 
     return true;
@@ -6322,6 +8961,7 @@ bool TCPIP_TCP_OptionsSet(TCP_SOCKET hTCP, TCP_SOCKET_OPTION option, void* optPa
                         pSkt->keepAliveTmo = pKData->keepAliveTmo ? pKData->keepAliveTmo : TCPIP_TCP_KEEP_ALIVE_TIMEOUT;
                         pSkt->keepAliveLim = pKData->keepAliveUnackLim ? pKData->keepAliveUnackLim : TCPIP_TCP_MAX_UNACKED_KEEP_ALIVES;
                     }
+                    _TcpTimerUpdate(pSkt);
                     return true;
                 }
                 return false;
@@ -6359,6 +8999,30 @@ bool TCPIP_TCP_OptionsSet(TCP_SOCKET hTCP, TCP_SOCKET_OPTION option, void* optPa
             case TCP_OPTION_TOS:
                 pSkt->tos = (uint8_t)(unsigned int)optParam;
                 return true;
+
+            case TCP_OPTION_CONGESTION_CONTROL:
+                if(pSkt->flags.congCtrl == 0 && (int)optParam != 0)
+                {   // start with a fresh congestion window
+                    _TcpCongInit(pSkt);
+                }
+                pSkt->flags.congCtrl = (int)optParam != 0;
+                return true;
+
+            case TCP_OPTION_WINDOW_SCALE:
+                pSkt->optFlags.wsEnable = (int)optParam != 0;
+                return true;
+
+            case TCP_OPTION_TIMESTAMPS:
+                pSkt->optFlags.tsEnable = (int)optParam != 0;
+                return true;
+
+            case TCP_OPTION_AUTO_TUNE:
+#if (_TCP_AUTO_TUNE)
+                pSkt->optFlags.autoTune = (int)optParam != 0;
+                return true;
+#else
+                return false;   // not built in
+#endif  // (_TCP_AUTO_TUNE)
                 
             default:
                 return false;   // not supported option
@@ -6421,6 +9085,22 @@ bool TCPIP_TCP_OptionsGet(TCP_SOCKET hTCP, TCP_SOCKET_OPTION option, void* optPa
              case TCP_OPTION_TOS:
                 *(uint8_t*)optParam = pSkt->tos;
                 return true;
+
+            case TCP_OPTION_CONGESTION_CONTROL:
+                *(bool*)optParam = pSkt->flags.congCtrl != 0;
+                return true;
+
+            case TCP_OPTION_WINDOW_SCALE:
+                *(bool*)optParam = pSkt->optFlags.wsEnable != 0;
+                return true;
+
+            case TCP_OPTION_TIMESTAMPS:
+                *(bool*)optParam = pSkt->optFlags.tsEnable != 0;
+                return true;
+
+            case TCP_OPTION_AUTO_TUNE:
+                *(bool*)optParam = pSkt->optFlags.autoTune != 0;
+                return true;
                 
             default:
                 return false;   // not supported option
@@ -6520,7 +9200,7 @@ static void _TCP_PayloadSet(TCB_STUB * pSkt, void* pPkt, uint8_t* payload1, uint
 }
 
 
-static bool _TCP_Flush(TCB_STUB * pSkt, void* pPkt, uint16_t hdrLen, uint16_t loadLen)
+static bool _TCP_Flush(TCB_STUB * pSkt, void* pPkt, uint16_t hdrLen, uint16_t loadLen, uint16_t loadSum, TCPIP_MAC_PACKET* pBurst)
 {
     switch(pSkt->addType)
     {
@@ -6531,7 +9211,7 @@ static bool _TCP_Flush(TCB_STUB * pSkt, void* pPkt, uint16_t hdrLen, uint16_t lo
 
 #if defined (TCPIP_STACK_USE_IPV4)
         case IP_ADDRESS_TYPE_IPV4:
-            return _TCPv4Flush(pSkt, (IPV4_PACKET*)pPkt, hdrLen, loadLen);
+            return _TCPv4Flush(pSkt, (IPV4_PACKET*)pPkt, hdrLen, loadLen, loadSum, pBurst);
 #endif  // defined (TCPIP_STACK_USE_IPV4)
 
         default:
@@ -159,5 +159,11 @@ bool TCPIP_TCP_SourceIPAddressSet(TCP_SOCKET s, IP_ADDRESS_TYPE addType, IP_MULT
 
 bool TCPIP_TCP_DestinationIPAddressSet(TCP_SOCKET s, IP_ADDRESS_TYPE addType, IP_MULTI_ADDRESS* remoteAddress);
 
+#if (_TCPIP_STACK_RX_RUN_TO_COMPLETION != 0)
+// processes a RX packet inline, without going through the module RX queue
+// called by the IPv4 in run-to-completion mode
+void TCPIP_TCP_RxInline(TCPIP_MAC_PACKET* pRxPkt);
+#endif  // (_TCPIP_STACK_RX_RUN_TO_COMPLETION != 0)
+
 
 #endif  // __TCP_MANAGER_H_
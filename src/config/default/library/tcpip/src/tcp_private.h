@@ -101,6 +101,195 @@ Microchip or any third party.
 #define _TCP_SOCKET_RETX_TMO    1500        // default value, 1.5 sec
 #endif
 
+// limits of the retransmission timeout calculated from the RTT measurements, ms
+#if defined(TCPIP_TCP_MIN_RTO) && (TCPIP_TCP_MIN_RTO != 0)
+#define _TCP_SOCKET_MIN_RTO     TCPIP_TCP_MIN_RTO
+#else
+#define _TCP_SOCKET_MIN_RTO     200         // default value, 200 ms
+#endif
+
+#if defined(TCPIP_TCP_MAX_RTO) && (TCPIP_TCP_MAX_RTO != 0)
+#define _TCP_SOCKET_MAX_RTO     TCPIP_TCP_MAX_RTO
+#else
+#define _TCP_SOCKET_MAX_RTO     60000       // default value, 60 sec
+#endif
+
+// number of buckets in the socket demultiplexing hash tables
+// there is a table for the listening sockets and one for the connected ones
+#if defined(TCPIP_TCP_SOCKET_HASH_BUCKETS) && (TCPIP_TCP_SOCKET_HASH_BUCKETS != 0)
+#define _TCP_SOCKET_HASH_BUCKETS    TCPIP_TCP_SOCKET_HASH_BUCKETS
+#else
+#define _TCP_SOCKET_HASH_BUCKETS    16          // default value
+#endif
+
+// number of slots in the socket timer wheel
+// each slot covers a TCPIP_TCP_TASK_TICK_RATE interval
+#if defined(TCPIP_TCP_TIMER_WHEEL_SLOTS) && (TCPIP_TCP_TIMER_WHEEL_SLOTS != 0)
+#define _TCP_TIMER_WHEEL_SLOTS      TCPIP_TCP_TIMER_WHEEL_SLOTS
+#else
+#define _TCP_TIMER_WHEEL_SLOTS      64          // default value
+#endif
+
+// default congestion control setting for the new sockets
+// can be changed per socket with TCP_OPTION_CONGESTION_CONTROL
+#if defined(TCPIP_TCP_CONGESTION_CONTROL) && (TCPIP_TCP_CONGESTION_CONTROL != 0)
+#define _TCP_CONGESTION_CONTROL     1
+#else
+#define _TCP_CONGESTION_CONTROL     0           // default value: disabled
+#endif
+
+// maximum number of out-of-order data blocks tracked in a socket RX FIFO
+#if defined(TCPIP_TCP_RX_OOO_BLOCKS) && (TCPIP_TCP_RX_OOO_BLOCKS != 0)
+#define _TCP_RX_OOO_BLOCKS          TCPIP_TCP_RX_OOO_BLOCKS
+#else
+#define _TCP_RX_OOO_BLOCKS          4           // default value
+#endif
+
+// selective acknowledgement (RFC 2018) support
+// off by default: the SACK blocks change the segments on the wire and shorten the data segments
+#if defined(TCPIP_TCP_SACK_ENABLE)
+#define _TCP_SACK_ENABLE            (TCPIP_TCP_SACK_ENABLE != 0)
+#else
+#define _TCP_SACK_ENABLE            0           // default value: disabled
+#endif
+
+// maximum number of SACK blocks carried by an ACK
+#define _TCP_SACK_BLOCKS_MAX        4
+
+// window scale option (RFC 7323) default setting for the new sockets
+// off by default: the SYN segments change on the wire
+#if defined(TCPIP_TCP_WINDOW_SCALE_ENABLE)
+#define _TCP_WINDOW_SCALE_ENABLE    (TCPIP_TCP_WINDOW_SCALE_ENABLE != 0)
+#else
+#define _TCP_WINDOW_SCALE_ENABLE    0           // default value: disabled
+#endif
+
+// timestamps option (RFC 7323) default setting for the new sockets
+// off by default: the option takes 12 bytes from every full size segment
+#if defined(TCPIP_TCP_TIMESTAMPS_ENABLE)
+#define _TCP_TIMESTAMPS_ENABLE      (TCPIP_TCP_TIMESTAMPS_ENABLE != 0)
+#else
+#define _TCP_TIMESTAMPS_ENABLE      0           // default value: disabled
+#endif
+
+// number of entries in the SYN backlog
+// the half-open IPv4 connections to the listening sockets are kept in the backlog
+// and a socket is taken only when the 3-way handshake completes
+// 0 disables the backlog: a listening socket is taken at the SYN arrival
+// off by default: the backlog takes RAM and changes the handshake on the wire
+#if defined(TCPIP_TCP_SYN_BACKLOG_SIZE)
+#define _TCP_SYN_BACKLOG_SIZE       TCPIP_TCP_SYN_BACKLOG_SIZE
+#else
+#define _TCP_SYN_BACKLOG_SIZE       0           // default value: disabled
+#endif
+
+#if (_TCP_SYN_BACKLOG_SIZE != 0) && defined (TCPIP_STACK_USE_IPV4)
+#define _TCP_SYN_BACKLOG_ENABLE     1
+#else
+#define _TCP_SYN_BACKLOG_ENABLE     0
+#endif
+
+// SYN cookies (RFC 4987) are sent when the SYN backlog is full
+#if defined(TCPIP_TCP_SYN_COOKIES)
+#define _TCP_SYN_COOKIES            (TCPIP_TCP_SYN_COOKIES != 0)
+#else
+#define _TCP_SYN_COOKIES            0           // default value: disabled
+#endif
+
+// number of entries in the compact TIME_WAIT table
+// the IPv4 connections in TIME_WAIT, or in LAST_ACK waiting only for the FIN acknowledge,
+// are kept in the table and their socket is released
+// 0 disables the table: the sockets are kept until the connection is closed
+// off by default: the table takes RAM and changes how the closing connections are handled
+#if defined(TCPIP_TCP_TIME_WAIT_SIZE)
+#define _TCP_TIME_WAIT_SIZE         TCPIP_TCP_TIME_WAIT_SIZE
+#else
+#define _TCP_TIME_WAIT_SIZE         0           // default value: disabled
+#endif
+
+#if (_TCP_TIME_WAIT_SIZE != 0) && defined (TCPIP_STACK_USE_IPV4)
+#define _TCP_TIME_WAIT_ENABLE       1
+#else
+#define _TCP_TIME_WAIT_ENABLE       0
+#endif
+
+// maximum number of full size segments built and transmitted in one pass
+// when the TX FIFO holds bulk data; IPv4 only
+// 1 disables the burst transmission
+// off by default: the burst segments are sent back to back
+#if defined(TCPIP_TCP_TX_BURST) && (TCPIP_TCP_TX_BURST != 0)
+#define _TCP_TX_BURST               TCPIP_TCP_TX_BURST
+#else
+#define _TCP_TX_BURST               1           // default value: disabled
+#endif
+
+// zero-copy transmission of user buffers: TCPIP_TCP_ArrayPutRef()
+#if defined(TCPIP_TCP_ZERO_COPY_TX)
+#define _TCP_TX_REF_ENABLE          (TCPIP_TCP_ZERO_COPY_TX != 0)
+#else
+#define _TCP_TX_REF_ENABLE          1           // default value: enabled
+#endif
+
+// the checksum of the pending TX data is calculated while TCPIP_TCP_ArrayPut copies it
+// and used when a segment carries all the pending data; IPv4 only
+#if defined(TCPIP_TCP_TX_CHECKSUM_CACHE)
+#define _TCP_TX_CHKSUM_CACHE        (TCPIP_TCP_TX_CHECKSUM_CACHE != 0)
+#else
+#define _TCP_TX_CHKSUM_CACHE        1           // default value: enabled
+#endif
+
+// socket buffers auto-tuning
+// the socket RX and TX FIFOs grow with the measured bandwidth-delay product
+// and shrink back to the default sizes when the socket is idle
+// the default setting for the sockets; requires TCPIP_TCP_DYNAMIC_OPTIONS
+#if defined(TCPIP_TCP_AUTO_TUNE) && (TCPIP_TCP_AUTO_TUNE != 0) && (TCPIP_TCP_DYNAMIC_OPTIONS != 0)
+#define _TCP_AUTO_TUNE              1
+#else
+#define _TCP_AUTO_TUNE              0           // default value: disabled
+#endif
+
+// maximum size of an auto-tuned RX or TX FIFO
+#if defined(TCPIP_TCP_AUTO_TUNE_MAX_BUFF) && (TCPIP_TCP_AUTO_TUNE_MAX_BUFF != 0)
+#define _TCP_AUTO_TUNE_MAX_BUFF     TCPIP_TCP_AUTO_TUNE_MAX_BUFF
+#else
+#define _TCP_AUTO_TUNE_MAX_BUFF     16384       // default value
+#endif
+
+// heap memory that all the auto-tuned sockets can use above the default FIFO sizes
+#if defined(TCPIP_TCP_AUTO_TUNE_MEM_LIMIT) && (TCPIP_TCP_AUTO_TUNE_MEM_LIMIT != 0)
+#define _TCP_AUTO_TUNE_MEM_LIMIT    TCPIP_TCP_AUTO_TUNE_MEM_LIMIT
+#else
+#define _TCP_AUTO_TUNE_MEM_LIMIT    32768       // default value
+#endif
+
+// time with no data transfer after which an auto-tuned socket returns to the default FIFO sizes, ms
+#if defined(TCPIP_TCP_AUTO_TUNE_IDLE_TIME) && (TCPIP_TCP_AUTO_TUNE_IDLE_TIME != 0)
+#define _TCP_AUTO_TUNE_IDLE_TIME    TCPIP_TCP_AUTO_TUNE_IDLE_TIME
+#else
+#define _TCP_AUTO_TUNE_IDLE_TIME    5000        // default value, 5 sec
+#endif
+
+
+// user buffer queued for zero-copy transmission
+// the buffer reserves its size in the TX FIFO, but the data is not copied
+typedef struct _tag_TCP_TX_REF_BUFF
+{
+    struct _tag_TCP_TX_REF_BUFF*    next;       // safe cast to SGL_LIST_NODE
+    const uint8_t*                  pBuff;      // user buffer
+    uint8_t*                        fifoStart;  // TX FIFO position of the first not acknowledged byte
+    uint16_t                        buffLen;    // user buffer size
+    uint16_t                        ackLen;     // bytes acknowledged so far
+    TCPIP_TCP_TX_REF_FUNCTION       ackFnc;     // owner notification
+    const void*                     ackParam;   // notification parameter
+}TCP_TX_REF_BUFF;
+
+// out-of-order data block stored in the socket RX FIFO
+// covers the sequence numbers [startSEQ, endSEQ)
+typedef struct
+{
+    uint32_t            startSEQ;                   // first sequence number of the block
+    uint32_t            endSEQ;                     // sequence number following the block
+}TCP_RX_OOO_BLOCK;
 
 /****************************************************************************
   Section:
@@ -120,7 +309,7 @@ typedef struct
   ***************************************************************************/
 
 // TCP Control Block (TCB) stub data storage. 
-typedef struct
+typedef struct _tag_TCB_STUB
 {
     uint8_t*            txStart;                    // First byte of skt TX buffer
     uint8_t*            txEnd;                      // Last byte of skt TX buffer
@@ -155,6 +344,15 @@ typedef struct
     uint32_t            closeWaitTime;              // TCP_CLOSE_WAIT, TCP_FIN_WAIT_2, TCP_TIME_WAIT timeout
     uint32_t            retxTmo;                    // current retransmission timeout, ms
     uint32_t            retxTime;                   // current retransmission time, ticks
+    uint32_t            srtt;                       // smoothed RTT, ms, scaled by 8
+    uint32_t            rttVar;                     // RTT variation, ms, scaled by 4
+    uint32_t            rto;                        // retransmission timeout calculated from the RTT, ms; 0 if no samples yet
+    uint32_t            rttSEQ;                     // sequence number that ends the timed segment
+    uint32_t            rttTime;                    // tick when the timed segment was sent
+    uint32_t            sndMaxSEQ;                  // highest sequence number sent
+    uint32_t            atRxSEQ;                    // auto-tune: remote sequence number at the last sample
+    uint32_t            atTxSEQ;                    // auto-tune: acknowledged sequence number at the last sample
+    uint32_t            atActiveTime;               // auto-tune: tick of the last data transfer
 
     TCP_SOCKET   sktIx;                             // socket number
     struct
@@ -189,24 +387,38 @@ typedef struct
     uint32_t            retryInterval;              // How long to wait before retrying transmission
     uint32_t            MySEQ;                      // Local sequence number
     uint32_t            RemoteSEQ;                  // Remote sequence number
-    int32_t             sHoleSize;                  // Size of the hole, or -1 for none exists.  (0 indicates hole has just been filled)
+    uint32_t            recoverSEQ;                 // highest sequence number sent when fast recovery was entered
+    uint32_t            tsRecent;                   // timestamp to be echoed to the remote node
+    uint32_t            tsLastAckSent;              // acknowledge number of the last segment sent
+    uint32_t            oooLastSEQ;                 // start of the most recently received out-of-order segment
+    TCP_RX_OOO_BLOCK    oooBlocks[_TCP_RX_OOO_BLOCKS];  // out-of-order data waiting in the RX FIFO, ascending order
+    SINGLE_LIST         txRefList;                  // TCP_TX_REF_BUFF user buffers queued for transmission, FIFO order
+    uint8_t*            txChkStart;                 // start of the TX data summed in txChkSum; 0 if not valid
+    uint32_t            txChkSum;                   // raw checksum of the TX data between txChkStart and txHead
     TCP_PORT            remotePort;                 // Remote port number
     TCP_PORT            localPort;                  // Local port number
     uint16_t            remoteWindow;               // Remote window size
     uint16_t            localWindow;                // last advertised window size
-    uint16_t            wFutureDataSize;            // How much out-of-order data has been received
     uint16_t            wRemoteMSS;                 // Maximum Segment Size option advertised by the remote node during initial handshaking
     uint16_t            localMSS;                   // our advertised MSS
     uint16_t            maxRemoteWindow;            // max advertised remote window size
+    uint16_t            cwnd;                       // congestion window, bytes
+    uint16_t            ssthresh;                   // slow start threshold, bytes
+    uint16_t            cwndAckBytes;               // bytes acknowledged in congestion avoidance since the last cwnd increase
     uint16_t            keepAliveTmo;               // timeout, ms
     uint16_t            remoteHash;                 // Consists of remoteIP, remotePort, localPort for connected sockets.
+    struct _tag_TCB_STUB*  hashNext;                // next socket in the same demultiplexing hash bucket
+    struct _tag_TCB_STUB** hashHead;                // hash bucket this socket is linked in; 0 if none
+    struct _tag_TCB_STUB*  tmrNext;                 // next socket in the same timer wheel slot
+    struct _tag_TCB_STUB** tmrHead;                 // timer wheel slot this socket is linked in; 0 if none
+    uint32_t            tmrTime;                    // earliest tick when the socket timers need processing
     struct
     {
         uint16_t openAddType    : 2;                // the address type used at open
         uint16_t bFINSent       : 1;                // A FIN has been sent
         uint16_t bSYNSent       : 1;                // A SYN has been sent
-        uint16_t res1           : 1;                // not used
-        uint16_t res2           : 1;                // not used
+        uint16_t congCtrl       : 1;                // congestion control enabled
+        uint16_t fastRecovery   : 1;                // in fast recovery
         uint16_t nonLinger      : 1;                // linger option
         uint16_t nonGraceful    : 1;                // graceful close
         uint16_t ackSent        : 1;                // acknowledge sent in this pass
@@ -230,6 +442,24 @@ typedef struct
     uint8_t             ttl;                        // socket TTL value
     uint8_t             tos;                        // socket TOS value
     uint8_t             dupAckCnt;                  // duplicate ack count for fast retransmission    
+    uint8_t             nOooBlocks;                 // number of valid oooBlocks
+    uint8_t             sndWndShift;                // remote window scale factor
+    uint8_t             txBurstPkts;                // burst packets still referencing the TX FIFO
+    uint16_t            nRttSamples;                // number of RTT samples
+    uint16_t            atRxPending;                // auto-tune: RX bytes not read by the user at the last sample
+    uint16_t            rxLent;                     // RX FIFO bytes lent to the user by TCPIP_TCP_RxSegmentsGet
+    uint16_t            txChkLen;                   // number of TX bytes summed in txChkSum
+    struct
+    {
+        uint8_t sackPermit      : 1;                // SACK permitted option negotiated with the remote node
+        uint8_t wsEnable        : 1;                // window scale option enabled
+        uint8_t wsPermit        : 1;                // window scale option negotiated with the remote node
+        uint8_t tsEnable        : 1;                // timestamps option enabled
+        uint8_t tsPermit        : 1;                // timestamps option negotiated with the remote node
+        uint8_t rttTiming       : 1;                // a segment is being timed for RTT measurement
+        uint8_t autoTune        : 1;                // FIFO sizes auto-tuning enabled
+        uint8_t atSample        : 1;                // auto-tune sample taken for the current connection
+    } optFlags;
 #if ((TCPIP_TCP_DEBUG_LEVEL & TCPIP_TCP_DEBUG_MASK_TRACE_STATE) != 0)
     union
     {
@@ -246,4 +476,52 @@ typedef struct
     uint8_t pad[];                  // padding; not used
 } TCB_STUB;
 
+// identity of an IPv4 connection that is not using a socket
+typedef struct
+{
+    IPV4_ADDR           remoteAddress;              // remote node address; 0 if the entry is free
+    IPV4_ADDR           localAddress;               // local address of the connection
+    TCPIP_NET_IF*       pNet;                       // interface of the connection
+    TCP_PORT            remotePort;                 // remote port number
+    TCP_PORT            localPort;                  // local port number
+    uint8_t             ttl;                        // TTL value for the transmitted segments
+    uint8_t             tos;                        // TOS value for the transmitted segments
+}TCP_V4_CONN_ID;
+
+// SYN backlog entry: a half-open connection to a listening port
+typedef struct
+{
+    TCP_V4_CONN_ID      conn;                       // connection identity
+    uint32_t            irs;                        // remote initial sequence number
+    uint32_t            iss;                        // local initial sequence number
+    uint32_t            tsRecent;                   // timestamp to be echoed to the remote node
+    uint32_t            retxTime;                   // tick when the SYN + ACK is retransmitted
+    uint16_t            remoteMSS;                  // MSS advertised by the remote node
+    uint16_t            rxWindow;                   // window advertised in the SYN + ACK
+    uint8_t             sndWndShift;                // remote window scale factor
+    uint8_t             retryCount;                 // number of SYN + ACK retransmissions
+    struct
+    {
+        uint8_t sackPermit      : 1;                // remote node sent SACK permitted
+        uint8_t wsPermit        : 1;                // window scale option negotiated
+        uint8_t tsPermit        : 1;                // timestamps option negotiated
+        uint8_t reserved        : 5;                // not used
+    }optFlags;
+}TCP_SYN_ENTRY;
+
+// compact TIME_WAIT table entry: a closing connection that released its socket
+typedef struct
+{
+    TCP_V4_CONN_ID      conn;                       // connection identity
+    uint32_t            sndNxt;                     // local sequence number; the FIN sequence number in LAST_ACK
+    uint32_t            rcvNxt;                     // remote sequence number following the remote FIN
+    uint32_t            tsRecent;                   // timestamp to be echoed to the remote node
+    uint32_t            eventTime;                  // tick when TIME_WAIT ends or the LAST_ACK FIN is retransmitted
+    uint32_t            retryInterval;              // LAST_ACK FIN retransmission interval, ticks
+    uint16_t            rxWindow;                   // advertised window
+    uint8_t             smState;                    // TCPIP_TCP_STATE_TIME_WAIT or TCPIP_TCP_STATE_LAST_ACK
+    uint8_t             retryCount;                 // number of LAST_ACK FIN retransmissions
+    uint8_t             tsPermit;                   // timestamps option negotiated
+}TCP_TW_ENTRY;
+
 #endif  // _TCP_PRIVATE_H_
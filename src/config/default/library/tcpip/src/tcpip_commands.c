@@ -291,9 +291,9 @@ static const char* _CommandPktLogModuleNames[] =
 
 #endif  // (TCPIP_PACKET_LOG_ENABLE)
 
-#if defined(TCPIP_PACKET_ALLOCATION_TRACE_ENABLE)
+#if defined(TCPIP_PACKET_ALLOCATION_TRACE_ENABLE) || (TCPIP_PACKET_RECYCLE_ENABLE)
 static void _Command_PktInfo(SYS_CMD_DEVICE_NODE* pCmdIO, int argc, char** argv);
-#endif  // defined(TCPIP_PACKET_ALLOCATION_TRACE_ENABLE)
+#endif  // defined(TCPIP_PACKET_ALLOCATION_TRACE_ENABLE) || (TCPIP_PACKET_RECYCLE_ENABLE)
 
 #if defined(TCPIP_STACK_USE_INTERNAL_HEAP_POOL)
 static void _Command_HeapList(SYS_CMD_DEVICE_NODE* pCmdIO, int argc, char** argv);
@@ -593,9 +593,9 @@ static const SYS_CMD_DESCRIPTOR    tcpipCmdTbl[]=
 #if (TCPIP_PACKET_LOG_ENABLE)
     {"plog",        _Command_PktLog,               ": PKT flight log"},
 #endif  // (TCPIP_PACKET_LOG_ENABLE)
-#if defined(TCPIP_PACKET_ALLOCATION_TRACE_ENABLE)
+#if defined(TCPIP_PACKET_ALLOCATION_TRACE_ENABLE) || (TCPIP_PACKET_RECYCLE_ENABLE)
     {"pktinfo",     _Command_PktInfo,              ": Check PKT allocation"},
-#endif  // defined(TCPIP_PACKET_ALLOCATION_TRACE_ENABLE)
+#endif  // defined(TCPIP_PACKET_ALLOCATION_TRACE_ENABLE) || (TCPIP_PACKET_RECYCLE_ENABLE)
 #if defined(TCPIP_STACK_USE_INTERNAL_HEAP_POOL)
     {"heaplist",    _Command_HeapList,             ": List heap"},
 #endif  // defined(TCPIP_STACK_USE_INTERNAL_HEAP_POOL)
@@ -3174,6 +3174,32 @@ static void _Command_StackOnOff(SYS_CMD_DEVICE_NODE* pCmdIO, int argc, char** ar
 }
 #endif  // (TCPIP_STACK_DOWN_OPERATION != 0)
 
+#if defined(TCPIP_STACK_USE_INTERNAL_HEAP_CLASS)
+static void _CommandHeapClassInfo(SYS_CMD_DEVICE_NODE* pCmdIO, TCPIP_STACK_HEAP_HANDLE heapH)
+{
+    int ix, nEntries;
+    TCPIP_HEAP_CLASS_INFO classInfo;
+    TCPIP_HEAP_CLASS_ENTRY_LIST entryList;
+    const void* cmdIoParam = pCmdIO->cmdIoParam;
+
+    if(!TCPIP_HEAP_CLASS_Info(heapH, &classInfo))
+    {
+        return;
+    }
+
+    (*pCmdIO->pCmdApi->print)(cmdIoParam, "Size classes: %d, class max size: %d, large allocs: %d, large free: %d, reclaims: %d\r\n", classInfo.nClasses, classInfo.classMaxSize, classInfo.largeAllocs, classInfo.largeFree, classInfo.nReclaims);
+
+    nEntries = TCPIP_HEAP_CLASS_Entries(heapH);
+    for(ix = 0; ix < nEntries; ix++)
+    {
+        if(TCPIP_HEAP_CLASS_EntryList(heapH, ix, &entryList) && entryList.nAllocs != 0)
+        {   // show only the used classes
+            (*pCmdIO->pCmdApi->print)(cmdIoParam, "\tclass: %4d, alloc: %4d, free: %4d, max: %4d, nAllocs: %6d, nHits: %6d\r\n", entryList.blockSize, entryList.allocBlocks, entryList.freeBlocks, entryList.maxBlocks, entryList.nAllocs, entryList.nHits);
+        }
+    }
+}
+#endif  // defined(TCPIP_STACK_USE_INTERNAL_HEAP_CLASS)
+
 static void _Command_HeapInfo(SYS_CMD_DEVICE_NODE* pCmdIO, int argc, char** argv)
 {
 #if defined(TCPIP_STACK_DRAM_DEBUG_ENABLE)    
@@ -3193,6 +3219,7 @@ static void _Command_HeapInfo(SYS_CMD_DEVICE_NODE* pCmdIO, int argc, char** argv
         "internal",     // TCPIP_STACK_HEAP_TYPE_INTERNAL_HEAP
         "pool",         // TCPIP_STACK_HEAP_TYPE_INTERNAL_HEAP_POOL
         "external",     // TCPIP_STACK_HEAP_TYPE_EXTERNAL_HEAP
+        "class",        // TCPIP_STACK_HEAP_TYPE_INTERNAL_HEAP_CLASS
     };
 
 
@@ -3236,6 +3263,13 @@ static void _Command_HeapInfo(SYS_CMD_DEVICE_NODE* pCmdIO, int argc, char** argv
         (*pCmdIO->pCmdApi->print)(cmdIoParam, "All available heap size: %d Bytes, high watermark: %d\r\n", TCPIP_HEAP_FreeSize(heapH), TCPIP_HEAP_HighWatermark(heapH));
         (*pCmdIO->pCmdApi->print)(cmdIoParam, "Last heap error: 0x%x\r\n", TCPIP_HEAP_LastError(heapH));
 
+#if defined(TCPIP_STACK_USE_INTERNAL_HEAP_CLASS)
+        if(hType == TCPIP_STACK_HEAP_TYPE_INTERNAL_HEAP_CLASS)
+        {
+            _CommandHeapClassInfo(pCmdIO, heapH);
+        }
+#endif  // defined(TCPIP_STACK_USE_INTERNAL_HEAP_CLASS)
+
 #if defined(TCPIP_STACK_DRAM_DEBUG_ENABLE)    
         nTraces = TCPIP_HEAP_TraceGetEntriesNo(heapH, true);
         if(nTraces)
@@ -4188,6 +4222,10 @@ static void _CommandArp(SYS_CMD_DEVICE_NODE* pCmdIO, int argc, char** argv)
                     message = "arp: address newly queued\r\n";
                     break;
 
+                case ARP_RES_HOST_UNREACHABLE:
+                    message = "arp: address recently failed to resolve\r\n";
+                    break;
+
                 default:    // ARP_RES_CACHE_FULL  
                     message = "arp: queue full/error\r\n";
                     break;
@@ -5262,8 +5300,11 @@ static void _Command_Udp(SYS_CMD_DEVICE_NODE* pCmdIO, int argc, char** argv)
 #if (TCPIP_TCP_COMMANDS)
 static void _Command_Tcp(SYS_CMD_DEVICE_NODE* pCmdIO, int argc, char** argv)
 {   // tcp info <n>
+    // tcp syn <clr>
     int  sktNo, ix, startIx, stopIx;
     TCP_SOCKET_INFO sktInfo;
+    TCP_SYN_BACKLOG_STAT synStat;
+    TCP_TIME_WAIT_STAT twStat;
 
     const void* cmdIoParam = pCmdIO->cmdIoParam;
 
@@ -5285,6 +5326,11 @@ static void _Command_Tcp(SYS_CMD_DEVICE_NODE* pCmdIO, int argc, char** argv)
             }
 
             (*pCmdIO->pCmdApi->print)(cmdIoParam, "TCP sockets: %d \r\n", sktNo);
+            if(TCPIP_TCP_TimeWaitStatGet(&twStat))
+            {
+                (*pCmdIO->pCmdApi->print)(cmdIoParam, "TIME_WAIT table: %d, time-wait: %d, last-ack: %d, released: %d, evicted: %d\r\n",
+                        twStat.tableSize, twStat.timeWait, twStat.lastAck, twStat.released, twStat.evicted);
+            }
             for(ix = startIx; ix < stopIx; ix++)
             {
                 if(TCPIP_TCP_SocketInfoGet(ix, &sktInfo))
@@ -5293,14 +5339,34 @@ static void _Command_Tcp(SYS_CMD_DEVICE_NODE* pCmdIO, int argc, char** argv)
                             ix, sktInfo.addressType, sktInfo.remotePort, sktInfo.localPort, sktInfo.flags);
                     (*pCmdIO->pCmdApi->print)(cmdIoParam, "\trxSize: %d, txSize: %d, state: %d, rxPend: %d, txPend: %d\r\n",
                             sktInfo.rxSize, sktInfo.txSize, sktInfo.state, sktInfo.rxPending, sktInfo.txPending);
+                    (*pCmdIO->pCmdApi->print)(cmdIoParam, "\tsrtt: %d ms, rttVar: %d ms, rto: %d ms, rttSamples: %d\r\n",
+                            sktInfo.srtt, sktInfo.rttVar, sktInfo.rto, sktInfo.rttSamples);
                 }
             }
 
             return;
         }
+
+        if(strcmp("syn", argv[1]) == 0)
+        {
+            if(!TCPIP_TCP_SynBacklogStatGet(&synStat, argc > 2 && strcmp("clr", argv[2]) == 0))
+            {
+                (*pCmdIO->pCmdApi->msg)(cmdIoParam, "TCP SYN backlog not enabled\r\n");
+                return;
+            }
+
+            (*pCmdIO->pCmdApi->print)(cmdIoParam, "TCP SYN backlog size: %d, used: %d\r\n", synStat.backlogSize, synStat.backlogUsed);
+            (*pCmdIO->pCmdApi->print)(cmdIoParam, "\tsynRcvd: %d, cookiesSent: %d, cookiesValid: %d, dropped: %d\r\n",
+                    synStat.synRcvd, synStat.cookiesSent, synStat.cookiesValid, synStat.dropped);
+            // connection rate since the last clear
+            (*pCmdIO->pCmdApi->print)(cmdIoParam, "\taccepted: %d in %d ms, rate: %d conn/s\r\n",
+                    synStat.accepted, synStat.statTime, synStat.statTime != 0 ? (int)(((uint64_t)synStat.accepted * 1000) / synStat.statTime) : 0);
+            return;
+        }
     }
 
     (*pCmdIO->pCmdApi->msg)(cmdIoParam, "usage: tcp info <n>\r\n");
+    (*pCmdIO->pCmdApi->msg)(cmdIoParam, "usage: tcp syn <clr>\r\n");
 }
 
 static void _Command_TcpTrace(SYS_CMD_DEVICE_NODE* pCmdIO, int argc, char** argv)
@@ -5918,19 +5984,36 @@ static void _CommandPktLogDefHandler(TCPIP_STACK_MODULE moduleId, const TCPIP_PK
 #endif  // (TCPIP_PACKET_LOG_ENABLE)
 
 
-#if defined(TCPIP_PACKET_ALLOCATION_TRACE_ENABLE)
+#if defined(TCPIP_PACKET_ALLOCATION_TRACE_ENABLE) || (TCPIP_PACKET_RECYCLE_ENABLE)
 static void _Command_PktInfo(SYS_CMD_DEVICE_NODE* pCmdIO, int argc, char** argv)
 {
     int  ix;
     TCPIP_PKT_TRACE_ENTRY tEntry;
     TCPIP_PKT_TRACE_INFO  tInfo;
+    TCPIP_PKT_RECYCLE_ENTRY rEntry;
 
     const void* cmdIoParam = pCmdIO->cmdIoParam;
 
+    int nClasses = TCPIP_PKT_RecycleGetEntriesNo();
+    if(nClasses != 0)
+    {
+        (*pCmdIO->pCmdApi->print)(cmdIoParam, "PKT recycle classes: %d\r\n", nClasses);
+        for(ix = 0; ix < nClasses; ix++)
+        {
+            if(TCPIP_PKT_RecycleGetEntry(ix, &rEntry))
+            {
+                (*pCmdIO->pCmdApi->print)(cmdIoParam, "\tsize: %4d, cached: %2d, hits: %6d, misses: %6d, drops: %6d\r\n",
+                        rEntry.blockSize, rEntry.nCached, rEntry.nHits, rEntry.nMisses, rEntry.nDrops);
+            }
+        }
+    }
 
     if(!TCPIP_PKT_TraceGetEntriesNo(&tInfo))
     {
-        (*pCmdIO->pCmdApi->msg)(cmdIoParam, "No packet info available\r\n");
+        if(nClasses == 0)
+        {
+            (*pCmdIO->pCmdApi->msg)(cmdIoParam, "No packet info available\r\n");
+        }
         return;
     }
 
@@ -5947,7 +6030,7 @@ static void _Command_PktInfo(SYS_CMD_DEVICE_NODE* pCmdIO, int argc, char** argv)
     }
 
 }
-#endif  // defined(TCPIP_PACKET_ALLOCATION_TRACE_ENABLE)
+#endif  // defined(TCPIP_PACKET_ALLOCATION_TRACE_ENABLE) || (TCPIP_PACKET_RECYCLE_ENABLE)
 
 #if defined(TCPIP_STACK_USE_INTERNAL_HEAP_POOL)
 static void _Command_HeapList(SYS_CMD_DEVICE_NODE* pCmdIO, int argc, char** argv)
@@ -6809,6 +6892,17 @@ static void _CommandIpv4Arp(SYS_CMD_DEVICE_NODE* pCmdIO, int argc, char** argv)
         (*pCmdIO->pCmdApi->print)(cmdIoParam, "pool: %d, pend: %d, txSubmit: %d, fwdSubmit: %d\r\n", arpStat.nPool, arpStat.nPend, arpStat.txSubmit, arpStat.fwdSubmit);
         (*pCmdIO->pCmdApi->print)(cmdIoParam, "txSolved: %d, fwdSolved: %d, totSolved: %d, totFailed: %d\r\n", arpStat.txSolved, arpStat.fwdSolved, arpStat.totSolved, arpStat.totFailed);
     }
+
+    size_t destIx;
+    TCPIP_IPV4_ARP_DEST_STAT destStat;
+    char addrBuff[20];
+
+    // the used destination slots start at index 0
+    for(destIx = 0; TCPIP_IPV4_ArpQueueStatGet(destIx, &destStat, statClear); destIx++)
+    {
+        TCPIP_Helper_IPAddressToString(&destStat.arpTarget, addrBuff, sizeof(addrBuff));
+        (*pCmdIO->pCmdApi->print)(cmdIoParam, "dest: %s, if: %d, pend: %d, queued: %d, flushed: %d, dropped: %d\r\n", addrBuff, destStat.netIx, destStat.pending, destStat.queued, destStat.flushed, destStat.dropped);
+    }
 }
 
 #if (TCPIP_IPV4_FORWARDING_ENABLE != 0)
@@ -137,6 +137,11 @@ TCPIP_STACK_HEAP_HANDLE TCPIP_HEAP_Create(const TCPIP_STACK_HEAP_CONFIG* initDat
                 return TCPIP_HEAP_CreateInternalPool((const TCPIP_STACK_HEAP_POOL_CONFIG*)initData, pRes);
 #endif  // defined (TCPIP_STACK_USE_INTERNAL_HEAP_POOL)
 
+#if defined (TCPIP_STACK_USE_INTERNAL_HEAP_CLASS)
+            case TCPIP_STACK_HEAP_TYPE_INTERNAL_HEAP_CLASS:
+                return TCPIP_HEAP_CreateInternalClass((const TCPIP_STACK_HEAP_CLASS_CONFIG*)initData, pRes);
+#endif  // defined (TCPIP_STACK_USE_INTERNAL_HEAP_CLASS)
+
             default:
                 break;
         }
@@ -262,6 +267,13 @@ TCPIP_STACK_HEAP_HANDLE TCPIP_HEAP_Create(const TCPIP_STACK_HEAP_CONFIG* initDat
             break;
 #endif  // defined (TCPIP_STACK_USE_INTERNAL_HEAP_POOL)
 
+#if defined (TCPIP_STACK_USE_INTERNAL_HEAP_CLASS)
+        case TCPIP_STACK_HEAP_TYPE_INTERNAL_HEAP_CLASS:
+            newH = TCPIP_HEAP_CreateInternalClass((const TCPIP_STACK_HEAP_CLASS_CONFIG*)initData, pRes);
+            flags = initData->heapFlags;
+            break;
+#endif  // defined (TCPIP_STACK_USE_INTERNAL_HEAP_CLASS)
+
         default:
             return 0;
     }
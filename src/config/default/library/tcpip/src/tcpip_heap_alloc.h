@@ -577,6 +577,40 @@ int     TCPIP_HEAP_POOL_Entries(TCPIP_STACK_HEAP_HANDLE heapH);
 bool TCPIP_HEAP_POOL_EntryList(TCPIP_STACK_HEAP_HANDLE heapH, int entryIx, TCPIP_HEAP_POOL_ENTRY_LIST* pList);
 
 
+// size class heap specific functionality for reporting the class occupancy
+// these functions should be called with a valid class heap handle!
+
+// size class entry describing the class status
+typedef struct
+{
+    int blockSize;      // size of the blocks in this class, bytes, header included
+    int allocBlocks;    // blocks of this class currently allocated
+    int freeBlocks;     // blocks of this class currently sitting in the class free list
+    int maxBlocks;      // max number of blocks of this class allocated at the same time
+    int nAllocs;        // number of allocations served from this class
+    int nHits;          // number of allocations served directly from the class free list
+}TCPIP_HEAP_CLASS_ENTRY_LIST;
+
+// size class heap global counters
+typedef struct
+{
+    int nClasses;       // number of size classes
+    int classMaxSize;   // largest block size served from the class lists, bytes
+    int largeAllocs;    // number of allocations served by the large block list
+    int largeFree;      // free space in the large block list, bytes
+    int nReclaims;      // number of times the class free lists were coalesced back into the large list
+}TCPIP_HEAP_CLASS_INFO;
+
+// returns the number of size classes in the class heap
+int     TCPIP_HEAP_CLASS_Entries(TCPIP_STACK_HEAP_HANDLE heapH);
+
+// lists a size class identified by its index
+bool    TCPIP_HEAP_CLASS_EntryList(TCPIP_STACK_HEAP_HANDLE heapH, int entryIx, TCPIP_HEAP_CLASS_ENTRY_LIST* pList);
+
+// returns the class heap global counters
+bool    TCPIP_HEAP_CLASS_Info(TCPIP_STACK_HEAP_HANDLE heapH, TCPIP_HEAP_CLASS_INFO* pInfo);
+
+
 
 // *****************************************************************************
 // supported heap creation functions
@@ -590,5 +624,8 @@ extern TCPIP_STACK_HEAP_HANDLE TCPIP_HEAP_CreateExternal(const TCPIP_STACK_HEAP_
 // pool heap - internal
 TCPIP_STACK_HEAP_HANDLE TCPIP_HEAP_CreateInternalPool(const TCPIP_STACK_HEAP_POOL_CONFIG* pHeapConfig, TCPIP_STACK_HEAP_RES* pRes);
 
+// size class heap - internal
+TCPIP_STACK_HEAP_HANDLE TCPIP_HEAP_CreateInternalClass(const TCPIP_STACK_HEAP_CLASS_CONFIG* pHeapConfig, TCPIP_STACK_HEAP_RES* pRes);
+
 #endif  // _TCPIP_HEAP_ALLOC_H_
 
@@ -0,0 +1,884 @@
+/*******************************************************************************
+  TCPIP Size Class Heap Allocation Manager
+
+  Summary:
+
+  Description:
+    Heap with segregated free lists per size class for the small blocks
+    and a coalescing first fit list for the large blocks.
+*******************************************************************************/
+
+/*
+Copyright (C) 2012-2023, Microchip Technology Inc., and its subsidiaries. All rights reserved.
+
+The software and documentation is provided by microchip and its contributors
+"as is" and any express, implied or statutory warranties, including, but not
+limited to, the implied warranties of merchantability, fitness for a particular
+purpose and non-infringement of third party intellectual property rights are
+disclaimed to the fullest extent permitted by law. In no event shall microchip
+or its contributors be liable for any direct, indirect, incidental, special,
+exemplary, or consequential damages (including, but not limited to, procurement
+of substitute goods or services; loss of use, data, or profits; or business
+interruption) however caused and on any theory of liability, whether in contract,
+strict liability, or tort (including negligence or otherwise) arising in any way
+out of the use of the software and documentation, even if advised of the
+possibility of such damage.
+
+Except as expressly permitted hereunder and subject to the applicable license terms
+for any third-party software incorporated in the software and any applicable open
+source software license terms, no license or other rights, whether express or
+implied, are granted under any patent or other intellectual property rights of
+Microchip or any third party.
+*/
+
+
+
+
+
+
+
+
+
+#include <string.h>
+#include <stdlib.h>
+
+#if defined(__mips__)
+#include <sys/kmem.h>
+#endif
+
+
+#include "tcpip/src/tcpip_private.h"
+
+#if defined (TCPIP_STACK_USE_INTERNAL_HEAP_CLASS)
+
+// definitions
+
+
+// min heap alignment
+// always power of 2
+#if (CACHE_LINE_SIZE >= 8u)
+typedef struct __attribute__((aligned(CACHE_LINE_SIZE)))
+{
+    uint64_t     pad[CACHE_LINE_SIZE / 8];
+}_heap_Align;
+#elif (CACHE_LINE_SIZE >= 4u)
+typedef uint32_t _heap_Align;
+#else
+#error "TCP/IP Heap: incorrect CACHE_LINE_SIZE!"
+#endif // (CACHE_LINE_SIZE >= 8u)
+
+typedef union __attribute__((aligned(CACHE_LINE_SIZE))) _tag_headNode
+{
+    _heap_Align x;
+    struct
+    {
+        union _tag_headNode*    next;
+        size_t                  units;
+    };
+}_headNode;
+
+
+#define _TCPIP_HEAP_MIN_BLK_USIZE_      2   // avoid tiny blocks having units <=  value.
+
+#define _TCPIP_HEAP_MIN_BLKS_           64  // efficiency reasons, the minimum heap size that can be handled.
+
+#define _TCPIP_HEAP_CLASS_MIN_UNITS     2   // smallest block that can be allocated: header + 1 data unit
+
+#define _TCPIP_HEAP_CLASS_MAX_UNITS     256 // maximum number of units of a size class block
+
+// default largest block size served from the size class lists, bytes
+#if defined(TCPIP_STACK_HEAP_CLASS_MAX_SIZE) && (TCPIP_STACK_HEAP_CLASS_MAX_SIZE != 0)
+#define _TCPIP_HEAP_CLASS_DEFAULT_MAX_SIZE  TCPIP_STACK_HEAP_CLASS_MAX_SIZE
+#else
+#define _TCPIP_HEAP_CLASS_DEFAULT_MAX_SIZE  512
+#endif
+
+// size class entry
+// blocks with the same number of units share the same class
+typedef struct
+{
+    _headNode*      freeList;       // singly linked list of free blocks of this class; LIFO
+    uint16_t        allocBlocks;    // currently allocated blocks
+    uint16_t        freeBlocks;     // blocks in the freeList
+    uint16_t        maxBlocks;      // max allocated blocks
+    uint16_t        pad;            // not used
+    uint32_t        nAllocs;        // allocation requests for this class
+    uint32_t        nHits;          // allocation requests served from the freeList
+}TCPIP_HEAP_CLASS_ENTRY;
+
+
+typedef struct
+{
+    _headNode*      _largeHead;
+    _headNode*      _largeTail;                 // head and tail pointers of the address ordered large block list
+    size_t          _heapUnits;                 // size of the heap, units
+    size_t          _heapAllocatedUnits;        // how many units allocated out there
+    size_t          _heapWatermark;             // max allocated units
+    size_t          _classFreeUnits;            // units sitting in the class free lists
+    TCPIP_HEAP_CLASS_ENTRY* _classTbl;          // the size class table; _nClasses entries
+    uint16_t        _nClasses;                  // number of size classes
+    uint16_t        _classMaxUnits;             // largest block, in units, served from the class lists
+    uint32_t        _largeAllocs;               // allocations served by the large block list
+    uint32_t        _nReclaims;                 // class lists coalesced back into the large list
+    TCPIP_STACK_HEAP_RES  _lastHeapErr;         // last error encountered
+    TCPIP_STACK_HEAP_FLAGS _heapFlags;          // heap flags
+    void*           allocatedBuffer;            // buffer initially allocated for this heap
+    void            (*free_fnc)(void* ptr);     // free function needed to delete the heap
+
+#if defined(TCPIP_STACK_DRAM_DEBUG_ENABLE)
+    _headNode*   _heapStart;                    // debug checkpoint
+    _headNode*   _heapEnd;                      // debug checkpoint
+#endif
+
+    OSAL_SEM_HANDLE_TYPE _heapSemaphore;
+
+    // alignment padding
+    // TCPIP_HEAP_CLASS_ENTRY _classTbl[_nClasses];    // the class table
+    // _headNode _heap[0];           // the heap itself, dynamically allocated
+
+}TCPIP_HEAP_CLASS_DCPT; // descriptor of a class heap
+
+
+// local data
+//
+
+static TCPIP_STACK_HEAP_RES   _TCPIP_HEAP_CLASS_Delete(TCPIP_STACK_HEAP_HANDLE heapH);
+static void*            _TCPIP_HEAP_CLASS_Malloc(TCPIP_STACK_HEAP_HANDLE heapH, size_t nBytes);
+static void*            _TCPIP_HEAP_CLASS_Calloc(TCPIP_STACK_HEAP_HANDLE heapH, size_t nElems, size_t elemSize);
+static size_t           _TCPIP_HEAP_CLASS_Free(TCPIP_STACK_HEAP_HANDLE heapH, const void* pBuff);
+
+static size_t           _TCPIP_HEAP_CLASS_Size(TCPIP_STACK_HEAP_HANDLE heapH);
+static size_t           _TCPIP_HEAP_CLASS_MaxSize(TCPIP_STACK_HEAP_HANDLE heapH);
+static size_t           _TCPIP_HEAP_CLASS_FreeSize(TCPIP_STACK_HEAP_HANDLE heapH);
+static size_t           _TCPIP_HEAP_CLASS_HighWatermark(TCPIP_STACK_HEAP_HANDLE heapH);
+static TCPIP_STACK_HEAP_RES   _TCPIP_HEAP_CLASS_LastError(TCPIP_STACK_HEAP_HANDLE heapH);
+#if defined(TCPIP_STACK_DRAM_DEBUG_ENABLE)
+static size_t           _TCPIP_HEAP_CLASS_AllocSize(TCPIP_STACK_HEAP_HANDLE heapH, const void* ptr);
+#endif  // defined(TCPIP_STACK_DRAM_DEBUG_ENABLE)
+
+// maps a buffer to non cached memory
+const void* _TCPIP_HEAP_BufferMapNonCached(const void* buffer, size_t buffSize);
+
+
+
+
+// the heap object
+static const TCPIP_HEAP_OBJECT      _tcpip_heap_class_object =
+{
+    .TCPIP_HEAP_Delete = _TCPIP_HEAP_CLASS_Delete,
+    .TCPIP_HEAP_Malloc = _TCPIP_HEAP_CLASS_Malloc,
+    .TCPIP_HEAP_Calloc = _TCPIP_HEAP_CLASS_Calloc,
+    .TCPIP_HEAP_Free = _TCPIP_HEAP_CLASS_Free,
+    .TCPIP_HEAP_Size = _TCPIP_HEAP_CLASS_Size,
+    .TCPIP_HEAP_MaxSize = _TCPIP_HEAP_CLASS_MaxSize,
+    .TCPIP_HEAP_FreeSize = _TCPIP_HEAP_CLASS_FreeSize,
+    .TCPIP_HEAP_HighWatermark = _TCPIP_HEAP_CLASS_HighWatermark,
+    .TCPIP_HEAP_LastError = _TCPIP_HEAP_CLASS_LastError,
+#if defined(TCPIP_STACK_DRAM_DEBUG_ENABLE)
+    .TCPIP_HEAP_AllocSize = _TCPIP_HEAP_CLASS_AllocSize,
+#endif  // defined(TCPIP_STACK_DRAM_DEBUG_ENABLE)
+};
+
+typedef struct
+{
+    TCPIP_HEAP_OBJECT       heapObj;    // heap object API
+    TCPIP_HEAP_CLASS_DCPT   heapDcpt;   // private heap object data
+}TCPIP_HEAP_CLASS_OBJ_INSTANCE;
+
+
+
+// local prototypes
+//
+
+static _headNode* _TCPIP_HEAP_CLASS_LargeAlloc(TCPIP_HEAP_CLASS_DCPT* hDcpt, size_t nunits);
+static bool _TCPIP_HEAP_CLASS_LargeInsert(TCPIP_HEAP_CLASS_DCPT* hDcpt, _headNode* ptr);
+static void _TCPIP_HEAP_CLASS_Reclaim(TCPIP_HEAP_CLASS_DCPT* hDcpt);
+
+// returns the TCPIP_HEAP_CLASS_OBJ_INSTANCE associated with a heap handle
+// null if invalid
+static __inline__ TCPIP_HEAP_CLASS_OBJ_INSTANCE* __attribute__((always_inline)) _TCPIP_HEAP_CLASS_ObjInstance(TCPIP_STACK_HEAP_HANDLE heapH)
+{
+#if defined(TCPIP_STACK_DRAM_DEBUG_ENABLE)
+    if(heapH)
+    {
+        TCPIP_HEAP_CLASS_OBJ_INSTANCE* pInst = (TCPIP_HEAP_CLASS_OBJ_INSTANCE*)heapH;
+        if(pInst->heapObj.TCPIP_HEAP_Delete == _TCPIP_HEAP_CLASS_Delete)
+        {
+            return pInst;
+        }
+    }
+    return 0;
+#else
+    return (heapH == 0) ? 0 : (TCPIP_HEAP_CLASS_OBJ_INSTANCE*)heapH;
+#endif  // defined(TCPIP_STACK_DRAM_DEBUG_ENABLE)
+
+}
+
+// returns the TCPIP_HEAP_CLASS_DCPT associated with a heap handle
+// null if invalid
+static __inline__ TCPIP_HEAP_CLASS_DCPT* __attribute__((always_inline)) _TCPIP_HEAP_CLASS_ObjDcpt(TCPIP_STACK_HEAP_HANDLE heapH)
+{
+    TCPIP_HEAP_CLASS_OBJ_INSTANCE* hInst = _TCPIP_HEAP_CLASS_ObjInstance(heapH);
+
+    return (hInst == 0) ? 0 : &hInst->heapDcpt;
+}
+
+// returns the size class entry for a block of nunits
+// null if the block is not handled by the class lists
+static __inline__ TCPIP_HEAP_CLASS_ENTRY* __attribute__((always_inline)) _TCPIP_HEAP_CLASS_Entry(TCPIP_HEAP_CLASS_DCPT* hDcpt, size_t nunits)
+{
+    return (nunits <= hDcpt->_classMaxUnits) ? hDcpt->_classTbl + (nunits - _TCPIP_HEAP_CLASS_MIN_UNITS) : 0;
+}
+
+// API
+
+TCPIP_STACK_HEAP_HANDLE TCPIP_HEAP_CreateInternalClass(const TCPIP_STACK_HEAP_CLASS_CONFIG* pHeapConfig, TCPIP_STACK_HEAP_RES* pRes)
+{
+    TCPIP_HEAP_CLASS_DCPT* hDcpt;
+    TCPIP_HEAP_CLASS_OBJ_INSTANCE* hInst;
+    size_t          heapSize, heapUnits, headerSize, classMaxSize, classMaxUnits, nClasses;
+    uint8_t*        allocatedHeapBuffer;
+    uint8_t*        alignHeapBuffer;
+    size_t          heapBufferSize;
+    uintptr_t       alignBuffer;
+    uint8_t*        heapStart;
+    TCPIP_STACK_HEAP_RES  res;
+
+
+    while(true)
+    {
+        hDcpt =0;
+        hInst = 0;
+
+        if( pHeapConfig == 0 || pHeapConfig->malloc_fnc == 0 || pHeapConfig->free_fnc == 0 || pHeapConfig->heapSize == 0)
+        {
+            res = TCPIP_STACK_HEAP_RES_INIT_ERR;
+            break;
+        }
+
+        classMaxSize = pHeapConfig->classMaxSize != 0 ? pHeapConfig->classMaxSize : _TCPIP_HEAP_CLASS_DEFAULT_MAX_SIZE;
+        classMaxUnits = (classMaxSize + sizeof(_headNode) - 1) / sizeof(_headNode) + 1;
+        if(classMaxUnits < _TCPIP_HEAP_CLASS_MIN_UNITS)
+        {
+            classMaxUnits = _TCPIP_HEAP_CLASS_MIN_UNITS;
+        }
+        else if(classMaxUnits > _TCPIP_HEAP_CLASS_MAX_UNITS)
+        {
+            classMaxUnits = _TCPIP_HEAP_CLASS_MAX_UNITS;
+        }
+        nClasses = classMaxUnits - _TCPIP_HEAP_CLASS_MIN_UNITS + 1;
+
+        heapBufferSize = pHeapConfig->heapSize;
+        allocatedHeapBuffer = (uint8_t*)(*pHeapConfig->malloc_fnc)(heapBufferSize);
+
+        if(allocatedHeapBuffer == 0)
+        {
+            res = TCPIP_STACK_HEAP_RES_CREATE_ERR;
+            break;
+        }
+
+
+        // align properly: round up and truncate
+        alignBuffer = ((uintptr_t)allocatedHeapBuffer + sizeof(_heap_Align)-1 ) & ~(sizeof(_heap_Align)-1);
+        heapBufferSize -= (uint8_t*)alignBuffer - allocatedHeapBuffer ;
+        heapBufferSize &= ~(sizeof(_heap_Align)-1) ;
+        alignHeapBuffer = (uint8_t*)alignBuffer;
+
+        // the class table is placed right after the heap instance
+        headerSize = sizeof(TCPIP_HEAP_CLASS_OBJ_INSTANCE) + nClasses * sizeof(TCPIP_HEAP_CLASS_ENTRY);
+        headerSize = ((headerSize + sizeof(_headNode) - 1) / sizeof(_headNode)) * sizeof(_headNode);
+
+        heapSize = heapBufferSize > headerSize ? heapBufferSize - headerSize : 0;
+
+        heapUnits = heapSize / sizeof(_headNode);           // adjust to multiple of heads
+
+        if(heapUnits < _TCPIP_HEAP_MIN_BLKS_)
+        {
+            (*pHeapConfig->free_fnc)(allocatedHeapBuffer);
+            res = TCPIP_STACK_HEAP_RES_BUFF_SIZE_ERR;
+            break;
+        }
+
+
+        // check if mapping needed; always alloc uncached!
+        alignHeapBuffer = (uint8_t*)_TCPIP_HEAP_BufferMapNonCached(alignHeapBuffer, heapBufferSize);
+
+        heapStart = alignHeapBuffer + headerSize;
+        hInst = (TCPIP_HEAP_CLASS_OBJ_INSTANCE*)alignHeapBuffer;
+        hInst->heapObj = _tcpip_heap_class_object;
+        hDcpt = &hInst->heapDcpt;
+        hDcpt->_largeHead = (_headNode*)heapStart;
+        hDcpt->_largeHead->units = heapUnits;
+        hDcpt->_largeHead->next = 0;
+        hDcpt->_largeTail = hDcpt->_largeHead;
+        hDcpt->_heapUnits = heapUnits;
+        hDcpt->_heapAllocatedUnits = 0;
+        hDcpt->_heapWatermark = 0;
+        hDcpt->_classFreeUnits = 0;
+        hDcpt->_classTbl = (TCPIP_HEAP_CLASS_ENTRY*)(hInst + 1);
+        memset(hDcpt->_classTbl, 0, nClasses * sizeof(TCPIP_HEAP_CLASS_ENTRY));
+        hDcpt->_nClasses = (uint16_t)nClasses;
+        hDcpt->_classMaxUnits = (uint16_t)classMaxUnits;
+        hDcpt->_largeAllocs = 0;
+        hDcpt->_nReclaims = 0;
+        hDcpt->_lastHeapErr = TCPIP_STACK_HEAP_RES_OK;
+        hDcpt->_heapFlags = pHeapConfig->heapFlags;
+        hDcpt->allocatedBuffer = allocatedHeapBuffer;
+        hDcpt->free_fnc = pHeapConfig->free_fnc;
+#ifdef TCPIP_STACK_DRAM_DEBUG_ENABLE
+        hDcpt->_heapStart = hDcpt->_largeHead;
+        hDcpt->_heapEnd = hDcpt->_largeHead + heapUnits;
+#endif
+        if(OSAL_SEM_Create(&hDcpt->_heapSemaphore, OSAL_SEM_TYPE_BINARY, 1, 1) != OSAL_RESULT_TRUE)
+        {
+            (*pHeapConfig->free_fnc)(allocatedHeapBuffer);
+            hInst = 0;
+            res = TCPIP_STACK_HEAP_RES_SYNCH_ERR;
+            break;
+        }
+
+        res = TCPIP_STACK_HEAP_RES_OK;
+        break;
+    }
+
+    if(pRes)
+    {
+        *pRes = res;
+    }
+
+    return hInst;
+
+}
+
+int TCPIP_HEAP_CLASS_Entries(TCPIP_STACK_HEAP_HANDLE heapH)
+{
+    TCPIP_HEAP_CLASS_DCPT* hDcpt = _TCPIP_HEAP_CLASS_ObjDcpt(heapH);
+
+    return hDcpt == 0 ? 0 : hDcpt->_nClasses;
+}
+
+bool TCPIP_HEAP_CLASS_EntryList(TCPIP_STACK_HEAP_HANDLE heapH, int entryIx, TCPIP_HEAP_CLASS_ENTRY_LIST* pList)
+{
+    TCPIP_HEAP_CLASS_ENTRY* pEntry;
+    TCPIP_HEAP_CLASS_DCPT* hDcpt = _TCPIP_HEAP_CLASS_ObjDcpt(heapH);
+
+    if(hDcpt == 0 || entryIx < 0 || entryIx >= hDcpt->_nClasses)
+    {
+        return false;
+    }
+
+    if(pList)
+    {
+        pEntry = hDcpt->_classTbl + entryIx;
+        (void)OSAL_SEM_Pend(&hDcpt->_heapSemaphore, OSAL_WAIT_FOREVER);
+        pList->blockSize = (entryIx + _TCPIP_HEAP_CLASS_MIN_UNITS) * sizeof(_headNode);
+        pList->allocBlocks = pEntry->allocBlocks;
+        pList->freeBlocks = pEntry->freeBlocks;
+        pList->maxBlocks = pEntry->maxBlocks;
+        pList->nAllocs = pEntry->nAllocs;
+        pList->nHits = pEntry->nHits;
+        (void)OSAL_SEM_Post(&hDcpt->_heapSemaphore);
+    }
+
+    return true;
+}
+
+bool TCPIP_HEAP_CLASS_Info(TCPIP_STACK_HEAP_HANDLE heapH, TCPIP_HEAP_CLASS_INFO* pInfo)
+{
+    TCPIP_HEAP_CLASS_DCPT* hDcpt = _TCPIP_HEAP_CLASS_ObjDcpt(heapH);
+
+    if(hDcpt == 0)
+    {
+        return false;
+    }
+
+    if(pInfo)
+    {
+        (void)OSAL_SEM_Pend(&hDcpt->_heapSemaphore, OSAL_WAIT_FOREVER);
+        pInfo->nClasses = hDcpt->_nClasses;
+        pInfo->classMaxSize = (hDcpt->_classMaxUnits - 1) * sizeof(_headNode);
+        pInfo->largeAllocs = hDcpt->_largeAllocs;
+        pInfo->largeFree = (hDcpt->_heapUnits - hDcpt->_heapAllocatedUnits - hDcpt->_classFreeUnits) * sizeof(_headNode);
+        pInfo->nReclaims = hDcpt->_nReclaims;
+        (void)OSAL_SEM_Post(&hDcpt->_heapSemaphore);
+    }
+
+    return true;
+}
+
+// internal functions
+//
+// deallocates the heap
+// NOTE: check is done if some blocks are still in use!
+static TCPIP_STACK_HEAP_RES _TCPIP_HEAP_CLASS_Delete(TCPIP_STACK_HEAP_HANDLE heapH)
+{
+    TCPIP_HEAP_CLASS_OBJ_INSTANCE* hInst;
+    TCPIP_HEAP_CLASS_DCPT*   hDcpt;
+
+    hInst = _TCPIP_HEAP_CLASS_ObjInstance(heapH);
+
+    if(hInst == 0)
+    {
+        return TCPIP_STACK_HEAP_RES_NO_HEAP;
+    }
+
+    hDcpt = &hInst->heapDcpt;
+
+    if(hDcpt->_heapAllocatedUnits != 0)
+    {
+        //  deallocating a heap not completely de-allocated
+        return (hDcpt->_lastHeapErr = TCPIP_STACK_HEAP_RES_IN_USE);
+    }
+
+#ifdef TCPIP_STACK_DRAM_DEBUG_ENABLE
+    // all the class blocks should coalesce back into the initial block
+    _TCPIP_HEAP_CLASS_Reclaim(hDcpt);
+    if(hDcpt->_largeHead != hDcpt->_heapStart || hDcpt->_largeHead->units != hDcpt->_heapUnits)
+    {
+        //  corrupted heap
+        return (hDcpt->_lastHeapErr = TCPIP_STACK_HEAP_RES_IN_USE);
+    }
+#endif
+
+    OSAL_SEM_Delete(&hDcpt->_heapSemaphore);
+    // invalidate it
+    memset(&hInst->heapObj, 0, sizeof(hInst->heapObj));
+    (*hDcpt->free_fnc)(hDcpt->allocatedBuffer);
+
+    return TCPIP_STACK_HEAP_RES_OK;
+}
+
+
+static void* _TCPIP_HEAP_CLASS_Malloc(TCPIP_STACK_HEAP_HANDLE heapH, size_t nBytes)
+{
+    _headNode   *ptr;
+    size_t      nunits;
+    TCPIP_HEAP_CLASS_DCPT*  hDcpt;
+    TCPIP_HEAP_CLASS_ENTRY* pClass;
+
+
+    hDcpt = _TCPIP_HEAP_CLASS_ObjDcpt(heapH);
+
+    if(hDcpt == 0 || nBytes == 0)
+    {
+        return 0;
+    }
+
+    nunits=(nBytes+sizeof(_headNode)-1)/sizeof(_headNode)+1;    // allocate units
+
+    (void)OSAL_SEM_Pend(&hDcpt->_heapSemaphore, OSAL_WAIT_FOREVER);
+
+    pClass = _TCPIP_HEAP_CLASS_Entry(hDcpt, nunits);
+    if(pClass != 0)
+    {   // fast path: try the class free list
+        pClass->nAllocs++;
+        if((ptr = pClass->freeList) != 0)
+        {
+            pClass->freeList = ptr->next;
+            pClass->freeBlocks--;
+            pClass->nHits++;
+            hDcpt->_classFreeUnits -= nunits;
+        }
+    }
+    else
+    {
+        ptr = 0;
+    }
+
+    if(ptr == 0)
+    {   // slow path: carve it from the large list
+        if((ptr = _TCPIP_HEAP_CLASS_LargeAlloc(hDcpt, nunits)) == 0)
+        {
+            if(hDcpt->_classFreeUnits != 0)
+            {   // coalesce the class lists and try again
+                _TCPIP_HEAP_CLASS_Reclaim(hDcpt);
+                ptr = _TCPIP_HEAP_CLASS_LargeAlloc(hDcpt, nunits);
+            }
+
+            if(ptr == 0)
+            {
+                hDcpt->_lastHeapErr = TCPIP_STACK_HEAP_RES_NO_MEM;
+                (void)OSAL_SEM_Post(&hDcpt->_heapSemaphore);
+                return 0;
+            }
+        }
+
+        if(pClass == 0)
+        {
+            hDcpt->_largeAllocs++;
+        }
+    }
+
+    // the block may be slightly larger than requested; account it to its own class
+    nunits = ptr->units;
+    if((pClass = _TCPIP_HEAP_CLASS_Entry(hDcpt, nunits)) != 0)
+    {
+        if(++pClass->allocBlocks > pClass->maxBlocks)
+        {
+            pClass->maxBlocks = pClass->allocBlocks;
+        }
+    }
+
+    if((hDcpt->_heapAllocatedUnits += nunits) > hDcpt->_heapWatermark)
+    {
+        hDcpt->_heapWatermark = hDcpt->_heapAllocatedUnits;
+    }
+    (void)OSAL_SEM_Post(&hDcpt->_heapSemaphore);
+    return ptr + 1;
+}
+
+static void* _TCPIP_HEAP_CLASS_Calloc(TCPIP_STACK_HEAP_HANDLE heapH, size_t nElems, size_t elemSize)
+{
+    void* pBuff = _TCPIP_HEAP_CLASS_Malloc(heapH, nElems * elemSize);
+    if(pBuff)
+    {
+        memset(pBuff, 0, nElems * elemSize);
+    }
+
+    return pBuff;
+
+}
+
+static size_t _TCPIP_HEAP_CLASS_Free(TCPIP_STACK_HEAP_HANDLE heapH, const void* pBuff)
+{
+    TCPIP_HEAP_CLASS_DCPT*  hDcpt;
+    TCPIP_HEAP_CLASS_ENTRY* pClass;
+    _headNode   *ptr;
+    size_t      freedUnits;
+
+    hDcpt = _TCPIP_HEAP_CLASS_ObjDcpt(heapH);
+
+    if(hDcpt == 0 || pBuff == 0)
+    {
+        return 0;
+    }
+
+    ptr = (_headNode*)pBuff-1;
+
+    (void)OSAL_SEM_Pend(&hDcpt->_heapSemaphore, OSAL_WAIT_FOREVER);
+
+#ifdef TCPIP_STACK_DRAM_DEBUG_ENABLE
+    if(ptr < hDcpt->_heapStart || ptr+ptr->units > hDcpt->_heapEnd || ptr->units < _TCPIP_HEAP_CLASS_MIN_UNITS)
+    {
+        hDcpt->_lastHeapErr = TCPIP_STACK_HEAP_RES_PTR_ERR;   // not one of our pointers!!!
+        (void)OSAL_SEM_Post(&hDcpt->_heapSemaphore);
+        return 0;
+    }
+#endif
+
+    freedUnits = ptr->units;
+
+    if((pClass = _TCPIP_HEAP_CLASS_Entry(hDcpt, freedUnits)) != 0)
+    {   // fast path: park it in its class list, no coalescing
+        ptr->next = pClass->freeList;
+        pClass->freeList = ptr;
+        pClass->freeBlocks++;
+        pClass->allocBlocks--;
+        hDcpt->_classFreeUnits += freedUnits;
+    }
+    else if(!_TCPIP_HEAP_CLASS_LargeInsert(hDcpt, ptr))
+    {
+        hDcpt->_lastHeapErr = TCPIP_STACK_HEAP_RES_PTR_ERR;   // corrupted pointer!!!
+        (void)OSAL_SEM_Post(&hDcpt->_heapSemaphore);
+        return 0;
+    }
+
+    hDcpt->_heapAllocatedUnits -= freedUnits;
+    (void)OSAL_SEM_Post(&hDcpt->_heapSemaphore);
+    return freedUnits * sizeof(_headNode);
+}
+
+
+static size_t _TCPIP_HEAP_CLASS_Size(TCPIP_STACK_HEAP_HANDLE heapH)
+{
+    TCPIP_HEAP_CLASS_DCPT*      hDcpt;
+
+    hDcpt = _TCPIP_HEAP_CLASS_ObjDcpt(heapH);
+
+    if(hDcpt)
+    {
+        return hDcpt->_heapUnits * sizeof(_headNode);
+    }
+
+    return 0;
+}
+
+static size_t _TCPIP_HEAP_CLASS_FreeSize(TCPIP_STACK_HEAP_HANDLE heapH)
+{
+    TCPIP_HEAP_CLASS_DCPT*      hDcpt;
+
+    hDcpt = _TCPIP_HEAP_CLASS_ObjDcpt(heapH);
+
+
+    if(hDcpt)
+    {
+        return (hDcpt->_heapUnits - hDcpt->_heapAllocatedUnits) * sizeof(_headNode);
+    }
+    return 0;
+}
+
+static size_t _TCPIP_HEAP_CLASS_HighWatermark(TCPIP_STACK_HEAP_HANDLE heapH)
+{
+    TCPIP_HEAP_CLASS_DCPT*      hDcpt;
+
+    hDcpt = _TCPIP_HEAP_CLASS_ObjDcpt(heapH);
+
+    if(hDcpt)
+    {
+        return hDcpt->_heapWatermark * sizeof(_headNode);
+    }
+    return 0;
+}
+
+static size_t _TCPIP_HEAP_CLASS_MaxSize(TCPIP_STACK_HEAP_HANDLE heapH)
+{
+    TCPIP_HEAP_CLASS_DCPT   *hDcpt;
+    _headNode   *ptr;
+    size_t      max_nunits;
+    int         classIx;
+
+    max_nunits = 0;
+
+    hDcpt = _TCPIP_HEAP_CLASS_ObjDcpt(heapH);
+    if(hDcpt)
+    {
+        (void)OSAL_SEM_Pend(&hDcpt->_heapSemaphore, OSAL_WAIT_FOREVER);
+
+        for(ptr = hDcpt->_largeHead; ptr != 0; ptr = ptr->next)
+        {
+            if(ptr->units >= max_nunits)
+            {   // found block
+                max_nunits = ptr->units;
+            }
+        }
+
+        // the class lists could hold a larger block
+        for(classIx = hDcpt->_nClasses - 1; classIx >= 0; classIx--)
+        {
+            if(hDcpt->_classTbl[classIx].freeList != 0)
+            {
+                if(classIx + _TCPIP_HEAP_CLASS_MIN_UNITS > max_nunits)
+                {
+                    max_nunits = classIx + _TCPIP_HEAP_CLASS_MIN_UNITS;
+                }
+                break;
+            }
+        }
+        (void)OSAL_SEM_Post(&hDcpt->_heapSemaphore);
+    }
+
+    return max_nunits * sizeof(_headNode);
+
+}
+
+
+static TCPIP_STACK_HEAP_RES _TCPIP_HEAP_CLASS_LastError(TCPIP_STACK_HEAP_HANDLE heapH)
+{
+    TCPIP_HEAP_CLASS_DCPT*      hDcpt;
+    TCPIP_STACK_HEAP_RES  res;
+
+    hDcpt = _TCPIP_HEAP_CLASS_ObjDcpt(heapH);
+
+    if(hDcpt)
+    {
+        res = hDcpt->_lastHeapErr;
+        hDcpt->_lastHeapErr = TCPIP_STACK_HEAP_RES_OK;
+        return res;
+    }
+
+    return TCPIP_STACK_HEAP_RES_NO_HEAP;
+
+}
+
+#if defined(TCPIP_STACK_DRAM_DEBUG_ENABLE)
+static size_t _TCPIP_HEAP_CLASS_AllocSize(TCPIP_STACK_HEAP_HANDLE heapH, const void* ptr)
+{
+    if(ptr)
+    {
+        _headNode* hPtr = (_headNode*)ptr -1;
+        return hPtr->units * sizeof(_headNode);
+    }
+
+    return 0;
+}
+#endif  // defined(TCPIP_STACK_DRAM_DEBUG_ENABLE)
+
+// allocates a block of nunits from the large list, first fit
+// the block is carved from the end of the free block
+// returns 0 if no block large enough exists
+// heap should be locked
+static _headNode* _TCPIP_HEAP_CLASS_LargeAlloc(TCPIP_HEAP_CLASS_DCPT* hDcpt, size_t nunits)
+{
+    _headNode   *ptr,*prev;
+
+    prev=0;
+
+    for(ptr = hDcpt->_largeHead; ptr != 0; prev = ptr, ptr = ptr->next)
+    {
+        if(ptr->units >= nunits)
+        {   // found block
+            if(ptr->units-nunits <= _TCPIP_HEAP_MIN_BLK_USIZE_)
+            {
+                nunits=ptr->units;  // get the whole block
+            }
+
+            if(ptr->units == nunits)
+            {   // exact match
+                if(prev)
+                {
+                    prev->next = ptr->next;
+                }
+                else
+                {
+                    hDcpt->_largeHead = ptr->next;
+                    prev = hDcpt->_largeHead;
+                }
+
+                if(hDcpt->_largeTail == ptr)
+                {
+                    hDcpt->_largeTail = prev;
+                }
+            }
+            else
+            {   // larger than we need
+                ptr->units -= nunits;
+                ptr += ptr->units;
+                ptr->units = nunits;
+            }
+
+            return ptr;
+        }
+    }
+
+    return 0;
+}
+
+// inserts a block in the address ordered large list
+// left and right coalescing is performed
+// returns false if the block is corrupted
+// heap should be locked
+static bool _TCPIP_HEAP_CLASS_LargeInsert(TCPIP_HEAP_CLASS_DCPT* hDcpt, _headNode* ptr)
+{
+    _headNode   *hdr;
+
+    if(!hDcpt->_largeHead)
+    {
+        ptr->next=0;
+        hDcpt->_largeHead = hDcpt->_largeTail = ptr;
+        return true;
+    }
+
+    if(ptr < hDcpt->_largeHead)
+    {   // put it in front
+        if(ptr+ptr->units == hDcpt->_largeHead)
+        {   // compact
+            ptr->units += hDcpt->_largeHead->units;
+            ptr->next = hDcpt->_largeHead->next;
+            if(hDcpt->_largeTail == hDcpt->_largeHead)
+            {
+                hDcpt->_largeTail = ptr;
+            }
+        }
+        else
+        {
+            ptr->next = hDcpt->_largeHead;
+        }
+        hDcpt->_largeHead = ptr;    // new head
+        return true;
+    }
+
+    if(ptr > hDcpt->_largeTail)
+    {   // append tail
+        if(hDcpt->_largeTail + hDcpt->_largeTail->units == ptr)
+        {   // compact
+            hDcpt->_largeTail->units += ptr->units;
+        }
+        else
+        {
+            hDcpt->_largeTail->next = ptr;
+            ptr->next = 0;
+            hDcpt->_largeTail = ptr;
+        }
+        return true;
+    }
+
+    // somewhere in the middle
+    for(hdr = hDcpt->_largeHead; hdr != 0; hdr = hdr->next)
+    {
+        if(hdr<ptr && ptr<hdr->next)
+        {   // found a place
+            if(ptr+ptr->units == hdr->next)
+            {   // compact right
+                ptr->units += hdr->next->units;
+                ptr->next = hdr->next->next;
+                if(hDcpt->_largeTail == hdr->next)
+                {
+                    hDcpt->_largeTail = ptr;
+                }
+            }
+            else
+            {
+            #ifdef TCPIP_STACK_DRAM_DEBUG_ENABLE
+                if(ptr+ptr->units > hdr->next)
+                {
+                    return false;  // corrupted pointer!!!
+                }
+            #endif
+                ptr->next = hdr->next;
+            }
+
+            // compact left
+            if(hdr+hdr->units == ptr)
+            {
+                hdr->units += ptr->units;
+                hdr->next = ptr->next;
+                if(hDcpt->_largeTail == ptr)
+                {
+                    hDcpt->_largeTail = hdr;
+                }
+            }
+            else
+            {
+            #ifdef TCPIP_STACK_DRAM_DEBUG_ENABLE
+                if(hdr+hdr->units > ptr)
+                {
+                    return false;      // corrupted pointer!!!
+                }
+            #endif
+                hdr->next = ptr;
+            }
+
+            return true;
+        }
+    }
+
+    return false;
+}
+
+// returns all the blocks parked in the class free lists to the large list
+// so that they can be coalesced with their neighbors
+// this is the slow path, called only when an allocation fails
+// heap should be locked
+static void _TCPIP_HEAP_CLASS_Reclaim(TCPIP_HEAP_CLASS_DCPT* hDcpt)
+{
+    int classIx;
+    _headNode   *ptr, *next;
+    TCPIP_HEAP_CLASS_ENTRY* pClass = hDcpt->_classTbl;
+
+    for(classIx = 0; classIx < hDcpt->_nClasses; classIx++, pClass++)
+    {
+        for(ptr = pClass->freeList; ptr != 0; ptr = next)
+        {
+            next = ptr->next;
+            _TCPIP_HEAP_CLASS_LargeInsert(hDcpt, ptr);
+        }
+        pClass->freeList = 0;
+        pClass->freeBlocks = 0;
+    }
+
+    hDcpt->_classFreeUnits = 0;
+    hDcpt->_nReclaims++;
+}
+
+#endif  // defined (TCPIP_STACK_USE_INTERNAL_HEAP_CLASS)
+
@@ -107,6 +107,8 @@ static TCPIP_HELPER_PORT_ENTRY tcpSecurePortTbl[_TCPIP_STACK_SECURE_PORT_ENTRIES
 static TCPIP_HELPER_PORT_ENTRY*    _TCPIP_Helper_SecurePortEntry(uint16_t port, TCPIP_HELPER_PORT_ENTRY** pFreeEntry);
 #endif  // _TCPIP_STACK_SECURE_PORT_ENTRIES != 0
 
+static uint16_t     _TCPIP_Helper_ChecksumCopy(uint8_t* pDst, const uint8_t* pSrc, uint16_t count, uint16_t seed);
+
 
 /*****************************************************************************
   Function:
@@ -889,6 +891,119 @@ uint16_t TCPIP_Helper_Base64Encode(const uint8_t* cSourceData, uint16_t wSourceL
 }
 
 
+// word at a time IP checksum calculation
+// the data is summed as 32 bit words in a 64 bit accumulator
+// and folded to 16 bits at the end
+// if pDst != 0, the data is also copied to pDst
+// pDst and pSrc must have the same 32 bit alignment!
+static uint16_t _TCPIP_Helper_ChecksumCopy(uint8_t* pDst, const uint8_t* pSrc, uint16_t count, uint16_t seed)
+{
+    uint64_t sum;
+    uint32_t w32;
+    union
+    {
+        uint8_t  b[2];
+        uint16_t w;
+    } w16;
+    bool oddStart;
+
+    sum = (uint64_t)seed;
+
+    oddStart = ((uintptr_t)pSrc & 0x1) != 0;
+    if(oddStart && count != 0)
+    {   // the 1st byte is the 2nd one of a 16 bit word
+        w16.b[0] = 0;
+        w16.b[1] = *pSrc++;
+        sum += w16.w;
+        if(pDst)
+        {
+            *pDst++ = w16.b[1];
+        }
+        count--;
+    }
+
+    if(((uintptr_t)pSrc & 0x2) != 0 && count >= 2)
+    {   // get to a 32 bit boundary
+        w16.w = *(const uint16_t*)pSrc;
+        sum += w16.w;
+        if(pDst)
+        {
+            *(uint16_t*)pDst = w16.w;
+            pDst += 2;
+        }
+        pSrc += 2;
+        count -= 2;
+    }
+
+    if(pDst)
+    {   // copy and sum
+        while(count >= 4)
+        {
+            w32 = *(const uint32_t*)pSrc;
+            *(uint32_t*)pDst = w32;
+            sum += w32;
+            pSrc += 4;
+            pDst += 4;
+            count -= 4;
+        }
+    }
+    else
+    {
+        while(count >= 16)
+        {
+            sum += (uint64_t)((const uint32_t*)pSrc)[0] + ((const uint32_t*)pSrc)[1];
+            sum += (uint64_t)((const uint32_t*)pSrc)[2] + ((const uint32_t*)pSrc)[3];
+            pSrc += 16;
+            count -= 16;
+        }
+        while(count >= 4)
+        {
+            sum += *(const uint32_t*)pSrc;
+            pSrc += 4;
+            count -= 4;
+        }
+    }
+
+    if(count >= 2)
+    {
+        w16.w = *(const uint16_t*)pSrc;
+        sum += w16.w;
+        if(pDst)
+        {
+            *(uint16_t*)pDst = w16.w;
+            pDst += 2;
+        }
+        pSrc += 2;
+        count -= 2;
+    }
+
+    if(count != 0)
+    {   // the remaining byte is the 1st one of a 16 bit word
+        w16.b[0] = *pSrc;
+        w16.b[1] = 0;
+        sum += w16.w;
+        if(pDst)
+        {
+            *pDst = w16.b[0];
+        }
+    }
+
+    // end-around carry (one's complement arithmetic)
+    sum = (sum & 0xffffffffULL) + (sum >> 32);
+    sum = (sum & 0xffffffffULL) + (sum >> 32);
+    w32 = (uint32_t)sum;
+    w32 = (w32 & 0xffff) + (w32 >> 16);
+    w32 = (w32 & 0xffff) + (w32 >> 16);
+
+    w16.w = (uint16_t)w32;
+    if(oddStart)
+    {
+        w16.w = ((uint16_t)w16.b[0] << 8) | (uint16_t)w16.b[1];
+    }
+
+    return ~w16.w;
+}
+
 /*****************************************************************************
   Function:
     uint16_t TCPIP_Helper_CalcIPChecksum(const uint8_t* buffer, uint16_t count, uint16_t seed)
@@ -915,58 +1030,17 @@ uint16_t TCPIP_Helper_Base64Encode(const uint8_t* cSourceData, uint16_t wSourceL
     
   Note:
     The checksum is implemented as a fast assembly function on PIC32M platforms.
+    Otherwise the data is summed 32 bits at a time.
   ***************************************************************************/
 #if !defined(__mips__)
 uint16_t TCPIP_Helper_CalcIPChecksum(const uint8_t* buffer, uint16_t count, uint16_t seed)
 {
-    uint16_t i;
-    uint16_t *val;
-    union
-    {
-        uint8_t  b[4];
-        uint16_t w[2];
-        uint32_t dw;
-    } sum;
-
     if(buffer == 0)
     {
         return 0;
     }
 
-    val = (uint16_t*)buffer;
-
-    // Calculate the sum of all words
-    sum.dw = (uint32_t)seed;
-    if ((unsigned int)buffer % 2)
-    {
-        sum.w[0] += (*(uint8_t *)buffer) << 8;
-        val = (uint16_t *)(buffer + 1);
-        count--;
-    }
-
-    i = count >> 1;
-
-    while(i--)
-        sum.dw += (uint32_t)*val++;
-
-    // Add in the sum of the remaining byte, if present
-    if(count & 0x1)
-        sum.dw += (uint32_t)*(uint8_t*)val;
-
-    // Do an end-around carry (one's complement arrithmatic)
-    sum.dw = (uint32_t)sum.w[0] + (uint32_t)sum.w[1];
-
-    // Do another end-around carry in case if the prior add 
-    // caused a carry out
-    sum.w[0] += sum.w[1];
-
-    if ((unsigned int)buffer % 2)
-    {
-        sum.w[0] = ((uint16_t)sum.b[0] << 8 ) | (uint16_t)sum.b[1];
-    }
-
-    // Return the resulting checksum
-    return ~sum.w[0];
+    return _TCPIP_Helper_ChecksumCopy(0, buffer, count, seed);
 }
 // This version of  TCPIP_Helper_Memcpy (without standard library memcpy) 
 // is tested on Cortex-A7, Cortex-A5, Cortex-M4, Cortex-M7, Cortex-M33.
@@ -1046,6 +1120,52 @@ void TCPIP_Helper_Memcpy (void *dst, const void *src, size_t len)
 #endif  // DEVICE_ARCH 
 #endif  // !defined(__mips__)
 
+/*****************************************************************************
+  Function:
+    uint16_t TCPIP_Helper_MemcpyChecksum(void* dst, const void* src, uint16_t len, uint16_t seed)
+
+  Summary:
+    Copies a buffer and calculates its IP checksum.
+
+  Description:
+    This function copies len bytes from src to dst and calculates
+    the IP checksum of the data in the same pass.
+
+  Precondition:
+    None
+
+  Parameters:
+    dst    - destination buffer
+    src    - source buffer
+    len    - number of bytes to copy
+    seed   - start seed
+
+  Returns:
+    The calculated checksum, the same as TCPIP_Helper_CalcIPChecksum(src, len, seed).
+    
+  Note:
+    When dst and src do not have the same 32 bit alignment
+    the data is copied first and then checksummed.
+  ***************************************************************************/
+uint16_t TCPIP_Helper_MemcpyChecksum(void* dst, const void* src, uint16_t len, uint16_t seed)
+{
+    uint16_t chkSum;
+
+    if((((uintptr_t)dst ^ (uintptr_t)src) & 0x3) == 0)
+    {
+        return _TCPIP_Helper_ChecksumCopy((uint8_t*)dst, (const uint8_t*)src, len, seed);
+    }
+
+    TCPIP_Helper_Memcpy(dst, src, len);
+    chkSum = ~TCPIP_Helper_CalcIPChecksum((const uint8_t*)dst, len, 0);
+    if(((uintptr_t)src & 0x1) != 0)
+    {   // the seed is added in the src alignment
+        seed = (seed << 8) | (seed >> 8);
+    }
+
+    return ~TCPIP_Helper_ChecksumFold((uint32_t)chkSum + seed);
+}
+
 // calculates the IP checksum for a packet with multiple segments
 uint16_t TCPIP_Helper_PacketChecksum(TCPIP_MAC_PACKET* pPkt, uint8_t* startAdd, uint16_t len, uint16_t seed)
 {
@@ -1401,11 +1521,24 @@ bool TCPIP_Helper_SingleListFind(SINGLE_LIST* pL, SGL_LIST_NODE* pN)
 
 void  TCPIP_Helper_SingleListAppend(SINGLE_LIST* pDstL, SINGLE_LIST* pAList)
 {
-    SGL_LIST_NODE* pN;
-    while((pN = TCPIP_Helper_SingleListHeadRemove(pAList)))
+    if(pAList->head == 0)
+    {   // nothing to append
+        return;
+    }
+
+    // link the whole list at once
+    if(pDstL->tail == 0)
     {
-        TCPIP_Helper_SingleListTailAdd(pDstL, pN);
+        pDstL->head = pAList->head;
     }
+    else
+    {
+        pDstL->tail->next = pAList->head;
+    }
+    pDstL->tail = pAList->tail;
+    pDstL->nNodes += pAList->nNodes;
+
+    TCPIP_Helper_SingleListInitialize(pAList);
 }
 
 
@@ -61,6 +61,7 @@ uint16_t        TCPIP_Helper_CalcIPChecksum(const uint8_t* buffer, uint16_t len,
 #else
 void            TCPIP_Helper_Memcpy(void *dst, const void *src, size_t len);
 #endif
+uint16_t        TCPIP_Helper_MemcpyChecksum(void* dst, const void* src, uint16_t len, uint16_t seed);
 uint16_t        TCPIP_Helper_PacketChecksum(TCPIP_MAC_PACKET* pPkt, uint8_t* startAdd, uint16_t len, uint16_t seed);
 
 uint16_t        TCPIP_Helper_ChecksumFold(uint32_t checksum);
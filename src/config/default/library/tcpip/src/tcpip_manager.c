@@ -265,6 +265,21 @@ static const TCPIP_FRAME_PROCESS_ENTRY TCPIP_FRAME_PROCESS_TBL [] =
 
 };
 
+// direct dispatch of the frame types to the TCPIP_FRAME_PROCESS_TBL entries
+// the hash is collision free for the currently supported frame types
+#define _TCPIP_FRAME_DISPATCH_SIZE      8       // power of 2
+#define _TCPIP_FRAME_DISPATCH_HASH(frameType)   (((frameType) ^ ((frameType) >> 8)) & (_TCPIP_FRAME_DISPATCH_SIZE - 1))
+
+#define _TCPIP_FRAME_DISPATCH_NONE      (-1)    // no frame type processed for this slot
+#define _TCPIP_FRAME_DISPATCH_SEARCH    (-2)    // hash collision; search the TCPIP_FRAME_PROCESS_TBL
+
+// TCPIP_FRAME_PROCESS_TBL index for each hash slot
+// built at stack initialization
+static int8_t           TCPIP_FRAME_DISPATCH_TBL [_TCPIP_FRAME_DISPATCH_SIZE];
+
+// RX burst statistics
+static TCPIP_STACK_RX_BURST_STATISTICS  tcpip_rx_burst_stat;
+
 
 static SYS_STATUS       tcpip_stack_status = SYS_STATUS_UNINITIALIZED;
 
@@ -291,6 +306,12 @@ static int  _TCPIPExtractMacRxPackets(TCPIP_NET_IF* pNetIf);
 
 static uint32_t _TCPIPProcessMacPackets(bool signal);
 
+static void _TCPIPFrameDispatchInit(void);
+
+static int  _TCPIPFrameDispatchIndex(uint16_t frameType);
+
+static void _TCPIPRxBurstStatUpdate(int burstSize);
+
 static void _TCPIP_ProcessMACErrorEvents(TCPIP_NET_IF* pNetIf, TCPIP_MAC_EVENT activeEvent);
 
 static bool _InitNetConfig(const TCPIP_NETWORK_CONFIG* pUsrConfig, int nNets);
@@ -894,6 +915,8 @@ static bool _TCPIP_DoInitialize(const TCPIP_STACK_INIT * init)
         {
             TCPIP_Helper_SingleListInitialize(TCPIP_MODULES_QUEUE_TBL + ix);
         }
+        _TCPIPFrameDispatchInit();
+        memset(&tcpip_rx_burst_stat, 0, sizeof(tcpip_rx_burst_stat));
 
         // start per interface initializing
         tcpip_stack_ctrl_data.stackAction = TCPIP_STACK_ACTION_INIT;
@@ -1985,12 +2008,13 @@ static int _TCPIPExtractMacRxPackets(TCPIP_NET_IF* pNetIf)
 static uint32_t _TCPIPProcessMacPackets(bool signal)
 {
     int                         frameIx;
-    bool                        frameFound;
     uint16_t                    frameType;
     TCPIP_MAC_PACKET*           pRxPkt;
     TCPIP_MAC_ETHERNET_HEADER*  pMacHdr;
     const TCPIP_FRAME_PROCESS_ENTRY*  pFrameEntry;
     uint32_t                    procFrameMask = 0;
+    // packets of the same type, delivered as a burst
+    SINGLE_LIST                 burstList[sizeof(TCPIP_FRAME_PROCESS_TBL) / sizeof(*TCPIP_FRAME_PROCESS_TBL)] = { {0} };
 
     SINGLE_LIST*                pPktQueue = (TCPIP_MODULES_QUEUE_TBL + TCPIP_MODULE_MANAGER);
 
@@ -2027,39 +2051,153 @@ static uint32_t _TCPIPProcessMacPackets(bool signal)
 #endif  // defined(TCPIP_STACK_USE_MAC_BRIDGE)
 
 
-        frameFound = false;
-        pFrameEntry = TCPIP_FRAME_PROCESS_TBL;
-        for(frameIx = 0; frameIx < sizeof(TCPIP_FRAME_PROCESS_TBL) / sizeof(*TCPIP_FRAME_PROCESS_TBL); frameIx++, pFrameEntry++)
+        frameIx = _TCPIPFrameDispatchIndex(frameType);
+        if(frameIx < 0)
+        {   // unknown packet type; discard
+            TCPIP_PKT_PacketAcknowledge(pRxPkt, TCPIP_MAC_PKT_ACK_TYPE_ERR); 
+            continue;
+        }
+
+        // found proper frame handler
+        pRxPkt->pktFlags &= ~TCPIP_MAC_PKT_FLAG_TYPE_MASK;
+        pRxPkt->pktFlags |= TCPIP_FRAME_PROCESS_TBL[frameIx].pktTypeFlags;
+
+#if (_TCPIP_STACK_RX_RUN_TO_COMPLETION != 0)
+        if(TCPIP_FRAME_PROCESS_TBL[frameIx].moduleId == TCPIP_MODULE_IPV4 && TCPIP_Helper_SingleListIsEmpty(burstList + frameIx))
+        {   // no IPv4 packets waiting; try to process it to completion
+            if(_TCPIPStackModuleRxInline(TCPIP_MODULE_IPV4) && TCPIP_IPV4_RxInline(pRxPkt))
+            {
+                continue;
+            }
+        }
+#endif  // (_TCPIP_STACK_RX_RUN_TO_COMPLETION != 0)
+
+        TCPIP_Helper_SingleListTailAdd(burstList + frameIx, (SGL_LIST_NODE*)pRxPkt);
+    }
+
+    // deliver the bursts
+    pFrameEntry = TCPIP_FRAME_PROCESS_TBL;
+    for(frameIx = 0; frameIx < sizeof(TCPIP_FRAME_PROCESS_TBL) / sizeof(*TCPIP_FRAME_PROCESS_TBL); frameIx++, pFrameEntry++)
+    {
+        int burstSize = TCPIP_Helper_SingleListCount(burstList + frameIx);
+        if(burstSize == 0)
         {
-            if(pFrameEntry->frameType == frameType)
-            {   // found proper frame handler
-                pRxPkt->pktFlags &= ~TCPIP_MAC_PKT_FLAG_TYPE_MASK;
-                pRxPkt->pktFlags |= pFrameEntry->pktTypeFlags;
+            continue;
+        }
 
-                if(_TCPIPStackModuleRxInsert(pFrameEntry->moduleId, pRxPkt, 0))
-                {
-                    if(signal)
-                    {   // signal to the module that RX is pending; if not already done so
-                        if((procFrameMask & (1 << frameIx)) == 0)
-                        {   // set the frame mask so we don't signal again
-                            procFrameMask |= 1 << frameIx;
-                            _TCPIPModuleSignalSetNotify(pFrameEntry->moduleId, TCPIP_MODULE_SIGNAL_RX_PENDING);
-                        }
-                    }
-                    frameFound = true;
-                }
-                break;
+        if(_TCPIPStackModuleRxInsertList(pFrameEntry->moduleId, burstList + frameIx, signal))
+        {   // signal to the module that RX is pending, once per burst
+            if(signal)
+            {
+                procFrameMask |= 1 << frameIx;
             }
+            _TCPIPRxBurstStatUpdate(burstSize);
         }
-        if(!frameFound)
-        {   // unknown packet type; discard
-            TCPIP_PKT_PacketAcknowledge(pRxPkt, TCPIP_MAC_PKT_ACK_TYPE_ERR); 
+        else
+        {   // module not running; discard
+            while((pRxPkt = (TCPIP_MAC_PACKET*)TCPIP_Helper_SingleListHeadRemove(burstList + frameIx)) != 0)
+            {
+                TCPIP_PKT_PacketAcknowledge(pRxPkt, TCPIP_MAC_PKT_ACK_TYPE_ERR); 
+            }
         }
     }
 
     return procFrameMask;
 }
 
+// builds the frame type dispatch table
+static void _TCPIPFrameDispatchInit(void)
+{
+    int frameIx, hashIx;
+    const TCPIP_FRAME_PROCESS_ENTRY* pFrameEntry;
+
+    memset(TCPIP_FRAME_DISPATCH_TBL, _TCPIP_FRAME_DISPATCH_NONE, sizeof(TCPIP_FRAME_DISPATCH_TBL));
+
+    pFrameEntry = TCPIP_FRAME_PROCESS_TBL;
+    for(frameIx = 0; frameIx < sizeof(TCPIP_FRAME_PROCESS_TBL) / sizeof(*TCPIP_FRAME_PROCESS_TBL); frameIx++, pFrameEntry++)
+    {
+        if(pFrameEntry->frameType == TCPIP_ETHER_TYPE_UNKNOWN)
+        {   // not processed
+            continue;
+        }
+
+        hashIx = _TCPIP_FRAME_DISPATCH_HASH(pFrameEntry->frameType);
+        if(TCPIP_FRAME_DISPATCH_TBL[hashIx] == _TCPIP_FRAME_DISPATCH_NONE)
+        {
+            TCPIP_FRAME_DISPATCH_TBL[hashIx] = (int8_t)frameIx;
+        }
+        else
+        {   // collision; fall back to searching
+            TCPIP_FRAME_DISPATCH_TBL[hashIx] = _TCPIP_FRAME_DISPATCH_SEARCH;
+        }
+    }
+}
+
+// returns the TCPIP_FRAME_PROCESS_TBL index for the frame type
+// or < 0 if the frame type is not processed
+static int _TCPIPFrameDispatchIndex(uint16_t frameType)
+{
+    int frameIx = TCPIP_FRAME_DISPATCH_TBL[_TCPIP_FRAME_DISPATCH_HASH(frameType)];
+
+    if(frameIx >= 0)
+    {
+        return TCPIP_FRAME_PROCESS_TBL[frameIx].frameType == frameType ? frameIx : _TCPIP_FRAME_DISPATCH_NONE;
+    }
+    else if(frameIx == _TCPIP_FRAME_DISPATCH_SEARCH)
+    {
+        const TCPIP_FRAME_PROCESS_ENTRY* pFrameEntry = TCPIP_FRAME_PROCESS_TBL;
+        for(frameIx = 0; frameIx < sizeof(TCPIP_FRAME_PROCESS_TBL) / sizeof(*TCPIP_FRAME_PROCESS_TBL); frameIx++, pFrameEntry++)
+        {
+            if(pFrameEntry->frameType == frameType && frameType != TCPIP_ETHER_TYPE_UNKNOWN)
+            {
+                return frameIx;
+            }
+        }
+    }
+
+    return _TCPIP_FRAME_DISPATCH_NONE;
+}
+
+static void _TCPIPRxBurstStatUpdate(int burstSize)
+{
+    int histIx;
+    int histSize;
+
+    tcpip_rx_burst_stat.nBursts++;
+    tcpip_rx_burst_stat.nPackets += burstSize;
+    if(burstSize > tcpip_rx_burst_stat.maxBurst)
+    {
+        tcpip_rx_burst_stat.maxBurst = burstSize;
+    }
+
+    // log2 bucket
+    for(histIx = 0, histSize = burstSize >> 1; histSize != 0 && histIx < TCPIP_STACK_RX_BURST_HIST_SIZE - 1; histSize >>= 1)
+    {
+        histIx++;
+    }
+    tcpip_rx_burst_stat.burstHist[histIx]++;
+}
+
+bool TCPIP_STACK_RxBurstStatisticsGet(TCPIP_STACK_RX_BURST_STATISTICS* pStat, bool clear)
+{
+    if(tcpip_stack_status == SYS_STATUS_UNINITIALIZED)
+    {
+        return false;
+    }
+
+    if(pStat)
+    {
+        *pStat = tcpip_rx_burst_stat;
+    }
+
+    if(clear)
+    {
+        memset(&tcpip_rx_burst_stat, 0, sizeof(tcpip_rx_burst_stat));
+    }
+
+    return true;
+}
+
 #if defined(TCPIP_STACK_USE_EVENT_NOTIFICATION)
 // MAC ISR call
 static void    _TCPIP_MacEventCB(TCPIP_MAC_EVENT event, const void* hParam)
@@ -4545,6 +4683,45 @@ bool _TCPIPStackModuleRxInsert(TCPIP_STACK_MODULE modId, TCPIP_MAC_PACKET* pRxPk
     return true;
 }
 
+// insert a list of packets into a module RX queue
+// signal should be false when modId == TCPIP_MODULE_MANAGER !
+bool _TCPIPStackModuleRxInsertList(TCPIP_STACK_MODULE modId, SINGLE_LIST* pList, bool signal)
+{
+#if (_TCPIP_STACK_RUN_TIME_INIT != 0)
+    TCPIP_MODULE_RUN_DCPT* pRDcpt = TCPIP_MODULES_RUN_TBL + modId;
+    if(pRDcpt->isRunning == 0)
+    {
+        return false;
+    }
+#endif  // (_TCPIP_STACK_RUN_TIME_INIT != 0)
+
+    SINGLE_LIST* pQueue = TCPIP_MODULES_QUEUE_TBL + modId;
+    OSAL_CRITSECT_DATA_TYPE critSect =  OSAL_CRIT_Enter(OSAL_CRIT_TYPE_LOW);
+    TCPIP_Helper_SingleListAppend(pQueue, pList);
+    OSAL_CRIT_Leave(OSAL_CRIT_TYPE_LOW, critSect);
+
+    if(signal)
+    {
+        _TCPIPModuleSignalSetNotify(modId, TCPIP_MODULE_SIGNAL_RX_PENDING);
+    }
+    return true;
+}
+
+#if (_TCPIP_STACK_RX_RUN_TO_COMPLETION != 0)
+bool _TCPIPStackModuleRxInline(TCPIP_STACK_MODULE modId)
+{
+#if (_TCPIP_STACK_RUN_TIME_INIT != 0)
+    TCPIP_MODULE_RUN_DCPT* pRDcpt = TCPIP_MODULES_RUN_TBL + modId;
+    if(pRDcpt->isRunning == 0)
+    {
+        return false;
+    }
+#endif  // (_TCPIP_STACK_RUN_TIME_INIT != 0)
+
+    return TCPIP_Helper_SingleListIsEmpty(TCPIP_MODULES_QUEUE_TBL + modId);
+}
+#endif  // (_TCPIP_STACK_RX_RUN_TO_COMPLETION != 0)
+
 //
 // extracts a packet from a module RX queue
 // returns 0 if queue is empty
@@ -4624,8 +4801,14 @@ TCPIP_MAC_RES _TCPIPStackPacketTx(TCPIP_NET_IF* pNetIf, TCPIP_MAC_PACKET * ptrPa
 {
     TCPIP_MAC_RES res;
 
-    TCPIP_PKT_FlightLogTx(ptrPacket, TCPIP_THIS_MODULE_ID);
-    TCPIP_PKT_FlightLogTx(ptrPacket, pNetIf->macId);    // MAC doesn't call the log function
+#if (TCPIP_PACKET_LOG_ENABLE)
+    TCPIP_MAC_PACKET* pBurstPkt;
+    for(pBurstPkt = ptrPacket; pBurstPkt != 0; pBurstPkt = pBurstPkt->next)
+    {   // log all the packets of a burst
+        TCPIP_PKT_FlightLogTx(pBurstPkt, TCPIP_THIS_MODULE_ID);
+        TCPIP_PKT_FlightLogTx(pBurstPkt, pNetIf->macId);    // MAC doesn't call the log function
+    }
+#endif  // (TCPIP_PACKET_LOG_ENABLE)
 
     if(pNetIf->hIfMac != 0)
     {
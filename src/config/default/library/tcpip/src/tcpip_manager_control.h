@@ -629,6 +629,21 @@ TCPIP_MAC_PACKET*   _TCPIPStackModuleRxExtract(TCPIP_STACK_MODULE modId);
 //      false if the insertion failed (the module is not running, for example)
 bool _TCPIPStackModuleRxInsert(TCPIP_STACK_MODULE modId, TCPIP_MAC_PACKET* pRxPkt, bool signal);
 
+// inserts a list of packets into a module queue
+// and signals once if necessary
+// returns:
+//      true if the packets were inserted; pList is emptied
+//      false if the insertion failed (the module is not running, for example);
+//      the packets are left in pList
+bool _TCPIPStackModuleRxInsertList(TCPIP_STACK_MODULE modId, SINGLE_LIST* pList, bool signal);
+
+#if (_TCPIP_STACK_RX_RUN_TO_COMPLETION != 0)
+// checks that a module can process a RX packet inline, run-to-completion
+// the module has to be running and its RX queue empty,
+// so that the packets order is preserved
+bool _TCPIPStackModuleRxInline(TCPIP_STACK_MODULE modId);
+#endif  // (_TCPIP_STACK_RX_RUN_TO_COMPLETION != 0)
+
 
 // purges the packets from a module RX queue
 // belonging to the pNetIf
@@ -116,6 +116,23 @@ static void                 _TCPIP_PKT_LogInit(bool resetAll);
 
 #endif  // (TCPIP_PACKET_LOG_ENABLE)
 
+#if (TCPIP_PACKET_RECYCLE_ENABLE)
+
+// recycle class descriptor
+typedef struct
+{
+    void*                   blockStack[TCPIP_PKT_RECYCLE_DEPTH];    // cached blocks, LIFO
+    int                     ownerStack[TCPIP_PKT_RECYCLE_DEPTH];    // module that allocated the block from the heap
+    TCPIP_PKT_RECYCLE_ENTRY info;                                   // class info and counters
+}TCPIP_PKT_RECYCLE_DCPT;
+
+static TCPIP_PKT_RECYCLE_DCPT   _pktRecycleTbl[TCPIP_PKT_RECYCLE_CLASSES];
+
+static void*                _TCPIP_PKT_RecycleAlloc(uint16_t* pAllocLen, int moduleId);
+static void                 _TCPIP_PKT_RecycleFree(void* pBlock, uint16_t allocLen, int moduleId);
+static bool                 _TCPIP_PKT_RecycleFlush(void);
+
+#endif  // (TCPIP_PACKET_RECYCLE_ENABLE)
 
 
 // API
@@ -159,6 +176,15 @@ bool TCPIP_PKT_Initialize(TCPIP_STACK_HEAP_HANDLE heapH, const TCPIP_NETWORK_CON
 
 #endif  // (TCPIP_PACKET_LOG_ENABLE)
 
+#if (TCPIP_PACKET_RECYCLE_ENABLE)
+        int classIx;
+        memset(_pktRecycleTbl, 0, sizeof(_pktRecycleTbl));
+        for(classIx = 0; classIx < sizeof(_pktRecycleTbl)/sizeof(*_pktRecycleTbl); classIx++)
+        {
+            _pktRecycleTbl[classIx].info.blockSize = (classIx + 1) * TCPIP_PKT_RECYCLE_CLASS_STEP;
+        }
+#endif  // (TCPIP_PACKET_RECYCLE_ENABLE)
+
         break;
     }
 
@@ -169,6 +195,13 @@ bool TCPIP_PKT_Initialize(TCPIP_STACK_HEAP_HANDLE heapH, const TCPIP_NETWORK_CON
 
 void TCPIP_PKT_Deinitialize(void)
 {
+#if (TCPIP_PACKET_RECYCLE_ENABLE)
+    if(pktMemH != 0)
+    {   // return the cached blocks to the heap
+        _TCPIP_PKT_RecycleFlush();
+    }
+#endif  // (TCPIP_PACKET_RECYCLE_ENABLE)
+
     pktMemH = 0;
 }
 
@@ -329,11 +362,15 @@ static __inline__ TCPIP_MAC_PACKET* __attribute__((always_inline)) _TCPIP_PKT_Pa
     // total allocation size
     allocLen = pktUpLen + sizeof(*pSeg) + segAllocSize;
 
-#if defined(TCPIP_STACK_DRAM_DEBUG_ENABLE) 
+#if (TCPIP_PACKET_RECYCLE_ENABLE)
+    pPkt = (TCPIP_MAC_PACKET*)_TCPIP_PKT_RecycleAlloc(&allocLen, moduleId);
+    // the block could be larger than requested
+    segAllocSize = allocLen - pktUpLen - sizeof(*pSeg);
+#elif defined(TCPIP_STACK_DRAM_DEBUG_ENABLE) 
     pPkt = (TCPIP_MAC_PACKET*)TCPIP_HEAP_MallocDebug(pktMemH, allocLen, moduleId, __LINE__);
 #else
     pPkt = (TCPIP_MAC_PACKET*)TCPIP_HEAP_Malloc(pktMemH, allocLen);
-#endif  // defined(TCPIP_STACK_DRAM_DEBUG_ENABLE) 
+#endif  // (TCPIP_PACKET_RECYCLE_ENABLE)
 
     if(pPkt)
     {   
@@ -378,19 +415,24 @@ static __inline__ void __attribute__((always_inline)) _TCPIP_PKT_PacketFreeInt(T
             pNSeg = pSeg->next;
             if((pSeg->segFlags & TCPIP_MAC_SEG_FLAG_STATIC) == 0)
             {
-#if defined(TCPIP_STACK_DRAM_DEBUG_ENABLE) 
+#if (TCPIP_PACKET_RECYCLE_ENABLE)
+                _TCPIP_PKT_RecycleFree(pSeg, sizeof(*pSeg) + pSeg->segAllocSize, moduleId);
+#elif defined(TCPIP_STACK_DRAM_DEBUG_ENABLE) 
                 TCPIP_HEAP_FreeDebug(pktMemH, pSeg, moduleId);
 #else
                 TCPIP_HEAP_Free(pktMemH, pSeg);
-#endif  // defined(TCPIP_STACK_DRAM_DEBUG_ENABLE) 
+#endif  // (TCPIP_PACKET_RECYCLE_ENABLE)
             }
         }
 
-#if defined(TCPIP_STACK_DRAM_DEBUG_ENABLE) 
+#if (TCPIP_PACKET_RECYCLE_ENABLE)
+        pSeg = pPkt->pDSeg;
+        _TCPIP_PKT_RecycleFree(pPkt, ((uint8_t*)pSeg - (uint8_t*)pPkt) + sizeof(*pSeg) + pSeg->segAllocSize, moduleId);
+#elif defined(TCPIP_STACK_DRAM_DEBUG_ENABLE) 
         TCPIP_HEAP_FreeDebug(pktMemH, pPkt, moduleId);
 #else
         TCPIP_HEAP_Free(pktMemH, pPkt);
-#endif  // defined(TCPIP_STACK_DRAM_DEBUG_ENABLE) 
+#endif  // (TCPIP_PACKET_RECYCLE_ENABLE)
     }
 }
 
@@ -440,11 +482,15 @@ static __inline__ TCPIP_MAC_DATA_SEGMENT* __attribute__((always_inline)) _TCPIP_
     allocLen = sizeof(*pSeg) + segAllocSize;
 
 
-#if defined(TCPIP_STACK_DRAM_DEBUG_ENABLE) 
+#if (TCPIP_PACKET_RECYCLE_ENABLE)
+    pSeg = (TCPIP_MAC_DATA_SEGMENT*)_TCPIP_PKT_RecycleAlloc(&allocLen, moduleId);
+    // the block could be larger than requested
+    segAllocSize = allocLen - sizeof(*pSeg);
+#elif defined(TCPIP_STACK_DRAM_DEBUG_ENABLE) 
     pSeg = (TCPIP_MAC_DATA_SEGMENT*)TCPIP_HEAP_MallocDebug(pktMemH, allocLen, moduleId, __LINE__);
 #else
     pSeg = (TCPIP_MAC_DATA_SEGMENT*)TCPIP_HEAP_Malloc(pktMemH, allocLen);
-#endif  // defined(TCPIP_STACK_DRAM_DEBUG_ENABLE) 
+#endif  // (TCPIP_PACKET_RECYCLE_ENABLE)
 
 
     if(pSeg)
@@ -467,11 +513,13 @@ static __inline__ void __attribute__((always_inline)) _TCPIP_PKT_SegmentFreeInt(
 {
     if( (pSeg->segFlags & TCPIP_MAC_SEG_FLAG_STATIC) == 0)
     {
-#if defined(TCPIP_STACK_DRAM_DEBUG_ENABLE) 
+#if (TCPIP_PACKET_RECYCLE_ENABLE)
+        _TCPIP_PKT_RecycleFree(pSeg, sizeof(*pSeg) + pSeg->segAllocSize, moduleId);
+#elif defined(TCPIP_STACK_DRAM_DEBUG_ENABLE) 
         TCPIP_HEAP_FreeDebug(pktMemH, pSeg, moduleId);
 #else
         TCPIP_HEAP_Free(pktMemH, pSeg);
-#endif  // defined(TCPIP_STACK_DRAM_DEBUG_ENABLE) 
+#endif  // (TCPIP_PACKET_RECYCLE_ENABLE)
     }
 
 }
@@ -687,7 +735,13 @@ TCPIP_MAC_PACKET* _TCPIP_PKT_PacketAlloc(uint16_t pktLen, uint16_t segLoadLen, T
     // total allocation size
     allocLen = pktUpLen + sizeof(*pSeg) + segAllocSize;
 
+#if (TCPIP_PACKET_RECYCLE_ENABLE)
+    pPkt = (TCPIP_MAC_PACKET*)_TCPIP_PKT_RecycleAlloc(&allocLen, TCPIP_THIS_MODULE_ID);
+    // the block could be larger than requested
+    segAllocSize = allocLen - pktUpLen - sizeof(*pSeg);
+#else
     pPkt = (TCPIP_MAC_PACKET*)TCPIP_HEAP_Malloc(pktMemH, allocLen);
+#endif  // (TCPIP_PACKET_RECYCLE_ENABLE)
 
     if(pPkt)
     {   
@@ -764,11 +818,20 @@ void _TCPIP_PKT_PacketFree(TCPIP_MAC_PACKET* pPkt)
             pNSeg = pSeg->next;
             if((pSeg->segFlags & TCPIP_MAC_SEG_FLAG_STATIC) == 0)
             {
+#if (TCPIP_PACKET_RECYCLE_ENABLE)
+                _TCPIP_PKT_RecycleFree(pSeg, sizeof(*pSeg) + pSeg->segAllocSize, TCPIP_THIS_MODULE_ID);
+#else
                 TCPIP_HEAP_Free(pktMemH, pSeg);
+#endif  // (TCPIP_PACKET_RECYCLE_ENABLE)
             }
         }
 
+#if (TCPIP_PACKET_RECYCLE_ENABLE)
+        pSeg = pPkt->pDSeg;
+        _TCPIP_PKT_RecycleFree(pPkt, ((uint8_t*)pSeg - (uint8_t*)pPkt) + sizeof(*pSeg) + pSeg->segAllocSize, TCPIP_THIS_MODULE_ID);
+#else
         TCPIP_HEAP_Free(pktMemH, pPkt);
+#endif  // (TCPIP_PACKET_RECYCLE_ENABLE)
     }
 }
 
@@ -787,7 +850,13 @@ TCPIP_MAC_DATA_SEGMENT* _TCPIP_PKT_SegmentAlloc(uint16_t loadLen, TCPIP_MAC_SEGM
     // total allocation size
     allocLen = sizeof(*pSeg) + segAllocSize;
 
+#if (TCPIP_PACKET_RECYCLE_ENABLE)
+    pSeg = (TCPIP_MAC_DATA_SEGMENT*)_TCPIP_PKT_RecycleAlloc(&allocLen, TCPIP_THIS_MODULE_ID);
+    // the block could be larger than requested
+    segAllocSize = allocLen - sizeof(*pSeg);
+#else
     pSeg = (TCPIP_MAC_DATA_SEGMENT*)TCPIP_HEAP_Malloc(pktMemH, allocLen);
+#endif  // (TCPIP_PACKET_RECYCLE_ENABLE)
 
     if(pSeg)
     {
@@ -809,11 +878,206 @@ void _TCPIP_PKT_SegmentFree(TCPIP_MAC_DATA_SEGMENT* pSeg)
 {
     if( (pSeg->segFlags & TCPIP_MAC_SEG_FLAG_STATIC) == 0)
     {
+#if (TCPIP_PACKET_RECYCLE_ENABLE)
+        _TCPIP_PKT_RecycleFree(pSeg, sizeof(*pSeg) + pSeg->segAllocSize, TCPIP_THIS_MODULE_ID);
+#else
         TCPIP_HEAP_Free(pktMemH, pSeg);
+#endif  // (TCPIP_PACKET_RECYCLE_ENABLE)
     }
 }
 #endif  // defined(TCPIP_PACKET_ALLOCATION_TRACE_ENABLE)
 
+#if (TCPIP_PACKET_RECYCLE_ENABLE)
+// returns the recycle class for a block size
+// or -1 if the block is too large for the recycle caches
+static __inline__ int __attribute__((always_inline)) _TCPIP_PKT_RecycleClass(uint16_t allocLen)
+{
+    if(allocLen == 0 || allocLen > TCPIP_PKT_RECYCLE_CLASSES * TCPIP_PKT_RECYCLE_CLASS_STEP)
+    {
+        return -1;
+    }
+
+    return (allocLen + TCPIP_PKT_RECYCLE_CLASS_STEP - 1) / TCPIP_PKT_RECYCLE_CLASS_STEP - 1;
+}
+
+// allocates a block of at least *pAllocLen bytes
+// the block is taken from the recycle cache if possible
+// small requests are rounded up to the class block size so that the block can be recycled
+// updates *pAllocLen with the actual size of the block
+static void* _TCPIP_PKT_RecycleAlloc(uint16_t* pAllocLen, int moduleId)
+{
+    void* pBlock;
+    int stackIx;
+    uint16_t allocLen = *pAllocLen;
+    int classIx = _TCPIP_PKT_RecycleClass(allocLen);
+
+    if(classIx >= 0)
+    {
+        TCPIP_PKT_RECYCLE_DCPT* pDcpt = _pktRecycleTbl + classIx;
+
+        pBlock = 0;
+        OSAL_CRITSECT_DATA_TYPE status = OSAL_CRIT_Enter(OSAL_CRIT_TYPE_LOW);
+        stackIx = pDcpt->info.nCached - 1;
+#if defined(TCPIP_STACK_DRAM_DEBUG_ENABLE) 
+        // the heap trace knows the block by the module that allocated it
+        // reuse only the blocks of the same module
+        for(; stackIx >= 0; stackIx--)
+        {
+            if(pDcpt->ownerStack[stackIx] == moduleId)
+            {
+                break;
+            }
+        }
+#endif  // defined(TCPIP_STACK_DRAM_DEBUG_ENABLE) 
+        if(stackIx >= 0)
+        {
+            pBlock = pDcpt->blockStack[stackIx];
+            // keep the stack compact
+            pDcpt->info.nCached--;
+            pDcpt->blockStack[stackIx] = pDcpt->blockStack[pDcpt->info.nCached];
+            pDcpt->ownerStack[stackIx] = pDcpt->ownerStack[pDcpt->info.nCached];
+            pDcpt->info.nHits++;
+        }
+        else
+        {
+            pDcpt->info.nMisses++;
+        }
+        OSAL_CRIT_Leave(OSAL_CRIT_TYPE_LOW, status);
+
+        allocLen = pDcpt->info.blockSize;
+        *pAllocLen = allocLen;
+        if(pBlock != 0)
+        {
+            return pBlock;
+        }
+    }
+
+    while(true)
+    {
+#if defined(TCPIP_STACK_DRAM_DEBUG_ENABLE) 
+        pBlock = TCPIP_HEAP_MallocDebug(pktMemH, allocLen, moduleId, __LINE__);
+#else
+        pBlock = TCPIP_HEAP_Malloc(pktMemH, allocLen);
+#endif  // defined(TCPIP_STACK_DRAM_DEBUG_ENABLE) 
+
+        if(pBlock != 0 || !_TCPIP_PKT_RecycleFlush())
+        {   // done or nothing more to release
+            break;
+        }
+        // the cached blocks were released; try again
+    }
+
+    return pBlock;
+}
+
+// frees a block of allocLen bytes
+// the block is kept in the recycle cache if it matches a class and there's room
+// moduleId is the module that allocated the block
+static void _TCPIP_PKT_RecycleFree(void* pBlock, uint16_t allocLen, int moduleId)
+{
+    int classIx = _TCPIP_PKT_RecycleClass(allocLen);
+
+    if(classIx >= 0 && _pktRecycleTbl[classIx].info.blockSize == allocLen)
+    {
+        TCPIP_PKT_RECYCLE_DCPT* pDcpt = _pktRecycleTbl + classIx;
+        bool cached = false;
+
+        OSAL_CRITSECT_DATA_TYPE status = OSAL_CRIT_Enter(OSAL_CRIT_TYPE_LOW);
+        if(pDcpt->info.nCached < sizeof(pDcpt->blockStack) / sizeof(*pDcpt->blockStack))
+        {
+            pDcpt->blockStack[pDcpt->info.nCached] = pBlock;
+            pDcpt->ownerStack[pDcpt->info.nCached] = moduleId;
+            pDcpt->info.nCached++;
+            cached = true;
+        }
+        else
+        {
+            pDcpt->info.nDrops++;
+        }
+        OSAL_CRIT_Leave(OSAL_CRIT_TYPE_LOW, status);
+
+        if(cached)
+        {
+            return;
+        }
+    }
+
+#if defined(TCPIP_STACK_DRAM_DEBUG_ENABLE) 
+    TCPIP_HEAP_FreeDebug(pktMemH, pBlock, moduleId);
+#else
+    TCPIP_HEAP_Free(pktMemH, pBlock);
+#endif  // defined(TCPIP_STACK_DRAM_DEBUG_ENABLE) 
+}
+
+// returns all the cached blocks to the heap
+// returns true if any block was released
+static bool _TCPIP_PKT_RecycleFlush(void)
+{
+    int classIx;
+    void* pBlock;
+#if defined(TCPIP_STACK_DRAM_DEBUG_ENABLE) 
+    int ownerId;
+#endif  // defined(TCPIP_STACK_DRAM_DEBUG_ENABLE) 
+    TCPIP_PKT_RECYCLE_DCPT* pDcpt;
+    bool released = false;
+
+    for(classIx = 0, pDcpt = _pktRecycleTbl; classIx < sizeof(_pktRecycleTbl) / sizeof(*_pktRecycleTbl); classIx++, pDcpt++)
+    {
+        while(true)
+        {
+            OSAL_CRITSECT_DATA_TYPE status = OSAL_CRIT_Enter(OSAL_CRIT_TYPE_LOW);
+            pBlock = 0;
+#if defined(TCPIP_STACK_DRAM_DEBUG_ENABLE) 
+            ownerId = 0;
+#endif  // defined(TCPIP_STACK_DRAM_DEBUG_ENABLE) 
+            if(pDcpt->info.nCached != 0)
+            {
+                pDcpt->info.nCached--;
+                pBlock = pDcpt->blockStack[pDcpt->info.nCached];
+#if defined(TCPIP_STACK_DRAM_DEBUG_ENABLE) 
+                ownerId = pDcpt->ownerStack[pDcpt->info.nCached];
+#endif  // defined(TCPIP_STACK_DRAM_DEBUG_ENABLE) 
+            }
+            OSAL_CRIT_Leave(OSAL_CRIT_TYPE_LOW, status);
+
+            if(pBlock == 0)
+            {
+                break;
+            }
+
+#if defined(TCPIP_STACK_DRAM_DEBUG_ENABLE) 
+            TCPIP_HEAP_FreeDebug(pktMemH, pBlock, ownerId);
+#else
+            TCPIP_HEAP_Free(pktMemH, pBlock);
+#endif  // defined(TCPIP_STACK_DRAM_DEBUG_ENABLE) 
+            released = true;
+        }
+    }
+
+    return released;
+}
+
+int TCPIP_PKT_RecycleGetEntriesNo(void)
+{
+    return sizeof(_pktRecycleTbl) / sizeof(*_pktRecycleTbl);
+}
+
+bool TCPIP_PKT_RecycleGetEntry(int entryIx, TCPIP_PKT_RECYCLE_ENTRY* pEntry)
+{
+    if(entryIx >= 0 && entryIx < sizeof(_pktRecycleTbl) / sizeof(*_pktRecycleTbl))
+    {
+        if(pEntry)
+        {
+            *pEntry = _pktRecycleTbl[entryIx].info;
+        }
+        return true;
+    }
+
+    return false;
+}
+
+#endif  // (TCPIP_PACKET_RECYCLE_ENABLE)
+
 
 #if (TCPIP_PACKET_LOG_ENABLE)
 
@@ -85,6 +85,40 @@ typedef struct
 // currently: tcp, udp, icmp, arp, ipv6
 #define TCPIP_PKT_TRACE_SIZE        8
 
+// enables the packet recycle caches
+// Freed packets and segments of small size are kept in per size class stacks
+// and reused by the next allocation of the same class, bypassing the heap.
+// Useful for the ARP replies, TCP ACKs, ICMP echoes, small UDP datagrams, etc.
+// The cached blocks are not returned to the heap until it runs out of memory,
+// so the feature is off by default
+#if !defined(TCPIP_PACKET_RECYCLE_ENABLE)
+#define TCPIP_PACKET_RECYCLE_ENABLE     0
+#endif
+
+// size step of the recycle classes, bytes
+// class n caches blocks of (n + 1) * TCPIP_PKT_RECYCLE_CLASS_STEP bytes
+// (packet header + 1st segment + segment buffer)
+#define TCPIP_PKT_RECYCLE_CLASS_STEP    64
+
+// number of the recycle classes
+// allocations larger than TCPIP_PKT_RECYCLE_CLASSES * TCPIP_PKT_RECYCLE_CLASS_STEP
+// always go to the heap
+#define TCPIP_PKT_RECYCLE_CLASSES       5
+
+// max number of blocks kept by each recycle class
+#define TCPIP_PKT_RECYCLE_DEPTH         3
+
+// recycle class info
+// only if TCPIP_PACKET_RECYCLE_ENABLE is enabled
+typedef struct
+{
+    uint16_t    blockSize;          // size of the blocks in this class
+    uint16_t    nCached;            // number of blocks currently cached
+    uint32_t    nHits;              // allocations served from the cache
+    uint32_t    nMisses;            // allocations that had to go to the heap
+    uint32_t    nDrops;             // blocks freed to the heap because the cache was full
+}TCPIP_PKT_RECYCLE_ENTRY;
+
 // module and packet logging flags
 // only if TCPIP_PACKET_LOG_ENABLE is enabled
 //
@@ -335,6 +369,13 @@ int     TCPIP_PKT_TraceGetEntriesNo(TCPIP_PKT_TRACE_INFO* pTraceInfo);
 // returns true if the entry is active - has valid data
 bool    TCPIP_PKT_TraceGetEntry(int entryIx, TCPIP_PKT_TRACE_ENTRY* tEntry);
 
+// returns the number of packet recycle classes
+int     TCPIP_PKT_RecycleGetEntriesNo(void);
+
+// populates a recycle class info for a index
+// returns true if the index is valid
+bool    TCPIP_PKT_RecycleGetEntry(int entryIx, TCPIP_PKT_RECYCLE_ENTRY* pEntry);
+
 
 // logs a TX packet info
 void    TCPIP_PKT_FlightLogTx(TCPIP_MAC_PACKET* pPkt, TCPIP_STACK_MODULE moduleId);
@@ -541,6 +582,22 @@ static __inline__ bool __attribute__((always_inline)) TCPIP_PKT_TraceGetEntrySta
 
 #endif  // defined(TCPIP_PACKET_ALLOCATION_TRACE_ENABLE)
 
+#if !(TCPIP_PACKET_RECYCLE_ENABLE)
+
+static __inline__ int __attribute__((always_inline)) TCPIP_PKT_RecycleGetEntriesNoStatic(void)
+{
+    return 0;
+}
+#define TCPIP_PKT_RecycleGetEntriesNo() TCPIP_PKT_RecycleGetEntriesNoStatic()
+
+static __inline__ bool __attribute__((always_inline)) TCPIP_PKT_RecycleGetEntryStatic(int entryIx, TCPIP_PKT_RECYCLE_ENTRY* pEntry)
+{
+    return false;
+}
+#define TCPIP_PKT_RecycleGetEntry(entryIx, pEntry) TCPIP_PKT_RecycleGetEntryStatic(entryIx, pEntry)
+
+#endif  // !(TCPIP_PACKET_RECYCLE_ENABLE)
+
 #if !(TCPIP_PACKET_LOG_ENABLE)
 
 #define TCPIP_PKT_FlightLogTx(pPkt, moduleId)
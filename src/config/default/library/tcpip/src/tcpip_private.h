@@ -76,6 +76,15 @@ Microchip or any third party.
 #define _TCPIP_STACK_ALIAS_INTERFACE_SUPPORT     0
 #endif  // defined(TCPIP_STACK_USE_IPV4) && (TCPIP_STACK_ALIAS_INTERFACE_SUPPORT != 0)
 
+// run-to-completion RX: the manager processes the IPv4 packets inline
+// and delivers the TCP/UDP packets directly to the transport
+// not available when IPv4 forwarding is enabled
+#if defined(TCPIP_STACK_USE_IPV4) && (TCPIP_STACK_RX_RUN_TO_COMPLETION != 0) && (TCPIP_IPV4_FORWARDING_ENABLE == 0)
+#define _TCPIP_STACK_RX_RUN_TO_COMPLETION     1
+#else
+#define _TCPIP_STACK_RX_RUN_TO_COMPLETION     0
+#endif  // defined(TCPIP_STACK_USE_IPV4) && (TCPIP_STACK_RX_RUN_TO_COMPLETION != 0) && (TCPIP_IPV4_FORWARDING_ENABLE == 0)
+
 // debug symbols
 
 #define _TCPIP_STACK_DEBUG_MASK_BASIC       0x01    // enable the _TCPIPStack_Assert and _TCPIPStack_Condition calls
@@ -61,6 +61,11 @@ Microchip or any third party.
 static UDP_SOCKET_DCPT** UDPSocketDcpt = 0; 
 
 static int          nUdpSockets = 0;    // number of sockets in the current UDP configuration
+
+// socket local port hash
+// the sockets are chained by index, in ascending order of the socket index
+static int16_t      udpPortHash[_UDP_PORT_HASH_BUCKETS];    // first socket index in each bucket; < 0 if empty
+static int16_t*     udpPortHashNext = 0;                    // next socket index in the same bucket, per socket; < 0 for end
 static const void*  udpMemH = 0;        // memory handle
 static int          udpInitCount = 0;   // initialization counter
 
@@ -256,6 +261,9 @@ static __inline__ void __attribute__((always_inline)) _UDP_RxPktAcknowledge(TCPI
 #endif  // (_TCPIP_IPV4_FRAGMENTATION != 0)
 
 static void     _UDPClose(UDP_SOCKET_DCPT* pSkt);
+
+static void     _UDPPortHashAdd(UDP_SOCKET_DCPT* pSkt);
+static void     _UDPPortHashRemove(UDP_SOCKET_DCPT* pSkt);
 static void     _UDPFreeTxResources(UDP_SOCKET_DCPT* pSkt);
 static void     _UDPFreeRxQueue(UDP_SOCKET_DCPT* pSkt);
 
@@ -418,6 +426,8 @@ static bool             _UDPIsAvailablePort(UDP_PORT port);
 
 static void             TCPIP_UDP_Process(void);
 
+static void             TCPIP_UDP_RxPacketProcess(TCPIP_MAC_PACKET* pRxPkt);
+
 static UDP_SOCKET       _UDPOpen(IP_ADDRESS_TYPE addType, UDP_OPEN_TYPE opType, UDP_PORT port, IP_MULTI_ADDRESS* address);
 
 #if (TCPIP_STACK_DOWN_OPERATION != 0) || (_TCPIP_STACK_INTERFACE_CHANGE_SIGNALING != 0)
@@ -493,6 +503,10 @@ static  bool _UDPSocketBind(UDP_SOCKET_DCPT* pSkt, TCPIP_NET_IF* pNet, IP_MULTI_
     pSkt->txStart = txBuff;
     pSkt->txEnd = txBuff + pSkt->txSize;
     pSkt->txWrite = txBuff;
+#if (_UDP_TX_CHKSUM_CACHE)
+    pSkt->txChkWrite = txBuff;
+    pSkt->txChkSum = 0;
+#endif  // (_UDP_TX_CHKSUM_CACHE)
     pSkt->addType =  addType;
     pSkt->pPkt = pTxPkt;
 }
@@ -597,7 +611,8 @@ bool TCPIP_UDP_Initialize(const TCPIP_STACK_MODULE_CTRL* const stackCtrl, const
         return false;
     }
 
-    newSktDcpt = (UDP_SOCKET_DCPT**)TCPIP_HEAP_Calloc(stackCtrl->memH, pUdpInit->nSockets, sizeof(UDP_SOCKET_DCPT*));
+    // the socket port hash chain is allocated at the end of the socket array
+    newSktDcpt = (UDP_SOCKET_DCPT**)TCPIP_HEAP_Calloc(stackCtrl->memH, pUdpInit->nSockets, sizeof(UDP_SOCKET_DCPT*) + sizeof(*udpPortHashNext));
     if(newSktDcpt == 0)
     {
         SYS_ERROR(SYS_ERROR_ERROR, "UDP Dynamic allocation failed");
@@ -644,6 +659,8 @@ bool TCPIP_UDP_Initialize(const TCPIP_STACK_MODULE_CTRL* const stackCtrl, const
     nUdpSockets = pUdpInit->nSockets;
     udpDefTxSize = pUdpInit->sktTxBuffSize;
     UDPSocketDcpt = newSktDcpt;
+    udpPortHashNext = (int16_t*)(newSktDcpt + nUdpSockets);
+    memset(udpPortHash, 0xff, sizeof(udpPortHash));
 #if (TCPIP_UDP_EXTERN_PACKET_PROCESS != 0)
     udpPktHandler = 0;
 #endif  // (TCPIP_UDP_EXTERN_PACKET_PROCESS != 0)
@@ -726,6 +743,7 @@ void TCPIP_UDP_Deinitialize(const TCPIP_STACK_MODULE_CTRL* const stackCtrl)
             TCPIP_HEAP_Free(udpMemH, UDPSocketDcpt);
 
             UDPSocketDcpt = 0;
+            udpPortHashNext = 0;
 
 #if (TCPIP_UDP_USE_POOL_BUFFERS != 0)
             // Note: no protection for this access
@@ -1040,6 +1058,9 @@ static UDP_SOCKET _UDPOpen(IP_ADDRESS_TYPE addType, UDP_OPEN_TYPE opType, UDP_PO
         pSkt->flags.stackConfig = 1;
     }
 
+    // make it visible to the RX demultiplexing
+    _UDPPortHashAdd(pSkt);
+
     // For IPv4 we postpone the allocation until the user wants to write something.
     // This allows RX only server sockets, that don't take extra memory.
     // Not possible for IPv6. It will have to rely on TCPIP_UDP_OptionsSet!
@@ -1144,48 +1165,62 @@ void TCPIP_UDP_Task(void)
 static void TCPIP_UDP_Process(void)
 {
     TCPIP_MAC_PACKET*   pRxPkt;
-    TCPIP_MAC_PKT_ACK_RES ackRes;
 
     // extract queued UDP packets
     while((pRxPkt = _TCPIPStackModuleRxExtract(TCPIP_THIS_MODULE_ID)) != 0)
     {
-        TCPIP_PKT_FlightLogRx(pRxPkt, TCPIP_THIS_MODULE_ID);
+        TCPIP_UDP_RxPacketProcess(pRxPkt);
+    }
+}
+
+#if (_TCPIP_STACK_RX_RUN_TO_COMPLETION != 0)
+void TCPIP_UDP_RxInline(TCPIP_MAC_PACKET* pRxPkt)
+{
+    TCPIP_UDP_RxPacketProcess(pRxPkt);
+}
+#endif  // (_TCPIP_STACK_RX_RUN_TO_COMPLETION != 0)
+
+// processes a RX UDP packet
+static void TCPIP_UDP_RxPacketProcess(TCPIP_MAC_PACKET* pRxPkt)
+{
+    TCPIP_MAC_PKT_ACK_RES ackRes;
+
+    TCPIP_PKT_FlightLogRx(pRxPkt, TCPIP_THIS_MODULE_ID);
 #if (TCPIP_UDP_EXTERN_PACKET_PROCESS != 0)
-        if(udpPktHandler != 0)
+    if(udpPktHandler != 0)
+    {
+        bool was_processed = (*udpPktHandler)(pRxPkt->pktIf, pRxPkt, udpPktHandlerParam);
+        if(was_processed)
         {
-            bool was_processed = (*udpPktHandler)(pRxPkt->pktIf, pRxPkt, udpPktHandlerParam);
-            if(was_processed)
-            {
-                TCPIP_PKT_FlightLogAcknowledge(pRxPkt, TCPIP_THIS_MODULE_ID, TCPIP_MAC_PKT_ACK_EXTERN);
-                continue;
-            }
+            TCPIP_PKT_FlightLogAcknowledge(pRxPkt, TCPIP_THIS_MODULE_ID, TCPIP_MAC_PKT_ACK_EXTERN);
+            return;
         }
+    }
 #endif  // (TCPIP_UDP_EXTERN_PACKET_PROCESS != 0)
 
-        ackRes = TCPIP_MAC_PKT_ACK_PROTO_DEST_ERR;
-        if(pRxPkt->totTransportLen < sizeof(UDP_HEADER))
-        {
-            ackRes = TCPIP_MAC_PKT_ACK_STRUCT_ERR;
-        }
+    ackRes = TCPIP_MAC_PKT_ACK_PROTO_DEST_ERR;
+    if(pRxPkt->totTransportLen < sizeof(UDP_HEADER))
+    {
+        ackRes = TCPIP_MAC_PKT_ACK_STRUCT_ERR;
+    }
 
 #if defined (TCPIP_STACK_USE_IPV4)
-        else if((pRxPkt->pktFlags & TCPIP_MAC_PKT_FLAG_NET_TYPE) == TCPIP_MAC_PKT_FLAG_IPV4) 
-        {
-            ackRes = TCPIP_UDP_ProcessIPv4(pRxPkt);
-        }
+    else if((pRxPkt->pktFlags & TCPIP_MAC_PKT_FLAG_NET_TYPE) == TCPIP_MAC_PKT_FLAG_IPV4) 
+    {
+        ackRes = TCPIP_UDP_ProcessIPv4(pRxPkt);
+    }
 #endif  // defined (TCPIP_STACK_USE_IPV4)
 
 #if defined (TCPIP_STACK_USE_IPV6)
-        else if((pRxPkt->pktFlags & TCPIP_MAC_PKT_FLAG_NET_TYPE) == TCPIP_MAC_PKT_FLAG_IPV6) 
-        {
-            ackRes = TCPIP_UDP_ProcessIPv6(pRxPkt);
-        }
+    else if((pRxPkt->pktFlags & TCPIP_MAC_PKT_FLAG_NET_TYPE) == TCPIP_MAC_PKT_FLAG_IPV6) 
+    {
+        ackRes = TCPIP_UDP_ProcessIPv6(pRxPkt);
+    }
 #endif  // defined (TCPIP_STACK_USE_IPV6)
 
-        if(ackRes != TCPIP_MAC_PKT_ACK_NONE)
-        {   // unknown/error; discard it.
-            _UDP_RxPktAcknowledge(pRxPkt, ackRes);
-        }
+    if(ackRes != TCPIP_MAC_PKT_ACK_NONE)
+    {   // unknown/error; discard it.
+        _UDP_RxPktAcknowledge(pRxPkt, ackRes);
     }
 }
 
@@ -1375,6 +1410,10 @@ static void _UDPv4TxPktReset(UDP_SOCKET_DCPT* pSkt, IPV4_PACKET* pPkt)
     else
     {
         pSkt->txWrite = pSkt->txStart;
+#if (_UDP_TX_CHKSUM_CACHE)
+        pSkt->txChkWrite = pSkt->txStart;
+        pSkt->txChkSum = 0;
+#endif  // (_UDP_TX_CHKSUM_CACHE)
     }
     pPkt->macPkt.pktFlags &= ~TCPIP_MAC_PKT_FLAG_QUEUED;
 
@@ -1699,6 +1738,13 @@ static uint16_t _UDPv4Flush(UDP_SOCKET_DCPT* pSkt)
             checksum = ~TCPIP_Helper_CalcIPChecksum((uint8_t*)pUDPHdr, sizeof(UDP_HEADER), checksum);
             checksum = ~TCPIP_Helper_CalcIPChecksum(pZSeg->segLoad, udpLoadLen, checksum);
         }
+#if (_UDP_TX_CHKSUM_CACHE)
+        else if(pSkt->txChkWrite == pSkt->txWrite)
+        {   // the payload has been summed by TCPIP_UDP_ArrayPut
+            checksum = ~TCPIP_Helper_CalcIPChecksum((uint8_t*)pUDPHdr, sizeof(UDP_HEADER), checksum);
+            checksum = TCPIP_Helper_ChecksumFold((uint32_t)checksum + pSkt->txChkSum);
+        }
+#endif  // (_UDP_TX_CHKSUM_CACHE)
         else
         {   // one contiguous buffer
             checksum = ~TCPIP_Helper_CalcIPChecksum((uint8_t*)pUDPHdr, udpTotLen, checksum);
@@ -1867,6 +1913,10 @@ static void _UDPv6TxPktReset(UDP_SOCKET_DCPT* pSkt, IPV6_PACKET* pV6Pkt, void* p
 
     _UDPResetHeader(pUpperLayer);
     pSkt->txWrite = pSkt->txStart;
+#if (_UDP_TX_CHKSUM_CACHE)
+    pSkt->txChkWrite = pSkt->txStart;
+    pSkt->txChkSum = 0;
+#endif  // (_UDP_TX_CHKSUM_CACHE)
 }
 
 static void _UDPv6TxMacAckFnc (TCPIP_MAC_PACKET* pPkt, const void * param)
@@ -2305,10 +2355,44 @@ static void _UDPClose(UDP_SOCKET_DCPT* pSkt)
     {   // acknowledge the old one
         _UDP_RxPktAcknowledge(pSkt->pCurrRxPkt, TCPIP_MAC_PKT_ACK_PROTO_DEST_CLOSE);
     }
+    _UDPPortHashRemove(pSkt);
     UDPSocketDcpt[pSkt->sktIx] = 0;
     TCPIP_HEAP_Free(udpMemH, pSkt);
 }
 
+// adds a socket to the local port hash
+// the bucket chain is kept sorted by the socket index
+// so that the lookup preserves the socket priority
+static void _UDPPortHashAdd(UDP_SOCKET_DCPT* pSkt)
+{
+    int16_t *pPrev;
+
+    OSAL_CRITSECT_DATA_TYPE status = OSAL_CRIT_Enter(OSAL_CRIT_TYPE_LOW);
+    for(pPrev = udpPortHash + (pSkt->localPort % _UDP_PORT_HASH_BUCKETS); *pPrev >= 0 && *pPrev < pSkt->sktIx; pPrev = udpPortHashNext + *pPrev);
+    udpPortHashNext[pSkt->sktIx] = *pPrev;
+    *pPrev = pSkt->sktIx;
+    OSAL_CRIT_Leave(OSAL_CRIT_TYPE_LOW, status);
+}
+
+// removes a socket from the local port hash
+// the socket next link is left in place,
+// so that a lookup that's currently on this socket can continue
+static void _UDPPortHashRemove(UDP_SOCKET_DCPT* pSkt)
+{
+    int16_t *pPrev;
+
+    OSAL_CRITSECT_DATA_TYPE status = OSAL_CRIT_Enter(OSAL_CRIT_TYPE_LOW);
+    for(pPrev = udpPortHash + (pSkt->localPort % _UDP_PORT_HASH_BUCKETS); *pPrev >= 0; pPrev = udpPortHashNext + *pPrev)
+    {
+        if(*pPrev == pSkt->sktIx)
+        {
+            *pPrev = udpPortHashNext[pSkt->sktIx];
+            break;
+        }
+    }
+    OSAL_CRIT_Leave(OSAL_CRIT_TYPE_LOW, status);
+}
+
 static void _UDPFreeTxResources(UDP_SOCKET_DCPT* pSkt)
 {
     void* pCurrPkt = 0;
@@ -2464,6 +2548,9 @@ bool TCPIP_UDP_TxOffsetSet(UDP_SOCKET s, uint16_t wOffset, bool relative)
         if(pSkt->txStart <= pNewWrite && pNewWrite <= pSkt->txEnd)
         {
             pSkt->txWrite = pNewWrite;
+#if (_UDP_TX_CHKSUM_CACHE)
+            pSkt->txChkWrite = 0;   // the data is no longer written sequentially
+#endif  // (_UDP_TX_CHKSUM_CACHE)
             return true;
         }        
     }
@@ -2477,6 +2564,9 @@ uint8_t* TCPIP_UDP_TxPointerGet(UDP_SOCKET s)
 
     if(pSkt && _UDPTxPktValid(pSkt))
     {
+#if (_UDP_TX_CHKSUM_CACHE)
+        pSkt->txChkWrite = 0;   // the user writes the buffer directly
+#endif  // (_UDP_TX_CHKSUM_CACHE)
         return pSkt->txWrite;
     }
 
@@ -2553,7 +2643,24 @@ uint16_t TCPIP_UDP_ArrayPut(UDP_SOCKET s, const uint8_t *cData, uint16_t wDataLe
 
             if(wDataLen)
             {
+#if (_UDP_TX_CHKSUM_CACHE)
+                if(pSkt->txChkWrite == pSkt->txWrite)
+                {   // sum the data while copying it
+                    uint16_t segChkSum = ~TCPIP_Helper_MemcpyChecksum(pSkt->txWrite, cData, wDataLen, 0);
+                    if(((pSkt->txWrite - pSkt->txStart) & 0x1) != 0)
+                    {
+                        segChkSum = TCPIP_Helper_htons(segChkSum);
+                    }
+                    pSkt->txChkSum += segChkSum;
+                    pSkt->txChkWrite += wDataLen;
+                }
+                else
+                {
+                    TCPIP_Helper_Memcpy(pSkt->txWrite, cData, wDataLen);
+                }
+#else
                 TCPIP_Helper_Memcpy(pSkt->txWrite, cData, wDataLen);
+#endif  // (_UDP_TX_CHKSUM_CACHE)
                 pSkt->txWrite += wDataLen;
             }
 
@@ -2740,6 +2847,78 @@ uint16_t TCPIP_UDP_ArrayGet(UDP_SOCKET s, uint8_t *cData, uint16_t reqBytes)
     return avlblBytes;
 }
 
+int TCPIP_UDP_RxSegmentsGet(UDP_SOCKET s, UDP_RX_SEGMENT* pSegs, int nSegs)
+{
+    TCPIP_MAC_DATA_SEGMENT *pSeg;
+    const uint8_t* pData;
+    uint16_t    segLen, totLen;
+    int         nLent;
+#if (_TCPIP_IPV4_FRAGMENTATION != 0)
+    TCPIP_MAC_PACKET* pFrag;
+#endif  // (_TCPIP_IPV4_FRAGMENTATION != 0)
+
+    UDP_SOCKET_DCPT* pSkt = _UDPSocketDcpt(s);
+
+    if(pSegs == 0 || nSegs <= 0 || pSkt == 0)
+    {
+        return 0;
+    }
+    
+    if(pSkt->pCurrRxSeg == 0 && pSkt->flags.rxAutoAdvance != 0)
+    {   // no more data in this packet 
+        _UDPUpdatePacketLock(pSkt);
+    }
+
+    // walk the packet segments without changing the socket read position
+    pSeg = pSkt->pCurrRxSeg;
+    pData = pSkt->rxCurr;
+    segLen = pSkt->rxSegLen;
+    totLen = pSkt->rxTotLen;
+#if (_TCPIP_IPV4_FRAGMENTATION != 0)
+    pFrag = pSkt->pCurrFrag;
+#endif  // (_TCPIP_IPV4_FRAGMENTATION != 0)
+
+    nLent = 0;
+    while(pSeg != 0 && totLen != 0 && nLent < nSegs)
+    {
+        if(segLen > totLen)
+        {
+            segLen = totLen;
+        }
+
+        if(segLen)
+        {
+            pSegs->pData = pData;
+            pSegs->dataLen = segLen;
+            pSegs++;
+            nLent++;
+            totLen -= segLen;
+        }
+
+        // go to the next segment in the packet
+        if((pSeg = pSeg->next) != 0)
+        {
+            segLen = pSeg->segLen;
+            pData = pSeg->segLoad;
+        }
+#if (_TCPIP_IPV4_FRAGMENTATION != 0)
+        else if((pFrag = pFrag->pkt_next) != 0)
+        {   // there is another fragment
+            pSeg = pFrag->pDSeg;
+            segLen = pFrag->totTransportLen;
+            pData = pFrag->pTransportLayer;
+        } 
+#endif  // (_TCPIP_IPV4_FRAGMENTATION != 0)
+    }
+
+    return nLent;
+}
+
+uint16_t TCPIP_UDP_RxRelease(UDP_SOCKET s, uint16_t nBytes)
+{
+    return TCPIP_UDP_ArrayGet(s, 0, nBytes);
+}
+
 uint16_t TCPIP_UDP_Discard(UDP_SOCKET s)
 {
     uint16_t nBytes = 0;
@@ -2782,7 +2961,7 @@ uint16_t TCPIP_UDP_Discard(UDP_SOCKET s)
   ***************************************************************************/
 static UDP_SOCKET_DCPT* _UDPFindMatchingSocket(TCPIP_MAC_PACKET* pRxPkt, UDP_HEADER *h, IP_ADDRESS_TYPE addressType)
 {
-    int sktIx;
+    int sktIx, nextIx;
     UDP_SOCKET_DCPT *pSkt;
     TCPIP_NET_IF* pPktIf;
     TCPIP_UDP_PKT_MATCH exactMatch, looseMatch;
@@ -2811,11 +2990,20 @@ static UDP_SOCKET_DCPT* _UDPFindMatchingSocket(TCPIP_MAC_PACKET* pRxPkt, UDP_HEA
     // 5. packet source address matches the socket expected source address or looseRemAddress flag is set
     
 
+    // Only the sockets in the local port hash bucket are checked.
+    // The chain is in ascending socket index order; the index check guards
+    // against a chain being changed while it's being traversed.
+
     pPktIf = (TCPIP_NET_IF*)pRxPkt->pktIf;
-    for(sktIx = 0; sktIx < nUdpSockets; sktIx++)
+    critStatus = OSAL_CRIT_Enter(OSAL_CRIT_TYPE_LOW);
+    sktIx = udpPortHash[h->DestinationPort % _UDP_PORT_HASH_BUCKETS];
+    OSAL_CRIT_Leave(OSAL_CRIT_TYPE_LOW, critStatus);
+
+    for(; sktIx >= 0; sktIx = (nextIx > sktIx) ? nextIx : -1)
     {
         bool processSkt = false;
         critStatus = OSAL_CRIT_Enter(OSAL_CRIT_TYPE_LOW);
+        nextIx = udpPortHashNext[sktIx];
         while(true)
         {
             pSkt = UDPSocketDcpt[sktIx];
@@ -3144,7 +3332,12 @@ bool TCPIP_UDP_Bind(UDP_SOCKET s, IP_ADDRESS_TYPE addType, UDP_PORT localPort,
     }
     if(bindSuccess)
     {
-        pSkt->localPort = localPort;
+        if(localPort != pSkt->localPort)
+        {   // move to the new hash bucket
+            _UDPPortHashRemove(pSkt);
+            pSkt->localPort = localPort;
+            _UDPPortHashAdd(pSkt);
+        }
     }
     else
     {   // restore old add type
@@ -3649,18 +3842,22 @@ static bool _UDPIsAvailablePort(UDP_PORT port)
 {
     int skt;
     UDP_SOCKET_DCPT *pSkt;
+    bool isAvailable = true;
 
-    // Find an available socket that matches the specified socket type
-    for(skt = 0; skt < nUdpSockets; skt++)
+    // check the sockets in this port hash bucket
+    OSAL_CRITSECT_DATA_TYPE status = OSAL_CRIT_Enter(OSAL_CRIT_TYPE_LOW);
+    for(skt = udpPortHash[port % _UDP_PORT_HASH_BUCKETS]; skt >= 0; skt = udpPortHashNext[skt])
     {
         pSkt = UDPSocketDcpt[skt]; 
         if(pSkt && pSkt->localPort == port)
         {
-            return false;
+            isAvailable = false;
+            break;
         }
     }
+    OSAL_CRIT_Leave(OSAL_CRIT_TYPE_LOW, status);
 
-    return true;
+    return isAvailable;
 }
 
 TCPIP_UDP_SIGNAL_HANDLE TCPIP_UDP_SignalHandlerRegister(UDP_SOCKET s, TCPIP_UDP_SIGNAL_TYPE sigMask, TCPIP_UDP_SIGNAL_FUNCTION handler, const void* hParam)
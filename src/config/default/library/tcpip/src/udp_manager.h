@@ -91,6 +91,12 @@ bool TCPIP_UDP_SetSplitPayload(UDP_SOCKET s, void* pLoad, uint16_t loadSize);
 // where is needed before and after this call
 uint8_t*    TCPIP_UDP_TxPointerGet(UDP_SOCKET s);
 
+#if (_TCPIP_STACK_RX_RUN_TO_COMPLETION != 0)
+// processes a RX packet inline, without going through the module RX queue
+// called by the IPv4 in run-to-completion mode
+void TCPIP_UDP_RxInline(TCPIP_MAC_PACKET* pRxPkt);
+#endif  // (_TCPIP_STACK_RX_RUN_TO_COMPLETION != 0)
+
 
 #endif // __UDP__MANAGER_H_
 
@@ -88,6 +88,20 @@ typedef struct
 // default TTL for multicast traffic
 #define UDP_MULTICAST_DEFAULT_TTL       1
 
+// number of buckets in the socket local port hash
+#if defined(TCPIP_UDP_PORT_HASH_BUCKETS) && (TCPIP_UDP_PORT_HASH_BUCKETS != 0)
+#define _UDP_PORT_HASH_BUCKETS          TCPIP_UDP_PORT_HASH_BUCKETS
+#else
+#define _UDP_PORT_HASH_BUCKETS          16      // default value
+#endif
+
+// the IPv4 payload checksum is calculated while TCPIP_UDP_ArrayPut copies the data
+#if defined(TCPIP_UDP_TX_CHECKSUM_CACHE)
+#define _UDP_TX_CHKSUM_CACHE            (TCPIP_UDP_TX_CHECKSUM_CACHE != 0)
+#else
+#define _UDP_TX_CHKSUM_CACHE            1       // default value: enabled
+#endif
+
 // incoming packet match flags
 typedef enum
 {
@@ -171,6 +185,10 @@ typedef struct
             // or neither (ADDR_ANY, IPv4/IPv6 not decided yet!)
     };
     uint16_t        txSize;         // size of the txBuffer
+#if (_UDP_TX_CHKSUM_CACHE)
+    uint8_t*        txChkWrite;     // txWrite position up to which txChkSum is valid; 0 if not valid
+    uint32_t        txChkSum;       // raw checksum of the data between txStart and txChkWrite
+#endif  // (_UDP_TX_CHKSUM_CACHE)
     // socket info
     UDP_SOCKET      sktIx;
     IPV4_ADDR       destAddress;    // requested destination address
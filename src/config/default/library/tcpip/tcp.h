@@ -186,8 +186,57 @@ typedef struct
     uint16_t            rxPending;          // bytes pending in RX buffer
     uint16_t            txPending;          // bytes pending in TX buffer
     TCP_SOCKET_FLAGS    flags;              // socket flags
+    uint32_t            srtt;               // smoothed round trip time, ms
+    uint32_t            rttVar;             // round trip time variation, ms
+    uint32_t            rto;                // current retransmission timeout, ms
+    uint16_t            rttSamples;         // number of round trip time samples taken
 } TCP_SOCKET_INFO;
 
+// *****************************************************************************
+/*
+  Structure:
+    TCP_SYN_BACKLOG_STAT
+
+  Summary:
+    TCP SYN backlog statistics.
+
+  Description:
+    Counters of the half-open connections handled by the SYN backlog
+    of the listening sockets.
+*/
+typedef struct
+{
+    uint16_t            backlogSize;        // number of entries in the SYN backlog
+    uint16_t            backlogUsed;        // entries currently holding a half-open connection
+    uint32_t            synRcvd;            // SYN segments received for the listening ports
+    uint32_t            cookiesSent;        // SYN + ACK segments carrying a SYN cookie, backlog full
+    uint32_t            cookiesValid;       // connections completed with a valid SYN cookie
+    uint32_t            accepted;           // connections that completed the handshake and were given a socket
+    uint32_t            dropped;            // half-open connections dropped: reset, timed out or no room
+    uint32_t            statTime;           // time since the counters were cleared, ms
+} TCP_SYN_BACKLOG_STAT;
+
+// *****************************************************************************
+/*
+  Structure:
+    TCP_TIME_WAIT_STAT
+
+  Summary:
+    TCP compact TIME_WAIT table statistics.
+
+  Description:
+    Occupancy of the table holding the closing connections
+    that released their sockets.
+*/
+typedef struct
+{
+    uint16_t            tableSize;          // number of entries in the TIME_WAIT table
+    uint16_t            timeWait;           // entries holding a connection in TIME_WAIT
+    uint16_t            lastAck;            // entries holding a connection in LAST_ACK
+    uint32_t            released;           // sockets released to the table
+    uint32_t            evicted;            // TIME_WAIT entries discarded to make room for new ones
+} TCP_TIME_WAIT_STAT;
+
 // *****************************************************************************
 /*
   Enumeration:
@@ -250,6 +299,19 @@ typedef enum
                                     // If 0, the socket will use the default global IPv4 TTL setting.
                                     // This option allows the user to specify a different TTL value.
     TCP_OPTION_TOS,                 // Sets the Type of Service (TOS) for IPv4 packets sent by the socket
+    TCP_OPTION_CONGESTION_CONTROL,  // Enables/disables the NewReno congestion control (RFC 5681/6582) for the socket:
+                                    // slow start, congestion avoidance, fast retransmit and fast recovery.
+                                    // When disabled, the socket transmits up to the remote window.
+                                    // The default setting is given by TCPIP_TCP_CONGESTION_CONTROL.
+    TCP_OPTION_WINDOW_SCALE,        // Enables/disables the window scale option (RFC 7323) negotiation.
+                                    // Takes effect at the next connection establishment.
+                                    // The default setting is given by TCPIP_TCP_WINDOW_SCALE_ENABLE.
+    TCP_OPTION_TIMESTAMPS,          // Enables/disables the timestamps option (RFC 7323) negotiation and the PAWS check.
+                                    // Takes effect at the next connection establishment.
+                                    // The default setting is given by TCPIP_TCP_TIMESTAMPS_ENABLE.
+    TCP_OPTION_AUTO_TUNE,           // Enables/disables the auto-tuning of the socket RX and TX buffer sizes.
+                                    // Setting the buffer sizes explicitly disables the auto-tuning.
+                                    // The default setting is given by TCPIP_TCP_AUTO_TUNE.
 } TCP_SOCKET_OPTION;
 
 
@@ -753,6 +815,10 @@ bool  TCPIP_TCP_RemoteBind(TCP_SOCKET hTCP, IP_ADDRESS_TYPE addType, TCP_PORT re
                       - TCP_OPTION_DELAY_SEND_ALL_ACK   - boolean to enable/disable the DELAY Send All ACK data functionality
                       - TCP_OPTION_TX_TTL              - 8-bit value of TTL
                       - TCP_OPTION_TOS                 - 8-bit value of the TOS
+                      - TCP_OPTION_CONGESTION_CONTROL  - boolean to enable/disable the congestion control
+                      - TCP_OPTION_WINDOW_SCALE        - boolean to enable/disable the window scale option
+                      - TCP_OPTION_TIMESTAMPS          - boolean to enable/disable the timestamps option
+                      - TCP_OPTION_AUTO_TUNE           - boolean to enable/disable the buffers auto-tuning
 
   Returns:
     - true  - Indicates success
@@ -795,6 +861,10 @@ bool  TCPIP_TCP_OptionsSet(TCP_SOCKET hTCP, TCP_SOCKET_OPTION option, void* optP
                       - TCP_OPTION_DELAY_SEND_ALL_ACK   - pointer to boolean to return current DELAY Send All ACK status
                       - TCP_OPTION_TX_TTL               - pointer to an 8 bit value to receive the TTL value
                       - TCP_OPTION_TOS                  - pointer to an 8 bit value to receive the TOS
+                      - TCP_OPTION_CONGESTION_CONTROL   - pointer to boolean to return current congestion control status
+                      - TCP_OPTION_WINDOW_SCALE         - pointer to boolean to return current window scale option status
+                      - TCP_OPTION_TIMESTAMPS           - pointer to boolean to return current timestamps option status
+                      - TCP_OPTION_AUTO_TUNE            - pointer to boolean to return current buffers auto-tuning status
 
   Returns:
     - true  - Indicates success
@@ -1168,6 +1238,84 @@ uint16_t  TCPIP_TCP_PutIsReady(TCP_SOCKET hTCP);
  */
 uint16_t  TCPIP_TCP_ArrayPut(TCP_SOCKET hTCP, const uint8_t* Data, uint16_t Len);
 
+// *****************************************************************************
+/*
+  Type:
+    TCPIP_TCP_TX_REF_FUNCTION
+
+  Summary:
+    Zero-copy transmit buffer notification.
+
+  Description:
+    Prototype of the function called when the TCP socket is done
+    with a buffer queued with TCPIP_TCP_ArrayPutRef.
+
+  Parameters:
+    hTCP        - TCP socket the buffer was queued on
+    pBuff       - the user buffer
+    acked       - true if all the buffer data was acknowledged by the remote host
+                  false if the data was discarded: socket aborted, closed, etc.
+    param       - parameter specified at the TCPIP_TCP_ArrayPutRef call
+
+  Remarks:
+    Once the function is called the buffer can be reused/freed by the owner.
+
+    The handler has to be short and fast.
+    It is called from the TCP stack context.
+
+ */
+
+typedef void    (*TCPIP_TCP_TX_REF_FUNCTION)(TCP_SOCKET hTCP, const uint8_t* pBuff, bool acked, const void* param);
+
+//*****************************************************************************
+/*
+  Function:
+    bool TCPIP_TCP_ArrayPutRef(TCP_SOCKET hTCP, const uint8_t* pBuff, uint16_t len, 
+                               TCPIP_TCP_TX_REF_FUNCTION ackFnc, const void* param)
+
+  Summary:
+    Queues a user buffer for transmission without copying it.
+
+  Description:
+    The buffer is transmitted as TCP payload directly from the user memory.
+    No copy to the socket TX buffer takes place.
+    The socket keeps a reference to the buffer until all its data
+    is acknowledged by the remote host.
+
+  Precondition:
+    TCP is initialized.
+
+  Parameters:
+    hTCP    - The socket to which data is to be written.
+    pBuff   - Pointer to the data to be sent.
+              The buffer can be in RAM or flash but it has to be available
+              until the ackFnc is called.
+    len     - Number of bytes to be sent.
+    ackFnc  - function to be called when the socket is done with the buffer.
+              Could be 0 if no notification is needed.
+    param   - parameter to be passed to ackFnc
+
+  Returns:
+    - true  - the buffer was queued for transmission
+    - false - the socket is not connected, invalid parameters,
+              not enough room in the socket TX buffer, out of memory, etc.
+
+  Remarks:
+    The buffer reserves len bytes in the TX buffer of the socket,
+    so len cannot exceed TCPIP_TCP_PutIsReady().
+    Larger buffers have to be queued in multiple calls.
+
+    Data queued with TCPIP_TCP_ArrayPut and TCPIP_TCP_ArrayPutRef is sent in
+    the order the calls were made.
+
+    The socket TX buffer cannot be resized (TCPIP_TCP_FifoSizeAdjust)
+    while user buffers are queued.
+
+    The transmission takes place as described for TCPIP_TCP_ArrayPut.
+
+ */
+bool  TCPIP_TCP_ArrayPutRef(TCP_SOCKET hTCP, const uint8_t* pBuff, uint16_t len, TCPIP_TCP_TX_REF_FUNCTION ackFnc, const void* param);
+
 //*****************************************************************************
 /*
   Function:
@@ -1503,6 +1651,91 @@ uint16_t  TCPIP_TCP_FifoRxFreeGet(TCP_SOCKET hTCP);
  */
 uint16_t TCPIP_TCP_Discard(TCP_SOCKET hTCP);
 
+// *****************************************************************************
+/*
+  Type:
+    TCP_RX_SEGMENT
+
+  Summary:
+    Received data lent to the application.
+
+  Description:
+    Describes a contiguous block of received data that's still
+    in the socket RX buffer/FIFO. See TCPIP_TCP_RxSegmentsGet.
+ */
+typedef struct
+{
+    const uint8_t*      pData;      // start of the data block; read only
+    uint16_t            dataLen;    // size of the data block
+}TCP_RX_SEGMENT;
+
+//*****************************************************************************
+/*
+  Function:
+    int TCPIP_TCP_RxSegmentsGet(TCP_SOCKET hTCP, TCP_RX_SEGMENT* pSegs, int nSegs)
+
+  Summary:
+    Lends the in-order received data without copying it.
+  
+  Description:
+    This function describes the data available in the socket RX buffer/FIFO
+    as a list of data blocks pointing directly inside the socket buffer.
+    No data is copied and the data is not removed from the FIFO.
+
+  Precondition:
+    TCP is initialized.
+
+  Parameters:
+    hTCP   - The socket from which data is to be read.
+    pSegs  - array to store the data blocks
+    nSegs  - number of entries in pSegs
+
+  Returns:
+    The number of data blocks stored in pSegs: 0, 1 or 2.
+    0 if no data is available or the socket is invalid.
+
+  Remarks:
+    Because the socket RX buffer is circular, the data is described
+    by at most 2 blocks.
+
+    The data blocks are read only and remain valid until the data
+    is released with TCPIP_TCP_RxRelease/TCPIP_TCP_ArrayGet/TCPIP_TCP_Discard
+    or the socket is closed.
+    The RX buffer is not resized (TCPIP_TCP_FifoSizeAdjust, auto-tuning)
+    while the data is lent.
+
+ */
+int  TCPIP_TCP_RxSegmentsGet(TCP_SOCKET hTCP, TCP_RX_SEGMENT* pSegs, int nSegs);
+
+//*****************************************************************************
+/*
+  Function:
+    uint16_t TCPIP_TCP_RxRelease(TCP_SOCKET hTCP, uint16_t nBytes)
+
+  Summary:
+    Releases the received data lent with TCPIP_TCP_RxSegmentsGet.
+  
+  Description:
+    This function removes nBytes from the socket RX buffer/FIFO
+    once the application is done with the lent data and ends the loan.
+
+  Precondition:
+    TCP is initialized.
+
+  Parameters:
+    hTCP   - The socket to release the data for.
+    nBytes - number of bytes consumed by the application
+
+  Returns:
+    The number of bytes removed from the RX buffer.
+
+  Remarks:
+    Any data that's not released stays in the RX buffer
+    and can be lent again with TCPIP_TCP_RxSegmentsGet.
+
+ */
+uint16_t  TCPIP_TCP_RxRelease(TCP_SOCKET hTCP, uint16_t nBytes);
+
 
 // *****************************************************************************
 /*
@@ -1710,6 +1943,8 @@ uint16_t  TCPIP_TCP_ArrayFind(TCP_SOCKET hTCP, const uint8_t* cFindArray,
     TX or RX associated buffer sizes can be changed too using the socket options.
     See TCPIP_TCP_OptionsSet.
 
+    Adjusting the buffers disables the auto-tuning for the socket.
+
     The size of the buffers should NOT be decreased when the socket has pending data
     to be sent to the remote party or to be received by the socket user.
     Doing this may disrupt the communication, make the TCP algorithm fail or have an 
@@ -1892,6 +2127,57 @@ bool             TCPIP_TCP_SignalHandlerDeregister(TCP_SOCKET s, TCPIP_TCP_SIGNA
 
 int     TCPIP_TCP_SocketsNumberGet(void);
 
+// *****************************************************************************
+/* Function:
+    bool TCPIP_TCP_SynBacklogStatGet(TCP_SYN_BACKLOG_STAT* pStat, bool clear)
+
+  Summary:
+    Returns the SYN backlog statistics.
+    
+  Description:
+    This function returns the counters of the SYN backlog
+    that holds the half-open connections to the listening sockets.
+    The number of accepted connections over the statTime interval
+    gives the connection accept rate.
+
+  Precondition:
+    TCP module properly initialized
+
+  Parameters:
+    pStat   - address to store the statistics; could be 0
+    clear   - if true, the counters are cleared after they are read
+
+  Returns:
+    true    - the SYN backlog is enabled and the statistics were returned
+    false   - the TCP module was built without the SYN backlog
+ */
+
+bool    TCPIP_TCP_SynBacklogStatGet(TCP_SYN_BACKLOG_STAT* pStat, bool clear);
+
+// *****************************************************************************
+/* Function:
+    bool TCPIP_TCP_TimeWaitStatGet(TCP_TIME_WAIT_STAT* pStat)
+
+  Summary:
+    Returns the compact TIME_WAIT table statistics.
+    
+  Description:
+    This function returns the occupancy of the table that holds
+    the closing connections (TIME_WAIT and LAST_ACK) that released their sockets.
+
+  Precondition:
+    TCP module properly initialized
+
+  Parameters:
+    pStat   - address to store the statistics
+
+  Returns:
+    true    - the TIME_WAIT table is enabled and the statistics were returned
+    false   - the TCP module was built without the TIME_WAIT table
+ */
+
+bool    TCPIP_TCP_TimeWaitStatGet(TCP_TIME_WAIT_STAT* pStat);
+
 // *****************************************************************************
 /* Function:
     bool    TCPIP_TCP_IsReady(void);
@@ -134,6 +134,17 @@ typedef enum
        protection if needed */
     TCPIP_STACK_HEAP_TYPE_EXTERNAL_HEAP,              
 
+    /* internally implemented size class heap */
+    /* Small blocks are kept in segregated free lists, one list per size class */
+    /* so that the allocation and deallocation of these blocks is O(1). */
+    /* Large blocks are allocated first fit from an address ordered list */
+    /* and coalesced on a slower path, like the internal heap. */
+    /* Free small blocks are returned to the large list when */
+    /* an allocation cannot be otherwise satisfied, to limit fragmentation. */
+    /* Note: this is a private TCPIP heap */
+    /* and multi-threaded protection is provided internally. */
+    TCPIP_STACK_HEAP_TYPE_INTERNAL_HEAP_CLASS,
+
     /* number of supported heap types */
     TCPIP_STACK_HEAP_TYPES
 
@@ -464,6 +475,37 @@ typedef struct
                                             // an entry runs out of blocks and nExpBlks != 0.
 }TCPIP_STACK_HEAP_POOL_CONFIG;
 
+//*******************************************************************************
+/* Internal Size Class Heap Configuration Data
+
+  Summary:
+    Defines the data required to initialize the TCP/IP stack internal size class heap.
+
+  Description:
+    This data type defines the data required to initialize the TCP/IP stack internal size class heap.
+
+  Remarks:
+    Blocks up to classMaxSize bytes are served from the per size class free lists.
+    Larger blocks are allocated from the coalescing large block list.
+    If classMaxSize == 0, a default value is used.
+*/
+
+typedef struct
+{
+    // the TCPIP_STACK_HEAP_CONFIG members
+    TCPIP_STACK_HEAP_TYPE   heapType;       // type of this heap: TCPIP_STACK_HEAP_TYPE_INTERNAL_HEAP_CLASS
+    TCPIP_STACK_HEAP_FLAGS  heapFlags;      // heap creation flags
+                                            // TCPIP_STACK_HEAP_FLAG_ALLOC_UNCACHED will be always internally set 
+                                            //
+    TCPIP_STACK_HEAP_USAGE  heapUsage;      // currently not used                                            
+    void* (*malloc_fnc)(size_t bytes);      // malloc style function for allocating the class heap itself
+    void  (*free_fnc)(void* ptr);           // free style function for releasing the allocated class heap
+
+    // specific class heap parameters
+    size_t                  heapSize;       // size of the class heap to be created and maintained
+    uint16_t                classMaxSize;   // largest block size, in bytes, served from the size class lists
+}TCPIP_STACK_HEAP_CLASS_CONFIG;
+
 //*******************************************************************************
 /*
   Function:
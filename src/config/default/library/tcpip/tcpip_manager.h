@@ -1637,6 +1637,63 @@ bool  TCPIP_STACK_NetMACStatisticsGet(TCPIP_NET_HANDLE netH, TCPIP_MAC_RX_STATIS
 
 bool  TCPIP_STACK_NetMACRegisterStatisticsGet(TCPIP_NET_HANDLE netH, TCPIP_MAC_STATISTICS_REG_ENTRY* pRegEntries, int nEntries, int* pHwEntries);
 
+// *****************************************************************************
+/*
+  Type:
+    TCPIP_STACK_RX_BURST_STATISTICS
+
+  Summary:
+    Statistics of the RX packet bursts delivered by the stack manager.
+
+  Description:
+    The stack manager delivers the received packets of the same type
+    (ARP, IPv4, IPv6, etc.) to the corresponding module as a burst.
+    This structure describes the sizes of these bursts.
+
+  Remarks:
+    The histogram buckets hold the number of bursts of size:
+    1, 2-3, 4-7, 8-15, 16 and more packets.
+*/
+#define TCPIP_STACK_RX_BURST_HIST_SIZE      5
+
+typedef struct
+{
+    uint32_t    nBursts;                                    // number of delivered bursts
+    uint32_t    nPackets;                                   // number of packets delivered in these bursts
+    uint32_t    maxBurst;                                   // largest burst size
+    uint32_t    burstHist[TCPIP_STACK_RX_BURST_HIST_SIZE];  // burst size histogram; log2 buckets
+}TCPIP_STACK_RX_BURST_STATISTICS;
+
+//*********************************************************************
+/*
+   Function:
+    bool  TCPIP_STACK_RxBurstStatisticsGet(TCPIP_STACK_RX_BURST_STATISTICS* pStat, bool clear);
+  
+   Summary:
+    Get the stack RX burst statistics.
+
+   Description:
+    This function returns the statistics of the RX packet bursts
+    delivered by the stack manager to the protocol modules.
+  
+   Precondition:    
+    The TCP/IP stack should have been initialized by TCPIP_STACK_Initialize.
+  
+   Parameters:
+    pStat   - pointer to a structure to receive the statistics
+              Can be 0 if only clearing the statistics
+    clear   - if true, the statistics are cleared after the read
+  
+   Returns:
+    - true  - if the call succeeded
+    - false - if the stack is not initialized
+                    
+   Remarks:            
+    None
+ */
+
+bool  TCPIP_STACK_RxBurstStatisticsGet(TCPIP_STACK_RX_BURST_STATISTICS* pStat, bool clear);
+
 //*********************************************************************
 /*
    Function:        
@@ -1559,6 +1559,100 @@ uint16_t                TCPIP_UDP_Get(UDP_SOCKET hUDP, uint8_t *v);
   */
 uint16_t               TCPIP_UDP_Discard(UDP_SOCKET hUDP);
 
+// *****************************************************************************
+/*
+  Type:
+    UDP_RX_SEGMENT
+
+  Summary:
+    Received data lent to the application.
+
+  Description:
+    Describes a contiguous block of received data that's still
+    in the RX packet buffer. See TCPIP_UDP_RxSegmentsGet.
+ */
+typedef struct
+{
+    const uint8_t*      pData;      // start of the data block; read only
+    uint16_t            dataLen;    // size of the data block
+}UDP_RX_SEGMENT;
+
+// *****************************************************************************
+
+/*
+  Function:
+    int TCPIP_UDP_RxSegmentsGet(UDP_SOCKET hUDP, UDP_RX_SEGMENT* pSegs, int nSegs)
+
+  Summary:
+    Lends the received data of the current RX packet without copying it.
+    
+  Description:
+    This function describes the data available in the current RX packet,
+    starting at the current read position, as a list of data blocks
+    pointing directly inside the RX packet buffers.
+    No data is copied and the read position is not changed.
+
+  Precondition:
+    UDP socket should have been opened with TCPIP_UDP_ServerOpen/TCPIP_UDP_ClientOpen.
+    hUDP - valid socket
+
+  Parameters:
+    hUDP   - socket handle
+    pSegs  - array to store the data blocks
+    nSegs  - number of entries in pSegs
+    
+  Returns:
+    The number of data blocks stored in pSegs.
+    0 if no data is available or invalid socket.
+
+  Remarks:
+    The data blocks are read only and remain valid until the
+    data is released with TCPIP_UDP_RxRelease/TCPIP_UDP_ArrayGet,
+    the packet is discarded (TCPIP_UDP_Discard, TCPIP_UDP_GetIsReady)
+    or the socket is closed.
+
+    A packet normally has a single data block.
+    Multiple blocks are returned for packets spanning multiple
+    MAC buffers or IP fragments.
+
+    As TCPIP_UDP_ArrayGet, the call will advance to the next queued
+    RX packet if the current one is done and the UDP_OPTION_RX_AUTO_ADVANCE is set.
+
+  */
+int                 TCPIP_UDP_RxSegmentsGet(UDP_SOCKET hUDP, UDP_RX_SEGMENT* pSegs, int nSegs);
+
+// *****************************************************************************
+
+/*
+  Function:
+    uint16_t TCPIP_UDP_RxRelease(UDP_SOCKET hUDP, uint16_t nBytes)
+
+  Summary:
+    Releases the received data lent with TCPIP_UDP_RxSegmentsGet.
+    
+  Description:
+    This function advances the current read position with nBytes
+    once the application is done with the lent data.
+
+  Precondition:
+    UDP socket should have been opened with TCPIP_UDP_ServerOpen/TCPIP_UDP_ClientOpen.
+    hUDP - valid socket
+
+  Parameters:
+    hUDP   - socket handle
+    nBytes - number of bytes consumed by the application
+    
+  Returns:
+    The number of released bytes.
+
+  Remarks:
+    The same as TCPIP_UDP_ArrayGet(hUDP, 0, nBytes).
+
+    TCPIP_UDP_Discard can be used to release the whole packet.
+
+  */
+uint16_t            TCPIP_UDP_RxRelease(UDP_SOCKET hUDP, uint16_t nBytes);
+
 
 // *****************************************************************************
 